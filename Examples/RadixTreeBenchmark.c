@@ -0,0 +1,80 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <Objectively.h>
+
+/**
+ * @brief Times exact matches of `count` keys in a Dictionary and a RadixTree.
+ */
+int main(int argc, char **argv) {
+
+	const int count = argc > 1 ? atoi(argv[1]) : 100000;
+
+	MutableDictionary *dictionary = $(alloc(MutableDictionary), init);
+	MutableRadixTree *tree = $(alloc(MutableRadixTree), init);
+
+	MutableArray *keys = $(alloc(MutableArray), initWithCapacity, count);
+
+	for (int i = 0; i < count; i++) {
+		String *key = str("/users/%d/profile", i * 7919);
+
+		$(dictionary, setObjectForKey, key, key);
+		$(tree, setObjectForKey, key, key);
+		$(keys, addObject, key);
+
+		release(key);
+	}
+
+	int misses = 0;
+
+	clock_t start = clock();
+	for (int i = 0; i < count; i++) {
+		const String *key = $((Array *) keys, objectAtIndex, i);
+		misses += $((Dictionary *) dictionary, objectForKey, (ident) key) != key;
+	}
+	const double dictionaryTime = (clock() - start) / (double) CLOCKS_PER_SEC;
+
+	start = clock();
+	for (int i = 0; i < count; i++) {
+		const String *key = $((Array *) keys, objectAtIndex, i);
+		misses += $((RadixTree *) tree, objectForKey, (ident) key) != key;
+	}
+	const double radixTreeTime = (clock() - start) / (double) CLOCKS_PER_SEC;
+
+	printf("%d exact matches: Dictionary %.3fs, RadixTree %.3fs\n", count, dictionaryTime, radixTreeTime);
+
+	release(keys);
+	release(tree);
+	release(dictionary);
+
+	if (misses) {
+		fprintf(stderr, "%d lookups returned the wrong object\n", misses);
+		return 1;
+	}
+
+	return 0;
+}
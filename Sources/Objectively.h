@@ -29,26 +29,42 @@
  */
 
 #include <Objectively/Array.h>
+#include <Objectively/BitSet.h>
 #include <Objectively/Boole.h>
+#include <Objectively/Cache.h>
 #include <Objectively/Class.h>
 #include <Objectively/Condition.h>
 #include <Objectively/Config.h>
+#include <Objectively/CountedSet.h>
 #include <Objectively/Data.h>
 #include <Objectively/Date.h>
 #include <Objectively/DateFormatter.h>
+#include <Objectively/Deque.h>
 #include <Objectively/Dictionary.h>
+#include <Objectively/DoubleArray.h>
 #include <Objectively/Enum.h>
 #include <Objectively/Error.h>
+#include <Objectively/FastEnumeration.h>
+#include <Objectively/FrozenDictionary.h>
+#include <Objectively/FrozenSet.h>
 #include <Objectively/Hash.h>
 #include <Objectively/IndexPath.h>
 #include <Objectively/IndexSet.h>
+#include <Objectively/IntegerArray.h>
 #include <Objectively/JSONPath.h>
 #include <Objectively/JSONSerialization.h>
 #include <Objectively/Lock.h>
 #include <Objectively/Log.h>
 #include <Objectively/MutableArray.h>
+#include <Objectively/MutableBitSet.h>
+#include <Objectively/MutableCountedSet.h>
 #include <Objectively/MutableData.h>
+#include <Objectively/MutableDeque.h>
 #include <Objectively/MutableDictionary.h>
+#include <Objectively/MutableDoubleArray.h>
+#include <Objectively/MutableIndexSet.h>
+#include <Objectively/MutableIntegerArray.h>
+#include <Objectively/MutableRadixTree.h>
 #include <Objectively/MutableSet.h>
 #include <Objectively/MutableString.h>
 #include <Objectively/Null.h>
@@ -58,11 +74,21 @@
 #include <Objectively/Operation.h>
 #include <Objectively/OperationQueue.h>
 #include <Objectively/Once.h>
+#include <Objectively/Parallel.h>
+#include <Objectively/PersistentArray.h>
+#include <Objectively/PersistentDictionary.h>
+#include <Objectively/PersistentSet.h>
+#include <Objectively/PriorityQueue.h>
+#include <Objectively/RadixTree.h>
 #include <Objectively/Regexp.h>
 #include <Objectively/Resource.h>
+#include <Objectively/Rope.h>
+#include <Objectively/Sequence.h>
 #include <Objectively/Set.h>
 #include <Objectively/String.h>
 #include <Objectively/StringReader.h>
+#include <Objectively/StringSearcher.h>
+#include <Objectively/StringTokenizer.h>
 #include <Objectively/Thread.h>
 #include <Objectively/Types.h>
 #include <Objectively/URL.h>
@@ -29,9 +29,53 @@
 #include <Objectively/Hash.h>
 #include <Objectively/MutableArray.h>
 #include <Objectively/MutableString.h>
+#include <Objectively/Parallel.h>
 
 #define _Class _Array
 
+/**
+ * @brief Shares the elements of `array` with `self`, which must not yet have elements.
+ * @remarks The elements of subarrays are copied instead, as they do not own their buffer.
+ */
+static void share(Array *self, const Array *array) {
+
+	if (array->count && array->parent) {
+
+		self->elements = malloc(array->count * sizeof(ident));
+		assert(self->elements);
+
+		for (size_t i = 0; i < array->count; i++) {
+			self->elements[i] = retain(array->elements[i]);
+		}
+
+		self->shared = malloc(sizeof(long));
+		assert(self->shared);
+
+		*self->shared = 1;
+		self->count = array->count;
+
+	} else if (array->count) {
+		Array *source = (Array *) array;
+
+		if (source->shared == NULL) {
+			volatile long *shared = malloc(sizeof(long));
+			assert(shared);
+
+			*shared = 1;
+
+			if (__sync_val_compare_and_swap(&source->shared, NULL, shared) != NULL) {
+				free((long *) shared);
+			}
+		}
+
+		__sync_add_and_fetch(source->shared, 1);
+
+		self->shared = source->shared;
+		self->elements = source->elements;
+		self->count = source->count;
+	}
+}
+
 #pragma mark - Object
 
 /**
@@ -41,6 +85,10 @@ static Object *copy(const Object *self) {
 
 	const Array *this = (Array *) self;
 
+	if (classof(this) == _Array()) {
+		return (Object *) retain((ident) this);
+	}
+
 	return (Object *) $(alloc(Array), initWithArray, this);
 }
 
@@ -51,11 +99,17 @@ static void dealloc(Object *self) {
 
 	Array *this = (Array *) self;
 
-	for (size_t i = 0; i < this->count; i++) {
-		release(this->elements[i]);
-	}
+	if (this->parent) {
+		release(this->parent);
+	} else if (this->shared == NULL || __sync_add_and_fetch(this->shared, -1) == 0) {
+
+		for (size_t i = 0; i < this->count; i++) {
+			release(this->elements[i]);
+		}
 
-	free(this->elements);
+		free(this->elements);
+		free((long *) this->shared);
+	}
 
 	super(Object, self, dealloc);
 }
@@ -67,7 +121,7 @@ static String *description(const Object *self) {
 
 	String *components = $((Array *) self, componentsJoinedByCharacters, ", ");
 
-	String *desc = $(alloc(String), initWithFormat, "[%s]", components);
+	String *desc = $(alloc(String), initWithFormat, "[%s]", components->chars);
 
 	release(components);
 
@@ -219,6 +273,22 @@ static _Bool containsObject(const Array *self, const ident obj) {
 	return $(self, indexOfObject, obj) != -1;
 }
 
+/**
+ * @fn size_t Array::countByEnumerating(const Array *self, FastEnumerationState *state)
+ * @memberof Array
+ */
+static size_t countByEnumerating(const Array *self, FastEnumerationState *state) {
+
+	if (state->cursor[0]) {
+		return 0;
+	}
+
+	state->cursor[0] = 1;
+	state->items = self->elements;
+
+	return self->count;
+}
+
 /**
  * @fn void Array::enumerateObjects(const Array *self, ArrayEnumerator enumerator, ident data)
  * @memberof Array
@@ -303,17 +373,7 @@ static Array *initWithArray(Array *self, const Array *array) {
 
 	self = (Array *) super(Object, self, init);
 	if (self) {
-
-		self->count = array->count;
-		if (self->count) {
-
-			self->elements = calloc(self->count, sizeof(ident));
-			assert(self->elements);
-
-			for (size_t i = 0; i < self->count; i++) {
-				self->elements[i] = retain(array->elements[i]);
-			}
-		}
+		share(self, array);
 	}
 
 	return self;
@@ -393,10 +453,10 @@ static Array *mappedArray(const Array *self, Functor functor, ident data) {
  */
 static MutableArray *mutableCopy(const Array *self) {
 
-	MutableArray *copy = $(alloc(MutableArray), initWithCapacity, self->count);
+	MutableArray *copy = $(alloc(MutableArray), init);
 	assert(copy);
 
-	$(copy, addObjectsFromArray, self);
+	share((Array *) copy, self);
 	return copy;
 }
 
@@ -411,6 +471,198 @@ static ident objectAtIndex(const Array *self, size_t index) {
 	return self->elements[index];
 }
 
+/**
+ * @brief The context of parallel Array operations.
+ */
+typedef struct {
+	const Array *array;
+	ident function;
+	ident combiner;
+	ident accumulator;
+	ident data;
+	ident *results;
+} ParallelArray;
+
+/**
+ * @brief ParallelFunction for parallelFilteredArray.
+ */
+static void parallelFilteredArray_function(const Range range, size_t chunk, ident data) {
+
+	ParallelArray *parallel = (ParallelArray *) data;
+	const Predicate predicate = (Predicate) parallel->function;
+
+	ident *elements = parallel->array->elements;
+	for (size_t i = range.location; i < range.location + range.length; i++) {
+		parallel->results[i] = predicate(elements[i], parallel->data) ? elements[i] : NULL;
+	}
+}
+
+/**
+ * @fn Array *Array::parallelFilteredArray(const Array *self, Predicate predicate, ident data)
+ * @memberof Array
+ */
+static Array *parallelFilteredArray(const Array *self, Predicate predicate, ident data) {
+
+	assert(predicate);
+
+	if (ParallelChunkCount(self->count) < 2) {
+		return $(self, filteredArray, predicate, data);
+	}
+
+	ParallelArray parallel = {
+		.array = self,
+		.function = predicate,
+		.data = data,
+		.results = calloc(self->count, sizeof(ident))
+	};
+
+	assert(parallel.results);
+
+	ParallelFor(self->count, parallelFilteredArray_function, &parallel);
+
+	MutableArray *array = $$(MutableArray, array);
+	assert(array);
+
+	for (size_t i = 0; i < self->count; i++) {
+		if (parallel.results[i]) {
+			$(array, addObject, parallel.results[i]);
+		}
+	}
+
+	free(parallel.results);
+
+	return (Array *) array;
+}
+
+/**
+ * @brief ParallelFunction for parallelMappedArray.
+ */
+static void parallelMappedArray_function(const Range range, size_t chunk, ident data) {
+
+	ParallelArray *parallel = (ParallelArray *) data;
+	const Functor functor = (Functor) parallel->function;
+
+	ident *elements = parallel->array->elements;
+	for (size_t i = range.location; i < range.location + range.length; i++) {
+		parallel->results[i] = functor(elements[i], parallel->data);
+		assert(parallel->results[i]);
+	}
+}
+
+/**
+ * @fn Array *Array::parallelMappedArray(const Array *self, Functor functor, ident data)
+ * @memberof Array
+ */
+static Array *parallelMappedArray(const Array *self, Functor functor, ident data) {
+
+	assert(functor);
+
+	if (ParallelChunkCount(self->count) < 2) {
+		return $(self, mappedArray, functor, data);
+	}
+
+	MutableArray *array = $$(MutableArray, arrayWithCapacity, self->count);
+	assert(array);
+
+	ParallelArray parallel = {
+		.array = self,
+		.function = functor,
+		.data = data,
+		.results = array->array.elements
+	};
+
+	ParallelFor(self->count, parallelMappedArray_function, &parallel);
+
+	array->array.count = self->count;
+
+	return (Array *) array;
+}
+
+/**
+ * @brief ParallelFunction for parallelReduce.
+ */
+static void parallelReduce_function(const Range range, size_t chunk, ident data) {
+
+	ParallelArray *parallel = (ParallelArray *) data;
+	const Reducer reducer = (Reducer) parallel->function;
+
+	ident accumulator = parallel->accumulator;
+
+	ident *elements = parallel->array->elements;
+	for (size_t i = range.location; i < range.location + range.length; i++) {
+		accumulator = reducer(elements[i], accumulator, parallel->data);
+	}
+
+	parallel->results[chunk] = accumulator;
+}
+
+/**
+ * @fn ident Array::parallelReduce(const Array *self, Reducer reducer, Reducer combiner, ident accumulator, ident data)
+ * @memberof Array
+ */
+static ident parallelReduce(const Array *self, Reducer reducer, Reducer combiner, ident accumulator, ident data) {
+
+	assert(reducer);
+	assert(combiner);
+
+	const size_t chunks = ParallelChunkCount(self->count);
+	if (chunks < 2) {
+		return $(self, reduce, reducer, accumulator, data);
+	}
+
+	ParallelArray parallel = {
+		.array = self,
+		.function = reducer,
+		.accumulator = accumulator,
+		.data = data,
+		.results = calloc(chunks, sizeof(ident))
+	};
+
+	assert(parallel.results);
+
+	ParallelFor(self->count, parallelReduce_function, &parallel);
+
+	accumulator = parallel.results[0];
+
+	for (size_t i = 1; i < chunks; i++) {
+		accumulator = combiner(parallel.results[i], accumulator, data);
+	}
+
+	free(parallel.results);
+
+	return accumulator;
+}
+
+/**
+ * @fn Array *Array::partitionedArray(const Array *self, size_t count)
+ * @memberof Array
+ */
+static Array *partitionedArray(const Array *self, size_t count) {
+
+	assert(count);
+
+	count = min(count, self->count);
+
+	MutableArray *partitions = $(alloc(MutableArray), initWithCapacity, count);
+	assert(partitions);
+
+	size_t location = 0;
+	for (size_t i = 0; i < count; i++) {
+
+		const size_t length = self->count / count + (i < self->count % count);
+
+		Array *partition = $(self, subarrayWithRange, (Range) { .location = location, .length = length });
+
+		$(partitions, addObject, partition);
+
+		release(partition);
+
+		location += length;
+	}
+
+	return (Array *) partitions;
+}
+
 /**
  * @fn ident Array::reduce(const Array *self, Reducer reducer, ident accumulator, ident data)
  * @memberof Array
@@ -441,6 +693,37 @@ static Array *sortedArray(const Array *self, Comparator comparator) {
 	return (Array *) array;
 }
 
+/**
+ * @fn Array *Array::subarrayWithRange(const Array *self, const Range range)
+ * @memberof Array
+ */
+static Array *subarrayWithRange(const Array *self, const Range range) {
+
+	assert(range.location + range.length <= self->count);
+
+	Array *subarray = (Array *) $((Object *) alloc(Array), init);
+	assert(subarray);
+
+	if (range.length) {
+
+		if (self->parent) {
+			subarray->parent = retain(self->parent);
+			subarray->elements = self->elements + range.location;
+		} else {
+			if (classof(self) == _Array()) {
+				subarray->parent = retain((ident) self);
+			} else {
+				subarray->parent = $(alloc(Array), initWithArray, self);
+			}
+			subarray->elements = subarray->parent->elements + range.location;
+		}
+
+		subarray->count = range.length;
+	}
+
+	return subarray;
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -463,6 +746,7 @@ static void initialize(Class *clazz) {
 	array->componentsJoinedByCharacters = componentsJoinedByCharacters;
 	array->componentsJoinedByString = componentsJoinedByString;
 	array->containsObject = containsObject;
+	array->countByEnumerating = countByEnumerating;
 	array->enumerateObjects = enumerateObjects;
 	array->filteredArray = filteredArray;
 	array->findObject = findObject;
@@ -474,8 +758,13 @@ static void initialize(Class *clazz) {
 	array->mappedArray = mappedArray;
 	array->mutableCopy = mutableCopy;
 	array->objectAtIndex = objectAtIndex;
+	array->parallelFilteredArray = parallelFilteredArray;
+	array->parallelMappedArray = parallelMappedArray;
+	array->parallelReduce = parallelReduce;
+	array->partitionedArray = partitionedArray;
 	array->reduce = reduce;
 	array->sortedArray = sortedArray;
+	array->subarrayWithRange = subarrayWithRange;
 }
 
 /**
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <Objectively/FastEnumeration.h>
 #include <Objectively/Object.h>
 
 /**
@@ -74,6 +75,21 @@ struct Array {
 	 * @private
 	 */
 	ident *elements;
+
+	/**
+	 * @brief The reference count of `elements` while they are shared between Arrays, or `NULL`.
+	 * @remarks Arrays share their elements on copy. A MutableArray resolves the sharing before
+	 * its first mutation.
+	 * @private
+	 */
+	volatile long *shared;
+
+	/**
+	 * @brief The Array whose elements this Array views, or `NULL`.
+	 * @remarks Subarrays retain their parent rather than their elements, and never free them.
+	 * @private
+	 */
+	Array *parent;
 };
 
 typedef struct MutableArray MutableArray;
@@ -137,6 +153,17 @@ struct ArrayInterface {
 	 */
 	_Bool (*containsObject)(const Array *self, const ident obj);
 
+	/**
+	 * @fn size_t Array::countByEnumerating(const Array *self, FastEnumerationState *state)
+	 * @brief Fetches the next batch of elements for fast enumeration.
+	 * @param self The Array.
+	 * @param state The FastEnumerationState.
+	 * @return The number of elements available at `state->items`, or `0` when enumeration is complete.
+	 * @see foreach
+	 * @memberof Array
+	 */
+	size_t (*countByEnumerating)(const Array *self, FastEnumerationState *state);
+
 	/**
 	 * @fn void Array::enumerateObjects(const Array *self, ArrayEnumerator enumerator, ident data)
 	 * @brief Enumerate the elements of this Array with the given function.
@@ -241,6 +268,58 @@ struct ArrayInterface {
 	 */
 	ident (*objectAtIndex)(const Array *self, size_t index);
 
+	/**
+	 * @fn Array *Array::parallelFilteredArray(const Array *self, Predicate predicate, ident data)
+	 * @brief Creates a new Array with elements that pass `predicate`, evaluated in parallel.
+	 * @param self The Array.
+	 * @param predicate The predicate function, which must be safe to call from multiple threads.
+	 * @param data User data.
+	 * @return The new, filtered Array, preserving the order of this Array.
+	 * @see ParallelFor(size_t, ParallelFunction, ident)
+	 * @memberof Array
+	 */
+	Array *(*parallelFilteredArray)(const Array *self, Predicate predicate, ident data);
+
+	/**
+	 * @fn Array *Array::parallelMappedArray(const Array *self, Functor functor, ident data)
+	 * @brief Transforms the elements in this Array by `functor`, evaluated in parallel.
+	 * @param self The Array.
+	 * @param functor The Functor, which must be safe to call from multiple threads.
+	 * @param data User data.
+	 * @return An Array containing the transformed elements of this Array, in order.
+	 * @see ParallelFor(size_t, ParallelFunction, ident)
+	 * @memberof Array
+	 */
+	Array *(*parallelMappedArray)(const Array *self, Functor functor, ident data);
+
+	/**
+	 * @fn ident Array::parallelReduce(const Array *self, Reducer reducer, Reducer combiner, ident accumulator, ident data)
+	 * @brief Reduces this Array in parallel chunks, and then combines the partial results in order.
+	 * @param self The Array.
+	 * @param reducer The Reducer, which must be safe to call from multiple threads.
+	 * @param combiner The associative Reducer that folds each partial result into the accumulator.
+	 * @param accumulator The initial accumulator value for each chunk, which must be an identity.
+	 * @param data User data.
+	 * @return The reduction result.
+	 * @remarks The combiner is invoked as `combiner(partial, accumulator, data)` on the calling
+	 * thread, for each chunk after the first.
+	 * @memberof Array
+	 */
+	ident (*parallelReduce)(const Array *self, Reducer reducer, Reducer combiner, ident accumulator, ident data);
+
+	/**
+	 * @fn Array *Array::partitionedArray(const Array *self, size_t count)
+	 * @brief Partitions this Array into `count` contiguous subarrays of near equal length.
+	 * @param self The Array.
+	 * @param count The desired count of partitions.
+	 * @return An Array of up to `count` subarrays, which share the elements of this Array.
+	 * @remarks Fewer partitions are returned if this Array holds fewer than `count` elements.
+	 * This is intended for dividing work between threads without copying.
+	 * @see subarrayWithRange(const Array *, const Range)
+	 * @memberof Array
+	 */
+	Array *(*partitionedArray)(const Array *self, size_t count);
+
 	/**
 	 * @fn ident Array::reduce(const Array *self, Reducer reducer, ident accumulator, ident data)
 	 * @param self The Array.
@@ -260,6 +339,17 @@ struct ArrayInterface {
 	 * @memberof Array
 	 */
 	Array *(*sortedArray)(const Array *self, Comparator comparator);
+
+	/**
+	 * @fn Array *Array::subarrayWithRange(const Array *self, const Range range)
+	 * @param self The Array.
+	 * @param range The range of elements.
+	 * @return A view of the elements of this Array in `range`.
+	 * @remarks The subarray retains its parent rather than each element, and so is created in
+	 * constant time. Subarrays of a MutableArray view a snapshot of its elements.
+	 * @memberof Array
+	 */
+	Array *(*subarrayWithRange)(const Array *self, const Range range);
 };
 
 /**
@@ -0,0 +1,427 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/BitSet.h>
+#include <Objectively/Hash.h>
+#include <Objectively/MutableBitSet.h>
+#include <Objectively/MutableIndexSet.h>
+#include <Objectively/MutableString.h>
+
+/**
+ * @return The count of set bits in `word`.
+ */
+static inline size_t popcount(uint64_t word) {
+#if defined(__GNUC__)
+	return __builtin_popcountll(word);
+#else
+	word = word - ((word >> 1) & 0x5555555555555555ULL);
+	word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+	word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+	return (word * 0x0101010101010101ULL) >> 56;
+#endif
+}
+
+/**
+ * @return The count of trailing zero bits in `word`, which must not be zero.
+ */
+static inline size_t ctz(uint64_t word) {
+#if defined(__GNUC__)
+	return __builtin_ctzll(word);
+#else
+	size_t n = 0;
+	while ((word & 1) == 0) {
+		word >>= 1;
+		n++;
+	}
+	return n;
+#endif
+}
+
+/**
+ * @return The count of words in use, ignoring trailing zero words.
+ */
+static size_t significantWords(const BitSet *self) {
+
+	size_t count = self->numberOfWords;
+	while (count && self->words[count - 1] == 0) {
+		count--;
+	}
+
+	return count;
+}
+
+#define _Class _BitSet
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	return (Object *) $(alloc(BitSet), initWithBitSet, (BitSet *) self);
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	BitSet *this = (BitSet *) self;
+
+	free(this->words);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	const BitSet *this = (BitSet *) self;
+	MutableString *desc = mstr("[");
+
+	for (ssize_t i = $(this, nextIndex, 0); i != -1; ) {
+		$(desc, appendFormat, "%zd", i);
+
+		i = $(this, nextIndex, i + 1);
+		if (i != -1) {
+			$(desc, appendCharacters, ", ");
+		}
+	}
+
+	$(desc, appendCharacters, "]");
+	return (String *) desc;
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	const BitSet *this = (BitSet *) self;
+
+	int hash = HASH_SEED;
+
+	const size_t count = significantWords(this);
+	for (size_t i = 0; i < count; i++) {
+		hash = HashForInteger(hash, (long) (this->words[i] ^ (this->words[i] >> 32)));
+	}
+
+	return hash;
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, _BitSet())) {
+
+		const BitSet *this = (BitSet *) self;
+		const BitSet *that = (BitSet *) other;
+
+		const size_t count = significantWords(this);
+		if (count == significantWords(that)) {
+			return memcmp(this->words, that->words, count * sizeof(uint64_t)) == 0;
+		}
+	}
+
+	return false;
+}
+
+#pragma mark - BitSet
+
+/**
+ * @fn _Bool BitSet::containsIndex(const BitSet *self, size_t index)
+ * @memberof BitSet
+ */
+static _Bool containsIndex(const BitSet *self, size_t index) {
+
+	const size_t word = index / BITSET_WORD_BITS;
+	if (word < self->numberOfWords) {
+		return (self->words[word] >> (index % BITSET_WORD_BITS)) & 1;
+	}
+
+	return false;
+}
+
+/**
+ * @fn size_t BitSet::count(const BitSet *self)
+ * @memberof BitSet
+ */
+static size_t count(const BitSet *self) {
+
+	size_t count = 0;
+
+	for (size_t i = 0; i < self->numberOfWords; i++) {
+		count += popcount(self->words[i]);
+	}
+
+	return count;
+}
+
+/**
+ * @fn IndexSet *BitSet::indexSet(const BitSet *self)
+ * @memberof BitSet
+ */
+static IndexSet *indexSet(const BitSet *self) {
+
+	MutableIndexSet *indexSet = $(alloc(MutableIndexSet), init);
+
+	const size_t bits = self->numberOfWords * BITSET_WORD_BITS;
+
+	size_t i = 0;
+	while (true) {
+
+		const ssize_t location = $(self, nextIndex, i);
+		if (location == -1) {
+			break;
+		}
+
+		size_t e = location;
+		while (e < bits) {
+			const uint64_t word = ~self->words[e / BITSET_WORD_BITS] >> (e % BITSET_WORD_BITS);
+			if (word) {
+				e += ctz(word);
+				break;
+			}
+			e += BITSET_WORD_BITS - (e % BITSET_WORD_BITS);
+		}
+
+		e = min(e, bits);
+
+		$(indexSet, addIndexesInRange, (Range) { .location = location, .length = e - location });
+		i = e;
+	}
+
+	return (IndexSet *) indexSet;
+}
+
+/**
+ * @fn BitSet *BitSet::initWithBitSet(BitSet *self, const BitSet *bitSet)
+ * @memberof BitSet
+ */
+static BitSet *initWithBitSet(BitSet *self, const BitSet *bitSet) {
+
+	assert(bitSet);
+
+	self = (BitSet *) super(Object, self, init);
+	if (self) {
+
+		self->numberOfWords = significantWords(bitSet);
+		if (self->numberOfWords) {
+
+			self->words = malloc(self->numberOfWords * sizeof(uint64_t));
+			assert(self->words);
+
+			memcpy(self->words, bitSet->words, self->numberOfWords * sizeof(uint64_t));
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn BitSet *BitSet::initWithIndexSet(BitSet *self, const IndexSet *indexSet)
+ * @memberof BitSet
+ */
+static BitSet *initWithIndexSet(BitSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	self = (BitSet *) super(Object, self, init);
+	if (self) {
+
+		if (indexSet->numberOfRanges) {
+
+			const Range last = indexSet->ranges[indexSet->numberOfRanges - 1];
+			const size_t bits = last.location + last.length;
+
+			self->numberOfWords = (bits + BITSET_WORD_BITS - 1) / BITSET_WORD_BITS;
+
+			self->words = calloc(self->numberOfWords, sizeof(uint64_t));
+			assert(self->words);
+
+			for (size_t i = 0; i < indexSet->numberOfRanges; i++) {
+
+				const Range range = indexSet->ranges[i];
+				for (size_t j = range.location; j < range.location + range.length; ) {
+
+					const size_t bit = j % BITSET_WORD_BITS;
+					const size_t n = min(BITSET_WORD_BITS - bit, range.location + range.length - j);
+
+					const uint64_t mask = n == BITSET_WORD_BITS ? ~0ULL : ((1ULL << n) - 1) << bit;
+					self->words[j / BITSET_WORD_BITS] |= mask;
+
+					j += n;
+				}
+			}
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn MutableBitSet *BitSet::mutableCopy(const BitSet *self)
+ * @memberof BitSet
+ */
+static MutableBitSet *mutableCopy(const BitSet *self) {
+
+	MutableBitSet *copy = $(alloc(MutableBitSet), initWithCapacity, self->numberOfWords * BITSET_WORD_BITS);
+	assert(copy);
+
+	$(copy, orBitSet, self);
+
+	return copy;
+}
+
+/**
+ * @fn ssize_t BitSet::nextIndex(const BitSet *self, size_t index)
+ * @memberof BitSet
+ */
+static ssize_t nextIndex(const BitSet *self, size_t index) {
+
+	size_t i = index / BITSET_WORD_BITS;
+	if (i >= self->numberOfWords) {
+		return -1;
+	}
+
+	uint64_t word = self->words[i] & (~0ULL << (index % BITSET_WORD_BITS));
+
+	while (word == 0) {
+		if (++i == self->numberOfWords) {
+			return -1;
+		}
+		word = self->words[i];
+	}
+
+	return i * BITSET_WORD_BITS + ctz(word);
+}
+
+/**
+ * @fn size_t BitSet::rank(const BitSet *self, size_t index)
+ * @memberof BitSet
+ */
+static size_t rank(const BitSet *self, size_t index) {
+
+	const size_t words = min(index / BITSET_WORD_BITS, self->numberOfWords);
+
+	size_t rank = 0;
+	for (size_t i = 0; i < words; i++) {
+		rank += popcount(self->words[i]);
+	}
+
+	const size_t bit = index % BITSET_WORD_BITS;
+	if (bit && words < self->numberOfWords) {
+		rank += popcount(self->words[words] & ((1ULL << bit) - 1));
+	}
+
+	return rank;
+}
+
+/**
+ * @fn ssize_t BitSet::select(const BitSet *self, size_t rank)
+ * @memberof BitSet
+ */
+static ssize_t _select(const BitSet *self, size_t rank) {
+
+	for (size_t i = 0; i < self->numberOfWords; i++) {
+
+		uint64_t word = self->words[i];
+
+		const size_t count = popcount(word);
+		if (rank < count) {
+
+			while (rank--) {
+				word &= word - 1;
+			}
+
+			return i * BITSET_WORD_BITS + ctz(word);
+		}
+
+		rank -= count;
+	}
+
+	return -1;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->description = description;
+	object->hash = hash;
+	object->isEqual = isEqual;
+
+	BitSetInterface *bitSet = (BitSetInterface *) clazz->def->interface;
+
+	bitSet->containsIndex = containsIndex;
+	bitSet->count = count;
+	bitSet->indexSet = indexSet;
+	bitSet->initWithBitSet = initWithBitSet;
+	bitSet->initWithIndexSet = initWithIndexSet;
+	bitSet->mutableCopy = mutableCopy;
+	bitSet->nextIndex = nextIndex;
+	bitSet->rank = rank;
+	bitSet->select = _select;
+}
+
+/**
+ * @fn Class *BitSet::_BitSet(void)
+ * @memberof BitSet
+ */
+Class *_BitSet(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "BitSet";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(BitSet);
+		clazz.interfaceOffset = offsetof(BitSet, interface);
+		clazz.interfaceSize = sizeof(BitSetInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
@@ -0,0 +1,174 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/IndexSet.h>
+
+/**
+ * @file
+ * @brief Dense sets of indexes, stored one bit per index.
+ */
+
+typedef struct BitSet BitSet;
+typedef struct BitSetInterface BitSetInterface;
+
+typedef struct MutableBitSet MutableBitSet;
+
+/**
+ * @brief The number of bits per BitSet word.
+ */
+#define BITSET_WORD_BITS 64
+
+/**
+ * @brief Dense sets of indexes, stored one bit per index.
+ * @details BitSets are best suited to dense selections, such as filter masks over columnar data.
+ * For sparse or highly contiguous selections, prefer IndexSet.
+ * @extends Object
+ * @ingroup Collections
+ */
+struct BitSet {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	BitSetInterface *interface;
+
+	/**
+	 * @brief The words, least significant bit first.
+	 */
+	uint64_t *words;
+
+	/**
+	 * @brief The count of `words`.
+	 */
+	size_t numberOfWords;
+};
+
+/**
+ * @brief The BitSet interface.
+ */
+struct BitSetInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn _Bool BitSet::containsIndex(const BitSet *self, size_t index)
+	 * @param self The BitSet.
+	 * @param index The index.
+	 * @return True if this BitSet contains `index`, false otherwise.
+	 * @memberof BitSet
+	 */
+	_Bool (*containsIndex)(const BitSet *self, size_t index);
+
+	/**
+	 * @fn size_t BitSet::count(const BitSet *self)
+	 * @param self The BitSet.
+	 * @return The count of indexes in this BitSet (its population count).
+	 * @memberof BitSet
+	 */
+	size_t (*count)(const BitSet *self);
+
+	/**
+	 * @fn IndexSet *BitSet::indexSet(const BitSet *self)
+	 * @param self The BitSet.
+	 * @return An IndexSet containing the indexes of this BitSet.
+	 * @memberof BitSet
+	 */
+	IndexSet *(*indexSet)(const BitSet *self);
+
+	/**
+	 * @fn BitSet *BitSet::initWithBitSet(BitSet *self, const BitSet *bitSet)
+	 * @brief Initializes this BitSet with the indexes of `bitSet`.
+	 * @param self The BitSet.
+	 * @param bitSet A BitSet.
+	 * @return The initialized BitSet, or `NULL` on error.
+	 * @memberof BitSet
+	 */
+	BitSet *(*initWithBitSet)(BitSet *self, const BitSet *bitSet);
+
+	/**
+	 * @fn BitSet *BitSet::initWithIndexSet(BitSet *self, const IndexSet *indexSet)
+	 * @brief Initializes this BitSet with the indexes of `indexSet`.
+	 * @param self The BitSet.
+	 * @param indexSet An IndexSet.
+	 * @return The initialized BitSet, or `NULL` on error.
+	 * @memberof BitSet
+	 */
+	BitSet *(*initWithIndexSet)(BitSet *self, const IndexSet *indexSet);
+
+	/**
+	 * @fn MutableBitSet *BitSet::mutableCopy(const BitSet *self)
+	 * @param self The BitSet.
+	 * @return A MutableBitSet with the contents of this BitSet.
+	 * @memberof BitSet
+	 */
+	MutableBitSet *(*mutableCopy)(const BitSet *self);
+
+	/**
+	 * @fn ssize_t BitSet::nextIndex(const BitSet *self, size_t index)
+	 * @param self The BitSet.
+	 * @param index The index at which to begin searching.
+	 * @return The least index in this BitSet greater than or equal to `index`, or `-1`.
+	 * @remarks Iterate a BitSet with
+	 * `for (ssize_t i = $(bitSet, nextIndex, 0); i != -1; i = $(bitSet, nextIndex, i + 1))`.
+	 * @memberof BitSet
+	 */
+	ssize_t (*nextIndex)(const BitSet *self, size_t index);
+
+	/**
+	 * @fn size_t BitSet::rank(const BitSet *self, size_t index)
+	 * @param self The BitSet.
+	 * @param index The index.
+	 * @return The count of indexes in this BitSet less than `index`.
+	 * @memberof BitSet
+	 */
+	size_t (*rank)(const BitSet *self, size_t index);
+
+	/**
+	 * @fn ssize_t BitSet::select(const BitSet *self, size_t rank)
+	 * @param self The BitSet.
+	 * @param rank The zero-based rank.
+	 * @return The index in this BitSet with the given `rank`, or `-1` if `rank` is not less
+	 * than its count.
+	 * @memberof BitSet
+	 */
+	ssize_t (*select)(const BitSet *self, size_t rank);
+};
+
+/**
+ * @fn Class *BitSet::_BitSet(void)
+ * @brief The BitSet archetype.
+ * @return The BitSet Class.
+ * @memberof BitSet
+ */
+OBJECTIVELY_EXPORT Class *_BitSet(void);
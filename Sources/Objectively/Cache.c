@@ -0,0 +1,551 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/Cache.h>
+#include <Objectively/Lock.h>
+
+#define CACHE_SHARD_DEFAULT_CAPACITY 16
+#define CACHE_SINGLE_SHARD_LIMIT 256
+
+/**
+ * @brief A Cache entry, linked into both its hash bucket and its shard's recency list.
+ */
+typedef struct CacheEntry {
+	uint32_t hash;
+	ident key;
+	ident obj;
+	size_t cost;
+	struct CacheEntry *chain;
+	struct CacheEntry *newer;
+	struct CacheEntry *older;
+} CacheEntry;
+
+/**
+ * @brief A Cache shard, guarding a hash table and recency list with its own Lock.
+ */
+typedef struct {
+	Lock *lock;
+	CacheEntry **buckets;
+	size_t capacity;
+	size_t count;
+	size_t cost;
+	CacheEntry *newest;
+	CacheEntry *oldest;
+	CacheStatistics statistics;
+} CacheShard;
+
+/**
+ * @brief Finalizes `hash`, so that its high and low bits may select shards and buckets.
+ */
+static inline uint32_t mix(uint32_t hash) {
+
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6b;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35;
+	hash ^= hash >> 16;
+
+	return hash;
+}
+
+/**
+ * @return The mixed hash of `key`.
+ */
+static inline uint32_t hashForKey(const ident key) {
+	return mix((uint32_t) $((Object *) key, hash));
+}
+
+/**
+ * @return The shard for `hash`.
+ */
+static inline CacheShard *shardForHash(const Cache *self, uint32_t hash) {
+	return (CacheShard *) self->locals.shards + ((hash >> 24) & (self->locals.numberOfShards - 1));
+}
+
+/**
+ * @return The address of the link to the entry for `key` in `shard`, which is `NULL` if absent.
+ */
+static CacheEntry **linkForKey(CacheShard *shard, uint32_t hash, const ident key) {
+
+	CacheEntry **link = &shard->buckets[hash & (shard->capacity - 1)];
+
+	while (*link) {
+		if ((*link)->hash == hash && $((Object *) (*link)->key, isEqual, key)) {
+			break;
+		}
+		link = &(*link)->chain;
+	}
+
+	return link;
+}
+
+/**
+ * @brief Removes `entry` from the recency list of `shard`.
+ */
+static void unlinkEntry(CacheShard *shard, CacheEntry *entry) {
+
+	if (entry->newer) {
+		entry->newer->older = entry->older;
+	} else {
+		shard->newest = entry->older;
+	}
+
+	if (entry->older) {
+		entry->older->newer = entry->newer;
+	} else {
+		shard->oldest = entry->newer;
+	}
+
+	entry->newer = entry->older = NULL;
+}
+
+/**
+ * @brief Inserts `entry` at the head of the recency list of `shard`.
+ */
+static void pushEntry(CacheShard *shard, CacheEntry *entry) {
+
+	entry->newer = NULL;
+	entry->older = shard->newest;
+
+	if (shard->newest) {
+		shard->newest->newer = entry;
+	} else {
+		shard->oldest = entry;
+	}
+
+	shard->newest = entry;
+}
+
+/**
+ * @brief Removes the entry at `link` from `shard`.
+ * @return The removed entry.
+ */
+static CacheEntry *removeEntry(CacheShard *shard, CacheEntry **link) {
+
+	CacheEntry *entry = *link;
+	*link = entry->chain;
+
+	unlinkEntry(shard, entry);
+
+	shard->count--;
+	shard->cost -= entry->cost;
+
+	entry->chain = NULL;
+	return entry;
+}
+
+/**
+ * @brief Doubles the count of buckets of `shard`.
+ */
+static void resizeShard(CacheShard *shard) {
+
+	const size_t capacity = shard->capacity * 2;
+
+	CacheEntry **buckets = calloc(capacity, sizeof(CacheEntry *));
+	assert(buckets);
+
+	for (size_t i = 0; i < shard->capacity; i++) {
+
+		CacheEntry *entry = shard->buckets[i];
+		while (entry) {
+			CacheEntry *chain = entry->chain;
+
+			CacheEntry **bucket = &buckets[entry->hash & (capacity - 1)];
+			entry->chain = *bucket;
+			*bucket = entry;
+
+			entry = chain;
+		}
+	}
+
+	free(shard->buckets);
+
+	shard->buckets = buckets;
+	shard->capacity = capacity;
+}
+
+/**
+ * @brief Releases the pair held by each entry in the list linked by `chain`, and frees them.
+ */
+static void freeEntries(Cache *self, CacheEntry *entry, _Bool evicted) {
+
+	while (entry) {
+		CacheEntry *chain = entry->chain;
+
+		if (evicted && self->evictionFunction) {
+			self->evictionFunction(self, entry->obj, entry->key, self->data);
+		}
+
+		release(entry->key);
+		release(entry->obj);
+		free(entry);
+
+		entry = chain;
+	}
+}
+
+#define _Class _Cache
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+	return NULL;
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	Cache *this = (Cache *) self;
+
+	$(this, removeAllObjects);
+
+	CacheShard *shards = this->locals.shards;
+	for (size_t i = 0; i < this->locals.numberOfShards; i++) {
+		release(shards[i].lock);
+		free(shards[i].buckets);
+	}
+
+	free(shards);
+
+	super(Object, self, dealloc);
+}
+
+#pragma mark - Cache
+
+/**
+ * @fn size_t Cache::count(const Cache *self)
+ * @memberof Cache
+ */
+static size_t count(const Cache *self) {
+
+	size_t count = 0;
+
+	CacheShard *shards = self->locals.shards;
+	for (size_t i = 0; i < self->locals.numberOfShards; i++) {
+		synchronized(shards[i].lock, {
+			count += shards[i].count;
+		});
+	}
+
+	return count;
+}
+
+/**
+ * @fn Cache *Cache::init(Cache *self)
+ * @memberof Cache
+ */
+static Cache *init(Cache *self) {
+
+	return $(self, initWithLimits, 0, 0);
+}
+
+/**
+ * @fn Cache *Cache::initWithLimits(Cache *self, size_t countLimit, size_t costLimit)
+ * @memberof Cache
+ */
+static Cache *initWithLimits(Cache *self, size_t countLimit, size_t costLimit) {
+
+	self = (Cache *) super(Object, self, init);
+	if (self) {
+
+		self->countLimit = countLimit;
+		self->costLimit = costLimit;
+
+		if ((countLimit && countLimit < CACHE_SINGLE_SHARD_LIMIT) ||
+			(costLimit && costLimit < CACHE_SINGLE_SHARD_LIMIT)) {
+			self->locals.numberOfShards = 1;
+		} else {
+			self->locals.numberOfShards = CACHE_MAX_SHARDS;
+		}
+
+		CacheShard *shards = calloc(self->locals.numberOfShards, sizeof(CacheShard));
+		assert(shards);
+
+		for (size_t i = 0; i < self->locals.numberOfShards; i++) {
+
+			shards[i].lock = $(alloc(Lock), init);
+			assert(shards[i].lock);
+
+			shards[i].capacity = CACHE_SHARD_DEFAULT_CAPACITY;
+			shards[i].buckets = calloc(shards[i].capacity, sizeof(CacheEntry *));
+			assert(shards[i].buckets);
+		}
+
+		self->locals.shards = shards;
+	}
+
+	return self;
+}
+
+/**
+ * @fn ident Cache::objectForKey(Cache *self, const ident key)
+ * @memberof Cache
+ */
+static ident objectForKey(Cache *self, const ident key) {
+
+	const uint32_t hash = hashForKey(key);
+	CacheShard *shard = shardForHash(self, hash);
+
+	ident obj = NULL;
+
+	synchronized(shard->lock, {
+
+		CacheEntry *entry = *linkForKey(shard, hash, key);
+		if (entry) {
+			unlinkEntry(shard, entry);
+			pushEntry(shard, entry);
+
+			obj = retain(entry->obj);
+			shard->statistics.hits++;
+		} else {
+			shard->statistics.misses++;
+		}
+	});
+
+	return obj;
+}
+
+/**
+ * @fn void Cache::removeAllObjects(Cache *self)
+ * @memberof Cache
+ */
+static void removeAllObjects(Cache *self) {
+
+	CacheShard *shards = self->locals.shards;
+	for (size_t i = 0; i < self->locals.numberOfShards; i++) {
+
+		CacheEntry *removed = NULL;
+
+		synchronized(shards[i].lock, {
+
+			for (CacheEntry *entry = shards[i].newest; entry; entry = entry->older) {
+				entry->chain = removed;
+				removed = entry;
+			}
+
+			memset(shards[i].buckets, 0, shards[i].capacity * sizeof(CacheEntry *));
+
+			shards[i].newest = shards[i].oldest = NULL;
+			shards[i].count = shards[i].cost = 0;
+		});
+
+		freeEntries(self, removed, false);
+	}
+}
+
+/**
+ * @fn void Cache::removeObjectForKey(Cache *self, const ident key)
+ * @memberof Cache
+ */
+static void removeObjectForKey(Cache *self, const ident key) {
+
+	const uint32_t hash = hashForKey(key);
+	CacheShard *shard = shardForHash(self, hash);
+
+	CacheEntry *removed = NULL;
+
+	synchronized(shard->lock, {
+
+		CacheEntry **link = linkForKey(shard, hash, key);
+		if (*link) {
+			removed = removeEntry(shard, link);
+		}
+	});
+
+	freeEntries(self, removed, false);
+}
+
+/**
+ * @fn void Cache::setObjectForKey(Cache *self, const ident obj, const ident key)
+ * @memberof Cache
+ */
+static void setObjectForKey(Cache *self, const ident obj, const ident key) {
+
+	$(self, setObjectForKeyWithCost, obj, key, 0);
+}
+
+/**
+ * @fn void Cache::setObjectForKeyWithCost(Cache *self, const ident obj, const ident key, size_t cost)
+ * @memberof Cache
+ */
+static void setObjectForKeyWithCost(Cache *self, const ident obj, const ident key, size_t cost) {
+
+	assert(obj);
+
+	const uint32_t hash = hashForKey(key);
+	CacheShard *shard = shardForHash(self, hash);
+
+	const size_t n = self->locals.numberOfShards;
+
+	const size_t countLimit = (self->countLimit + n - 1) / n;
+	const size_t costLimit = (self->costLimit + n - 1) / n;
+
+	ident replaced = NULL;
+	CacheEntry *evicted = NULL;
+
+	synchronized(shard->lock, {
+
+		CacheEntry *entry = *linkForKey(shard, hash, key);
+		if (entry) {
+			replaced = entry->obj;
+			entry->obj = retain(obj);
+
+			shard->cost += cost - entry->cost;
+			entry->cost = cost;
+
+			unlinkEntry(shard, entry);
+		} else {
+			entry = calloc(1, sizeof(CacheEntry));
+			assert(entry);
+
+			entry->hash = hash;
+			entry->key = retain(key);
+			entry->obj = retain(obj);
+			entry->cost = cost;
+
+			if (shard->count == shard->capacity) {
+				resizeShard(shard);
+			}
+
+			CacheEntry **bucket = &shard->buckets[hash & (shard->capacity - 1)];
+			entry->chain = *bucket;
+			*bucket = entry;
+
+			shard->count++;
+			shard->cost += cost;
+		}
+
+		pushEntry(shard, entry);
+
+		while (shard->oldest && ((countLimit && shard->count > countLimit) || (costLimit && shard->cost > costLimit))) {
+
+			CacheEntry *oldest = shard->oldest;
+			CacheEntry **link = linkForKey(shard, oldest->hash, oldest->key);
+
+			oldest = removeEntry(shard, link);
+			oldest->chain = evicted;
+			evicted = oldest;
+
+			shard->statistics.evictions++;
+		}
+	});
+
+	release(replaced);
+
+	freeEntries(self, evicted, true);
+}
+
+/**
+ * @fn CacheStatistics Cache::statistics(const Cache *self)
+ * @memberof Cache
+ */
+static CacheStatistics statistics(const Cache *self) {
+
+	CacheStatistics statistics = { 0, 0, 0 };
+
+	CacheShard *shards = self->locals.shards;
+	for (size_t i = 0; i < self->locals.numberOfShards; i++) {
+		synchronized(shards[i].lock, {
+			statistics.hits += shards[i].statistics.hits;
+			statistics.misses += shards[i].statistics.misses;
+			statistics.evictions += shards[i].statistics.evictions;
+		});
+	}
+
+	return statistics;
+}
+
+/**
+ * @fn size_t Cache::totalCost(const Cache *self)
+ * @memberof Cache
+ */
+static size_t totalCost(const Cache *self) {
+
+	size_t cost = 0;
+
+	CacheShard *shards = self->locals.shards;
+	for (size_t i = 0; i < self->locals.numberOfShards; i++) {
+		synchronized(shards[i].lock, {
+			cost += shards[i].cost;
+		});
+	}
+
+	return cost;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+
+	CacheInterface *cache = (CacheInterface *) clazz->def->interface;
+
+	cache->count = count;
+	cache->init = init;
+	cache->initWithLimits = initWithLimits;
+	cache->objectForKey = objectForKey;
+	cache->removeAllObjects = removeAllObjects;
+	cache->removeObjectForKey = removeObjectForKey;
+	cache->setObjectForKey = setObjectForKey;
+	cache->setObjectForKeyWithCost = setObjectForKeyWithCost;
+	cache->statistics = statistics;
+	cache->totalCost = totalCost;
+}
+
+/**
+ * @fn Class *Cache::_Cache(void)
+ * @memberof Cache
+ */
+Class *_Cache(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "Cache";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(Cache);
+		clazz.interfaceOffset = offsetof(Cache, interface);
+		clazz.interfaceSize = sizeof(CacheInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
@@ -0,0 +1,240 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Object.h>
+
+/**
+ * @file
+ * @brief Thread-safe, size-bounded caches with least recently used eviction.
+ */
+
+/**
+ * @brief The maximum count of independently locked shards in a Cache.
+ */
+#define CACHE_MAX_SHARDS 16
+
+typedef struct Cache Cache;
+typedef struct CacheInterface CacheInterface;
+
+/**
+ * @brief A function type for notification of Cache evictions.
+ * @param cache The Cache.
+ * @param obj The evicted Object.
+ * @param key The key of the evicted Object.
+ * @param data User data.
+ * @remarks The function is called without any of the Cache's locks held, and may access it.
+ */
+typedef void (*CacheEvictionFunction)(Cache *cache, ident obj, ident key, ident data);
+
+/**
+ * @brief Cache access statistics.
+ */
+typedef struct {
+
+	/**
+	 * @brief The count of lookups that found an Object.
+	 */
+	size_t hits;
+
+	/**
+	 * @brief The count of lookups that found no Object.
+	 */
+	size_t misses;
+
+	/**
+	 * @brief The count of Objects evicted to satisfy the Cache's limits.
+	 */
+	size_t evictions;
+} CacheStatistics;
+
+/**
+ * @brief Thread-safe, size-bounded caches with least recently used eviction.
+ * @details Keys are distributed between shards by hash, each with its own Lock, hash table and
+ * recency list, so that concurrent access to different keys rarely contends. Limits are divided
+ * evenly between shards, so eviction is approximately least recently used across the Cache.
+ * Caches with small limits use a single shard, and are exactly least recently used.
+ * @extends Object
+ */
+struct Cache {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	CacheInterface *interface;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The shards.
+		 */
+		ident shards;
+
+		/**
+		 * @brief The count of shards, a power of two.
+		 */
+		size_t numberOfShards;
+	} locals;
+
+	/**
+	 * @brief The maximum total cost of the Objects in this Cache, or `0` for no limit.
+	 */
+	size_t costLimit;
+
+	/**
+	 * @brief The maximum count of Objects in this Cache, or `0` for no limit.
+	 */
+	size_t countLimit;
+
+	/**
+	 * @brief The user data passed to `evictionFunction`.
+	 */
+	ident data;
+
+	/**
+	 * @brief An optional function called for each Object evicted to satisfy the limits.
+	 */
+	CacheEvictionFunction evictionFunction;
+};
+
+/**
+ * @brief The Cache interface.
+ */
+struct CacheInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn size_t Cache::count(const Cache *self)
+	 * @param self The Cache.
+	 * @return The count of Objects in this Cache.
+	 * @memberof Cache
+	 */
+	size_t (*count)(const Cache *self);
+
+	/**
+	 * @fn Cache *Cache::init(Cache *self)
+	 * @brief Initializes this Cache without limits.
+	 * @param self The Cache.
+	 * @return The initialized Cache, or `NULL` on error.
+	 * @memberof Cache
+	 */
+	Cache *(*init)(Cache *self);
+
+	/**
+	 * @fn Cache *Cache::initWithLimits(Cache *self, size_t countLimit, size_t costLimit)
+	 * @brief Initializes this Cache with the specified limits.
+	 * @param self The Cache.
+	 * @param countLimit The maximum count of Objects, or `0` for no limit.
+	 * @param costLimit The maximum total cost of Objects, or `0` for no limit.
+	 * @return The initialized Cache, or `NULL` on error.
+	 * @memberof Cache
+	 */
+	Cache *(*initWithLimits)(Cache *self, size_t countLimit, size_t costLimit);
+
+	/**
+	 * @fn ident Cache::objectForKey(Cache *self, const ident key)
+	 * @brief Retrieves the Object for `key`, marking it as recently used.
+	 * @param self The Cache.
+	 * @param key The key.
+	 * @return The Object for `key`, or `NULL`. The Object is retained, and must be released by
+	 * the caller, as it may be evicted at any time by another thread.
+	 * @memberof Cache
+	 */
+	ident (*objectForKey)(Cache *self, const ident key);
+
+	/**
+	 * @fn void Cache::removeAllObjects(Cache *self)
+	 * @brief Removes all Objects from this Cache, without calling the eviction function.
+	 * @param self The Cache.
+	 * @memberof Cache
+	 */
+	void (*removeAllObjects)(Cache *self);
+
+	/**
+	 * @fn void Cache::removeObjectForKey(Cache *self, const ident key)
+	 * @brief Removes the Object for `key` from this Cache, without calling the eviction function.
+	 * @param self The Cache.
+	 * @param key The key.
+	 * @memberof Cache
+	 */
+	void (*removeObjectForKey)(Cache *self, const ident key);
+
+	/**
+	 * @fn void Cache::setObjectForKey(Cache *self, const ident obj, const ident key)
+	 * @brief Sets the Object for `key`, with a cost of `0`.
+	 * @param self The Cache.
+	 * @param obj The Object.
+	 * @param key The key.
+	 * @memberof Cache
+	 */
+	void (*setObjectForKey)(Cache *self, const ident obj, const ident key);
+
+	/**
+	 * @fn void Cache::setObjectForKeyWithCost(Cache *self, const ident obj, const ident key, size_t cost)
+	 * @brief Sets the Object for `key`, evicting the least recently used Objects as necessary.
+	 * @param self The Cache.
+	 * @param obj The Object.
+	 * @param key The key.
+	 * @param cost The cost of `obj`, in units of the cost limit (e.g. bytes).
+	 * @memberof Cache
+	 */
+	void (*setObjectForKeyWithCost)(Cache *self, const ident obj, const ident key, size_t cost);
+
+	/**
+	 * @fn CacheStatistics Cache::statistics(const Cache *self)
+	 * @param self The Cache.
+	 * @return The access statistics of this Cache.
+	 * @memberof Cache
+	 */
+	CacheStatistics (*statistics)(const Cache *self);
+
+	/**
+	 * @fn size_t Cache::totalCost(const Cache *self)
+	 * @param self The Cache.
+	 * @return The total cost of the Objects in this Cache.
+	 * @memberof Cache
+	 */
+	size_t (*totalCost)(const Cache *self);
+};
+
+/**
+ * @fn Class *Cache::_Cache(void)
+ * @brief The Cache archetype.
+ * @return The Cache Class.
+ * @memberof Cache
+ */
+OBJECTIVELY_EXPORT Class *_Cache(void);
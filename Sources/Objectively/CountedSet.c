@@ -0,0 +1,466 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/CountedSet.h>
+#include <Objectively/Hash.h>
+#include <Objectively/MutableArray.h>
+#include <Objectively/MutableCountedSet.h>
+#include <Objectively/MutableString.h>
+
+#define _Class _CountedSet
+
+/**
+ * @return The preferred entry index for `hash` in a table of `capacity` entries.
+ */
+static inline size_t bin(int hash, size_t capacity) {
+
+	uint32_t h = (uint32_t) hash;
+
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	h ^= h >> 13;
+
+	return h & (capacity - 1);
+}
+
+/**
+ * @return The index of the entry for `obj`, or `-1` if it is not present.
+ */
+static ssize_t indexOfObject(const CountedSet *self, const ident obj, int hash) {
+
+	if (self->capacity) {
+
+		const size_t mask = self->capacity - 1;
+
+		for (size_t i = bin(hash, self->capacity); self->entries[i].object; i = (i + 1) & mask) {
+
+			const CountedSetEntry *entry = &self->entries[i];
+			if (entry->hash == hash) {
+				if (entry->object == obj || $((Object *) entry->object, isEqual, obj)) {
+					return i;
+				}
+			}
+		}
+	}
+
+	return -1;
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	const CountedSet *this = (CountedSet *) self;
+
+	if (classof(this) == _CountedSet()) {
+		return (Object *) retain((ident) this);
+	}
+
+	return (Object *) $(alloc(CountedSet), initWithCountedSet, this);
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	CountedSet *this = (CountedSet *) self;
+
+	for (size_t i = 0; i < this->capacity; i++) {
+		release(this->entries[i].object);
+	}
+
+	free(this->entries);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @brief CountedSetEnumerator for description.
+ */
+static void description_enumerator(const CountedSet *set, ident obj, size_t count, ident data) {
+
+	MutableString *desc = (MutableString *) data;
+
+	String *objDesc = $((Object *) obj, description);
+
+	$(desc, appendFormat, "%s: %zu, ", objDesc->chars, count);
+
+	release(objDesc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	const CountedSet *this = (CountedSet *) self;
+
+	MutableString *desc = $(alloc(MutableString), init);
+
+	$(desc, appendCharacters, "{");
+
+	$(this, enumerateObjectsAndCounts, description_enumerator, desc);
+
+	$(desc, appendCharacters, "}");
+
+	return (String *) desc;
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	const CountedSet *this = (CountedSet *) self;
+
+	unsigned int hash = HashForInteger(HASH_SEED, this->count);
+
+	for (size_t i = 0; i < this->capacity; i++) {
+
+		const CountedSetEntry *entry = &this->entries[i];
+		if (entry->object) {
+			hash += (unsigned int) entry->hash + 31 * (unsigned int) entry->count;
+		}
+	}
+
+	return (int) hash;
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, _CountedSet())) {
+
+		const CountedSet *this = (CountedSet *) self;
+		const CountedSet *that = (CountedSet *) other;
+
+		if (this->count == that->count && this->total == that->total) {
+
+			for (size_t i = 0; i < this->capacity; i++) {
+
+				const CountedSetEntry *entry = &this->entries[i];
+				if (entry->object) {
+
+					const ssize_t index = indexOfObject(that, entry->object, entry->hash);
+					if (index == -1 || that->entries[index].count != entry->count) {
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+#pragma mark - CountedSet
+
+/**
+ * @fn Array *CountedSet::allObjects(const CountedSet *self)
+ * @memberof CountedSet
+ */
+static Array *allObjects(const CountedSet *self) {
+
+	MutableArray *objects = $(alloc(MutableArray), initWithCapacity, self->count);
+
+	for (size_t i = 0; i < self->capacity; i++) {
+		if (self->entries[i].object) {
+			$(objects, addObject, self->entries[i].object);
+		}
+	}
+
+	return (Array *) objects;
+}
+
+/**
+ * @fn _Bool CountedSet::containsObject(const CountedSet *self, const ident obj)
+ * @memberof CountedSet
+ */
+static _Bool containsObject(const CountedSet *self, const ident obj) {
+	return $(self, countForObject, obj) > 0;
+}
+
+/**
+ * @fn size_t CountedSet::countForObject(const CountedSet *self, const ident obj)
+ * @memberof CountedSet
+ */
+static size_t countForObject(const CountedSet *self, const ident obj) {
+
+	assert(obj);
+
+	const ssize_t index = indexOfObject(self, obj, $((Object *) obj, hash));
+	if (index > -1) {
+		return self->entries[index].count;
+	}
+
+	return 0;
+}
+
+/**
+ * @fn void CountedSet::enumerateObjectsAndCounts(const CountedSet *self, CountedSetEnumerator enumerator, ident data)
+ * @memberof CountedSet
+ */
+static void enumerateObjectsAndCounts(const CountedSet *self, CountedSetEnumerator enumerator, ident data) {
+
+	assert(enumerator);
+
+	for (size_t i = 0; i < self->capacity; i++) {
+
+		const CountedSetEntry *entry = &self->entries[i];
+		if (entry->object) {
+			enumerator(self, entry->object, entry->count, data);
+		}
+	}
+}
+
+/**
+ * @fn CountedSet *CountedSet::initWithArray(CountedSet *self, const Array *array)
+ * @memberof CountedSet
+ */
+static CountedSet *initWithArray(CountedSet *self, const Array *array) {
+
+	self = (CountedSet *) super(Object, self, init);
+	if (self) {
+		if (array) {
+			$$(MutableCountedSet, addObjectsFromArray, (MutableCountedSet *) self, array);
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn CountedSet *CountedSet::initWithCountedSet(CountedSet *self, const CountedSet *set)
+ * @memberof CountedSet
+ */
+static CountedSet *initWithCountedSet(CountedSet *self, const CountedSet *set) {
+
+	self = (CountedSet *) super(Object, self, init);
+	if (self) {
+		if (set && set->count) {
+
+			self->capacity = set->capacity;
+			self->count = set->count;
+			self->total = set->total;
+
+			self->entries = malloc(self->capacity * sizeof(CountedSetEntry));
+			assert(self->entries);
+
+			memcpy(self->entries, set->entries, self->capacity * sizeof(CountedSetEntry));
+
+			for (size_t i = 0; i < self->capacity; i++) {
+				if (self->entries[i].object) {
+					retain(self->entries[i].object);
+				}
+			}
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn CountedSet *CountedSet::initWithObjects(CountedSet *self, ...)
+ * @memberof CountedSet
+ */
+static CountedSet *initWithObjects(CountedSet *self, ...) {
+
+	self = (CountedSet *) super(Object, self, init);
+	if (self) {
+
+		va_list args;
+		va_start(args, self);
+
+		ident obj;
+		while ((obj = va_arg(args, ident))) {
+			$$(MutableCountedSet, addObject, (MutableCountedSet *) self, obj);
+		}
+
+		va_end(args);
+	}
+
+	return self;
+}
+
+/**
+ * @fn MutableCountedSet *CountedSet::mutableCopy(const CountedSet *self)
+ * @memberof CountedSet
+ */
+static MutableCountedSet *mutableCopy(const CountedSet *self) {
+
+	return (MutableCountedSet *) $((CountedSet *) alloc(MutableCountedSet), initWithCountedSet, self);
+}
+
+/**
+ * @brief Restores the min-heap property of `heap`, ordered by count, from `index` downward.
+ */
+static void siftDown(const CountedSetEntry **heap, size_t count, size_t index) {
+
+	while (true) {
+
+		size_t smallest = index;
+
+		const size_t left = 2 * index + 1, right = left + 1;
+
+		if (left < count && heap[left]->count < heap[smallest]->count) {
+			smallest = left;
+		}
+		if (right < count && heap[right]->count < heap[smallest]->count) {
+			smallest = right;
+		}
+
+		if (smallest == index) {
+			break;
+		}
+
+		const CountedSetEntry *entry = heap[index];
+		heap[index] = heap[smallest];
+		heap[smallest] = entry;
+
+		index = smallest;
+	}
+}
+
+/**
+ * @fn Array *CountedSet::objectsWithHighestCounts(const CountedSet *self, size_t limit)
+ * @memberof CountedSet
+ */
+static Array *objectsWithHighestCounts(const CountedSet *self, size_t limit) {
+
+	limit = min(limit, self->count);
+
+	MutableArray *objects = $(alloc(MutableArray), initWithCapacity, limit);
+
+	if (limit) {
+
+		const CountedSetEntry **heap = calloc(limit, sizeof(CountedSetEntry *));
+		assert(heap);
+
+		size_t count = 0;
+
+		for (size_t i = 0; i < self->capacity; i++) {
+
+			const CountedSetEntry *entry = &self->entries[i];
+			if (entry->object) {
+
+				if (count < limit) {
+					heap[count++] = entry;
+
+					if (count == limit) {
+						for (size_t j = limit / 2; j > 0; j--) {
+							siftDown(heap, limit, j - 1);
+						}
+					}
+				} else if (entry->count > heap[0]->count) {
+					heap[0] = entry;
+					siftDown(heap, limit, 0);
+				}
+			}
+		}
+
+		for (size_t i = limit; i > 0; i--) {
+
+			const CountedSetEntry *entry = heap[0];
+
+			heap[0] = heap[i - 1];
+			siftDown(heap, i - 1, 0);
+
+			heap[i - 1] = entry;
+		}
+
+		for (size_t i = 0; i < limit; i++) {
+			$(objects, addObject, heap[i]->object);
+		}
+
+		free(heap);
+	}
+
+	return (Array *) objects;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->description = description;
+	object->hash = hash;
+	object->isEqual = isEqual;
+
+	CountedSetInterface *countedSet = (CountedSetInterface *) clazz->def->interface;
+
+	countedSet->allObjects = allObjects;
+	countedSet->containsObject = containsObject;
+	countedSet->countForObject = countForObject;
+	countedSet->enumerateObjectsAndCounts = enumerateObjectsAndCounts;
+	countedSet->initWithArray = initWithArray;
+	countedSet->initWithCountedSet = initWithCountedSet;
+	countedSet->initWithObjects = initWithObjects;
+	countedSet->mutableCopy = mutableCopy;
+	countedSet->objectsWithHighestCounts = objectsWithHighestCounts;
+}
+
+/**
+ * @fn Class *CountedSet::_CountedSet(void)
+ * @memberof CountedSet
+ */
+Class *_CountedSet(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "CountedSet";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(CountedSet);
+		clazz.interfaceOffset = offsetof(CountedSet, interface);
+		clazz.interfaceSize = sizeof(CountedSetInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
@@ -0,0 +1,213 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+#include <Objectively/Object.h>
+
+/**
+ * @file
+ * @brief Immutable counted sets (multisets).
+ */
+
+typedef struct CountedSet CountedSet;
+typedef struct CountedSetInterface CountedSetInterface;
+
+/**
+ * @brief A function type for CountedSet enumeration (iteration).
+ * @param set The CountedSet.
+ * @param obj The Object for the current iteration.
+ * @param count The occurrence count of `obj`.
+ * @param data User data.
+ */
+typedef void (*CountedSetEnumerator)(const CountedSet *set, ident obj, size_t count, ident data);
+
+/**
+ * @brief A CountedSet entry.
+ */
+typedef struct {
+
+	/**
+	 * @brief The Object, or `NULL` if this entry is vacant.
+	 */
+	ident object;
+
+	/**
+	 * @brief The hash of `object`.
+	 */
+	int hash;
+
+	/**
+	 * @brief The occurrence count of `object`.
+	 */
+	size_t count;
+} CountedSetEntry;
+
+typedef struct MutableCountedSet MutableCountedSet;
+
+/**
+ * @brief Immutable counted sets (multisets).
+ * @details Occurrence counts are stored inline in an open-addressed hash table, so counting an
+ * Object never allocates.
+ * @extends Object
+ * @ingroup Collections
+ */
+struct CountedSet {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	CountedSetInterface *interface;
+
+	/**
+	 * @brief The internal size (number of entries), always a power of two.
+	 * @private
+	 */
+	size_t capacity;
+
+	/**
+	 * @brief The count of distinct Objects.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The entries.
+	 * @private
+	 */
+	CountedSetEntry *entries;
+
+	/**
+	 * @brief The sum of all occurrence counts.
+	 */
+	size_t total;
+};
+
+/**
+ * @brief The CountedSet interface.
+ */
+struct CountedSetInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn Array *CountedSet::allObjects(const CountedSet *self)
+	 * @param self The CountedSet.
+	 * @return An Array containing the distinct Objects in this CountedSet.
+	 * @memberof CountedSet
+	 */
+	Array *(*allObjects)(const CountedSet *self);
+
+	/**
+	 * @fn _Bool CountedSet::containsObject(const CountedSet *self, const ident obj)
+	 * @param self The CountedSet.
+	 * @param obj An Object.
+	 * @return `true` if this CountedSet contains the given Object, `false` otherwise.
+	 * @memberof CountedSet
+	 */
+	_Bool (*containsObject)(const CountedSet *self, const ident obj);
+
+	/**
+	 * @fn size_t CountedSet::countForObject(const CountedSet *self, const ident obj)
+	 * @param self The CountedSet.
+	 * @param obj An Object.
+	 * @return The occurrence count of `obj`, or `0` if it is not present.
+	 * @memberof CountedSet
+	 */
+	size_t (*countForObject)(const CountedSet *self, const ident obj);
+
+	/**
+	 * @fn void CountedSet::enumerateObjectsAndCounts(const CountedSet *self, CountedSetEnumerator enumerator, ident data)
+	 * @brief Enumerate the Objects and counts of this CountedSet with the given function.
+	 * @param self The CountedSet.
+	 * @param enumerator The enumerator function.
+	 * @param data User data.
+	 * @memberof CountedSet
+	 */
+	void (*enumerateObjectsAndCounts)(const CountedSet *self, CountedSetEnumerator enumerator, ident data);
+
+	/**
+	 * @fn CountedSet *CountedSet::initWithArray(CountedSet *self, const Array *array)
+	 * @brief Initializes this CountedSet, counting the elements of `array`.
+	 * @param self The CountedSet.
+	 * @param array An Array.
+	 * @return The initialized CountedSet, or `NULL` on error.
+	 * @memberof CountedSet
+	 */
+	CountedSet *(*initWithArray)(CountedSet *self, const Array *array);
+
+	/**
+	 * @fn CountedSet *CountedSet::initWithCountedSet(CountedSet *self, const CountedSet *set)
+	 * @brief Initializes this CountedSet with the Objects and counts of `set`.
+	 * @param self The CountedSet.
+	 * @param set A CountedSet.
+	 * @return The initialized CountedSet, or `NULL` on error.
+	 * @memberof CountedSet
+	 */
+	CountedSet *(*initWithCountedSet)(CountedSet *self, const CountedSet *set);
+
+	/**
+	 * @fn CountedSet *CountedSet::initWithObjects(CountedSet *self, ...)
+	 * @brief Initializes this CountedSet, counting the specified `NULL`-terminated Objects.
+	 * @param self The CountedSet.
+	 * @return The initialized CountedSet, or `NULL` on error.
+	 * @memberof CountedSet
+	 */
+	CountedSet *(*initWithObjects)(CountedSet *self, ...);
+
+	/**
+	 * @fn MutableCountedSet *CountedSet::mutableCopy(const CountedSet *self)
+	 * @param self The CountedSet.
+	 * @return A MutableCountedSet with the contents of this CountedSet.
+	 * @memberof CountedSet
+	 */
+	MutableCountedSet *(*mutableCopy)(const CountedSet *self);
+
+	/**
+	 * @fn Array *CountedSet::objectsWithHighestCounts(const CountedSet *self, size_t limit)
+	 * @brief Selects the most frequently occurring Objects in this CountedSet.
+	 * @param self The CountedSet.
+	 * @param limit The maximum number of Objects to return.
+	 * @return An Array of up to `limit` Objects, ordered by descending count.
+	 * @remarks This is `O(n log limit)`.
+	 * @memberof CountedSet
+	 */
+	Array *(*objectsWithHighestCounts)(const CountedSet *self, size_t limit);
+};
+
+/**
+ * @fn Class *CountedSet::_CountedSet(void)
+ * @brief The CountedSet archetype.
+ * @return The CountedSet Class.
+ * @memberof CountedSet
+ */
+OBJECTIVELY_EXPORT Class *_CountedSet(void);
@@ -43,6 +43,10 @@ static Object *copy(const Object *self) {
 
 	Data *this = (Data *) self;
 
+	if (classof(this) == _Data()) {
+		return (Object *) retain((ident) this);
+	}
+
 	return (Object *) $(alloc(Data), initWithBytes, this->bytes, this->length);
 }
 
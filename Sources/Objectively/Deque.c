@@ -0,0 +1,374 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdlib.h>
+
+#include <Objectively/Deque.h>
+#include <Objectively/Hash.h>
+#include <Objectively/MutableArray.h>
+#include <Objectively/MutableDeque.h>
+
+/**
+ * @return The smallest power of two greater than or equal to `count`, or `0` if `count` is `0`.
+ */
+static size_t capacityForCount(size_t count) {
+
+	size_t capacity = count ? 1 : 0;
+	while (capacity < count) {
+		capacity <<= 1;
+	}
+
+	return capacity;
+}
+
+/**
+ * @return The Object at the specified logical index of the given Deque.
+ */
+static inline ident slot(const Deque *deque, size_t index) {
+	return deque->elements[(deque->head + index) & (deque->capacity - 1)];
+}
+
+#define _Class _Deque
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	const Deque *this = (Deque *) self;
+
+	Deque *that = (Deque *) super(Object, alloc(Deque), init);
+	if (that) {
+
+		that->capacity = capacityForCount(this->count);
+		if (that->capacity) {
+
+			that->elements = calloc(that->capacity, sizeof(ident));
+			assert(that->elements);
+
+			for (size_t i = 0; i < this->count; i++) {
+				that->elements[i] = retain(slot(this, i));
+			}
+
+			that->count = this->count;
+		}
+	}
+
+	return (Object *) that;
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	Deque *this = (Deque *) self;
+
+	for (size_t i = 0; i < this->count; i++) {
+		release(slot(this, i));
+	}
+
+	free(this->elements);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	Array *array = $((Deque *) self, allObjects);
+
+	String *desc = $((Object *) array, description);
+
+	release(array);
+
+	return desc;
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	const Deque *this = (Deque *) self;
+
+	int hash = HashForInteger(HASH_SEED, this->count);
+
+	for (size_t i = 0; i < this->count; i++) {
+		hash = HashForObject(hash, slot(this, i));
+	}
+
+	return hash;
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, _Deque())) {
+
+		const Deque *this = (Deque *) self;
+		const Deque *that = (Deque *) other;
+
+		if (this->count == that->count) {
+
+			for (size_t i = 0; i < this->count; i++) {
+
+				const Object *thisObject = slot(this, i);
+				const Object *thatObject = slot(that, i);
+
+				if ($(thisObject, isEqual, thatObject) == false) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+#pragma mark - Deque
+
+/**
+ * @fn Array *Deque::allObjects(const Deque *self)
+ * @memberof Deque
+ */
+static Array *allObjects(const Deque *self) {
+
+	MutableArray *array = $$(MutableArray, arrayWithCapacity, self->count);
+
+	for (size_t i = 0; i < self->count; i++) {
+		$(array, addObject, slot(self, i));
+	}
+
+	return (Array *) array;
+}
+
+/**
+ * @fn _Bool Deque::containsObject(const Deque *self, const ident obj)
+ * @memberof Deque
+ */
+static _Bool containsObject(const Deque *self, const ident obj) {
+
+	for (size_t i = 0; i < self->count; i++) {
+		if ($((Object *) slot(self, i), isEqual, obj)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @fn size_t Deque::countByEnumerating(const Deque *self, FastEnumerationState *state)
+ * @memberof Deque
+ */
+static size_t countByEnumerating(const Deque *self, FastEnumerationState *state) {
+
+	const size_t first = min(self->count, self->capacity - self->head);
+
+	switch (state->cursor[0]++) {
+		case 0:
+			state->items = self->elements + self->head;
+			return first;
+		case 1:
+			state->items = self->elements;
+			return self->count - first;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * @fn ident Deque::firstObject(const Deque *self)
+ * @memberof Deque
+ */
+static ident firstObject(const Deque *self) {
+	return self->count ? slot(self, 0) : NULL;
+}
+
+/**
+ * @fn Deque *Deque::initWithArray(Deque *self, const Array *array)
+ * @memberof Deque
+ */
+static Deque *initWithArray(Deque *self, const Array *array) {
+
+	assert(array);
+
+	self = (Deque *) super(Object, self, init);
+	if (self) {
+
+		self->capacity = capacityForCount(array->count);
+		if (self->capacity) {
+
+			self->elements = calloc(self->capacity, sizeof(ident));
+			assert(self->elements);
+
+			for (size_t i = 0; i < array->count; i++) {
+				self->elements[i] = retain(array->elements[i]);
+			}
+
+			self->count = array->count;
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn Deque *Deque::initWithObjects(Deque *self, ...)
+ * @memberof Deque
+ */
+static Deque *initWithObjects(Deque *self, ...) {
+
+	self = (Deque *) super(Object, self, init);
+	if (self) {
+
+		va_list args;
+		va_start(args, self);
+
+		size_t count = 0;
+		while (va_arg(args, ident)) {
+			count++;
+		}
+
+		va_end(args);
+
+		self->capacity = capacityForCount(count);
+		if (self->capacity) {
+
+			self->elements = calloc(self->capacity, sizeof(ident));
+			assert(self->elements);
+
+			va_start(args, self);
+
+			for (size_t i = 0; i < count; i++) {
+				self->elements[i] = retain(va_arg(args, ident));
+			}
+
+			va_end(args);
+
+			self->count = count;
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn ident Deque::lastObject(const Deque *self)
+ * @memberof Deque
+ */
+static ident lastObject(const Deque *self) {
+	return self->count ? slot(self, self->count - 1) : NULL;
+}
+
+/**
+ * @fn MutableDeque *Deque::mutableCopy(const Deque *self)
+ * @memberof Deque
+ */
+static MutableDeque *mutableCopy(const Deque *self) {
+
+	MutableDeque *copy = $(alloc(MutableDeque), initWithCapacity, self->count);
+	assert(copy);
+
+	for (size_t i = 0; i < self->count; i++) {
+		$(copy, pushBack, slot(self, i));
+	}
+
+	return copy;
+}
+
+/**
+ * @fn ident Deque::objectAtIndex(const Deque *self, size_t index)
+ * @memberof Deque
+ */
+static ident objectAtIndex(const Deque *self, size_t index) {
+
+	assert(index < self->count);
+
+	return slot(self, index);
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->description = description;
+	object->hash = hash;
+	object->isEqual = isEqual;
+
+	DequeInterface *deque = (DequeInterface *) clazz->def->interface;
+
+	deque->allObjects = allObjects;
+	deque->containsObject = containsObject;
+	deque->countByEnumerating = countByEnumerating;
+	deque->firstObject = firstObject;
+	deque->initWithArray = initWithArray;
+	deque->initWithObjects = initWithObjects;
+	deque->lastObject = lastObject;
+	deque->mutableCopy = mutableCopy;
+	deque->objectAtIndex = objectAtIndex;
+}
+
+/**
+ * @fn Class *Deque::_Deque(void)
+ * @memberof Deque
+ */
+Class *_Deque(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "Deque";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(Deque);
+		clazz.interfaceOffset = offsetof(Deque, interface);
+		clazz.interfaceSize = sizeof(DequeInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
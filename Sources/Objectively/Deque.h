@@ -0,0 +1,181 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+
+/**
+ * @file
+ * @brief Immutable double-ended queues.
+ */
+
+typedef struct Deque Deque;
+typedef struct DequeInterface DequeInterface;
+
+typedef struct MutableDeque MutableDeque;
+
+/**
+ * @brief Immutable double-ended queues.
+ * @details Deques are backed by a power-of-two ring buffer, so that elements may be added and
+ * removed at either end in constant time (see MutableDeque), while remaining indexable.
+ * @extends Object
+ * @ingroup Collections
+ */
+struct Deque {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	DequeInterface *interface;
+
+	/**
+	 * @brief The count of elements.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The ring buffer capacity, which is always zero or a power of two.
+	 * @private
+	 */
+	size_t capacity;
+
+	/**
+	 * @brief The index of the first element within `elements`.
+	 * @private
+	 */
+	size_t head;
+
+	/**
+	 * @brief The ring buffer.
+	 * @private
+	 */
+	ident *elements;
+};
+
+/**
+ * @brief The Deque interface.
+ */
+struct DequeInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn Array *Deque::allObjects(const Deque *self)
+	 * @param self The Deque.
+	 * @return An Array containing all Objects in this Deque, from first to last.
+	 * @memberof Deque
+	 */
+	Array *(*allObjects)(const Deque *self);
+
+	/**
+	 * @fn _Bool Deque::containsObject(const Deque *self, const ident obj)
+	 * @param self The Deque.
+	 * @param obj An Object.
+	 * @return True if this Deque contains the given Object, false otherwise.
+	 * @memberof Deque
+	 */
+	_Bool (*containsObject)(const Deque *self, const ident obj);
+
+	/**
+	 * @fn size_t Deque::countByEnumerating(const Deque *self, FastEnumerationState *state)
+	 * @brief Fetches the next batch of elements for fast enumeration.
+	 * @param self The Deque.
+	 * @param state The FastEnumerationState.
+	 * @return The number of elements available at `state->items`, or `0` when enumeration is complete.
+	 * @remarks Elements are returned in at most two batches, one for each contiguous segment of
+	 * the ring buffer.
+	 * @see foreach
+	 * @memberof Deque
+	 */
+	size_t (*countByEnumerating)(const Deque *self, FastEnumerationState *state);
+
+	/**
+	 * @fn ident Deque::firstObject(const Deque *self)
+	 * @param self The Deque.
+	 * @return The first Object in this Deque, or `NULL` if it is empty.
+	 * @memberof Deque
+	 */
+	ident (*firstObject)(const Deque *self);
+
+	/**
+	 * @fn Deque *Deque::initWithArray(Deque *self, const Array *array)
+	 * @brief Initializes this Deque to contain the Objects in `array`.
+	 * @param self The Deque.
+	 * @param array An Array.
+	 * @return The initialized Deque, or `NULL` on error.
+	 * @memberof Deque
+	 */
+	Deque *(*initWithArray)(Deque *self, const Array *array);
+
+	/**
+	 * @fn Deque *Deque::initWithObjects(Deque *self, ...)
+	 * @brief Initializes this Deque to contain the `NULL`-terminated list of Objects.
+	 * @param self The Deque.
+	 * @return The initialized Deque, or `NULL` on error.
+	 * @memberof Deque
+	 */
+	Deque *(*initWithObjects)(Deque *self, ...);
+
+	/**
+	 * @fn ident Deque::lastObject(const Deque *self)
+	 * @param self The Deque.
+	 * @return The last Object in this Deque, or `NULL` if it is empty.
+	 * @memberof Deque
+	 */
+	ident (*lastObject)(const Deque *self);
+
+	/**
+	 * @fn MutableDeque *Deque::mutableCopy(const Deque *self)
+	 * @param self The Deque.
+	 * @return A MutableDeque with the contents of this Deque.
+	 * @memberof Deque
+	 */
+	MutableDeque *(*mutableCopy)(const Deque *self);
+
+	/**
+	 * @fn ident Deque::objectAtIndex(const Deque *self, size_t index)
+	 * @param self The Deque.
+	 * @param index The index of the desired Object, where `0` is the first Object.
+	 * @return The Object at the specified index.
+	 * @memberof Deque
+	 */
+	ident (*objectAtIndex)(const Deque *self, size_t index);
+};
+
+/**
+ * @fn Class *Deque::_Deque(void)
+ * @brief The Deque archetype.
+ * @return The Deque Class.
+ * @memberof Deque
+ */
+OBJECTIVELY_EXPORT Class *_Deque(void);
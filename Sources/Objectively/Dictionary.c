@@ -26,6 +26,8 @@
 #include <stdlib.h>
 
 #include <Objectively/Dictionary.h>
+#include <Objectively/DictionaryBin.h>
+#include <Objectively/FrozenDictionary.h>
 #include <Objectively/Hash.h>
 #include <Objectively/MutableArray.h>
 #include <Objectively/MutableDictionary.h>
@@ -42,6 +44,10 @@ static Object *copy(const Object *self) {
 
 	const Dictionary *this = (Dictionary *) self;
 
+	if (classof(this) == _Dictionary()) {
+		return (Object *) retain((ident) this);
+	}
+
 	Dictionary *that = $(alloc(Dictionary), initWithDictionary, this);
 
 	return (Object *) that;
@@ -131,21 +137,16 @@ static _Bool isEqual(const Object *self, const Object *other) {
 
 		if (this->count == that->count) {
 
-			Array *keys = $(this, allKeys);
-
-			for (size_t i = 0; i < keys->count; i++) {
-				const ident key = $(keys, objectAtIndex, i);
+			foreach(const ident key, this) {
 
 				const Object *thisObject = $(this, objectForKey, key);
 				const Object *thatObject = $(that, objectForKey, key);
 
 				if ($(thisObject, isEqual, thatObject) == false) {
-					release(keys);
 					return false;
 				}
 			}
 
-			release(keys);
 			return true;
 		}
 	}
@@ -211,6 +212,37 @@ static _Bool containsKeyPath(const Dictionary *self, const char *path) {
 	return $(self, objectForKeyPath, path) != NULL;
 }
 
+/**
+ * @fn size_t Dictionary::countByEnumerating(const Dictionary *self, FastEnumerationState *state)
+ * @memberof Dictionary
+ */
+static size_t countByEnumerating(const Dictionary *self, FastEnumerationState *state) {
+
+	size_t count = 0;
+
+	while (state->cursor[0] < self->capacity) {
+
+		const Array *array = self->elements[state->cursor[0]];
+		if (array) {
+
+			while (state->cursor[1] < array->count && count < FAST_ENUMERATION_BUFFER_SIZE) {
+				state->buffer[count++] = array->elements[state->cursor[1]];
+				state->cursor[1] += 2;
+			}
+
+			if (count == FAST_ENUMERATION_BUFFER_SIZE) {
+				break;
+			}
+		}
+
+		state->cursor[0]++;
+		state->cursor[1] = 0;
+	}
+
+	state->items = state->buffer;
+	return count;
+}
+
 /**
  * @fn Dictionary *Dictionary::dictionaryWithDictionary(const Dictionary *dictionary)
  * @memberof Dictionary
@@ -262,8 +294,8 @@ static void enumerateObjectsAndKeys(const Dictionary *self, DictionaryEnumerator
 
 			for (size_t j = 0; j < array->count; j += 2) {
 
-				ident key = $(array, objectAtIndex, j);
-				ident obj = $(array, objectAtIndex, j + 1);
+				ident key = array->elements[j];
+				ident obj = array->elements[j + 1];
 
 				enumerator(self, obj, key, data);
 			}
@@ -288,8 +320,8 @@ static Dictionary *filterObjectsAndKeys(const Dictionary *self, DictionaryPredic
 
 			for (size_t j = 0; j < array->count; j += 2) {
 
-				ident key = $(array, objectAtIndex, j);
-				ident obj = $(array, objectAtIndex, j + 1);
+				ident key = array->elements[j];
+				ident obj = array->elements[j + 1];
 
 				if (predicate(obj, key, data)) {
 					$(dictionary, setObjectForKey, obj, key);
@@ -301,6 +333,14 @@ static Dictionary *filterObjectsAndKeys(const Dictionary *self, DictionaryPredic
 	return (Dictionary *) dictionary;
 }
 
+/**
+ * @fn FrozenDictionary *Dictionary::freeze(const Dictionary *self)
+ * @memberof Dictionary
+ */
+static FrozenDictionary *freeze(const Dictionary *self) {
+	return $(alloc(FrozenDictionary), initWithDictionary, self);
+}
+
 /**
  * @fn Dictionary *Dictionary::initWithDictionary(Dictionary *self, const Dictionary *dictionary)
  * @memberof Dictionary
@@ -386,7 +426,7 @@ static ident objectForKey(const Dictionary *self, const ident key) {
 	Array *array = self->elements[bin];
 	if (array) {
 
-		const ssize_t index = $(array, indexOfObject, key);
+		const ssize_t index = indexOfKey(array, key);
 		if (index > -1) {
 			return $(array, objectAtIndex, index + 1);
 		}
@@ -433,10 +473,12 @@ static void initialize(Class *clazz) {
 	dictionary->allObjects = allObjects;
 	dictionary->containsKey = containsKey;
 	dictionary->containsKeyPath = containsKeyPath;
+	dictionary->countByEnumerating = countByEnumerating;
 	dictionary->dictionaryWithDictionary = dictionaryWithDictionary;
 	dictionary->dictionaryWithObjectsAndKeys = dictionaryWithObjectsAndKeys;
 	dictionary->enumerateObjectsAndKeys = enumerateObjectsAndKeys;
 	dictionary->filterObjectsAndKeys = filterObjectsAndKeys;
+	dictionary->freeze = freeze;
 	dictionary->initWithDictionary = initWithDictionary;
 	dictionary->initWithObjectsAndKeys = initWithObjectsAndKeys;
 	dictionary->mutableCopy = mutableCopy;
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <Objectively/Array.h>
+#include <Objectively/FastEnumeration.h>
 #include <Objectively/Object.h>
 
 /**
@@ -88,6 +89,7 @@ struct Dictionary {
 	ident *elements;
 };
 
+typedef struct FrozenDictionary FrozenDictionary;
 typedef struct MutableDictionary MutableDictionary;
 
 /**
@@ -134,6 +136,17 @@ struct DictionaryInterface {
 	 */
 	_Bool (*containsKeyPath)(const Dictionary *self, const char *path);
 
+	/**
+	 * @fn size_t Dictionary::countByEnumerating(const Dictionary *self, FastEnumerationState *state)
+	 * @brief Fetches the next batch of keys for fast enumeration.
+	 * @param self The Dictionary.
+	 * @param state The FastEnumerationState.
+	 * @return The number of keys available at `state->items`, or `0` when enumeration is complete.
+	 * @see foreach
+	 * @memberof Dictionary
+	 */
+	size_t (*countByEnumerating)(const Dictionary *self, FastEnumerationState *state);
+
 	/**
 	 * @static
 	 * @fn Dictionary *Dictionary::dictionaryWithDictionary(const Dictionary *dictionary)
@@ -176,6 +189,17 @@ struct DictionaryInterface {
 	 */
 	Dictionary *(*filterObjectsAndKeys)(const Dictionary *self, DictionaryPredicate predicate, ident data);
 
+	/**
+	 * @fn FrozenDictionary *Dictionary::freeze(const Dictionary *self)
+	 * @brief Creates a read-only FrozenDictionary with the pairs of this Dictionary.
+	 * @param self The Dictionary.
+	 * @return The FrozenDictionary.
+	 * @remarks Freezing is linear in the count of pairs. Lookups in the result hash once and
+	 * compare once, making it well suited to tables built once and consulted often.
+	 * @memberof Dictionary
+	 */
+	FrozenDictionary *(*freeze)(const Dictionary *self);
+
 	/**
 	 * @fn Dictionary *Dictionary::initWithDictionary(Dictionary *self, const Dictionary *dictionary)
 	 * @brief Initializes this Dictionary to contain elements of `dictionary`.
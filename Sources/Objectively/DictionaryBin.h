@@ -0,0 +1,47 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+
+/**
+ * @file
+ * @brief Helpers shared by Dictionary and MutableDictionary for searching their bins.
+ * @remarks This header is private to the library, and is not installed.
+ */
+
+/**
+ * @return The index of `key` within the key-value pairs of `bin`, or `-1`.
+ * @remarks Only keys are compared, so that a value equal to `key` is never mistaken for it.
+ */
+static inline ssize_t indexOfKey(const Array *bin, const ident key) {
+
+	for (size_t i = 0; i < bin->count; i += 2) {
+		if ($((Object *) key, isEqual, (Object *) bin->elements[i])) {
+			return i;
+		}
+	}
+
+	return -1;
+}
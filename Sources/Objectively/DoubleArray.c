@@ -0,0 +1,416 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/Hash.h>
+#include <Objectively/DoubleArray.h>
+#include <Objectively/MutableArray.h>
+#include <Objectively/MutableDoubleArray.h>
+#include <Objectively/MutableString.h>
+#include <Objectively/Number.h>
+#include <Objectively/RadixSort.h>
+
+#define _Class _DoubleArray
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	DoubleArray *this = (DoubleArray *) self;
+
+	if (classof(this) == _DoubleArray()) {
+		return (Object *) retain((ident) this);
+	}
+
+	return (Object *) $(alloc(DoubleArray), initWithValues, this->values, this->count);
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	DoubleArray *this = (DoubleArray *) self;
+
+	free(this->values);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	const DoubleArray *this = (DoubleArray *) self;
+
+	MutableString *desc = mstr("[");
+
+	for (size_t i = 0; i < this->count; i++) {
+		$(desc, appendFormat, "%g", this->values[i]);
+
+		if (i < this->count - 1) {
+			$(desc, appendCharacters, ", ");
+		}
+	}
+
+	$(desc, appendCharacters, "]");
+	return (String *) desc;
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	const DoubleArray *this = (DoubleArray *) self;
+
+	int hash = HASH_SEED;
+	hash = HashForInteger(hash, this->count);
+
+	const Range range = { 0, this->count * sizeof(double) };
+	hash = HashForBytes(hash, (uint8_t *) this->values, range);
+
+	return hash;
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, _DoubleArray())) {
+
+		const DoubleArray *this = (DoubleArray *) self;
+		const DoubleArray *that = (DoubleArray *) other;
+
+		if (this->count == that->count) {
+			return this->count == 0 || memcmp(this->values, that->values, this->count * sizeof(double)) == 0;
+		}
+	}
+
+	return false;
+}
+
+#pragma mark - DoubleArray
+
+/**
+ * @fn Array *DoubleArray::array(const DoubleArray *self)
+ * @memberof DoubleArray
+ */
+static Array *array(const DoubleArray *self) {
+
+	MutableArray *array = $(alloc(MutableArray), initWithCapacity, self->count);
+
+	for (size_t i = 0; i < self->count; i++) {
+
+		Number *number = $$(Number, numberWithValue, self->values[i]);
+
+		$(array, addObject, number);
+
+		release(number);
+	}
+
+	return (Array *) array;
+}
+
+/**
+ * @fn double DoubleArray::dot(const DoubleArray *self, const DoubleArray *other)
+ * @memberof DoubleArray
+ */
+static double dot(const DoubleArray *self, const DoubleArray *other) {
+
+	assert(other);
+	assert(self->count == other->count);
+
+	const double *a = self->values, *b = other->values;
+
+	double dot[4] = { 0.0, 0.0, 0.0, 0.0 };
+
+	size_t i = 0;
+	for (; i + 4 <= self->count; i += 4) {
+		dot[0] += a[i + 0] * b[i + 0];
+		dot[1] += a[i + 1] * b[i + 1];
+		dot[2] += a[i + 2] * b[i + 2];
+		dot[3] += a[i + 3] * b[i + 3];
+	}
+
+	for (; i < self->count; i++) {
+		dot[0] += a[i] * b[i];
+	}
+
+	return (dot[0] + dot[1]) + (dot[2] + dot[3]);
+}
+
+/**
+ * @fn DoubleArray *DoubleArray::initWithArray(DoubleArray *self, const Array *array)
+ * @memberof DoubleArray
+ */
+static DoubleArray *initWithArray(DoubleArray *self, const Array *array) {
+
+	assert(array);
+
+	self = (DoubleArray *) super(Object, self, init);
+	if (self) {
+
+		self->count = array->count;
+		if (self->count) {
+
+			self->values = malloc(self->count * sizeof(double));
+			assert(self->values);
+
+			for (size_t i = 0; i < self->count; i++) {
+				const Number *number = cast(Number, array->elements[i]);
+				self->values[i] = number->value;
+			}
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn DoubleArray *DoubleArray::initWithValues(DoubleArray *self, const double *values, size_t count)
+ * @memberof DoubleArray
+ */
+static DoubleArray *initWithValues(DoubleArray *self, const double *values, size_t count) {
+
+	self = (DoubleArray *) super(Object, self, init);
+	if (self) {
+
+		self->count = count;
+		if (self->count) {
+			assert(values);
+
+			self->values = malloc(self->count * sizeof(double));
+			assert(self->values);
+
+			memcpy(self->values, values, self->count * sizeof(double));
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn DoubleArray *DoubleArray::doubleArrayWithValues(const double *values, size_t count)
+ * @memberof DoubleArray
+ */
+static DoubleArray *doubleArrayWithValues(const double *values, size_t count) {
+
+	return $(alloc(DoubleArray), initWithValues, values, count);
+}
+
+/**
+ * @fn double DoubleArray::maximum(const DoubleArray *self)
+ * @memberof DoubleArray
+ */
+static double maximum(const DoubleArray *self) {
+
+	assert(self->count);
+
+	double max = self->values[0];
+
+	for (size_t i = 1; i < self->count; i++) {
+		max = self->values[i] > max ? self->values[i] : max;
+	}
+
+	return max;
+}
+
+/**
+ * @fn double DoubleArray::mean(const DoubleArray *self)
+ * @memberof DoubleArray
+ */
+static double mean(const DoubleArray *self) {
+
+	if (self->count) {
+		return $(self, sum) / self->count;
+	}
+
+	return 0.0;
+}
+
+/**
+ * @fn double DoubleArray::minimum(const DoubleArray *self)
+ * @memberof DoubleArray
+ */
+static double minimum(const DoubleArray *self) {
+
+	assert(self->count);
+
+	double min = self->values[0];
+
+	for (size_t i = 1; i < self->count; i++) {
+		min = self->values[i] < min ? self->values[i] : min;
+	}
+
+	return min;
+}
+
+/**
+ * @fn MutableDoubleArray *DoubleArray::mutableCopy(const DoubleArray *self)
+ * @memberof DoubleArray
+ */
+static MutableDoubleArray *mutableCopy(const DoubleArray *self) {
+
+	MutableDoubleArray *copy = $(alloc(MutableDoubleArray), initWithCapacity, self->count);
+	assert(copy);
+
+	$(copy, addValues, self->values, self->count);
+
+	return copy;
+}
+
+/**
+ * @fn DoubleArray *DoubleArray::prefixSum(const DoubleArray *self)
+ * @memberof DoubleArray
+ */
+static DoubleArray *prefixSum(const DoubleArray *self) {
+
+	DoubleArray *prefixSum = $(alloc(DoubleArray), initWithValues, self->values, self->count);
+	assert(prefixSum);
+
+	double sum = 0.0;
+
+	for (size_t i = 0; i < prefixSum->count; i++) {
+		sum += prefixSum->values[i];
+		prefixSum->values[i] = sum;
+	}
+
+	return prefixSum;
+}
+
+/**
+ * @fn DoubleArray *DoubleArray::sortedArray(const DoubleArray *self)
+ * @memberof DoubleArray
+ */
+static DoubleArray *sortedArray(const DoubleArray *self) {
+
+	DoubleArray *sorted = $(alloc(DoubleArray), initWithValues, self->values, self->count);
+	assert(sorted);
+
+	RadixSortDoubles(sorted->values, sorted->count);
+
+	return sorted;
+}
+
+/**
+ * @fn double DoubleArray::sum(const DoubleArray *self)
+ * @memberof DoubleArray
+ */
+static double sum(const DoubleArray *self) {
+
+	const double *values = self->values;
+
+	double sum[4] = { 0.0, 0.0, 0.0, 0.0 };
+
+	size_t i = 0;
+	for (; i + 4 <= self->count; i += 4) {
+		sum[0] += values[i + 0];
+		sum[1] += values[i + 1];
+		sum[2] += values[i + 2];
+		sum[3] += values[i + 3];
+	}
+
+	for (; i < self->count; i++) {
+		sum[0] += values[i];
+	}
+
+	return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+}
+
+/**
+ * @fn double DoubleArray::valueAtIndex(const DoubleArray *self, size_t index)
+ * @memberof DoubleArray
+ */
+static double valueAtIndex(const DoubleArray *self, size_t index) {
+
+	assert(index < self->count);
+
+	return self->values[index];
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->description = description;
+	object->hash = hash;
+	object->isEqual = isEqual;
+
+	DoubleArrayInterface *doubleArray = (DoubleArrayInterface *) clazz->def->interface;
+
+	doubleArray->array = array;
+	doubleArray->dot = dot;
+	doubleArray->initWithArray = initWithArray;
+	doubleArray->initWithValues = initWithValues;
+	doubleArray->doubleArrayWithValues = doubleArrayWithValues;
+	doubleArray->maximum = maximum;
+	doubleArray->mean = mean;
+	doubleArray->minimum = minimum;
+	doubleArray->mutableCopy = mutableCopy;
+	doubleArray->prefixSum = prefixSum;
+	doubleArray->sortedArray = sortedArray;
+	doubleArray->sum = sum;
+	doubleArray->valueAtIndex = valueAtIndex;
+}
+
+/**
+ * @fn Class *DoubleArray::_DoubleArray(void)
+ * @memberof DoubleArray
+ */
+Class *_DoubleArray(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "DoubleArray";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(DoubleArray);
+		clazz.interfaceOffset = offsetof(DoubleArray, interface);
+		clazz.interfaceSize = sizeof(DoubleArrayInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
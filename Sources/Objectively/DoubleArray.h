@@ -0,0 +1,201 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+
+/**
+ * @file
+ * @brief Immutable contiguous arrays of double precision values.
+ */
+
+typedef struct DoubleArray DoubleArray;
+typedef struct DoubleArrayInterface DoubleArrayInterface;
+
+/**
+ * @brief Immutable contiguous arrays of double precision values.
+ * @details Unlike an Array of Number, values are stored inline, without per-element allocations.
+ * Sums and dot products accumulate in four independent lanes, so that they may be vectorized.
+ * @extends Object
+ * @ingroup Collections
+ */
+struct DoubleArray {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	DoubleArrayInterface *interface;
+
+	/**
+	 * @brief The values.
+	 */
+	double *values;
+
+	/**
+	 * @brief The count of values.
+	 */
+	size_t count;
+};
+
+typedef struct MutableDoubleArray MutableDoubleArray;
+
+/**
+ * @brief The DoubleArray interface.
+ */
+struct DoubleArrayInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn Array *DoubleArray::array(const DoubleArray *self)
+	 * @param self The DoubleArray.
+	 * @return An Array of Number containing the values of this DoubleArray.
+	 * @memberof DoubleArray
+	 */
+	Array *(*array)(const DoubleArray *self);
+
+	/**
+	 * @fn double DoubleArray::dot(const DoubleArray *self, const DoubleArray *other)
+	 * @param self The DoubleArray.
+	 * @param other A DoubleArray of the same count.
+	 * @return The dot product of this DoubleArray and `other`.
+	 * @memberof DoubleArray
+	 */
+	double (*dot)(const DoubleArray *self, const DoubleArray *other);
+
+	/**
+	 * @fn DoubleArray *DoubleArray::initWithArray(DoubleArray *self, const Array *array)
+	 * @brief Initializes this DoubleArray with the values of an Array of Number.
+	 * @param self The DoubleArray.
+	 * @param array An Array of Number.
+	 * @return The initialized DoubleArray, or `NULL` on error.
+	 * @memberof DoubleArray
+	 */
+	DoubleArray *(*initWithArray)(DoubleArray *self, const Array *array);
+
+	/**
+	 * @fn DoubleArray *DoubleArray::initWithValues(DoubleArray *self, const double *values, size_t count)
+	 * @brief Initializes this DoubleArray by copying `count` of `values`.
+	 * @param self The DoubleArray.
+	 * @param values The values.
+	 * @param count The count of `values` to copy.
+	 * @return The initialized DoubleArray, or `NULL` on error.
+	 * @memberof DoubleArray
+	 */
+	DoubleArray *(*initWithValues)(DoubleArray *self, const double *values, size_t count);
+
+	/**
+	 * @static
+	 * @fn DoubleArray *DoubleArray::doubleArrayWithValues(const double *values, size_t count)
+	 * @brief Returns a new DoubleArray by copying `count` of `values`.
+	 * @param values The values.
+	 * @param count The count of `values` to copy.
+	 * @return The new DoubleArray, or `NULL` on error.
+	 * @memberof DoubleArray
+	 */
+	DoubleArray *(*doubleArrayWithValues)(const double *values, size_t count);
+
+	/**
+	 * @fn double DoubleArray::maximum(const DoubleArray *self)
+	 * @param self The DoubleArray, which must not be empty.
+	 * @return The greatest value in this DoubleArray.
+	 * @memberof DoubleArray
+	 */
+	double (*maximum)(const DoubleArray *self);
+
+	/**
+	 * @fn double DoubleArray::mean(const DoubleArray *self)
+	 * @param self The DoubleArray.
+	 * @return The arithmetic mean of the values in this DoubleArray, or `0.0` if it is empty.
+	 * @memberof DoubleArray
+	 */
+	double (*mean)(const DoubleArray *self);
+
+	/**
+	 * @fn double DoubleArray::minimum(const DoubleArray *self)
+	 * @param self The DoubleArray, which must not be empty.
+	 * @return The least value in this DoubleArray.
+	 * @memberof DoubleArray
+	 */
+	double (*minimum)(const DoubleArray *self);
+
+	/**
+	 * @fn MutableDoubleArray *DoubleArray::mutableCopy(const DoubleArray *self)
+	 * @param self The DoubleArray.
+	 * @return A MutableDoubleArray with the contents of this DoubleArray.
+	 * @memberof DoubleArray
+	 */
+	MutableDoubleArray *(*mutableCopy)(const DoubleArray *self);
+
+	/**
+	 * @fn DoubleArray *DoubleArray::prefixSum(const DoubleArray *self)
+	 * @param self The DoubleArray.
+	 * @return A new DoubleArray whose value at each index is the sum of this DoubleArray's
+	 * values up to and including that index.
+	 * @memberof DoubleArray
+	 */
+	DoubleArray *(*prefixSum)(const DoubleArray *self);
+
+	/**
+	 * @fn DoubleArray *DoubleArray::sortedArray(const DoubleArray *self)
+	 * @param self The DoubleArray.
+	 * @return A new DoubleArray with the values of this DoubleArray in ascending order.
+	 * @memberof DoubleArray
+	 */
+	DoubleArray *(*sortedArray)(const DoubleArray *self);
+
+	/**
+	 * @fn double DoubleArray::sum(const DoubleArray *self)
+	 * @param self The DoubleArray.
+	 * @return The sum of the values in this DoubleArray.
+	 * @memberof DoubleArray
+	 */
+	double (*sum)(const DoubleArray *self);
+
+	/**
+	 * @fn double DoubleArray::valueAtIndex(const DoubleArray *self, size_t index)
+	 * @param self The DoubleArray.
+	 * @param index The index of the desired value.
+	 * @return The value at the specified index.
+	 * @memberof DoubleArray
+	 */
+	double (*valueAtIndex)(const DoubleArray *self, size_t index);
+};
+
+/**
+ * @fn Class *DoubleArray::_DoubleArray(void)
+ * @brief The DoubleArray archetype.
+ * @return The DoubleArray Class.
+ * @memberof DoubleArray
+ */
+OBJECTIVELY_EXPORT Class *_DoubleArray(void);
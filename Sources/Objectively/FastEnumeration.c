@@ -0,0 +1,64 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+
+#include <Objectively/Array.h>
+#include <Objectively/Deque.h>
+#include <Objectively/Dictionary.h>
+#include <Objectively/FastEnumeration.h>
+#include <Objectively/Set.h>
+
+/**
+ * @return The FastEnumerator for the given collection.
+ */
+static FastEnumerator enumeratorForCollection(const Object *collection) {
+
+	if ($(collection, isKindOfClass, _Array())) {
+		return (FastEnumerator) interfaceof(Array, classof(collection))->countByEnumerating;
+	} else if ($(collection, isKindOfClass, _Deque())) {
+		return (FastEnumerator) interfaceof(Deque, classof(collection))->countByEnumerating;
+	} else if ($(collection, isKindOfClass, _Dictionary())) {
+		return (FastEnumerator) interfaceof(Dictionary, classof(collection))->countByEnumerating;
+	} else if ($(collection, isKindOfClass, _Set())) {
+		return (FastEnumerator) interfaceof(Set, classof(collection))->countByEnumerating;
+	}
+
+	assert(false);
+	return NULL;
+}
+
+size_t FastEnumerate(FastEnumerationState *state) {
+
+	assert(state);
+
+	if (state->collection == NULL) {
+		return 0;
+	}
+
+	if (state->enumerator == NULL) {
+		state->enumerator = enumeratorForCollection(state->collection);
+	}
+
+	return state->enumerator(state->collection, state);
+}
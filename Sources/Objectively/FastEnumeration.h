@@ -0,0 +1,125 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Types.h>
+
+/**
+ * @file
+ * @brief Cursor-based fast enumeration of collections.
+ * @details Fast enumeration fetches elements in batches into a stack-allocated
+ * FastEnumerationState, so that loops over collections are plain pointer walks rather than a
+ * callback per element. Use the `foreach` macro:
+ *
+ * @code
+ * foreach(String *string, array) {
+ *     printf("%s\n", string->chars);
+ * }
+ * @endcode
+ *
+ * Array, Deque, Set and Dictionary (and their mutable subclasses) are enumerable. Dictionaries
+ * enumerate their keys. `break` and `continue` behave as in any other loop. Collections must
+ * not be mutated while they are being enumerated.
+ */
+
+/**
+ * @brief The number of elements a collection may copy into a FastEnumerationState per batch.
+ */
+#define FAST_ENUMERATION_BUFFER_SIZE 16
+
+/**
+ * @brief The state of a fast enumeration, typically allocated on the stack by `foreach`.
+ */
+typedef struct FastEnumerationState FastEnumerationState;
+
+/**
+ * @brief The function type for fetching the next batch of elements from a collection.
+ * @param collection The collection.
+ * @param state The FastEnumerationState.
+ * @return The number of elements available at `state->items`, or `0` when enumeration is complete.
+ */
+typedef size_t (*FastEnumerator)(const ident collection, FastEnumerationState *state);
+
+struct FastEnumerationState {
+
+	/**
+	 * @brief The collection being enumerated.
+	 */
+	ident collection;
+
+	/**
+	 * @brief The collection's FastEnumerator, resolved on the first batch.
+	 */
+	FastEnumerator enumerator;
+
+	/**
+	 * @brief The current batch of elements.
+	 * @details This may point directly into the collection's storage, or at `buffer`.
+	 */
+	ident *items;
+
+	/**
+	 * @brief The count of `items`.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The index of the current element in `items`.
+	 */
+	size_t index;
+
+	/**
+	 * @brief The collection's cursor, which is opaque to callers and zero initially.
+	 */
+	size_t cursor[2];
+
+	/**
+	 * @brief Set when the loop body exits with `break`.
+	 */
+	_Bool stop;
+
+	/**
+	 * @brief Scratch space for collections that can not expose their storage directly.
+	 */
+	ident buffer[FAST_ENUMERATION_BUFFER_SIZE];
+};
+
+/**
+ * @brief Fetches the next batch of elements for the given FastEnumerationState.
+ * @param state The FastEnumerationState, with `collection` set.
+ * @return The number of elements available at `state->items`, or `0` when enumeration is complete.
+ * @remarks `collection` may be `NULL`, in which case there are no elements.
+ */
+OBJECTIVELY_EXPORT size_t FastEnumerate(FastEnumerationState *state);
+
+/**
+ * @brief Enumerates the elements of `collection`, assigning each to `decl`.
+ * @param decl The loop variable declaration, e.g. `String *string`.
+ * @param enumerable The collection.
+ */
+#define foreach(decl, enumerable) \
+	for (FastEnumerationState _state = { .collection = (ident) (enumerable) }; \
+			_state.stop == false && (_state.index = 0, _state.count = FastEnumerate(&_state)); ) \
+		for (; _state.stop == false && _state.index < _state.count; _state.index++) \
+			for (decl = (_state.stop = true, _state.items[_state.index]); _state.stop; _state.stop = false)
@@ -0,0 +1,546 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/FrozenDictionary.h>
+#include <Objectively/Hash.h>
+#include <Objectively/MutableArray.h>
+#include <Objectively/MutableString.h>
+
+#define _Class _FrozenDictionary
+
+/**
+ * @brief The average count of distinct key hashes per CHD bucket.
+ */
+#define FROZEN_DICTIONARY_BUCKET_SIZE 4
+
+/**
+ * @brief The number of displacements tried for a bucket before reseeding.
+ */
+#define FROZEN_DICTIONARY_MAX_DISPLACEMENT (1u << 20)
+
+/**
+ * @return A well-distributed permutation of `h`.
+ */
+static inline uint32_t mix(uint32_t h) {
+
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35;
+	h ^= h >> 16;
+
+	return h;
+}
+
+/**
+ * @return `h` reduced to the range `[0, n)` without division.
+ */
+static inline size_t reduce(uint32_t h, size_t n) {
+	return (size_t) (((uint64_t) h * n) >> 32);
+}
+
+/**
+ * @return The CHD bucket for `hash`.
+ */
+static inline size_t bucketFor(uint32_t hash, uint32_t seed, size_t buckets) {
+	return reduce(mix(hash ^ seed), buckets);
+}
+
+/**
+ * @return The slot for `hash`, under the displacement of its bucket.
+ */
+static inline size_t slotFor(uint32_t hash, uint32_t displacement, size_t slots) {
+	return reduce(mix(hash + displacement * 0x9e3779b9), slots);
+}
+
+/**
+ * @brief qsort comparator for entries, by hash.
+ */
+static int compareEntries(const void *a, const void *b) {
+
+	const uint32_t ha = (uint32_t) ((const FrozenDictionaryEntry *) a)->hash;
+	const uint32_t hb = (uint32_t) ((const FrozenDictionaryEntry *) b)->hash;
+
+	return ha < hb ? -1 : ha > hb ? 1 : 0;
+}
+
+/**
+ * @brief The build state: a run of entries sharing one hash, and its assigned slot.
+ */
+typedef struct {
+	uint32_t hash;
+	size_t first;
+	size_t length;
+	size_t slot;
+} Group;
+
+/**
+ * @brief Searches for a displacement for every bucket, given `seed`, largest buckets first.
+ * @return True on success, false if some bucket could not be placed.
+ */
+static _Bool displace(Group *groups, size_t numberOfGroups, uint32_t seed, size_t numberOfBuckets, uint32_t *displacements) {
+
+	size_t *sizes = calloc(numberOfBuckets + 1, sizeof(size_t));
+	size_t *starts = calloc(numberOfBuckets + 1, sizeof(size_t));
+	size_t *members = malloc(numberOfGroups * sizeof(size_t));
+	size_t *order = malloc(numberOfBuckets * sizeof(size_t));
+	uint8_t *taken = calloc(numberOfGroups, sizeof(uint8_t));
+
+	assert(sizes && starts && members && order && taken);
+
+	for (size_t i = 0; i < numberOfGroups; i++) {
+		sizes[bucketFor(groups[i].hash, seed, numberOfBuckets)]++;
+	}
+
+	size_t largest = 0;
+	for (size_t i = 0; i < numberOfBuckets; i++) {
+		starts[i + 1] = starts[i] + sizes[i];
+		largest = max(largest, sizes[i]);
+	}
+
+	for (size_t i = 0; i < numberOfGroups; i++) {
+		const size_t bucket = bucketFor(groups[i].hash, seed, numberOfBuckets);
+		members[starts[bucket] + --sizes[bucket]] = i;
+	}
+
+	for (size_t i = 0; i < numberOfBuckets; i++) {
+		sizes[i] = starts[i + 1] - starts[i];
+	}
+
+	size_t *bySize = calloc(largest + 2, sizeof(size_t));
+	assert(bySize);
+
+	for (size_t i = 0; i < numberOfBuckets; i++) {
+		bySize[largest - sizes[i] + 1]++;
+	}
+
+	for (size_t i = 1; i <= largest + 1; i++) {
+		bySize[i] += bySize[i - 1];
+	}
+
+	for (size_t i = 0; i < numberOfBuckets; i++) {
+		order[bySize[largest - sizes[i]]++] = i;
+	}
+
+	free(bySize);
+
+	_Bool success = true;
+
+	for (size_t i = 0; i < numberOfBuckets && success; i++) {
+
+		const size_t bucket = order[i];
+		if (sizes[bucket] == 0) {
+			break;
+		}
+
+		const size_t *bucketMembers = members + starts[bucket];
+
+		uint32_t d;
+		for (d = 0; d < FROZEN_DICTIONARY_MAX_DISPLACEMENT; d++) {
+
+			size_t placed = 0;
+			for (; placed < sizes[bucket]; placed++) {
+
+				Group *group = &groups[bucketMembers[placed]];
+
+				group->slot = slotFor(group->hash, d, numberOfGroups);
+				if (taken[group->slot]) {
+					break;
+				}
+
+				taken[group->slot] = 1;
+			}
+
+			if (placed == sizes[bucket]) {
+				break;
+			}
+
+			for (size_t j = 0; j < placed; j++) {
+				taken[groups[bucketMembers[j]].slot] = 0;
+			}
+		}
+
+		if (d == FROZEN_DICTIONARY_MAX_DISPLACEMENT) {
+			success = false;
+		} else {
+			displacements[bucket] = d;
+		}
+	}
+
+	free(taken);
+	free(order);
+	free(members);
+	free(starts);
+	free(sizes);
+
+	return success;
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	return (Object *) retain((ident) self);
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	FrozenDictionary *this = (FrozenDictionary *) self;
+
+	for (size_t i = 0; i < this->count; i++) {
+		release(this->locals.entries[i].key);
+		release(this->locals.entries[i].obj);
+	}
+
+	free(this->locals.entries);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @brief FrozenDictionaryEnumerator for description.
+ */
+static void description_enumerator(const FrozenDictionary *dict, ident obj, ident key, ident data) {
+
+	MutableString *desc = (MutableString *) data;
+
+	String *objDesc = $((Object *) obj, description);
+	String *keyDesc = $((Object *) key, description);
+
+	$(desc, appendFormat, "%s: %s, ", keyDesc->chars, objDesc->chars);
+
+	release(objDesc);
+	release(keyDesc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	const FrozenDictionary *this = (FrozenDictionary *) self;
+
+	MutableString *desc = $(alloc(MutableString), init);
+
+	$(desc, appendCharacters, "{");
+
+	$(this, enumerateObjectsAndKeys, description_enumerator, desc);
+
+	$(desc, appendCharacters, "}");
+
+	return (String *) desc;
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	const FrozenDictionary *this = (FrozenDictionary *) self;
+
+	unsigned int hash = HashForInteger(HASH_SEED, this->count);
+
+	for (size_t i = 0; i < this->count; i++) {
+
+		const FrozenDictionaryEntry *entry = &this->locals.entries[i];
+
+		hash += (unsigned int) entry->hash + 31 * (unsigned int) $((Object *) entry->obj, hash);
+	}
+
+	return (int) hash;
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, _FrozenDictionary())) {
+
+		const FrozenDictionary *this = (FrozenDictionary *) self;
+		const FrozenDictionary *that = (FrozenDictionary *) other;
+
+		if (this->count == that->count) {
+
+			for (size_t i = 0; i < this->count; i++) {
+
+				const FrozenDictionaryEntry *entry = &this->locals.entries[i];
+
+				const Object *obj = $(that, objectForKey, entry->key);
+				if (obj == NULL || $(obj, isEqual, entry->obj) == false) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+#pragma mark - FrozenDictionary
+
+/**
+ * @fn Array *FrozenDictionary::allKeys(const FrozenDictionary *self)
+ * @memberof FrozenDictionary
+ */
+static Array *allKeys(const FrozenDictionary *self) {
+
+	MutableArray *keys = $(alloc(MutableArray), initWithCapacity, self->count);
+
+	for (size_t i = 0; i < self->count; i++) {
+		$(keys, addObject, self->locals.entries[i].key);
+	}
+
+	return (Array *) keys;
+}
+
+/**
+ * @fn Array *FrozenDictionary::allObjects(const FrozenDictionary *self)
+ * @memberof FrozenDictionary
+ */
+static Array *allObjects(const FrozenDictionary *self) {
+
+	MutableArray *objects = $(alloc(MutableArray), initWithCapacity, self->count);
+
+	for (size_t i = 0; i < self->count; i++) {
+		$(objects, addObject, self->locals.entries[i].obj);
+	}
+
+	return (Array *) objects;
+}
+
+/**
+ * @fn _Bool FrozenDictionary::containsKey(const FrozenDictionary *self, const ident key)
+ * @memberof FrozenDictionary
+ */
+static _Bool containsKey(const FrozenDictionary *self, const ident key) {
+	return $(self, objectForKey, key) != NULL;
+}
+
+/**
+ * @fn void FrozenDictionary::enumerateObjectsAndKeys(const FrozenDictionary *self, FrozenDictionaryEnumerator enumerator, ident data)
+ * @memberof FrozenDictionary
+ */
+static void enumerateObjectsAndKeys(const FrozenDictionary *self, FrozenDictionaryEnumerator enumerator, ident data) {
+
+	assert(enumerator);
+
+	for (size_t i = 0; i < self->count; i++) {
+		enumerator(self, self->locals.entries[i].obj, self->locals.entries[i].key, data);
+	}
+}
+
+/**
+ * @brief DictionaryEnumerator for initWithDictionary.
+ */
+static void initWithDictionary_enumerator(const Dictionary *dictionary, ident obj, ident key, ident data) {
+
+	FrozenDictionaryEntry **entry = (FrozenDictionaryEntry **) data;
+
+	(*entry)->hash = $((Object *) key, hash);
+	(*entry)->key = retain(key);
+	(*entry)->obj = retain(obj);
+
+	(*entry)++;
+}
+
+/**
+ * @fn FrozenDictionary *FrozenDictionary::initWithDictionary(FrozenDictionary *self, const Dictionary *dictionary)
+ * @memberof FrozenDictionary
+ */
+static FrozenDictionary *initWithDictionary(FrozenDictionary *self, const Dictionary *dictionary) {
+
+	self = (FrozenDictionary *) super(Object, self, init);
+	if (self) {
+
+		if (dictionary == NULL || dictionary->count == 0) {
+			return self;
+		}
+
+		const size_t count = dictionary->count;
+
+		FrozenDictionaryEntry *entries = malloc(count * sizeof(FrozenDictionaryEntry));
+		assert(entries);
+
+		FrozenDictionaryEntry *entry = entries;
+		$(dictionary, enumerateObjectsAndKeys, initWithDictionary_enumerator, &entry);
+
+		qsort(entries, count, sizeof(FrozenDictionaryEntry), compareEntries);
+
+		Group *groups = malloc(count * sizeof(Group));
+		assert(groups);
+
+		size_t numberOfGroups = 0;
+		for (size_t i = 0; i < count; i++) {
+			if (i == 0 || entries[i].hash != entries[i - 1].hash) {
+				groups[numberOfGroups++] = (Group) {
+					.hash = (uint32_t) entries[i].hash,
+					.first = i
+				};
+			}
+			groups[numberOfGroups - 1].length++;
+		}
+
+		const size_t numberOfBuckets = (numberOfGroups + FROZEN_DICTIONARY_BUCKET_SIZE - 1) / FROZEN_DICTIONARY_BUCKET_SIZE;
+
+		const size_t size = count * sizeof(FrozenDictionaryEntry)
+			+ (numberOfGroups + 1) * sizeof(uint32_t)
+			+ numberOfBuckets * sizeof(uint32_t);
+
+		self->locals.entries = malloc(size);
+		assert(self->locals.entries);
+
+		self->locals.offsets = (uint32_t *) (self->locals.entries + count);
+		self->locals.displacements = self->locals.offsets + numberOfGroups + 1;
+
+		uint32_t seed = 0x2545f491;
+		while (displace(groups, numberOfGroups, seed, numberOfBuckets, self->locals.displacements) == false) {
+			seed = mix(seed + 1);
+		}
+
+		size_t *slots = malloc(numberOfGroups * sizeof(size_t));
+		assert(slots);
+
+		for (size_t i = 0; i < numberOfGroups; i++) {
+			slots[groups[i].slot] = i;
+		}
+
+		size_t offset = 0;
+		for (size_t i = 0; i < numberOfGroups; i++) {
+
+			const Group *group = &groups[slots[i]];
+
+			self->locals.offsets[i] = (uint32_t) offset;
+
+			memcpy(self->locals.entries + offset, entries + group->first, group->length * sizeof(FrozenDictionaryEntry));
+			offset += group->length;
+		}
+
+		self->locals.offsets[numberOfGroups] = (uint32_t) offset;
+
+		self->locals.seed = seed;
+		self->locals.numberOfBuckets = numberOfBuckets;
+		self->locals.numberOfSlots = numberOfGroups;
+
+		self->count = count;
+
+		free(slots);
+		free(groups);
+		free(entries);
+	}
+
+	return self;
+}
+
+/**
+ * @fn ident FrozenDictionary::objectForKey(const FrozenDictionary *self, const ident key)
+ * @memberof FrozenDictionary
+ */
+static ident objectForKey(const FrozenDictionary *self, const ident key) {
+
+	assert(key);
+
+	if (self->count == 0) {
+		return NULL;
+	}
+
+	const int hash = $((Object *) key, hash);
+
+	const size_t bucket = bucketFor((uint32_t) hash, self->locals.seed, self->locals.numberOfBuckets);
+	const size_t slot = slotFor((uint32_t) hash, self->locals.displacements[bucket], self->locals.numberOfSlots);
+
+	for (uint32_t i = self->locals.offsets[slot]; i < self->locals.offsets[slot + 1]; i++) {
+
+		const FrozenDictionaryEntry *entry = &self->locals.entries[i];
+		if (entry->hash == hash) {
+			if (entry->key == key || $((Object *) entry->key, isEqual, key)) {
+				return entry->obj;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->description = description;
+	object->hash = hash;
+	object->isEqual = isEqual;
+
+	FrozenDictionaryInterface *dictionary = (FrozenDictionaryInterface *) clazz->def->interface;
+
+	dictionary->allKeys = allKeys;
+	dictionary->allObjects = allObjects;
+	dictionary->containsKey = containsKey;
+	dictionary->enumerateObjectsAndKeys = enumerateObjectsAndKeys;
+	dictionary->initWithDictionary = initWithDictionary;
+	dictionary->objectForKey = objectForKey;
+}
+
+/**
+ * @fn Class *FrozenDictionary::_FrozenDictionary(void)
+ * @memberof FrozenDictionary
+ */
+Class *_FrozenDictionary(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "FrozenDictionary";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(FrozenDictionary);
+		clazz.interfaceOffset = offsetof(FrozenDictionary, interface);
+		clazz.interfaceSize = sizeof(FrozenDictionaryInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
@@ -0,0 +1,203 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+#include <Objectively/Dictionary.h>
+
+/**
+ * @file
+ * @brief Read-only key-value stores indexed by a minimal perfect hash.
+ */
+
+typedef struct FrozenDictionary FrozenDictionary;
+typedef struct FrozenDictionaryInterface FrozenDictionaryInterface;
+
+/**
+ * @brief A function type for FrozenDictionary enumeration (iteration).
+ * @param dictionary The FrozenDictionary.
+ * @param obj The Object for the current iteration.
+ * @param key The key for the current iteration.
+ * @param data User data.
+ */
+typedef void (*FrozenDictionaryEnumerator)(const FrozenDictionary *dictionary, ident obj, ident key, ident data);
+
+/**
+ * @brief A FrozenDictionary entry.
+ */
+typedef struct {
+
+	/**
+	 * @brief The hash of `key`.
+	 */
+	int hash;
+
+	/**
+	 * @brief The key.
+	 */
+	ident key;
+
+	/**
+	 * @brief The Object.
+	 */
+	ident obj;
+} FrozenDictionaryEntry;
+
+/**
+ * @brief Read-only key-value stores indexed by a minimal perfect hash.
+ * @details A FrozenDictionary is built once, with the CHD (compress, hash and displace)
+ * algorithm, and laid out in a single contiguous allocation. Each distinct key hash maps to its
+ * own slot, so a lookup costs one hash and, typically, one key comparison.
+ * @details Building is `O(n)` expected; use Dictionary::freeze for tables that are read far more
+ * often than they are created.
+ * @extends Object
+ * @ingroup Collections
+ */
+struct FrozenDictionary {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	FrozenDictionaryInterface *interface;
+
+	/**
+	 * @brief The count of pairs.
+	 */
+	size_t count;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The seed of the bucket hash function.
+		 */
+		uint32_t seed;
+
+		/**
+		 * @brief The count of CHD buckets.
+		 */
+		size_t numberOfBuckets;
+
+		/**
+		 * @brief The count of slots, one per distinct key hash.
+		 */
+		size_t numberOfSlots;
+
+		/**
+		 * @brief The entries, ordered by slot.
+		 */
+		FrozenDictionaryEntry *entries;
+
+		/**
+		 * @brief The index of the first entry of each slot, followed by `count`.
+		 */
+		uint32_t *offsets;
+
+		/**
+		 * @brief The displacement of each bucket.
+		 */
+		uint32_t *displacements;
+	} locals;
+};
+
+/**
+ * @brief The FrozenDictionary interface.
+ */
+struct FrozenDictionaryInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn Array *FrozenDictionary::allKeys(const FrozenDictionary *self)
+	 * @param self The FrozenDictionary.
+	 * @return An Array containing all keys in this FrozenDictionary.
+	 * @memberof FrozenDictionary
+	 */
+	Array *(*allKeys)(const FrozenDictionary *self);
+
+	/**
+	 * @fn Array *FrozenDictionary::allObjects(const FrozenDictionary *self)
+	 * @param self The FrozenDictionary.
+	 * @return An Array containing all Objects in this FrozenDictionary.
+	 * @memberof FrozenDictionary
+	 */
+	Array *(*allObjects)(const FrozenDictionary *self);
+
+	/**
+	 * @fn _Bool FrozenDictionary::containsKey(const FrozenDictionary *self, const ident key)
+	 * @param self The FrozenDictionary.
+	 * @param key The key.
+	 * @return `true` if this FrozenDictionary contains the given key, `false` otherwise.
+	 * @memberof FrozenDictionary
+	 */
+	_Bool (*containsKey)(const FrozenDictionary *self, const ident key);
+
+	/**
+	 * @fn void FrozenDictionary::enumerateObjectsAndKeys(const FrozenDictionary *self, FrozenDictionaryEnumerator enumerator, ident data)
+	 * @brief Enumerate the pairs of this FrozenDictionary with the given function.
+	 * @param self The FrozenDictionary.
+	 * @param enumerator The enumerator function.
+	 * @param data User data.
+	 * @memberof FrozenDictionary
+	 */
+	void (*enumerateObjectsAndKeys)(const FrozenDictionary *self, FrozenDictionaryEnumerator enumerator, ident data);
+
+	/**
+	 * @fn FrozenDictionary *FrozenDictionary::initWithDictionary(FrozenDictionary *self, const Dictionary *dictionary)
+	 * @brief Initializes this FrozenDictionary with the pairs of `dictionary`.
+	 * @param self The FrozenDictionary.
+	 * @param dictionary A Dictionary.
+	 * @return The initialized FrozenDictionary, or `NULL` on error.
+	 * @memberof FrozenDictionary
+	 */
+	FrozenDictionary *(*initWithDictionary)(FrozenDictionary *self, const Dictionary *dictionary);
+
+	/**
+	 * @fn ident FrozenDictionary::objectForKey(const FrozenDictionary *self, const ident key)
+	 * @param self The FrozenDictionary.
+	 * @param key The key.
+	 * @return The Object for the given key, or `NULL` if not found.
+	 * @memberof FrozenDictionary
+	 */
+	ident (*objectForKey)(const FrozenDictionary *self, const ident key);
+};
+
+/**
+ * @fn Class *FrozenDictionary::_FrozenDictionary(void)
+ * @brief The FrozenDictionary archetype.
+ * @return The FrozenDictionary Class.
+ * @memberof FrozenDictionary
+ */
+OBJECTIVELY_EXPORT Class *_FrozenDictionary(void);
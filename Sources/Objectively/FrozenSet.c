@@ -0,0 +1,237 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include <Objectively/FrozenSet.h>
+#include <Objectively/Hash.h>
+#include <Objectively/MutableDictionary.h>
+
+#define _Class _FrozenSet
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	return (Object *) retain((ident) self);
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	FrozenSet *this = (FrozenSet *) self;
+
+	release(this->dictionary);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	Array *array = $((FrozenSet *) self, allObjects);
+
+	String *description = $((Object *) array, description);
+
+	release(array);
+
+	return description;
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	const FrozenSet *this = (FrozenSet *) self;
+
+	return HashForObject(HASH_SEED, this->dictionary);
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, _FrozenSet())) {
+
+		const FrozenSet *this = (FrozenSet *) self;
+		const FrozenSet *that = (FrozenSet *) other;
+
+		return $((Object *) this->dictionary, isEqual, (Object *) that->dictionary);
+	}
+
+	return false;
+}
+
+#pragma mark - FrozenSet
+
+/**
+ * @fn Array *FrozenSet::allObjects(const FrozenSet *self)
+ * @memberof FrozenSet
+ */
+static Array *allObjects(const FrozenSet *self) {
+	return $(self->dictionary, allKeys);
+}
+
+/**
+ * @fn _Bool FrozenSet::containsObject(const FrozenSet *self, const ident obj)
+ * @memberof FrozenSet
+ */
+static _Bool containsObject(const FrozenSet *self, const ident obj) {
+	return $(self->dictionary, containsKey, obj);
+}
+
+/**
+ * @fn void FrozenSet::enumerateObjects(const FrozenSet *self, FrozenSetEnumerator enumerator, ident data)
+ * @memberof FrozenSet
+ */
+static void enumerateObjects(const FrozenSet *self, FrozenSetEnumerator enumerator, ident data) {
+
+	assert(enumerator);
+
+	const FrozenDictionaryEntry *entries = self->dictionary->locals.entries;
+
+	for (size_t i = 0; i < self->count; i++) {
+		enumerator(self, entries[i].key, data);
+	}
+}
+
+/**
+ * @brief Initializes `self` with the Objects mapped to themselves in `dictionary`.
+ */
+static FrozenSet *initWithDictionary(FrozenSet *self, const Dictionary *dictionary) {
+
+	self = (FrozenSet *) super(Object, self, init);
+	if (self) {
+		self->dictionary = $(alloc(FrozenDictionary), initWithDictionary, dictionary);
+		assert(self->dictionary);
+
+		self->count = self->dictionary->count;
+	}
+
+	return self;
+}
+
+/**
+ * @fn FrozenSet *FrozenSet::initWithArray(FrozenSet *self, const Array *array)
+ * @memberof FrozenSet
+ */
+static FrozenSet *initWithArray(FrozenSet *self, const Array *array) {
+
+	MutableDictionary *dictionary = $(alloc(MutableDictionary), initWithCapacity, array ? array->count : 0);
+
+	if (array) {
+		for (size_t i = 0; i < array->count; i++) {
+			$(dictionary, setObjectForKey, array->elements[i], array->elements[i]);
+		}
+	}
+
+	self = initWithDictionary(self, (Dictionary *) dictionary);
+
+	release(dictionary);
+	return self;
+}
+
+/**
+ * @brief SetEnumerator for initWithSet.
+ */
+static void initWithSet_enumerator(const Set *set, ident obj, ident data) {
+	$((MutableDictionary *) data, setObjectForKey, obj, obj);
+}
+
+/**
+ * @fn FrozenSet *FrozenSet::initWithSet(FrozenSet *self, const Set *set)
+ * @memberof FrozenSet
+ */
+static FrozenSet *initWithSet(FrozenSet *self, const Set *set) {
+
+	MutableDictionary *dictionary = $(alloc(MutableDictionary), initWithCapacity, set ? set->count : 0);
+
+	if (set) {
+		$(set, enumerateObjects, initWithSet_enumerator, dictionary);
+	}
+
+	self = initWithDictionary(self, (Dictionary *) dictionary);
+
+	release(dictionary);
+	return self;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->description = description;
+	object->hash = hash;
+	object->isEqual = isEqual;
+
+	FrozenSetInterface *set = (FrozenSetInterface *) clazz->def->interface;
+
+	set->allObjects = allObjects;
+	set->containsObject = containsObject;
+	set->enumerateObjects = enumerateObjects;
+	set->initWithArray = initWithArray;
+	set->initWithSet = initWithSet;
+}
+
+/**
+ * @fn Class *FrozenSet::_FrozenSet(void)
+ * @memberof FrozenSet
+ */
+Class *_FrozenSet(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "FrozenSet";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(FrozenSet);
+		clazz.interfaceOffset = offsetof(FrozenSet, interface);
+		clazz.interfaceSize = sizeof(FrozenSetInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
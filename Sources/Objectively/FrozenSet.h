@@ -0,0 +1,140 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/FrozenDictionary.h>
+#include <Objectively/Set.h>
+
+/**
+ * @file
+ * @brief Read-only sets indexed by a minimal perfect hash.
+ */
+
+typedef struct FrozenSet FrozenSet;
+typedef struct FrozenSetInterface FrozenSetInterface;
+
+/**
+ * @brief A function type for FrozenSet enumeration (iteration).
+ * @param set The FrozenSet.
+ * @param obj The Object for the current iteration.
+ * @param data User data.
+ */
+typedef void (*FrozenSetEnumerator)(const FrozenSet *set, ident obj, ident data);
+
+/**
+ * @brief Read-only sets indexed by a minimal perfect hash.
+ * @see FrozenDictionary
+ * @extends Object
+ * @ingroup Collections
+ */
+struct FrozenSet {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	FrozenSetInterface *interface;
+
+	/**
+	 * @brief The count of elements.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The backing FrozenDictionary, mapping each Object to itself.
+	 * @private
+	 */
+	FrozenDictionary *dictionary;
+};
+
+/**
+ * @brief The FrozenSet interface.
+ */
+struct FrozenSetInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn Array *FrozenSet::allObjects(const FrozenSet *self)
+	 * @param self The FrozenSet.
+	 * @return An Array containing all Objects in this FrozenSet.
+	 * @memberof FrozenSet
+	 */
+	Array *(*allObjects)(const FrozenSet *self);
+
+	/**
+	 * @fn _Bool FrozenSet::containsObject(const FrozenSet *self, const ident obj)
+	 * @param self The FrozenSet.
+	 * @param obj An Object.
+	 * @return `true` if this FrozenSet contains the given Object, `false` otherwise.
+	 * @memberof FrozenSet
+	 */
+	_Bool (*containsObject)(const FrozenSet *self, const ident obj);
+
+	/**
+	 * @fn void FrozenSet::enumerateObjects(const FrozenSet *self, FrozenSetEnumerator enumerator, ident data)
+	 * @brief Enumerate the elements of this FrozenSet with the given function.
+	 * @param self The FrozenSet.
+	 * @param enumerator The enumerator function.
+	 * @param data User data.
+	 * @memberof FrozenSet
+	 */
+	void (*enumerateObjects)(const FrozenSet *self, FrozenSetEnumerator enumerator, ident data);
+
+	/**
+	 * @fn FrozenSet *FrozenSet::initWithArray(FrozenSet *self, const Array *array)
+	 * @brief Initializes this FrozenSet with the contents of `array`.
+	 * @param self The FrozenSet.
+	 * @param array An Array.
+	 * @return The initialized FrozenSet, or `NULL` on error.
+	 * @memberof FrozenSet
+	 */
+	FrozenSet *(*initWithArray)(FrozenSet *self, const Array *array);
+
+	/**
+	 * @fn FrozenSet *FrozenSet::initWithSet(FrozenSet *self, const Set *set)
+	 * @brief Initializes this FrozenSet with the contents of `set`.
+	 * @param self The FrozenSet.
+	 * @param set A Set.
+	 * @return The initialized FrozenSet, or `NULL` on error.
+	 * @memberof FrozenSet
+	 */
+	FrozenSet *(*initWithSet)(FrozenSet *self, const Set *set);
+};
+
+/**
+ * @fn Class *FrozenSet::_FrozenSet(void)
+ * @brief The FrozenSet archetype.
+ * @return The FrozenSet Class.
+ * @memberof FrozenSet
+ */
+OBJECTIVELY_EXPORT Class *_FrozenSet(void);
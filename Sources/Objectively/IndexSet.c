@@ -27,6 +27,7 @@
 
 #include <Objectively/Hash.h>
 #include <Objectively/IndexSet.h>
+#include <Objectively/MutableIndexSet.h>
 #include <Objectively/MutableString.h>
 
 /**
@@ -41,29 +42,94 @@ static int compare(const void *a, const void *b) {
 }
 
 /**
- * @brief Sorts and compacts the given array to contain only unique values.
+ * @return The exclusive end of `range`.
  */
-static size_t compact(size_t *indexes, size_t count) {
+static inline size_t end(const Range range) {
+	return range.location + range.length;
+}
 
-	size_t size = 0;
+/**
+ * @brief A growable list of sorted Ranges, used to build IndexSets.
+ */
+typedef struct {
+	Range *ranges;
+	size_t count;
+	size_t capacity;
+	size_t indexes;
+} Ranges;
 
-	if (count) {
-		qsort(indexes, count, sizeof(size_t), compare);
+/**
+ * @brief Appends `range` to `ranges`, coalescing it with the last Range if they overlap or are
+ * adjacent. The `range` must not begin before the last Range.
+ */
+static void append(Ranges *ranges, const Range range) {
+
+	if (range.length == 0) {
+		return;
+	}
+
+	if (ranges->count) {
+		Range *last = &ranges->ranges[ranges->count - 1];
 
-		for (size_t i = 1; i < count; i++) {
-			if (indexes[i] != indexes[size]) {
-				indexes[++size] = indexes[i];
+		assert(range.location >= last->location);
+
+		if ((size_t) range.location <= end(*last)) {
+			if (end(range) > end(*last)) {
+				ranges->indexes += end(range) - end(*last);
+				last->length = end(range) - last->location;
 			}
+			return;
 		}
+	}
 
-		size++;
+	if (ranges->count == ranges->capacity) {
+		ranges->capacity = ranges->capacity ? ranges->capacity << 1 : 4;
+		ranges->ranges = realloc(ranges->ranges, ranges->capacity * sizeof(Range));
+		assert(ranges->ranges);
 	}
 
-	return size;
+	ranges->ranges[ranges->count++] = range;
+	ranges->indexes += range.length;
 }
 
 #define _Class _IndexSet
 
+/**
+ * @brief Initializes `self` by taking ownership of `ranges`.
+ */
+static IndexSet *initWithRanges(IndexSet *self, Ranges *ranges) {
+
+	self = (IndexSet *) super(Object, self, init);
+	if (self) {
+		self->ranges = ranges->ranges;
+		self->numberOfRanges = ranges->count;
+		self->count = ranges->indexes;
+	} else {
+		free(ranges->ranges);
+	}
+
+	return self;
+}
+
+/**
+ * @return The index of the first Range in `self` whose end is greater than `index`.
+ */
+static size_t search(const IndexSet *self, size_t index) {
+
+	size_t low = 0, high = self->numberOfRanges;
+
+	while (low < high) {
+		const size_t mid = low + ((high - low) >> 1);
+		if (end(self->ranges[mid]) <= index) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
 #pragma mark - Object
 
 /**
@@ -72,7 +138,7 @@ static size_t compact(size_t *indexes, size_t count) {
 static Object *copy(const Object *self) {
 
 	IndexSet *this = (IndexSet *) self;
-	IndexSet *that = $(alloc(IndexSet), initWithIndexes, this->indexes, this->count);
+	IndexSet *that = $(alloc(IndexSet), initWithIndexSet, this);
 
 	return (Object *) that;
 }
@@ -84,7 +150,7 @@ static void dealloc(Object *self) {
 
 	IndexSet *this = (IndexSet *) self;
 
-	free(this->indexes);
+	free(this->ranges);
 
 	super(Object, self, dealloc);
 }
@@ -97,10 +163,12 @@ static String *description(const Object *self) {
 	const IndexSet *this = (IndexSet *) self;
 	MutableString *desc = mstr("[");
 
-	for (size_t i = 0; i < this->count; i++) {
-		$(desc, appendFormat, "%d", this->indexes[i]);
-		if (i < this->count - 1) {
-			$(desc, appendCharacters, ", ");
+	for (size_t i = 0; i < this->numberOfRanges; i++) {
+		for (size_t j = 0; j < this->ranges[i].length; j++) {
+			$(desc, appendFormat, "%zu", (size_t) this->ranges[i].location + j);
+			if (i < this->numberOfRanges - 1 || j < this->ranges[i].length - 1) {
+				$(desc, appendCharacters, ", ");
+			}
 		}
 	}
 
@@ -117,8 +185,9 @@ static int hash(const Object *self) {
 
 	const IndexSet *this = (IndexSet *) self;
 
-	for (size_t i = 0; i < this->count; i++) {
-		hash = HashForInteger(hash, this->indexes[i]);
+	for (size_t i = 0; i < this->numberOfRanges; i++) {
+		hash = HashForInteger(hash, this->ranges[i].location);
+		hash = HashForInteger(hash, this->ranges[i].length);
 	}
 
 	return hash;
@@ -138,8 +207,8 @@ static _Bool isEqual(const Object *self, const Object *other) {
 		const IndexSet *this = (IndexSet *) self;
 		const IndexSet *that = (IndexSet *) other;
 
-		if (this->count == that->count) {
-			return memcmp(this->indexes, that->indexes, this->count * sizeof(size_t)) == 0;
+		if (this->numberOfRanges == that->numberOfRanges) {
+			return memcmp(this->ranges, that->ranges, this->numberOfRanges * sizeof(Range)) == 0;
 		}
 	}
 
@@ -154,13 +223,98 @@ static _Bool isEqual(const Object *self, const Object *other) {
  */
 static _Bool containsIndex(const IndexSet *self, size_t index) {
 
-	for (size_t i = 0; i < self->count; i++) {
-		if (self->indexes[i] == index) {
-			return true;
+	const size_t i = search(self, index);
+
+	return i < self->numberOfRanges && (size_t) self->ranges[i].location <= index;
+}
+
+/**
+ * @fn _Bool IndexSet::containsIndexesInRange(const IndexSet *self, const Range range)
+ * @memberof IndexSet
+ */
+static _Bool containsIndexesInRange(const IndexSet *self, const Range range) {
+
+	if (range.length == 0) {
+		return true;
+	}
+
+	const size_t i = search(self, range.location);
+
+	return i < self->numberOfRanges
+		&& self->ranges[i].location <= range.location
+		&& end(self->ranges[i]) >= end(range);
+}
+
+/**
+ * @fn IndexSet *IndexSet::differenceWithIndexSet(const IndexSet *self, const IndexSet *indexSet)
+ * @memberof IndexSet
+ */
+static IndexSet *differenceWithIndexSet(const IndexSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	Ranges ranges = { 0 };
+
+	size_t j = 0;
+	for (size_t i = 0; i < self->numberOfRanges; i++) {
+
+		size_t location = self->ranges[i].location;
+		const size_t e = end(self->ranges[i]);
+
+		while (j < indexSet->numberOfRanges && end(indexSet->ranges[j]) <= location) {
+			j++;
+		}
+
+		for (size_t k = j; k < indexSet->numberOfRanges && (size_t) indexSet->ranges[k].location < e; k++) {
+
+			const Range subtrahend = indexSet->ranges[k];
+			if ((size_t) subtrahend.location > location) {
+				append(&ranges, (Range) { .location = location, .length = subtrahend.location - location });
+			}
+
+			location = max(location, end(subtrahend));
+			if (location >= e) {
+				break;
+			}
+		}
+
+		if (location < e) {
+			append(&ranges, (Range) { .location = location, .length = e - location });
 		}
 	}
 
-	return false;
+	return initWithRanges(alloc(IndexSet), &ranges);
+}
+
+/**
+ * @fn void IndexSet::enumerateRanges(const IndexSet *self, IndexSetEnumerator enumerator, ident data)
+ * @memberof IndexSet
+ */
+static void enumerateRanges(const IndexSet *self, IndexSetEnumerator enumerator, ident data) {
+
+	assert(enumerator);
+
+	for (size_t i = 0; i < self->numberOfRanges; i++) {
+		enumerator(self, self->ranges[i], data);
+	}
+}
+
+/**
+ * @fn size_t IndexSet::getIndexes(const IndexSet *self, size_t *indexes, size_t count)
+ * @memberof IndexSet
+ */
+static size_t getIndexes(const IndexSet *self, size_t *indexes, size_t count) {
+
+	size_t n = 0;
+
+	for (size_t i = 0; i < self->numberOfRanges && n < count; i++) {
+		const Range range = self->ranges[i];
+		for (size_t j = 0; j < range.length && n < count; j++) {
+			indexes[n++] = range.location + j;
+		}
+	}
+
+	return n;
 }
 
 /**
@@ -177,20 +331,132 @@ static IndexSet *initWithIndex(IndexSet *self, size_t index) {
  */
 static IndexSet *initWithIndexes(IndexSet *self, size_t *indexes, size_t count) {
 
-	self = (IndexSet *) super(Object, self, init);
-	if (self) {
+	Ranges ranges = { 0 };
 
-		self->count = compact(indexes, count);
-		if (self->count) {
+	if (count) {
+
+		size_t *sorted = malloc(count * sizeof(size_t));
+		assert(sorted);
 
-			self->indexes = calloc(sizeof(size_t), self->count);
-			assert(self->indexes);
+		memcpy(sorted, indexes, count * sizeof(size_t));
+		qsort(sorted, count, sizeof(size_t), compare);
 
-			memcpy(self->indexes, indexes, sizeof(size_t) * self->count);
+		for (size_t i = 0; i < count; i++) {
+			append(&ranges, (Range) { .location = sorted[i], .length = 1 });
 		}
+
+		free(sorted);
 	}
 
-	return self;
+	return initWithRanges(self, &ranges);
+}
+
+/**
+ * @fn IndexSet *IndexSet::initWithIndexesInRange(IndexSet *self, const Range range)
+ * @memberof IndexSet
+ */
+static IndexSet *initWithIndexesInRange(IndexSet *self, const Range range) {
+
+	assert(range.location >= 0);
+
+	Ranges ranges = { 0 };
+
+	append(&ranges, range);
+
+	return initWithRanges(self, &ranges);
+}
+
+/**
+ * @fn IndexSet *IndexSet::initWithIndexSet(IndexSet *self, const IndexSet *indexSet)
+ * @memberof IndexSet
+ */
+static IndexSet *initWithIndexSet(IndexSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	Ranges ranges = { 0 };
+
+	if (indexSet->numberOfRanges) {
+		ranges.ranges = malloc(indexSet->numberOfRanges * sizeof(Range));
+		assert(ranges.ranges);
+
+		memcpy(ranges.ranges, indexSet->ranges, indexSet->numberOfRanges * sizeof(Range));
+
+		ranges.count = ranges.capacity = indexSet->numberOfRanges;
+		ranges.indexes = indexSet->count;
+	}
+
+	return initWithRanges(self, &ranges);
+}
+
+/**
+ * @fn IndexSet *IndexSet::intersectionWithIndexSet(const IndexSet *self, const IndexSet *indexSet)
+ * @memberof IndexSet
+ */
+static IndexSet *intersectionWithIndexSet(const IndexSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	Ranges ranges = { 0 };
+
+	size_t i = 0, j = 0;
+	while (i < self->numberOfRanges && j < indexSet->numberOfRanges) {
+
+		const Range a = self->ranges[i], b = indexSet->ranges[j];
+
+		const size_t location = max(a.location, b.location);
+		const size_t e = min(end(a), end(b));
+
+		if (location < e) {
+			append(&ranges, (Range) { .location = location, .length = e - location });
+		}
+
+		if (end(a) < end(b)) {
+			i++;
+		} else {
+			j++;
+		}
+	}
+
+	return initWithRanges(alloc(IndexSet), &ranges);
+}
+
+/**
+ * @fn MutableIndexSet *IndexSet::mutableCopy(const IndexSet *self)
+ * @memberof IndexSet
+ */
+static MutableIndexSet *mutableCopy(const IndexSet *self) {
+
+	MutableIndexSet *copy = $(alloc(MutableIndexSet), init);
+	assert(copy);
+
+	$(copy, addIndexSet, self);
+
+	return copy;
+}
+
+/**
+ * @fn IndexSet *IndexSet::unionWithIndexSet(const IndexSet *self, const IndexSet *indexSet)
+ * @memberof IndexSet
+ */
+static IndexSet *unionWithIndexSet(const IndexSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	Ranges ranges = { 0 };
+
+	size_t i = 0, j = 0;
+	while (i < self->numberOfRanges || j < indexSet->numberOfRanges) {
+
+		if (j == indexSet->numberOfRanges
+			|| (i < self->numberOfRanges && self->ranges[i].location < indexSet->ranges[j].location)) {
+			append(&ranges, self->ranges[i++]);
+		} else {
+			append(&ranges, indexSet->ranges[j++]);
+		}
+	}
+
+	return initWithRanges(alloc(IndexSet), &ranges);
 }
 
 #pragma mark - Class lifecycle
@@ -207,8 +473,17 @@ static void initialize(Class *clazz) {
 	((ObjectInterface *) clazz->def->interface)->isEqual = isEqual;
 
 	((IndexSetInterface *) clazz->def->interface)->containsIndex = containsIndex;
+	((IndexSetInterface *) clazz->def->interface)->containsIndexesInRange = containsIndexesInRange;
+	((IndexSetInterface *) clazz->def->interface)->differenceWithIndexSet = differenceWithIndexSet;
+	((IndexSetInterface *) clazz->def->interface)->enumerateRanges = enumerateRanges;
+	((IndexSetInterface *) clazz->def->interface)->getIndexes = getIndexes;
 	((IndexSetInterface *) clazz->def->interface)->initWithIndex = initWithIndex;
 	((IndexSetInterface *) clazz->def->interface)->initWithIndexes = initWithIndexes;
+	((IndexSetInterface *) clazz->def->interface)->initWithIndexesInRange = initWithIndexesInRange;
+	((IndexSetInterface *) clazz->def->interface)->initWithIndexSet = initWithIndexSet;
+	((IndexSetInterface *) clazz->def->interface)->intersectionWithIndexSet = intersectionWithIndexSet;
+	((IndexSetInterface *) clazz->def->interface)->mutableCopy = mutableCopy;
+	((IndexSetInterface *) clazz->def->interface)->unionWithIndexSet = unionWithIndexSet;
 }
 
 /**
@@ -232,4 +507,3 @@ Class *_IndexSet(void) {
 }
 
 #undef _Class
-
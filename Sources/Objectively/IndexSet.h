@@ -33,8 +33,20 @@
 typedef struct IndexSet IndexSet;
 typedef struct IndexSetInterface IndexSetInterface;
 
+typedef struct MutableIndexSet MutableIndexSet;
+
+/**
+ * @brief A function pointer for IndexSet range enumeration.
+ * @param indexSet The IndexSet.
+ * @param range The Range of contiguous indexes for the current iteration.
+ * @param data User data.
+ */
+typedef void (*IndexSetEnumerator)(const IndexSet *indexSet, const Range range, ident data);
+
 /**
  * @brief Index Sets represent the Set to an element or node within a tree or graph structure.
+ * @details Indexes are stored as a sorted list of disjoint, non-adjacent Ranges, so that large
+ * contiguous selections are compact, and membership tests are `O(log n)` in the number of Ranges.
  * @extends Object
  */
 struct IndexSet {
@@ -51,12 +63,17 @@ struct IndexSet {
 	IndexSetInterface *interface;
 
 	/**
-	 * @brief The indexes.
+	 * @brief The sorted, disjoint, non-adjacent Ranges of indexes.
+	 */
+	Range *ranges;
+
+	/**
+	 * @brief The count of `ranges`.
 	 */
-	size_t *indexes;
+	size_t numberOfRanges;
 
 	/**
-	 * @brief The count of `indexes`.
+	 * @brief The count of indexes.
 	 */
 	size_t count;
 };
@@ -80,6 +97,46 @@ struct IndexSetInterface {
 	 */
 	_Bool (*containsIndex)(const IndexSet *self, size_t index);
 
+	/**
+	 * @fn _Bool IndexSet::containsIndexesInRange(const IndexSet *self, const Range range)
+	 * @param self The IndexSet.
+	 * @param range The Range of indexes.
+	 * @return True if this IndexSet contains every index in `range`, false otherwise.
+	 * @memberof IndexSet
+	 */
+	_Bool (*containsIndexesInRange)(const IndexSet *self, const Range range);
+
+	/**
+	 * @fn IndexSet *IndexSet::differenceWithIndexSet(const IndexSet *self, const IndexSet *indexSet)
+	 * @param self The IndexSet.
+	 * @param indexSet The IndexSet to subtract.
+	 * @return A new IndexSet containing the indexes of this IndexSet not in `indexSet`.
+	 * @memberof IndexSet
+	 */
+	IndexSet *(*differenceWithIndexSet)(const IndexSet *self, const IndexSet *indexSet);
+
+	/**
+	 * @fn void IndexSet::enumerateRanges(const IndexSet *self, IndexSetEnumerator enumerator, ident data)
+	 * @brief Enumerates the Ranges of this IndexSet in ascending order.
+	 * @param self The IndexSet.
+	 * @param enumerator The enumerator function.
+	 * @param data User data.
+	 * @memberof IndexSet
+	 */
+	void (*enumerateRanges)(const IndexSet *self, IndexSetEnumerator enumerator, ident data);
+
+	/**
+	 * @fn size_t IndexSet::getIndexes(const IndexSet *self, size_t *indexes, size_t count)
+	 * @brief Copies the indexes of this IndexSet, in ascending order, to the given buffer.
+	 * @param self The IndexSet.
+	 * @param indexes The buffer to receive the indexes.
+	 * @param count The capacity of `indexes`.
+	 * @return The number of indexes copied, which is at most `count`.
+	 * @remarks This replaces the `indexes` array, which IndexSet no longer stores.
+	 * @memberof IndexSet
+	 */
+	size_t (*getIndexes)(const IndexSet *self, size_t *indexes, size_t count);
+
 	/**
 	 * @fn IndexSet *IndexSet::initWithIndex(IndexSet *self, size_t index)
 	 * @brief Initializes this IndexSet with the specified index.
@@ -94,12 +151,58 @@ struct IndexSetInterface {
 	 * @fn IndexSet *IndexSet::initWithIndexes(IndexSet *self, size_t *indexes, size_t count)
 	 * @brief Initializes this IndexSet with the specified indexes and count.
 	 * @param self The IndexSet.
-	 * @param indexes The indexes.
+	 * @param indexes The indexes, which need not be sorted or unique.
 	 * @param count The count of `indexes`.
 	 * @return The intialized IndexSet, or `NULL` on error.
 	 * @memberof IndexSet
 	 */
 	IndexSet *(*initWithIndexes)(IndexSet *self, size_t *indexes, size_t count);
+
+	/**
+	 * @fn IndexSet *IndexSet::initWithIndexesInRange(IndexSet *self, const Range range)
+	 * @brief Initializes this IndexSet with the indexes in `range`.
+	 * @param self The IndexSet.
+	 * @param range The Range of indexes.
+	 * @return The intialized IndexSet, or `NULL` on error.
+	 * @memberof IndexSet
+	 */
+	IndexSet *(*initWithIndexesInRange)(IndexSet *self, const Range range);
+
+	/**
+	 * @fn IndexSet *IndexSet::initWithIndexSet(IndexSet *self, const IndexSet *indexSet)
+	 * @brief Initializes this IndexSet with the indexes of `indexSet`.
+	 * @param self The IndexSet.
+	 * @param indexSet An IndexSet.
+	 * @return The intialized IndexSet, or `NULL` on error.
+	 * @memberof IndexSet
+	 */
+	IndexSet *(*initWithIndexSet)(IndexSet *self, const IndexSet *indexSet);
+
+	/**
+	 * @fn IndexSet *IndexSet::intersectionWithIndexSet(const IndexSet *self, const IndexSet *indexSet)
+	 * @param self The IndexSet.
+	 * @param indexSet The IndexSet to intersect.
+	 * @return A new IndexSet containing the indexes in both this IndexSet and `indexSet`.
+	 * @memberof IndexSet
+	 */
+	IndexSet *(*intersectionWithIndexSet)(const IndexSet *self, const IndexSet *indexSet);
+
+	/**
+	 * @fn MutableIndexSet *IndexSet::mutableCopy(const IndexSet *self)
+	 * @param self The IndexSet.
+	 * @return A MutableIndexSet with the contents of this IndexSet.
+	 * @memberof IndexSet
+	 */
+	MutableIndexSet *(*mutableCopy)(const IndexSet *self);
+
+	/**
+	 * @fn IndexSet *IndexSet::unionWithIndexSet(const IndexSet *self, const IndexSet *indexSet)
+	 * @param self The IndexSet.
+	 * @param indexSet The IndexSet to unite.
+	 * @return A new IndexSet containing the indexes in either this IndexSet or `indexSet`.
+	 * @memberof IndexSet
+	 */
+	IndexSet *(*unionWithIndexSet)(const IndexSet *self, const IndexSet *indexSet);
 };
 
 /**
@@ -109,4 +212,3 @@ struct IndexSetInterface {
  * @memberof IndexSet
  */
 OBJECTIVELY_EXPORT Class *_IndexSet(void);
-
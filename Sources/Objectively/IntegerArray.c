@@ -0,0 +1,399 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/Hash.h>
+#include <Objectively/IntegerArray.h>
+#include <Objectively/MutableArray.h>
+#include <Objectively/MutableIntegerArray.h>
+#include <Objectively/MutableString.h>
+#include <Objectively/Number.h>
+#include <Objectively/RadixSort.h>
+
+#define _Class _IntegerArray
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	IntegerArray *this = (IntegerArray *) self;
+
+	if (classof(this) == _IntegerArray()) {
+		return (Object *) retain((ident) this);
+	}
+
+	return (Object *) $(alloc(IntegerArray), initWithValues, this->values, this->count);
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	IntegerArray *this = (IntegerArray *) self;
+
+	free(this->values);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	const IntegerArray *this = (IntegerArray *) self;
+
+	MutableString *desc = mstr("[");
+
+	for (size_t i = 0; i < this->count; i++) {
+		$(desc, appendFormat, "%" PRId64, this->values[i]);
+
+		if (i < this->count - 1) {
+			$(desc, appendCharacters, ", ");
+		}
+	}
+
+	$(desc, appendCharacters, "]");
+	return (String *) desc;
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	const IntegerArray *this = (IntegerArray *) self;
+
+	int hash = HASH_SEED;
+	hash = HashForInteger(hash, this->count);
+
+	const Range range = { 0, this->count * sizeof(int64_t) };
+	hash = HashForBytes(hash, (uint8_t *) this->values, range);
+
+	return hash;
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, _IntegerArray())) {
+
+		const IntegerArray *this = (IntegerArray *) self;
+		const IntegerArray *that = (IntegerArray *) other;
+
+		if (this->count == that->count) {
+			return this->count == 0 || memcmp(this->values, that->values, this->count * sizeof(int64_t)) == 0;
+		}
+	}
+
+	return false;
+}
+
+#pragma mark - IntegerArray
+
+/**
+ * @fn Array *IntegerArray::array(const IntegerArray *self)
+ * @memberof IntegerArray
+ */
+static Array *array(const IntegerArray *self) {
+
+	MutableArray *array = $(alloc(MutableArray), initWithCapacity, self->count);
+
+	for (size_t i = 0; i < self->count; i++) {
+
+		Number *number = $$(Number, numberWithValue, (double) self->values[i]);
+
+		$(array, addObject, number);
+
+		release(number);
+	}
+
+	return (Array *) array;
+}
+
+/**
+ * @fn int64_t IntegerArray::dot(const IntegerArray *self, const IntegerArray *other)
+ * @memberof IntegerArray
+ */
+static int64_t dot(const IntegerArray *self, const IntegerArray *other) {
+
+	assert(other);
+	assert(self->count == other->count);
+
+	const int64_t *a = self->values, *b = other->values;
+
+	uint64_t dot = 0;
+
+	for (size_t i = 0; i < self->count; i++) {
+		dot += (uint64_t) a[i] * (uint64_t) b[i];
+	}
+
+	return (int64_t) dot;
+}
+
+/**
+ * @fn IntegerArray *IntegerArray::initWithArray(IntegerArray *self, const Array *array)
+ * @memberof IntegerArray
+ */
+static IntegerArray *initWithArray(IntegerArray *self, const Array *array) {
+
+	assert(array);
+
+	self = (IntegerArray *) super(Object, self, init);
+	if (self) {
+
+		self->count = array->count;
+		if (self->count) {
+
+			self->values = malloc(self->count * sizeof(int64_t));
+			assert(self->values);
+
+			for (size_t i = 0; i < self->count; i++) {
+				const Number *number = cast(Number, array->elements[i]);
+				self->values[i] = (int64_t) number->value;
+			}
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn IntegerArray *IntegerArray::initWithValues(IntegerArray *self, const int64_t *values, size_t count)
+ * @memberof IntegerArray
+ */
+static IntegerArray *initWithValues(IntegerArray *self, const int64_t *values, size_t count) {
+
+	self = (IntegerArray *) super(Object, self, init);
+	if (self) {
+
+		self->count = count;
+		if (self->count) {
+			assert(values);
+
+			self->values = malloc(self->count * sizeof(int64_t));
+			assert(self->values);
+
+			memcpy(self->values, values, self->count * sizeof(int64_t));
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn IntegerArray *IntegerArray::integerArrayWithValues(const int64_t *values, size_t count)
+ * @memberof IntegerArray
+ */
+static IntegerArray *integerArrayWithValues(const int64_t *values, size_t count) {
+
+	return $(alloc(IntegerArray), initWithValues, values, count);
+}
+
+/**
+ * @fn int64_t IntegerArray::maximum(const IntegerArray *self)
+ * @memberof IntegerArray
+ */
+static int64_t maximum(const IntegerArray *self) {
+
+	assert(self->count);
+
+	int64_t max = self->values[0];
+
+	for (size_t i = 1; i < self->count; i++) {
+		max = self->values[i] > max ? self->values[i] : max;
+	}
+
+	return max;
+}
+
+/**
+ * @fn double IntegerArray::mean(const IntegerArray *self)
+ * @memberof IntegerArray
+ */
+static double mean(const IntegerArray *self) {
+
+	if (self->count) {
+		return (double) $(self, sum) / self->count;
+	}
+
+	return 0.0;
+}
+
+/**
+ * @fn int64_t IntegerArray::minimum(const IntegerArray *self)
+ * @memberof IntegerArray
+ */
+static int64_t minimum(const IntegerArray *self) {
+
+	assert(self->count);
+
+	int64_t min = self->values[0];
+
+	for (size_t i = 1; i < self->count; i++) {
+		min = self->values[i] < min ? self->values[i] : min;
+	}
+
+	return min;
+}
+
+/**
+ * @fn MutableIntegerArray *IntegerArray::mutableCopy(const IntegerArray *self)
+ * @memberof IntegerArray
+ */
+static MutableIntegerArray *mutableCopy(const IntegerArray *self) {
+
+	MutableIntegerArray *copy = $(alloc(MutableIntegerArray), initWithCapacity, self->count);
+	assert(copy);
+
+	$(copy, addValues, self->values, self->count);
+
+	return copy;
+}
+
+/**
+ * @fn IntegerArray *IntegerArray::prefixSum(const IntegerArray *self)
+ * @memberof IntegerArray
+ */
+static IntegerArray *prefixSum(const IntegerArray *self) {
+
+	IntegerArray *prefixSum = $(alloc(IntegerArray), initWithValues, self->values, self->count);
+	assert(prefixSum);
+
+	uint64_t sum = 0;
+
+	for (size_t i = 0; i < prefixSum->count; i++) {
+		sum += (uint64_t) prefixSum->values[i];
+		prefixSum->values[i] = (int64_t) sum;
+	}
+
+	return prefixSum;
+}
+
+/**
+ * @fn IntegerArray *IntegerArray::sortedArray(const IntegerArray *self)
+ * @memberof IntegerArray
+ */
+static IntegerArray *sortedArray(const IntegerArray *self) {
+
+	IntegerArray *sorted = $(alloc(IntegerArray), initWithValues, self->values, self->count);
+	assert(sorted);
+
+	RadixSortIntegers(sorted->values, sorted->count);
+
+	return sorted;
+}
+
+/**
+ * @fn int64_t IntegerArray::sum(const IntegerArray *self)
+ * @memberof IntegerArray
+ */
+static int64_t sum(const IntegerArray *self) {
+
+	uint64_t sum = 0;
+
+	for (size_t i = 0; i < self->count; i++) {
+		sum += (uint64_t) self->values[i];
+	}
+
+	return (int64_t) sum;
+}
+
+/**
+ * @fn int64_t IntegerArray::valueAtIndex(const IntegerArray *self, size_t index)
+ * @memberof IntegerArray
+ */
+static int64_t valueAtIndex(const IntegerArray *self, size_t index) {
+
+	assert(index < self->count);
+
+	return self->values[index];
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->description = description;
+	object->hash = hash;
+	object->isEqual = isEqual;
+
+	IntegerArrayInterface *integerArray = (IntegerArrayInterface *) clazz->def->interface;
+
+	integerArray->array = array;
+	integerArray->dot = dot;
+	integerArray->initWithArray = initWithArray;
+	integerArray->initWithValues = initWithValues;
+	integerArray->integerArrayWithValues = integerArrayWithValues;
+	integerArray->maximum = maximum;
+	integerArray->mean = mean;
+	integerArray->minimum = minimum;
+	integerArray->mutableCopy = mutableCopy;
+	integerArray->prefixSum = prefixSum;
+	integerArray->sortedArray = sortedArray;
+	integerArray->sum = sum;
+	integerArray->valueAtIndex = valueAtIndex;
+}
+
+/**
+ * @fn Class *IntegerArray::_IntegerArray(void)
+ * @memberof IntegerArray
+ */
+Class *_IntegerArray(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "IntegerArray";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(IntegerArray);
+		clazz.interfaceOffset = offsetof(IntegerArray, interface);
+		clazz.interfaceSize = sizeof(IntegerArrayInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
@@ -0,0 +1,202 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+
+/**
+ * @file
+ * @brief Immutable contiguous arrays of 64 bit integers.
+ */
+
+typedef struct IntegerArray IntegerArray;
+typedef struct IntegerArrayInterface IntegerArrayInterface;
+
+/**
+ * @brief Immutable contiguous arrays of 64 bit integers.
+ * @details Unlike an Array of Number, values are stored inline, without per-element allocations,
+ * and arithmetic over them is performed in tight loops suitable for vectorization.
+ * @extends Object
+ * @ingroup Collections
+ */
+struct IntegerArray {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	IntegerArrayInterface *interface;
+
+	/**
+	 * @brief The values.
+	 */
+	int64_t *values;
+
+	/**
+	 * @brief The count of values.
+	 */
+	size_t count;
+};
+
+typedef struct MutableIntegerArray MutableIntegerArray;
+
+/**
+ * @brief The IntegerArray interface.
+ */
+struct IntegerArrayInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn Array *IntegerArray::array(const IntegerArray *self)
+	 * @param self The IntegerArray.
+	 * @return An Array of Number containing the values of this IntegerArray.
+	 * @remarks Number is backed by a `double`, so values beyond 2^53 lose precision.
+	 * @memberof IntegerArray
+	 */
+	Array *(*array)(const IntegerArray *self);
+
+	/**
+	 * @fn int64_t IntegerArray::dot(const IntegerArray *self, const IntegerArray *other)
+	 * @param self The IntegerArray.
+	 * @param other An IntegerArray of the same count.
+	 * @return The dot product of this IntegerArray and `other`.
+	 * @memberof IntegerArray
+	 */
+	int64_t (*dot)(const IntegerArray *self, const IntegerArray *other);
+
+	/**
+	 * @fn IntegerArray *IntegerArray::initWithArray(IntegerArray *self, const Array *array)
+	 * @brief Initializes this IntegerArray with the values of an Array of Number.
+	 * @param self The IntegerArray.
+	 * @param array An Array of Number.
+	 * @return The initialized IntegerArray, or `NULL` on error.
+	 * @memberof IntegerArray
+	 */
+	IntegerArray *(*initWithArray)(IntegerArray *self, const Array *array);
+
+	/**
+	 * @fn IntegerArray *IntegerArray::initWithValues(IntegerArray *self, const int64_t *values, size_t count)
+	 * @brief Initializes this IntegerArray by copying `count` of `values`.
+	 * @param self The IntegerArray.
+	 * @param values The values.
+	 * @param count The count of `values` to copy.
+	 * @return The initialized IntegerArray, or `NULL` on error.
+	 * @memberof IntegerArray
+	 */
+	IntegerArray *(*initWithValues)(IntegerArray *self, const int64_t *values, size_t count);
+
+	/**
+	 * @static
+	 * @fn IntegerArray *IntegerArray::integerArrayWithValues(const int64_t *values, size_t count)
+	 * @brief Returns a new IntegerArray by copying `count` of `values`.
+	 * @param values The values.
+	 * @param count The count of `values` to copy.
+	 * @return The new IntegerArray, or `NULL` on error.
+	 * @memberof IntegerArray
+	 */
+	IntegerArray *(*integerArrayWithValues)(const int64_t *values, size_t count);
+
+	/**
+	 * @fn int64_t IntegerArray::maximum(const IntegerArray *self)
+	 * @param self The IntegerArray, which must not be empty.
+	 * @return The greatest value in this IntegerArray.
+	 * @memberof IntegerArray
+	 */
+	int64_t (*maximum)(const IntegerArray *self);
+
+	/**
+	 * @fn double IntegerArray::mean(const IntegerArray *self)
+	 * @param self The IntegerArray.
+	 * @return The arithmetic mean of the values in this IntegerArray, or `0.0` if it is empty.
+	 * @memberof IntegerArray
+	 */
+	double (*mean)(const IntegerArray *self);
+
+	/**
+	 * @fn int64_t IntegerArray::minimum(const IntegerArray *self)
+	 * @param self The IntegerArray, which must not be empty.
+	 * @return The least value in this IntegerArray.
+	 * @memberof IntegerArray
+	 */
+	int64_t (*minimum)(const IntegerArray *self);
+
+	/**
+	 * @fn MutableIntegerArray *IntegerArray::mutableCopy(const IntegerArray *self)
+	 * @param self The IntegerArray.
+	 * @return A MutableIntegerArray with the contents of this IntegerArray.
+	 * @memberof IntegerArray
+	 */
+	MutableIntegerArray *(*mutableCopy)(const IntegerArray *self);
+
+	/**
+	 * @fn IntegerArray *IntegerArray::prefixSum(const IntegerArray *self)
+	 * @param self The IntegerArray.
+	 * @return A new IntegerArray whose value at each index is the sum of this IntegerArray's
+	 * values up to and including that index.
+	 * @memberof IntegerArray
+	 */
+	IntegerArray *(*prefixSum)(const IntegerArray *self);
+
+	/**
+	 * @fn IntegerArray *IntegerArray::sortedArray(const IntegerArray *self)
+	 * @param self The IntegerArray.
+	 * @return A new IntegerArray with the values of this IntegerArray in ascending order.
+	 * @memberof IntegerArray
+	 */
+	IntegerArray *(*sortedArray)(const IntegerArray *self);
+
+	/**
+	 * @fn int64_t IntegerArray::sum(const IntegerArray *self)
+	 * @param self The IntegerArray.
+	 * @return The sum of the values in this IntegerArray.
+	 * @memberof IntegerArray
+	 */
+	int64_t (*sum)(const IntegerArray *self);
+
+	/**
+	 * @fn int64_t IntegerArray::valueAtIndex(const IntegerArray *self, size_t index)
+	 * @param self The IntegerArray.
+	 * @param index The index of the desired value.
+	 * @return The value at the specified index.
+	 * @memberof IntegerArray
+	 */
+	int64_t (*valueAtIndex)(const IntegerArray *self, size_t index);
+};
+
+/**
+ * @fn Class *IntegerArray::_IntegerArray(void)
+ * @brief The IntegerArray archetype.
+ * @return The IntegerArray Class.
+ * @memberof IntegerArray
+ */
+OBJECTIVELY_EXPORT Class *_IntegerArray(void);
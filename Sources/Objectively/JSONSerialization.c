@@ -29,6 +29,7 @@
 #include <Objectively/JSONSerialization.h>
 #include <Objectively/MutableData.h>
 #include <Objectively/MutableDictionary.h>
+#include <Objectively/MutableString.h>
 #include <Objectively/MutableArray.h>
 #include <Objectively/Null.h>
 #include <Objectively/Number.h>
@@ -92,9 +93,10 @@ static void writeString(JSONWriter *writer, const String *string) {
  */
 static void writeNumber(JSONWriter *writer, const Number *number) {
 
-	String *string = $(alloc(String), initWithFormat, "%.5f", number->value);
+	MutableString *string = $(alloc(MutableString), init);
 
-	$(writer->data, appendBytes, (uint8_t *) string->chars, string->length);
+	$(string, appendDouble, number->value, 5);
+	$(writer->data, appendBytes, (uint8_t *) string->string.chars, string->string.length);
 
 	release(string);
 }
@@ -35,6 +35,7 @@
 #endif
 
 #include <Objectively/Log.h>
+#include <Objectively/MutableString.h>
 
 #define _Class _Log
 
@@ -172,34 +173,39 @@ static void _log(const Log *self, LogLevel level, const char *fmt, va_list args)
 	char buffer[128];
 	strftime(buffer, sizeof(buffer), self->format, localDate);
 
-	char *c = buffer;
+	MutableString *line = $(alloc(MutableString), initWithCapacity, 256);
+
+	const char *c = buffer;
 	while (*c) {
 
-		if (*c == '%') {
-			_Bool token = true;
-
-			if (*(c + 1) == 'n') {
-				fputs(self->name, self->file);
-			} else if (*(c + 1) == 'l') {
-				fputs(levels[level], self->file);
-			} else if (*(c + 1) == 'm') {
-				vfprintf(self->file, fmt, args);
-			} else {
-				token = false;
-			}
-
-			if (token) {
-				c++;
-				c++;
-				continue;
-			}
+		const char *token = strchr(c, '%');
+		if (token == NULL) {
+			$(line, appendCharacters, c);
+			break;
+		}
+
+		$(line, appendBytes, (const uint8_t *) c, token - c);
+
+		if (*(token + 1) == 'n') {
+			$(line, appendCharacters, self->name);
+		} else if (*(token + 1) == 'l') {
+			$(line, appendCharacters, levels[level]);
+		} else if (*(token + 1) == 'm') {
+			$(line, appendVaList, fmt, args);
+		} else {
+			$(line, appendBytes, (const uint8_t *) token, 1);
+			c = token + 1;
+			continue;
 		}
 
-		fputc(*c, self->file);
-		c++;
+		c = token + 2;
 	}
 
-	fputc('\n', self->file);
+	$(line, appendBytes, (const uint8_t *) "\n", 1);
+
+	fwrite(line->string.chars, 1, line->string.length, self->file);
+	release(line);
+
 	fflush(self->file);
 }
 
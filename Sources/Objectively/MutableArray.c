@@ -31,6 +31,46 @@
 
 #define ARRAY_CHUNK_SIZE 64
 
+/**
+ * @brief Ensures that this MutableArray exclusively owns its elements, ahead of a mutation.
+ */
+static void unshare(MutableArray *self) {
+
+	Array *array = (Array *) self;
+
+	if (array->shared) {
+
+		if (__sync_add_and_fetch(array->shared, 0) > 1) {
+
+			self->capacity = max(self->capacity, array->count + ARRAY_CHUNK_SIZE);
+
+			ident *elements = calloc(self->capacity, sizeof(ident));
+			assert(elements);
+
+			for (size_t i = 0; i < array->count; i++) {
+				elements[i] = retain(array->elements[i]);
+			}
+
+			if (__sync_add_and_fetch(array->shared, -1) == 0) {
+
+				for (size_t i = 0; i < array->count; i++) {
+					release(array->elements[i]);
+				}
+
+				free(array->elements);
+				free((long *) array->shared);
+			}
+
+			array->elements = elements;
+		} else {
+			self->capacity = max(self->capacity, array->count);
+			free((long *) array->shared);
+		}
+
+		array->shared = NULL;
+	}
+}
+
 #pragma mark - Object
 
 /**
@@ -40,9 +80,7 @@ static Object *copy(const Object *self) {
 
 	Array *this = (Array *)  self;
 
-	MutableArray *copy = $(alloc(MutableArray), initWithCapacity, this->count);
-
-	$(copy, addObjectsFromArray, this);
+	MutableArray *copy = (MutableArray *) $((Array *) alloc(MutableArray), initWithArray, this);
 
 	return (Object *) copy;
 }
@@ -55,6 +93,8 @@ static Object *copy(const Object *self) {
  */
 static void addObject(MutableArray *self, const ident obj) {
 
+	unshare(self);
+
 	Array *array = (Array *) self;
 	if (array->count == self->capacity) {
 
@@ -188,6 +228,20 @@ static void insertObjectAtIndex(MutableArray *self, ident obj, size_t index) {
  */
 static void removeAllObjects(MutableArray *self) {
 
+	Array *array = (Array *) self;
+
+	if (array->shared) {
+
+		if (__sync_add_and_fetch(array->shared, -1) == 0) {
+			free((long *) array->shared);
+			array->shared = NULL;
+		} else {
+			array->shared = NULL;
+			array->elements = NULL;
+			array->count = self->capacity = 0;
+		}
+	}
+
 	for (size_t i = self->array.count; i > 0; i--) {
 		$(self, removeObjectAtIndex, i - 1);
 	}
@@ -224,6 +278,8 @@ static void removeObjectAtIndex(MutableArray *self, size_t index) {
 
 	assert(index < self->array.count);
 
+	unshare(self);
+
 	release(self->array.elements[index]);
 
 	for (size_t i = index; i < self->array.count - 1; i++) {
@@ -241,6 +297,8 @@ static void setObjectAtIndex(MutableArray *self, const ident obj, size_t index)
 
 	assert(index < self->array.count);
 
+	unshare(self);
+
 	retain(obj);
 
 	release(self->array.elements[index]);
@@ -263,6 +321,9 @@ static int _sort(void *data, const void *a, const void *b) {
  * @memberof MutableArray
  */
 static void sort(MutableArray *self, Comparator comparator) {
+
+	unshare(self);
+
 	qsort_r(self->array.elements, self->array.count, sizeof(ident), comparator, _sort);
 }
 
@@ -280,6 +341,9 @@ static int _sort(void *data, const void *a, const void *b) {
  * @memberof MutableArray
  */
 static void sort(MutableArray *self, Comparator comparator) {
+
+	unshare(self);
+
 	qsort_s(self->array.elements, self->array.count, sizeof(ident), _sort, comparator);
 }
 
@@ -297,6 +361,9 @@ static int _sort(const void *a, const void *b, void *data) {
  * @memberof MutableArray
  */
 static void sort(MutableArray *self, Comparator comparator) {
+
+	unshare(self);
+
 	qsort_r(self->array.elements, self->array.count, sizeof(ident), _sort, comparator);
 }
 
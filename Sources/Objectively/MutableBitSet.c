@@ -0,0 +1,313 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/MutableBitSet.h>
+
+#define _Class _MutableBitSet
+
+/**
+ * @brief Ensures that this MutableBitSet has at least `numberOfWords` words.
+ */
+static void reserve(MutableBitSet *self, size_t numberOfWords) {
+
+	BitSet *bitSet = (BitSet *) self;
+
+	if (numberOfWords > self->capacity) {
+
+		const size_t capacity = max(numberOfWords, self->capacity << 1);
+
+		bitSet->words = realloc(bitSet->words, capacity * sizeof(uint64_t));
+		assert(bitSet->words);
+
+		self->capacity = capacity;
+	}
+
+	if (numberOfWords > bitSet->numberOfWords) {
+		memset(bitSet->words + bitSet->numberOfWords, 0, (numberOfWords - bitSet->numberOfWords) * sizeof(uint64_t));
+		bitSet->numberOfWords = numberOfWords;
+	}
+}
+
+/**
+ * @brief Sets or clears the bits in `range`, one word at a time.
+ */
+static void fill(BitSet *bitSet, const Range range, _Bool value) {
+
+	const size_t e = min(range.location + range.length, bitSet->numberOfWords * BITSET_WORD_BITS);
+
+	for (size_t i = range.location; i < e; ) {
+
+		const size_t bit = i % BITSET_WORD_BITS;
+		const size_t n = min(BITSET_WORD_BITS - bit, e - i);
+
+		const uint64_t mask = n == BITSET_WORD_BITS ? ~0ULL : ((1ULL << n) - 1) << bit;
+
+		if (value) {
+			bitSet->words[i / BITSET_WORD_BITS] |= mask;
+		} else {
+			bitSet->words[i / BITSET_WORD_BITS] &= ~mask;
+		}
+
+		i += n;
+	}
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	return (Object *) $((BitSet *) self, mutableCopy);
+}
+
+#pragma mark - MutableBitSet
+
+/**
+ * @fn void MutableBitSet::addIndex(MutableBitSet *self, size_t index)
+ * @memberof MutableBitSet
+ */
+static void addIndex(MutableBitSet *self, size_t index) {
+
+	reserve(self, index / BITSET_WORD_BITS + 1);
+
+	self->bitSet.words[index / BITSET_WORD_BITS] |= 1ULL << (index % BITSET_WORD_BITS);
+}
+
+/**
+ * @fn void MutableBitSet::addIndexesInRange(MutableBitSet *self, const Range range)
+ * @memberof MutableBitSet
+ */
+static void addIndexesInRange(MutableBitSet *self, const Range range) {
+
+	assert(range.location >= 0);
+
+	if (range.length) {
+		reserve(self, (range.location + range.length + BITSET_WORD_BITS - 1) / BITSET_WORD_BITS);
+		fill((BitSet *) self, range, true);
+	}
+}
+
+/**
+ * @fn void MutableBitSet::andBitSet(MutableBitSet *self, const BitSet *bitSet)
+ * @memberof MutableBitSet
+ */
+static void andBitSet(MutableBitSet *self, const BitSet *bitSet) {
+
+	assert(bitSet);
+
+	if (bitSet == (BitSet *) self) {
+		return;
+	}
+
+	uint64_t *restrict words = self->bitSet.words;
+	const uint64_t *restrict other = bitSet->words;
+
+	const size_t count = min(self->bitSet.numberOfWords, bitSet->numberOfWords);
+	for (size_t i = 0; i < count; i++) {
+		words[i] &= other[i];
+	}
+
+	self->bitSet.numberOfWords = count;
+}
+
+/**
+ * @fn void MutableBitSet::andNotBitSet(MutableBitSet *self, const BitSet *bitSet)
+ * @memberof MutableBitSet
+ */
+static void andNotBitSet(MutableBitSet *self, const BitSet *bitSet) {
+
+	assert(bitSet);
+
+	if (bitSet == (BitSet *) self) {
+		$(self, removeAllIndexes);
+		return;
+	}
+
+	uint64_t *restrict words = self->bitSet.words;
+	const uint64_t *restrict other = bitSet->words;
+
+	const size_t count = min(self->bitSet.numberOfWords, bitSet->numberOfWords);
+	for (size_t i = 0; i < count; i++) {
+		words[i] &= ~other[i];
+	}
+}
+
+/**
+ * @fn MutableBitSet *MutableBitSet::init(MutableBitSet *self)
+ * @memberof MutableBitSet
+ */
+static MutableBitSet *init(MutableBitSet *self) {
+
+	return $(self, initWithCapacity, 0);
+}
+
+/**
+ * @fn MutableBitSet *MutableBitSet::initWithCapacity(MutableBitSet *self, size_t capacity)
+ * @memberof MutableBitSet
+ */
+static MutableBitSet *initWithCapacity(MutableBitSet *self, size_t capacity) {
+
+	self = (MutableBitSet *) super(Object, self, init);
+	if (self) {
+
+		self->capacity = (capacity + BITSET_WORD_BITS - 1) / BITSET_WORD_BITS;
+		if (self->capacity) {
+
+			self->bitSet.words = calloc(self->capacity, sizeof(uint64_t));
+			assert(self->bitSet.words);
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn void MutableBitSet::orBitSet(MutableBitSet *self, const BitSet *bitSet)
+ * @memberof MutableBitSet
+ */
+static void orBitSet(MutableBitSet *self, const BitSet *bitSet) {
+
+	assert(bitSet);
+
+	if (bitSet == (BitSet *) self) {
+		return;
+	}
+
+	reserve(self, bitSet->numberOfWords);
+
+	uint64_t *restrict words = self->bitSet.words;
+	const uint64_t *restrict other = bitSet->words;
+
+	const size_t count = bitSet->numberOfWords;
+	for (size_t i = 0; i < count; i++) {
+		words[i] |= other[i];
+	}
+}
+
+/**
+ * @fn void MutableBitSet::removeAllIndexes(MutableBitSet *self)
+ * @memberof MutableBitSet
+ */
+static void removeAllIndexes(MutableBitSet *self) {
+
+	self->bitSet.numberOfWords = 0;
+}
+
+/**
+ * @fn void MutableBitSet::removeIndex(MutableBitSet *self, size_t index)
+ * @memberof MutableBitSet
+ */
+static void removeIndex(MutableBitSet *self, size_t index) {
+
+	const size_t word = index / BITSET_WORD_BITS;
+	if (word < self->bitSet.numberOfWords) {
+		self->bitSet.words[word] &= ~(1ULL << (index % BITSET_WORD_BITS));
+	}
+}
+
+/**
+ * @fn void MutableBitSet::removeIndexesInRange(MutableBitSet *self, const Range range)
+ * @memberof MutableBitSet
+ */
+static void removeIndexesInRange(MutableBitSet *self, const Range range) {
+
+	assert(range.location >= 0);
+
+	fill((BitSet *) self, range, false);
+}
+
+/**
+ * @fn void MutableBitSet::xorBitSet(MutableBitSet *self, const BitSet *bitSet)
+ * @memberof MutableBitSet
+ */
+static void xorBitSet(MutableBitSet *self, const BitSet *bitSet) {
+
+	assert(bitSet);
+
+	if (bitSet == (BitSet *) self) {
+		$(self, removeAllIndexes);
+		return;
+	}
+
+	reserve(self, bitSet->numberOfWords);
+
+	uint64_t *restrict words = self->bitSet.words;
+	const uint64_t *restrict other = bitSet->words;
+
+	const size_t count = bitSet->numberOfWords;
+	for (size_t i = 0; i < count; i++) {
+		words[i] ^= other[i];
+	}
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ObjectInterface *) clazz->def->interface)->copy = copy;
+
+	MutableBitSetInterface *mutableBitSet = (MutableBitSetInterface *) clazz->def->interface;
+
+	mutableBitSet->addIndex = addIndex;
+	mutableBitSet->addIndexesInRange = addIndexesInRange;
+	mutableBitSet->andBitSet = andBitSet;
+	mutableBitSet->andNotBitSet = andNotBitSet;
+	mutableBitSet->init = init;
+	mutableBitSet->initWithCapacity = initWithCapacity;
+	mutableBitSet->orBitSet = orBitSet;
+	mutableBitSet->removeAllIndexes = removeAllIndexes;
+	mutableBitSet->removeIndex = removeIndex;
+	mutableBitSet->removeIndexesInRange = removeIndexesInRange;
+	mutableBitSet->xorBitSet = xorBitSet;
+}
+
+/**
+ * @fn Class *MutableBitSet::_MutableBitSet(void)
+ * @memberof MutableBitSet
+ */
+Class *_MutableBitSet(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "MutableBitSet";
+		clazz.superclass = _BitSet();
+		clazz.instanceSize = sizeof(MutableBitSet);
+		clazz.interfaceOffset = offsetof(MutableBitSet, interface);
+		clazz.interfaceSize = sizeof(MutableBitSetInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
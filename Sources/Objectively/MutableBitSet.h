@@ -0,0 +1,178 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/BitSet.h>
+
+/**
+ * @file
+ * @brief Mutable dense sets of indexes.
+ */
+
+typedef struct MutableBitSetInterface MutableBitSetInterface;
+
+/**
+ * @brief Mutable dense sets of indexes.
+ * @details MutableBitSets grow as indexes are added. The bulk operations process a full word
+ * per iteration, in loops that the compiler can vectorize.
+ * @extends BitSet
+ * @ingroup Collections
+ */
+struct MutableBitSet {
+
+	/**
+	 * @brief The superclass.
+	 */
+	BitSet bitSet;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	MutableBitSetInterface *interface;
+
+	/**
+	 * @brief The capacity of `words`.
+	 * @private
+	 */
+	size_t capacity;
+};
+
+/**
+ * @brief The MutableBitSet interface.
+ */
+struct MutableBitSetInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	BitSetInterface bitSetInterface;
+
+	/**
+	 * @fn void MutableBitSet::addIndex(MutableBitSet *self, size_t index)
+	 * @brief Adds the specified index to this MutableBitSet.
+	 * @param self The MutableBitSet.
+	 * @param index The index.
+	 * @memberof MutableBitSet
+	 */
+	void (*addIndex)(MutableBitSet *self, size_t index);
+
+	/**
+	 * @fn void MutableBitSet::addIndexesInRange(MutableBitSet *self, const Range range)
+	 * @brief Adds the indexes in `range` to this MutableBitSet.
+	 * @param self The MutableBitSet.
+	 * @param range The Range of indexes.
+	 * @memberof MutableBitSet
+	 */
+	void (*addIndexesInRange)(MutableBitSet *self, const Range range);
+
+	/**
+	 * @fn void MutableBitSet::andBitSet(MutableBitSet *self, const BitSet *bitSet)
+	 * @brief Removes the indexes of this MutableBitSet that are not in `bitSet`.
+	 * @param self The MutableBitSet.
+	 * @param bitSet A BitSet.
+	 * @memberof MutableBitSet
+	 */
+	void (*andBitSet)(MutableBitSet *self, const BitSet *bitSet);
+
+	/**
+	 * @fn void MutableBitSet::andNotBitSet(MutableBitSet *self, const BitSet *bitSet)
+	 * @brief Removes the indexes of `bitSet` from this MutableBitSet.
+	 * @param self The MutableBitSet.
+	 * @param bitSet A BitSet.
+	 * @memberof MutableBitSet
+	 */
+	void (*andNotBitSet)(MutableBitSet *self, const BitSet *bitSet);
+
+	/**
+	 * @fn MutableBitSet *MutableBitSet::init(MutableBitSet *self)
+	 * @brief Initializes this MutableBitSet.
+	 * @param self The MutableBitSet.
+	 * @return The initialized MutableBitSet, or `NULL` on error.
+	 * @memberof MutableBitSet
+	 */
+	MutableBitSet *(*init)(MutableBitSet *self);
+
+	/**
+	 * @fn MutableBitSet *MutableBitSet::initWithCapacity(MutableBitSet *self, size_t capacity)
+	 * @brief Initializes this MutableBitSet with room for `capacity` indexes.
+	 * @param self The MutableBitSet.
+	 * @param capacity The initial capacity, in indexes.
+	 * @return The initialized MutableBitSet, or `NULL` on error.
+	 * @memberof MutableBitSet
+	 */
+	MutableBitSet *(*initWithCapacity)(MutableBitSet *self, size_t capacity);
+
+	/**
+	 * @fn void MutableBitSet::orBitSet(MutableBitSet *self, const BitSet *bitSet)
+	 * @brief Adds the indexes of `bitSet` to this MutableBitSet.
+	 * @param self The MutableBitSet.
+	 * @param bitSet A BitSet.
+	 * @memberof MutableBitSet
+	 */
+	void (*orBitSet)(MutableBitSet *self, const BitSet *bitSet);
+
+	/**
+	 * @fn void MutableBitSet::removeAllIndexes(MutableBitSet *self)
+	 * @brief Removes all indexes from this MutableBitSet.
+	 * @param self The MutableBitSet.
+	 * @memberof MutableBitSet
+	 */
+	void (*removeAllIndexes)(MutableBitSet *self);
+
+	/**
+	 * @fn void MutableBitSet::removeIndex(MutableBitSet *self, size_t index)
+	 * @brief Removes the specified index from this MutableBitSet.
+	 * @param self The MutableBitSet.
+	 * @param index The index.
+	 * @memberof MutableBitSet
+	 */
+	void (*removeIndex)(MutableBitSet *self, size_t index);
+
+	/**
+	 * @fn void MutableBitSet::removeIndexesInRange(MutableBitSet *self, const Range range)
+	 * @brief Removes the indexes in `range` from this MutableBitSet.
+	 * @param self The MutableBitSet.
+	 * @param range The Range of indexes.
+	 * @memberof MutableBitSet
+	 */
+	void (*removeIndexesInRange)(MutableBitSet *self, const Range range);
+
+	/**
+	 * @fn void MutableBitSet::xorBitSet(MutableBitSet *self, const BitSet *bitSet)
+	 * @brief Toggles the indexes of `bitSet` in this MutableBitSet.
+	 * @param self The MutableBitSet.
+	 * @param bitSet A BitSet.
+	 * @memberof MutableBitSet
+	 */
+	void (*xorBitSet)(MutableBitSet *self, const BitSet *bitSet);
+};
+
+/**
+ * @fn Class *MutableBitSet::_MutableBitSet(void)
+ * @brief The MutableBitSet archetype.
+ * @return The MutableBitSet Class.
+ * @memberof MutableBitSet
+ */
+OBJECTIVELY_EXPORT Class *_MutableBitSet(void);
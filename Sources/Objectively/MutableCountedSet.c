@@ -0,0 +1,330 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/MutableCountedSet.h>
+
+#define _Class _MutableCountedSet
+
+#define MUTABLECOUNTEDSET_DEFAULT_CAPACITY 16
+
+/**
+ * @return The preferred entry index for `hash` in a table of `capacity` entries.
+ */
+static inline size_t bin(int hash, size_t capacity) {
+
+	uint32_t h = (uint32_t) hash;
+
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	h ^= h >> 13;
+
+	return h & (capacity - 1);
+}
+
+/**
+ * @brief Resizes the table of `set` to `capacity` entries, a power of two.
+ */
+static void resize(CountedSet *set, size_t capacity) {
+
+	CountedSetEntry *entries = set->entries;
+	const size_t oldCapacity = set->capacity;
+
+	set->entries = calloc(capacity, sizeof(CountedSetEntry));
+	assert(set->entries);
+
+	set->capacity = capacity;
+
+	for (size_t i = 0; i < oldCapacity; i++) {
+		if (entries[i].object) {
+
+			size_t j = bin(entries[i].hash, capacity);
+			while (set->entries[j].object) {
+				j = (j + 1) & (capacity - 1);
+			}
+
+			set->entries[j] = entries[i];
+		}
+	}
+
+	free(entries);
+}
+
+/**
+ * @brief Adds `count` occurrences of `obj`, whose hash is `hash`, to `set`.
+ */
+static void insert(CountedSet *set, const ident obj, int hash, size_t count) {
+
+	if ((set->count + 1) * 4 > set->capacity * 3) {
+		resize(set, max(set->capacity << 1, (size_t) MUTABLECOUNTEDSET_DEFAULT_CAPACITY));
+	}
+
+	const size_t mask = set->capacity - 1;
+
+	size_t i = bin(hash, set->capacity);
+	for (; set->entries[i].object; i = (i + 1) & mask) {
+
+		CountedSetEntry *entry = &set->entries[i];
+		if (entry->hash == hash) {
+			if (entry->object == obj || $((Object *) entry->object, isEqual, obj)) {
+				entry->count += count;
+				set->total += count;
+				return;
+			}
+		}
+	}
+
+	set->entries[i].object = retain(obj);
+	set->entries[i].hash = hash;
+	set->entries[i].count = count;
+
+	set->count++;
+	set->total += count;
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	return (Object *) $((CountedSet *) self, mutableCopy);
+}
+
+#pragma mark - MutableCountedSet
+
+/**
+ * @fn void MutableCountedSet::addObject(MutableCountedSet *self, const ident obj)
+ * @memberof MutableCountedSet
+ */
+static void addObject(MutableCountedSet *self, const ident obj) {
+	$$(MutableCountedSet, addObjectWithCount, self, obj, 1);
+}
+
+/**
+ * @fn void MutableCountedSet::addObjectWithCount(MutableCountedSet *self, const ident obj, size_t count)
+ * @memberof MutableCountedSet
+ */
+static void addObjectWithCount(MutableCountedSet *self, const ident obj, size_t count) {
+
+	assert(obj);
+
+	if (count) {
+		insert((CountedSet *) self, obj, $((Object *) obj, hash), count);
+	}
+}
+
+/**
+ * @fn void MutableCountedSet::addObjectsFromArray(MutableCountedSet *self, const Array *array)
+ * @memberof MutableCountedSet
+ */
+static void addObjectsFromArray(MutableCountedSet *self, const Array *array) {
+
+	if (array) {
+		for (size_t i = 0; i < array->count; i++) {
+			$$(MutableCountedSet, addObjectWithCount, self, array->elements[i], 1);
+		}
+	}
+}
+
+/**
+ * @fn void MutableCountedSet::addObjectsFromCountedSet(MutableCountedSet *self, const CountedSet *set)
+ * @memberof MutableCountedSet
+ */
+static void addObjectsFromCountedSet(MutableCountedSet *self, const CountedSet *set) {
+
+	if (set) {
+		for (size_t i = 0; i < set->capacity; i++) {
+
+			const CountedSetEntry *entry = &set->entries[i];
+			if (entry->object) {
+				insert((CountedSet *) self, entry->object, entry->hash, entry->count);
+			}
+		}
+	}
+}
+
+/**
+ * @fn MutableCountedSet *MutableCountedSet::countedSet(void)
+ * @memberof MutableCountedSet
+ */
+static MutableCountedSet *countedSet(void) {
+
+	return $(alloc(MutableCountedSet), init);
+}
+
+/**
+ * @fn MutableCountedSet *MutableCountedSet::init(MutableCountedSet *self)
+ * @memberof MutableCountedSet
+ */
+static MutableCountedSet *init(MutableCountedSet *self) {
+
+	return $(self, initWithCapacity, 0);
+}
+
+/**
+ * @fn MutableCountedSet *MutableCountedSet::initWithCapacity(MutableCountedSet *self, size_t capacity)
+ * @memberof MutableCountedSet
+ */
+static MutableCountedSet *initWithCapacity(MutableCountedSet *self, size_t capacity) {
+
+	self = (MutableCountedSet *) super(Object, self, init);
+	if (self) {
+		if (capacity) {
+
+			size_t size = MUTABLECOUNTEDSET_DEFAULT_CAPACITY;
+			while (size * 3 < capacity * 4) {
+				size <<= 1;
+			}
+
+			resize((CountedSet *) self, size);
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn void MutableCountedSet::removeAllObjects(MutableCountedSet *self)
+ * @memberof MutableCountedSet
+ */
+static void removeAllObjects(MutableCountedSet *self) {
+
+	CountedSet *set = (CountedSet *) self;
+
+	for (size_t i = 0; i < set->capacity; i++) {
+		release(set->entries[i].object);
+	}
+
+	if (set->capacity) {
+		memset(set->entries, 0, set->capacity * sizeof(CountedSetEntry));
+	}
+
+	set->count = set->total = 0;
+}
+
+/**
+ * @fn void MutableCountedSet::removeObject(MutableCountedSet *self, const ident obj)
+ * @memberof MutableCountedSet
+ */
+static void removeObject(MutableCountedSet *self, const ident obj) {
+
+	assert(obj);
+
+	CountedSet *set = (CountedSet *) self;
+
+	if (set->capacity == 0) {
+		return;
+	}
+
+	const size_t mask = set->capacity - 1;
+	const int hash = $((Object *) obj, hash);
+
+	size_t i = bin(hash, set->capacity);
+	for (; set->entries[i].object; i = (i + 1) & mask) {
+
+		CountedSetEntry *entry = &set->entries[i];
+		if (entry->hash == hash) {
+			if (entry->object == obj || $((Object *) entry->object, isEqual, obj)) {
+				break;
+			}
+		}
+	}
+
+	CountedSetEntry *entry = &set->entries[i];
+	if (entry->object == NULL) {
+		return;
+	}
+
+	set->total--;
+
+	if (--entry->count) {
+		return;
+	}
+
+	release(entry->object);
+	set->count--;
+
+	for (size_t j = (i + 1) & mask; set->entries[j].object; j = (j + 1) & mask) {
+
+		const size_t k = bin(set->entries[j].hash, set->capacity);
+
+		const _Bool stays = i <= j ? (i < k && k <= j) : (i < k || k <= j);
+		if (stays == false) {
+			set->entries[i] = set->entries[j];
+			i = j;
+		}
+	}
+
+	memset(&set->entries[i], 0, sizeof(CountedSetEntry));
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+
+	MutableCountedSetInterface *mutableCountedSet = (MutableCountedSetInterface *) clazz->def->interface;
+
+	mutableCountedSet->addObject = addObject;
+	mutableCountedSet->addObjectWithCount = addObjectWithCount;
+	mutableCountedSet->addObjectsFromArray = addObjectsFromArray;
+	mutableCountedSet->addObjectsFromCountedSet = addObjectsFromCountedSet;
+	mutableCountedSet->countedSet = countedSet;
+	mutableCountedSet->init = init;
+	mutableCountedSet->initWithCapacity = initWithCapacity;
+	mutableCountedSet->removeAllObjects = removeAllObjects;
+	mutableCountedSet->removeObject = removeObject;
+}
+
+/**
+ * @fn Class *MutableCountedSet::_MutableCountedSet(void)
+ * @memberof MutableCountedSet
+ */
+Class *_MutableCountedSet(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "MutableCountedSet";
+		clazz.superclass = _CountedSet();
+		clazz.instanceSize = sizeof(MutableCountedSet);
+		clazz.interfaceOffset = offsetof(MutableCountedSet, interface);
+		clazz.interfaceSize = sizeof(MutableCountedSetInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
@@ -0,0 +1,153 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/CountedSet.h>
+
+/**
+ * @file
+ * @brief Mutable counted sets (multisets).
+ */
+
+typedef struct MutableCountedSetInterface MutableCountedSetInterface;
+
+/**
+ * @brief Mutable counted sets (multisets).
+ * @extends CountedSet
+ * @ingroup Collections
+ */
+struct MutableCountedSet {
+
+	/**
+	 * @brief The superclass.
+	 */
+	CountedSet countedSet;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	MutableCountedSetInterface *interface;
+};
+
+/**
+ * @brief The MutableCountedSet interface.
+ */
+struct MutableCountedSetInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	CountedSetInterface countedSetInterface;
+
+	/**
+	 * @fn void MutableCountedSet::addObject(MutableCountedSet *self, const ident obj)
+	 * @brief Increments the occurrence count of the given Object.
+	 * @param self The MutableCountedSet.
+	 * @param obj The Object.
+	 * @memberof MutableCountedSet
+	 */
+	void (*addObject)(MutableCountedSet *self, const ident obj);
+
+	/**
+	 * @fn void MutableCountedSet::addObjectWithCount(MutableCountedSet *self, const ident obj, size_t count)
+	 * @brief Increments the occurrence count of the given Object by `count`.
+	 * @param self The MutableCountedSet.
+	 * @param obj The Object.
+	 * @param count The count to add.
+	 * @memberof MutableCountedSet
+	 */
+	void (*addObjectWithCount)(MutableCountedSet *self, const ident obj, size_t count);
+
+	/**
+	 * @fn void MutableCountedSet::addObjectsFromArray(MutableCountedSet *self, const Array *array)
+	 * @brief Counts each element of `array`.
+	 * @param self The MutableCountedSet.
+	 * @param array An Array.
+	 * @memberof MutableCountedSet
+	 */
+	void (*addObjectsFromArray)(MutableCountedSet *self, const Array *array);
+
+	/**
+	 * @fn void MutableCountedSet::addObjectsFromCountedSet(MutableCountedSet *self, const CountedSet *set)
+	 * @brief Merges `set` into this MutableCountedSet, summing the occurrence counts.
+	 * @param self The MutableCountedSet.
+	 * @param set A CountedSet.
+	 * @remarks This is intended for combining partial counts, e.g. from parallel aggregation.
+	 * @memberof MutableCountedSet
+	 */
+	void (*addObjectsFromCountedSet)(MutableCountedSet *self, const CountedSet *set);
+
+	/**
+	 * @static
+	 * @fn MutableCountedSet *MutableCountedSet::countedSet(void)
+	 * @return A new, empty MutableCountedSet.
+	 * @memberof MutableCountedSet
+	 */
+	MutableCountedSet *(*countedSet)(void);
+
+	/**
+	 * @fn MutableCountedSet *MutableCountedSet::init(MutableCountedSet *self)
+	 * @brief Initializes this MutableCountedSet.
+	 * @param self The MutableCountedSet.
+	 * @return The initialized MutableCountedSet, or `NULL` on error.
+	 * @memberof MutableCountedSet
+	 */
+	MutableCountedSet *(*init)(MutableCountedSet *self);
+
+	/**
+	 * @fn MutableCountedSet *MutableCountedSet::initWithCapacity(MutableCountedSet *self, size_t capacity)
+	 * @brief Initializes this MutableCountedSet with room for `capacity` distinct Objects.
+	 * @param self The MutableCountedSet.
+	 * @param capacity The expected count of distinct Objects.
+	 * @return The initialized MutableCountedSet, or `NULL` on error.
+	 * @memberof MutableCountedSet
+	 */
+	MutableCountedSet *(*initWithCapacity)(MutableCountedSet *self, size_t capacity);
+
+	/**
+	 * @fn void MutableCountedSet::removeAllObjects(MutableCountedSet *self)
+	 * @brief Removes all Objects from this MutableCountedSet.
+	 * @param self The MutableCountedSet.
+	 * @memberof MutableCountedSet
+	 */
+	void (*removeAllObjects)(MutableCountedSet *self);
+
+	/**
+	 * @fn void MutableCountedSet::removeObject(MutableCountedSet *self, const ident obj)
+	 * @brief Decrements the occurrence count of the given Object, removing it at zero.
+	 * @param self The MutableCountedSet.
+	 * @param obj The Object.
+	 * @memberof MutableCountedSet
+	 */
+	void (*removeObject)(MutableCountedSet *self, const ident obj);
+};
+
+/**
+ * @fn Class *MutableCountedSet::_MutableCountedSet(void)
+ * @brief The MutableCountedSet archetype.
+ * @return The MutableCountedSet Class.
+ * @memberof MutableCountedSet
+ */
+OBJECTIVELY_EXPORT Class *_MutableCountedSet(void);
@@ -0,0 +1,332 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/MutableArray.h>
+#include <Objectively/MutableDeque.h>
+
+#define _Class _MutableDeque
+
+#define DEQUE_MIN_CAPACITY 8
+
+/**
+ * @return The ring buffer index of the specified logical index of the given Deque.
+ */
+static inline size_t position(const Deque *deque, size_t index) {
+	return (deque->head + index) & (deque->capacity - 1);
+}
+
+/**
+ * @brief Copies the elements of the given Deque, in order, to `dest`.
+ */
+static void unwrap(const Deque *deque, ident *dest) {
+
+	if (deque->count == 0) {
+		return;
+	}
+
+	const size_t first = min(deque->count, deque->capacity - deque->head);
+
+	memcpy(dest, deque->elements + deque->head, first * sizeof(ident));
+	memcpy(dest + first, deque->elements, (deque->count - first) * sizeof(ident));
+}
+
+/**
+ * @brief Resizes the ring buffer of the given Deque to `capacity`, which must be a power of two.
+ */
+static void resize(Deque *deque, size_t capacity) {
+
+	assert(capacity >= deque->count);
+
+	ident *elements = calloc(capacity, sizeof(ident));
+	assert(elements);
+
+	unwrap(deque, elements);
+
+	free(deque->elements);
+
+	deque->elements = elements;
+	deque->capacity = capacity;
+	deque->head = 0;
+}
+
+/**
+ * @brief Ensures that there is room in this MutableDeque for one more Object, evicting the
+ * Object at the opposite end if it is bounded and full.
+ */
+static void reserve(MutableDeque *self, _Bool front) {
+
+	Deque *deque = (Deque *) self;
+
+	if (self->limit && deque->count == self->limit) {
+
+		if (front) {
+			release(deque->elements[position(deque, deque->count - 1)]);
+		} else {
+			release(deque->elements[deque->head]);
+			deque->head = position(deque, 1);
+		}
+
+		deque->count--;
+	}
+
+	if (deque->count == deque->capacity) {
+		resize(deque, deque->capacity ? deque->capacity << 1 : DEQUE_MIN_CAPACITY);
+	}
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	const MutableDeque *this = (MutableDeque *) self;
+
+	MutableDeque *that = $((Deque *) this, mutableCopy);
+	that->limit = this->limit;
+
+	return (Object *) that;
+}
+
+#pragma mark - MutableDeque
+
+/**
+ * @fn MutableDeque *MutableDeque::deque(void)
+ * @memberof MutableDeque
+ */
+static MutableDeque *deque(void) {
+
+	return $(alloc(MutableDeque), init);
+}
+
+/**
+ * @fn Array *MutableDeque::drain(MutableDeque *self)
+ * @memberof MutableDeque
+ */
+static Array *drain(MutableDeque *self) {
+
+	Deque *deque = (Deque *) self;
+
+	MutableArray *array = $$(MutableArray, arrayWithCapacity, deque->count);
+
+	if (deque->count) {
+		unwrap(deque, array->array.elements);
+		array->array.count = deque->count;
+	}
+
+	deque->count = deque->head = 0;
+
+	return (Array *) array;
+}
+
+/**
+ * @fn MutableDeque *MutableDeque::init(MutableDeque *self)
+ * @memberof MutableDeque
+ */
+static MutableDeque *init(MutableDeque *self) {
+
+	return $(self, initWithCapacity, 0);
+}
+
+/**
+ * @fn MutableDeque *MutableDeque::initWithCapacity(MutableDeque *self, size_t capacity)
+ * @memberof MutableDeque
+ */
+static MutableDeque *initWithCapacity(MutableDeque *self, size_t capacity) {
+
+	self = (MutableDeque *) super(Object, self, init);
+	if (self) {
+
+		if (capacity) {
+
+			size_t size = 1;
+			while (size < capacity) {
+				size <<= 1;
+			}
+
+			resize((Deque *) self, size);
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn MutableDeque *MutableDeque::initWithLimit(MutableDeque *self, size_t limit)
+ * @memberof MutableDeque
+ */
+static MutableDeque *initWithLimit(MutableDeque *self, size_t limit) {
+
+	assert(limit);
+
+	self = $(self, initWithCapacity, limit);
+	if (self) {
+		self->limit = limit;
+	}
+
+	return self;
+}
+
+/**
+ * @fn ident MutableDeque::popBack(MutableDeque *self)
+ * @memberof MutableDeque
+ */
+static ident popBack(MutableDeque *self) {
+
+	Deque *deque = (Deque *) self;
+
+	if (deque->count == 0) {
+		return NULL;
+	}
+
+	deque->count--;
+
+	const size_t index = position(deque, deque->count);
+	ident obj = deque->elements[index];
+	deque->elements[index] = NULL;
+
+	return obj;
+}
+
+/**
+ * @fn ident MutableDeque::popFront(MutableDeque *self)
+ * @memberof MutableDeque
+ */
+static ident popFront(MutableDeque *self) {
+
+	Deque *deque = (Deque *) self;
+
+	if (deque->count == 0) {
+		return NULL;
+	}
+
+	ident obj = deque->elements[deque->head];
+	deque->elements[deque->head] = NULL;
+
+	deque->head = position(deque, 1);
+	deque->count--;
+
+	return obj;
+}
+
+/**
+ * @fn void MutableDeque::pushBack(MutableDeque *self, const ident obj)
+ * @memberof MutableDeque
+ */
+static void pushBack(MutableDeque *self, const ident obj) {
+
+	assert(obj);
+
+	reserve(self, false);
+
+	Deque *deque = (Deque *) self;
+
+	deque->elements[position(deque, deque->count)] = retain(obj);
+	deque->count++;
+}
+
+/**
+ * @fn void MutableDeque::pushFront(MutableDeque *self, const ident obj)
+ * @memberof MutableDeque
+ */
+static void pushFront(MutableDeque *self, const ident obj) {
+
+	assert(obj);
+
+	reserve(self, true);
+
+	Deque *deque = (Deque *) self;
+
+	deque->head = position(deque, deque->capacity - 1);
+	deque->elements[deque->head] = retain(obj);
+	deque->count++;
+}
+
+/**
+ * @fn void MutableDeque::removeAllObjects(MutableDeque *self)
+ * @memberof MutableDeque
+ */
+static void removeAllObjects(MutableDeque *self) {
+
+	Deque *deque = (Deque *) self;
+
+	for (size_t i = 0; i < deque->count; i++) {
+
+		const size_t index = position(deque, i);
+
+		release(deque->elements[index]);
+		deque->elements[index] = NULL;
+	}
+
+	deque->count = deque->head = 0;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ObjectInterface *) clazz->def->interface)->copy = copy;
+
+	MutableDequeInterface *mutableDeque = (MutableDequeInterface *) clazz->def->interface;
+
+	mutableDeque->deque = deque;
+	mutableDeque->drain = drain;
+	mutableDeque->init = init;
+	mutableDeque->initWithCapacity = initWithCapacity;
+	mutableDeque->initWithLimit = initWithLimit;
+	mutableDeque->popBack = popBack;
+	mutableDeque->popFront = popFront;
+	mutableDeque->pushBack = pushBack;
+	mutableDeque->pushFront = pushFront;
+	mutableDeque->removeAllObjects = removeAllObjects;
+}
+
+/**
+ * @fn Class *MutableDeque::_MutableDeque(void)
+ * @memberof MutableDeque
+ */
+Class *_MutableDeque(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "MutableDeque";
+		clazz.superclass = _Deque();
+		clazz.instanceSize = sizeof(MutableDeque);
+		clazz.interfaceOffset = offsetof(MutableDeque, interface);
+		clazz.interfaceSize = sizeof(MutableDequeInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
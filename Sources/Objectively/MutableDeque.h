@@ -0,0 +1,173 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Deque.h>
+
+/**
+ * @file
+ * @brief Mutable double-ended queues.
+ */
+
+typedef struct MutableDequeInterface MutableDequeInterface;
+
+/**
+ * @brief Mutable double-ended queues.
+ * @details Objects may be pushed and popped at either end in constant time. The ring buffer
+ * grows geometrically, unless a limit is specified, in which case pushing onto a full
+ * MutableDeque overwrites the Object at the opposite end. This is useful for sliding windows.
+ * @extends Deque
+ * @ingroup Collections
+ */
+struct MutableDeque {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Deque deque;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	MutableDequeInterface *interface;
+
+	/**
+	 * @brief The maximum count of elements, or `0` for unbounded.
+	 */
+	size_t limit;
+};
+
+/**
+ * @brief The MutableDeque interface.
+ */
+struct MutableDequeInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	DequeInterface dequeInterface;
+
+	/**
+	 * @static
+	 * @fn MutableDeque *MutableDeque::deque(void)
+	 * @brief Returns a new MutableDeque.
+	 * @return The new MutableDeque, or `NULL` on error.
+	 * @memberof MutableDeque
+	 */
+	MutableDeque *(*deque)(void);
+
+	/**
+	 * @fn Array *MutableDeque::drain(MutableDeque *self)
+	 * @brief Removes all Objects from this MutableDeque, returning them in an Array.
+	 * @param self The MutableDeque.
+	 * @return An Array containing the removed Objects, from first to last.
+	 * @memberof MutableDeque
+	 */
+	Array *(*drain)(MutableDeque *self);
+
+	/**
+	 * @fn MutableDeque *MutableDeque::init(MutableDeque *self)
+	 * @brief Initializes this MutableDeque.
+	 * @param self The MutableDeque.
+	 * @return The initialized MutableDeque, or `NULL` on error.
+	 * @memberof MutableDeque
+	 */
+	MutableDeque *(*init)(MutableDeque *self);
+
+	/**
+	 * @fn MutableDeque *MutableDeque::initWithCapacity(MutableDeque *self, size_t capacity)
+	 * @brief Initializes this MutableDeque with the specified capacity.
+	 * @param self The MutableDeque.
+	 * @param capacity The desired initial capacity, which is rounded up to a power of two.
+	 * @return The initialized MutableDeque, or `NULL` on error.
+	 * @memberof MutableDeque
+	 */
+	MutableDeque *(*initWithCapacity)(MutableDeque *self, size_t capacity);
+
+	/**
+	 * @fn MutableDeque *MutableDeque::initWithLimit(MutableDeque *self, size_t limit)
+	 * @brief Initializes this MutableDeque with a bounded capacity.
+	 * @param self The MutableDeque.
+	 * @param limit The maximum count of elements.
+	 * @return The initialized MutableDeque, or `NULL` on error.
+	 * @remarks Pushing onto a full MutableDeque releases the Object at the opposite end.
+	 * @memberof MutableDeque
+	 */
+	MutableDeque *(*initWithLimit)(MutableDeque *self, size_t limit);
+
+	/**
+	 * @fn ident MutableDeque::popBack(MutableDeque *self)
+	 * @brief Removes the last Object from this MutableDeque.
+	 * @param self The MutableDeque.
+	 * @return The removed Object, retained, or `NULL` if this MutableDeque is empty.
+	 * @memberof MutableDeque
+	 */
+	ident (*popBack)(MutableDeque *self);
+
+	/**
+	 * @fn ident MutableDeque::popFront(MutableDeque *self)
+	 * @brief Removes the first Object from this MutableDeque.
+	 * @param self The MutableDeque.
+	 * @return The removed Object, retained, or `NULL` if this MutableDeque is empty.
+	 * @memberof MutableDeque
+	 */
+	ident (*popFront)(MutableDeque *self);
+
+	/**
+	 * @fn void MutableDeque::pushBack(MutableDeque *self, const ident obj)
+	 * @brief Appends the specified Object to this MutableDeque.
+	 * @param self The MutableDeque.
+	 * @param obj The Object.
+	 * @remarks If this MutableDeque is bounded and full, its first Object is released.
+	 * @memberof MutableDeque
+	 */
+	void (*pushBack)(MutableDeque *self, const ident obj);
+
+	/**
+	 * @fn void MutableDeque::pushFront(MutableDeque *self, const ident obj)
+	 * @brief Prepends the specified Object to this MutableDeque.
+	 * @param self The MutableDeque.
+	 * @param obj The Object.
+	 * @remarks If this MutableDeque is bounded and full, its last Object is released.
+	 * @memberof MutableDeque
+	 */
+	void (*pushFront)(MutableDeque *self, const ident obj);
+
+	/**
+	 * @fn void MutableDeque::removeAllObjects(MutableDeque *self)
+	 * @brief Removes all Objects from this MutableDeque.
+	 * @param self The MutableDeque.
+	 * @memberof MutableDeque
+	 */
+	void (*removeAllObjects)(MutableDeque *self);
+};
+
+/**
+ * @fn Class *MutableDeque::_MutableDeque(void)
+ * @brief The MutableDeque archetype.
+ * @return The MutableDeque Class.
+ * @memberof MutableDeque
+ */
+OBJECTIVELY_EXPORT Class *_MutableDeque(void);
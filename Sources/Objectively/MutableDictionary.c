@@ -25,6 +25,7 @@
 #include <stdarg.h>
 #include <stdlib.h>
 
+#include <Objectively/DictionaryBin.h>
 #include <Objectively/Hash.h>
 #include <Objectively/MutableArray.h>
 #include <Objectively/MutableDictionary.h>
@@ -146,7 +147,7 @@ static void removeObjectForKey(MutableDictionary *self, const ident key) {
 	MutableArray *array = self->dictionary.elements[bin];
 	if (array) {
 
-		const ssize_t index = $((Array *) array, indexOfObject, key);
+		const ssize_t index = indexOfKey((Array *) array, key);
 		if (index > -1) {
 
 			$(array, removeObjectAtIndex, index);
@@ -202,8 +203,8 @@ static void setObjectForKey_resize(Dictionary *dict) {
 
 					for (size_t j = 0; j < array->count; j += 2) {
 
-						ident key = $(array, objectAtIndex, j);
-						ident obj = $(array, objectAtIndex, j + 1);
+						ident key = array->elements[j];
+						ident obj = array->elements[j + 1];
 
 						$$(MutableDictionary, setObjectForKey, (MutableDictionary *) dict, obj, key);
 					}
@@ -236,7 +237,7 @@ static void setObjectForKey(MutableDictionary *self, const ident obj, const iden
 		array = dict->elements[bin] = $(alloc(MutableArray), init);
 	}
 
-	const ssize_t index = $((Array *) array, indexOfObject, key);
+	const ssize_t index = indexOfKey((Array *) array, key);
 	if (index > -1) {
 		$(array, setObjectAtIndex, obj, index + 1);
 	} else {
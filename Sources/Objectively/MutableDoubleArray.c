@@ -0,0 +1,218 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/MutableDoubleArray.h>
+#include <Objectively/RadixSort.h>
+
+#define _Class _MutableDoubleArray
+
+#define MUTABLEDOUBLEARRAY_DEFAULT_CAPACITY 16
+
+/**
+ * @brief Ensures that `self` has room for `count` values.
+ */
+static void ensureCapacity(MutableDoubleArray *self, size_t count) {
+
+	if (count > self->capacity) {
+
+		size_t capacity = self->capacity ?: MUTABLEDOUBLEARRAY_DEFAULT_CAPACITY;
+		while (capacity < count) {
+			capacity *= 2;
+		}
+
+		self->doubleArray.values = realloc(self->doubleArray.values, capacity * sizeof(double));
+		assert(self->doubleArray.values);
+
+		self->capacity = capacity;
+	}
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	return (Object *) $((DoubleArray *) self, mutableCopy);
+}
+
+#pragma mark - MutableDoubleArray
+
+/**
+ * @fn void MutableDoubleArray::addValue(MutableDoubleArray *self, double value)
+ * @memberof MutableDoubleArray
+ */
+static void addValue(MutableDoubleArray *self, double value) {
+
+	ensureCapacity(self, self->doubleArray.count + 1);
+
+	self->doubleArray.values[self->doubleArray.count++] = value;
+}
+
+/**
+ * @fn void MutableDoubleArray::addValues(MutableDoubleArray *self, const double *values, size_t count)
+ * @memberof MutableDoubleArray
+ */
+static void addValues(MutableDoubleArray *self, const double *values, size_t count) {
+
+	if (count) {
+		assert(values);
+
+		ensureCapacity(self, self->doubleArray.count + count);
+
+		memcpy(self->doubleArray.values + self->doubleArray.count, values, count * sizeof(double));
+		self->doubleArray.count += count;
+	}
+}
+
+/**
+ * @fn MutableDoubleArray *MutableDoubleArray::init(MutableDoubleArray *self)
+ * @memberof MutableDoubleArray
+ */
+static MutableDoubleArray *init(MutableDoubleArray *self) {
+
+	return $(self, initWithCapacity, MUTABLEDOUBLEARRAY_DEFAULT_CAPACITY);
+}
+
+/**
+ * @fn MutableDoubleArray *MutableDoubleArray::initWithCapacity(MutableDoubleArray *self, size_t capacity)
+ * @memberof MutableDoubleArray
+ */
+static MutableDoubleArray *initWithCapacity(MutableDoubleArray *self, size_t capacity) {
+
+	self = (MutableDoubleArray *) super(Object, self, init);
+	if (self) {
+
+		self->capacity = capacity;
+		if (self->capacity) {
+
+			self->doubleArray.values = malloc(self->capacity * sizeof(double));
+			assert(self->doubleArray.values);
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn MutableDoubleArray *MutableDoubleArray::doubleArray(void)
+ * @memberof MutableDoubleArray
+ */
+static MutableDoubleArray *doubleArray(void) {
+
+	return $(alloc(MutableDoubleArray), init);
+}
+
+/**
+ * @fn void MutableDoubleArray::removeAllValues(MutableDoubleArray *self)
+ * @memberof MutableDoubleArray
+ */
+static void removeAllValues(MutableDoubleArray *self) {
+
+	self->doubleArray.count = 0;
+}
+
+/**
+ * @fn void MutableDoubleArray::removeValueAtIndex(MutableDoubleArray *self, size_t index)
+ * @memberof MutableDoubleArray
+ */
+static void removeValueAtIndex(MutableDoubleArray *self, size_t index) {
+
+	assert(index < self->doubleArray.count);
+
+	double *values = self->doubleArray.values;
+	memmove(values + index, values + index + 1, (self->doubleArray.count - index - 1) * sizeof(double));
+
+	self->doubleArray.count--;
+}
+
+/**
+ * @fn void MutableDoubleArray::setValueAtIndex(MutableDoubleArray *self, double value, size_t index)
+ * @memberof MutableDoubleArray
+ */
+static void setValueAtIndex(MutableDoubleArray *self, double value, size_t index) {
+
+	assert(index < self->doubleArray.count);
+
+	self->doubleArray.values[index] = value;
+}
+
+/**
+ * @fn void MutableDoubleArray::sort(MutableDoubleArray *self)
+ * @memberof MutableDoubleArray
+ */
+static void sort(MutableDoubleArray *self) {
+
+	RadixSortDoubles(self->doubleArray.values, self->doubleArray.count);
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+
+	MutableDoubleArrayInterface *mutableDoubleArray = (MutableDoubleArrayInterface *) clazz->def->interface;
+
+	mutableDoubleArray->addValue = addValue;
+	mutableDoubleArray->addValues = addValues;
+	mutableDoubleArray->init = init;
+	mutableDoubleArray->initWithCapacity = initWithCapacity;
+	mutableDoubleArray->doubleArray = doubleArray;
+	mutableDoubleArray->removeAllValues = removeAllValues;
+	mutableDoubleArray->removeValueAtIndex = removeValueAtIndex;
+	mutableDoubleArray->setValueAtIndex = setValueAtIndex;
+	mutableDoubleArray->sort = sort;
+}
+
+/**
+ * @fn Class *MutableDoubleArray::_MutableDoubleArray(void)
+ * @memberof MutableDoubleArray
+ */
+Class *_MutableDoubleArray(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "MutableDoubleArray";
+		clazz.superclass = _DoubleArray();
+		clazz.instanceSize = sizeof(MutableDoubleArray);
+		clazz.interfaceOffset = offsetof(MutableDoubleArray, interface);
+		clazz.interfaceSize = sizeof(MutableDoubleArrayInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
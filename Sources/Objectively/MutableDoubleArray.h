@@ -0,0 +1,161 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/DoubleArray.h>
+
+/**
+ * @file
+ * @brief Mutable contiguous arrays of double precision values.
+ */
+
+typedef struct MutableDoubleArrayInterface MutableDoubleArrayInterface;
+
+/**
+ * @brief Mutable contiguous arrays of double precision values.
+ * @extends DoubleArray
+ * @ingroup Collections
+ */
+struct MutableDoubleArray {
+
+	/**
+	 * @brief The superclass.
+	 */
+	DoubleArray doubleArray;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	MutableDoubleArrayInterface *interface;
+
+	/**
+	 * @brief The capacity, which is always `>= self->doubleArray.count`.
+	 * @private
+	 */
+	size_t capacity;
+};
+
+/**
+ * @brief The MutableDoubleArray interface.
+ */
+struct MutableDoubleArrayInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	DoubleArrayInterface doubleArrayInterface;
+
+	/**
+	 * @fn void MutableDoubleArray::addValue(MutableDoubleArray *self, double value)
+	 * @brief Appends the specified value to this MutableDoubleArray.
+	 * @param self The MutableDoubleArray.
+	 * @param value The value to append.
+	 * @memberof MutableDoubleArray
+	 */
+	void (*addValue)(MutableDoubleArray *self, double value);
+
+	/**
+	 * @fn void MutableDoubleArray::addValues(MutableDoubleArray *self, const double *values, size_t count)
+	 * @brief Appends `count` of `values` to this MutableDoubleArray.
+	 * @param self The MutableDoubleArray.
+	 * @param values The values to append.
+	 * @param count The count of `values` to append.
+	 * @memberof MutableDoubleArray
+	 */
+	void (*addValues)(MutableDoubleArray *self, const double *values, size_t count);
+
+	/**
+	 * @fn MutableDoubleArray *MutableDoubleArray::init(MutableDoubleArray *self)
+	 * @brief Initializes this MutableDoubleArray.
+	 * @param self The MutableDoubleArray.
+	 * @return The initialized MutableDoubleArray, or `NULL` on error.
+	 * @memberof MutableDoubleArray
+	 */
+	MutableDoubleArray *(*init)(MutableDoubleArray *self);
+
+	/**
+	 * @fn MutableDoubleArray *MutableDoubleArray::initWithCapacity(MutableDoubleArray *self, size_t capacity)
+	 * @brief Initializes this MutableDoubleArray with the specified capacity.
+	 * @param self The MutableDoubleArray.
+	 * @param capacity The desired initial capacity.
+	 * @return The initialized MutableDoubleArray, or `NULL` on error.
+	 * @memberof MutableDoubleArray
+	 */
+	MutableDoubleArray *(*initWithCapacity)(MutableDoubleArray *self, size_t capacity);
+
+	/**
+	 * @static
+	 * @fn MutableDoubleArray *MutableDoubleArray::doubleArray(void)
+	 * @brief Returns a new MutableDoubleArray.
+	 * @return The new MutableDoubleArray, or `NULL` on error.
+	 * @memberof MutableDoubleArray
+	 */
+	MutableDoubleArray *(*doubleArray)(void);
+
+	/**
+	 * @fn void MutableDoubleArray::removeAllValues(MutableDoubleArray *self)
+	 * @brief Removes all values from this MutableDoubleArray.
+	 * @param self The MutableDoubleArray.
+	 * @memberof MutableDoubleArray
+	 */
+	void (*removeAllValues)(MutableDoubleArray *self);
+
+	/**
+	 * @fn void MutableDoubleArray::removeValueAtIndex(MutableDoubleArray *self, size_t index)
+	 * @brief Removes the value at the specified index.
+	 * @param self The MutableDoubleArray.
+	 * @param index The index of the value to remove.
+	 * @memberof MutableDoubleArray
+	 */
+	void (*removeValueAtIndex)(MutableDoubleArray *self, size_t index);
+
+	/**
+	 * @fn void MutableDoubleArray::setValueAtIndex(MutableDoubleArray *self, double value, size_t index)
+	 * @brief Replaces the value at the specified index.
+	 * @param self The MutableDoubleArray.
+	 * @param value The value.
+	 * @param index The index of the value to replace.
+	 * @memberof MutableDoubleArray
+	 */
+	void (*setValueAtIndex)(MutableDoubleArray *self, double value, size_t index);
+
+	/**
+	 * @fn void MutableDoubleArray::sort(MutableDoubleArray *self)
+	 * @brief Sorts this MutableDoubleArray in place, in ascending order.
+	 * @param self The MutableDoubleArray.
+	 * @remarks Sorting is performed by a least significant digit radix sort, in linear time.
+	 * Negative zero is ordered before positive zero, and NaN values are ordered at the extremes.
+	 * @memberof MutableDoubleArray
+	 */
+	void (*sort)(MutableDoubleArray *self);
+};
+
+/**
+ * @fn Class *MutableDoubleArray::_MutableDoubleArray(void)
+ * @brief The MutableDoubleArray archetype.
+ * @return The MutableDoubleArray Class.
+ * @memberof MutableDoubleArray
+ */
+OBJECTIVELY_EXPORT Class *_MutableDoubleArray(void);
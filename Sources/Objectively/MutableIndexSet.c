@@ -0,0 +1,328 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/MutableIndexSet.h>
+
+#define _Class _MutableIndexSet
+
+/**
+ * @return The exclusive end of `range`.
+ */
+static inline size_t end(const Range range) {
+	return range.location + range.length;
+}
+
+/**
+ * @return The index of the first Range whose end is at least `index`.
+ */
+static size_t firstEndingAtOrAfter(const IndexSet *self, size_t index) {
+
+	size_t low = 0, high = self->numberOfRanges;
+
+	while (low < high) {
+		const size_t mid = low + ((high - low) >> 1);
+		if (end(self->ranges[mid]) < index) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+/**
+ * @return The index of the first Range beginning after `index`.
+ */
+static size_t firstBeginningAfter(const IndexSet *self, size_t index) {
+
+	size_t low = 0, high = self->numberOfRanges;
+
+	while (low < high) {
+		const size_t mid = low + ((high - low) >> 1);
+		if ((size_t) self->ranges[mid].location <= index) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+/**
+ * @brief Replaces the Ranges `[i, j)` of this MutableIndexSet with `pieces`.
+ */
+static void replace(MutableIndexSet *self, size_t i, size_t j, const Range *pieces, size_t count) {
+
+	IndexSet *indexSet = (IndexSet *) self;
+
+	const size_t numberOfRanges = indexSet->numberOfRanges - (j - i) + count;
+	if (numberOfRanges > self->capacity) {
+
+		self->capacity = max(numberOfRanges, self->capacity << 1);
+
+		indexSet->ranges = realloc(indexSet->ranges, self->capacity * sizeof(Range));
+		assert(indexSet->ranges);
+	}
+
+	for (size_t k = i; k < j; k++) {
+		indexSet->count -= indexSet->ranges[k].length;
+	}
+
+	memmove(indexSet->ranges + i + count, indexSet->ranges + j, (indexSet->numberOfRanges - j) * sizeof(Range));
+
+	for (size_t k = 0; k < count; k++) {
+		indexSet->ranges[i + k] = pieces[k];
+		indexSet->count += pieces[k].length;
+	}
+
+	indexSet->numberOfRanges = numberOfRanges;
+}
+
+/**
+ * @brief Replaces the contents of this MutableIndexSet with those of `indexSet`, releasing it.
+ */
+static void adopt(MutableIndexSet *self, IndexSet *indexSet) {
+
+	free(self->indexSet.ranges);
+
+	self->indexSet.ranges = indexSet->ranges;
+	self->indexSet.numberOfRanges = indexSet->numberOfRanges;
+	self->indexSet.count = indexSet->count;
+
+	self->capacity = indexSet->numberOfRanges;
+
+	indexSet->ranges = NULL;
+	indexSet->numberOfRanges = indexSet->count = 0;
+
+	release(indexSet);
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	return (Object *) $((IndexSet *) self, mutableCopy);
+}
+
+#pragma mark - MutableIndexSet
+
+/**
+ * @fn void MutableIndexSet::addIndex(MutableIndexSet *self, size_t index)
+ * @memberof MutableIndexSet
+ */
+static void addIndex(MutableIndexSet *self, size_t index) {
+	$(self, addIndexesInRange, (Range) { .location = index, .length = 1 });
+}
+
+/**
+ * @fn void MutableIndexSet::addIndexes(MutableIndexSet *self, size_t *indexes, size_t count)
+ * @memberof MutableIndexSet
+ */
+static void addIndexes(MutableIndexSet *self, size_t *indexes, size_t count) {
+
+	IndexSet *indexSet = $(alloc(IndexSet), initWithIndexes, indexes, count);
+
+	$(self, addIndexSet, indexSet);
+
+	release(indexSet);
+}
+
+/**
+ * @fn void MutableIndexSet::addIndexesInRange(MutableIndexSet *self, const Range range)
+ * @memberof MutableIndexSet
+ */
+static void addIndexesInRange(MutableIndexSet *self, const Range range) {
+
+	assert(range.location >= 0);
+
+	if (range.length == 0) {
+		return;
+	}
+
+	const IndexSet *indexSet = (IndexSet *) self;
+
+	const size_t i = firstEndingAtOrAfter(indexSet, range.location);
+	const size_t j = firstBeginningAfter(indexSet, end(range));
+
+	Range piece = range;
+	if (i < j) {
+		const size_t location = min((size_t) range.location, (size_t) indexSet->ranges[i].location);
+		const size_t e = max(end(range), end(indexSet->ranges[j - 1]));
+
+		piece = (Range) { .location = location, .length = e - location };
+	}
+
+	replace(self, i, j, &piece, 1);
+}
+
+/**
+ * @fn void MutableIndexSet::addIndexSet(MutableIndexSet *self, const IndexSet *indexSet)
+ * @memberof MutableIndexSet
+ */
+static void addIndexSet(MutableIndexSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	if (indexSet->numberOfRanges) {
+		adopt(self, $((IndexSet *) self, unionWithIndexSet, indexSet));
+	}
+}
+
+/**
+ * @fn MutableIndexSet *MutableIndexSet::init(MutableIndexSet *self)
+ * @memberof MutableIndexSet
+ */
+static MutableIndexSet *init(MutableIndexSet *self) {
+
+	return (MutableIndexSet *) super(Object, self, init);
+}
+
+/**
+ * @fn void MutableIndexSet::intersectIndexSet(MutableIndexSet *self, const IndexSet *indexSet)
+ * @memberof MutableIndexSet
+ */
+static void intersectIndexSet(MutableIndexSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	adopt(self, $((IndexSet *) self, intersectionWithIndexSet, indexSet));
+}
+
+/**
+ * @fn void MutableIndexSet::removeAllIndexes(MutableIndexSet *self)
+ * @memberof MutableIndexSet
+ */
+static void removeAllIndexes(MutableIndexSet *self) {
+
+	self->indexSet.numberOfRanges = self->indexSet.count = 0;
+}
+
+/**
+ * @fn void MutableIndexSet::removeIndex(MutableIndexSet *self, size_t index)
+ * @memberof MutableIndexSet
+ */
+static void removeIndex(MutableIndexSet *self, size_t index) {
+	$(self, removeIndexesInRange, (Range) { .location = index, .length = 1 });
+}
+
+/**
+ * @fn void MutableIndexSet::removeIndexesInRange(MutableIndexSet *self, const Range range)
+ * @memberof MutableIndexSet
+ */
+static void removeIndexesInRange(MutableIndexSet *self, const Range range) {
+
+	assert(range.location >= 0);
+
+	if (range.length == 0) {
+		return;
+	}
+
+	const IndexSet *indexSet = (IndexSet *) self;
+
+	const size_t i = firstEndingAtOrAfter(indexSet, range.location + 1);
+	const size_t j = firstBeginningAfter(indexSet, end(range) - 1);
+
+	if (i >= j) {
+		return;
+	}
+
+	Range pieces[2];
+	size_t count = 0;
+
+	const Range first = indexSet->ranges[i];
+	if (first.location < range.location) {
+		pieces[count++] = (Range) { .location = first.location, .length = range.location - first.location };
+	}
+
+	const Range last = indexSet->ranges[j - 1];
+	if (end(last) > end(range)) {
+		pieces[count++] = (Range) { .location = end(range), .length = end(last) - end(range) };
+	}
+
+	replace(self, i, j, pieces, count);
+}
+
+/**
+ * @fn void MutableIndexSet::removeIndexSet(MutableIndexSet *self, const IndexSet *indexSet)
+ * @memberof MutableIndexSet
+ */
+static void removeIndexSet(MutableIndexSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	if (indexSet->numberOfRanges) {
+		adopt(self, $((IndexSet *) self, differenceWithIndexSet, indexSet));
+	}
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ObjectInterface *) clazz->def->interface)->copy = copy;
+
+	((MutableIndexSetInterface *) clazz->def->interface)->addIndex = addIndex;
+	((MutableIndexSetInterface *) clazz->def->interface)->addIndexes = addIndexes;
+	((MutableIndexSetInterface *) clazz->def->interface)->addIndexesInRange = addIndexesInRange;
+	((MutableIndexSetInterface *) clazz->def->interface)->addIndexSet = addIndexSet;
+	((MutableIndexSetInterface *) clazz->def->interface)->init = init;
+	((MutableIndexSetInterface *) clazz->def->interface)->intersectIndexSet = intersectIndexSet;
+	((MutableIndexSetInterface *) clazz->def->interface)->removeAllIndexes = removeAllIndexes;
+	((MutableIndexSetInterface *) clazz->def->interface)->removeIndex = removeIndex;
+	((MutableIndexSetInterface *) clazz->def->interface)->removeIndexesInRange = removeIndexesInRange;
+	((MutableIndexSetInterface *) clazz->def->interface)->removeIndexSet = removeIndexSet;
+}
+
+/**
+ * @fn Class *MutableIndexSet::_MutableIndexSet(void)
+ * @memberof MutableIndexSet
+ */
+Class *_MutableIndexSet(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "MutableIndexSet";
+		clazz.superclass = _IndexSet();
+		clazz.instanceSize = sizeof(MutableIndexSet);
+		clazz.interfaceOffset = offsetof(MutableIndexSet, interface);
+		clazz.interfaceSize = sizeof(MutableIndexSetInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
@@ -0,0 +1,166 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/IndexSet.h>
+
+/**
+ * @file
+ * @brief Mutable index sets.
+ */
+
+typedef struct MutableIndexSetInterface MutableIndexSetInterface;
+
+/**
+ * @brief Mutable index sets.
+ * @extends IndexSet
+ */
+struct MutableIndexSet {
+
+	/**
+	 * @brief The superclass.
+	 */
+	IndexSet indexSet;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	MutableIndexSetInterface *interface;
+
+	/**
+	 * @brief The capacity of `ranges`.
+	 * @private
+	 */
+	size_t capacity;
+};
+
+/**
+ * @brief The MutableIndexSet interface.
+ */
+struct MutableIndexSetInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	IndexSetInterface indexSetInterface;
+
+	/**
+	 * @fn void MutableIndexSet::addIndex(MutableIndexSet *self, size_t index)
+	 * @brief Adds the specified index to this MutableIndexSet.
+	 * @param self The MutableIndexSet.
+	 * @param index The index.
+	 * @memberof MutableIndexSet
+	 */
+	void (*addIndex)(MutableIndexSet *self, size_t index);
+
+	/**
+	 * @fn void MutableIndexSet::addIndexes(MutableIndexSet *self, size_t *indexes, size_t count)
+	 * @brief Adds the specified indexes to this MutableIndexSet.
+	 * @param self The MutableIndexSet.
+	 * @param indexes The indexes, which need not be sorted or unique.
+	 * @param count The count of `indexes`.
+	 * @memberof MutableIndexSet
+	 */
+	void (*addIndexes)(MutableIndexSet *self, size_t *indexes, size_t count);
+
+	/**
+	 * @fn void MutableIndexSet::addIndexesInRange(MutableIndexSet *self, const Range range)
+	 * @brief Adds the indexes in `range` to this MutableIndexSet.
+	 * @param self The MutableIndexSet.
+	 * @param range The Range of indexes.
+	 * @memberof MutableIndexSet
+	 */
+	void (*addIndexesInRange)(MutableIndexSet *self, const Range range);
+
+	/**
+	 * @fn void MutableIndexSet::addIndexSet(MutableIndexSet *self, const IndexSet *indexSet)
+	 * @brief Adds the indexes of `indexSet` to this MutableIndexSet.
+	 * @param self The MutableIndexSet.
+	 * @param indexSet An IndexSet.
+	 * @memberof MutableIndexSet
+	 */
+	void (*addIndexSet)(MutableIndexSet *self, const IndexSet *indexSet);
+
+	/**
+	 * @fn MutableIndexSet *MutableIndexSet::init(MutableIndexSet *self)
+	 * @brief Initializes this MutableIndexSet.
+	 * @param self The MutableIndexSet.
+	 * @return The initialized MutableIndexSet, or `NULL` on error.
+	 * @memberof MutableIndexSet
+	 */
+	MutableIndexSet *(*init)(MutableIndexSet *self);
+
+	/**
+	 * @fn void MutableIndexSet::intersectIndexSet(MutableIndexSet *self, const IndexSet *indexSet)
+	 * @brief Removes the indexes of this MutableIndexSet that are not in `indexSet`.
+	 * @param self The MutableIndexSet.
+	 * @param indexSet An IndexSet.
+	 * @memberof MutableIndexSet
+	 */
+	void (*intersectIndexSet)(MutableIndexSet *self, const IndexSet *indexSet);
+
+	/**
+	 * @fn void MutableIndexSet::removeAllIndexes(MutableIndexSet *self)
+	 * @brief Removes all indexes from this MutableIndexSet.
+	 * @param self The MutableIndexSet.
+	 * @memberof MutableIndexSet
+	 */
+	void (*removeAllIndexes)(MutableIndexSet *self);
+
+	/**
+	 * @fn void MutableIndexSet::removeIndex(MutableIndexSet *self, size_t index)
+	 * @brief Removes the specified index from this MutableIndexSet.
+	 * @param self The MutableIndexSet.
+	 * @param index The index.
+	 * @memberof MutableIndexSet
+	 */
+	void (*removeIndex)(MutableIndexSet *self, size_t index);
+
+	/**
+	 * @fn void MutableIndexSet::removeIndexesInRange(MutableIndexSet *self, const Range range)
+	 * @brief Removes the indexes in `range` from this MutableIndexSet.
+	 * @param self The MutableIndexSet.
+	 * @param range The Range of indexes.
+	 * @memberof MutableIndexSet
+	 */
+	void (*removeIndexesInRange)(MutableIndexSet *self, const Range range);
+
+	/**
+	 * @fn void MutableIndexSet::removeIndexSet(MutableIndexSet *self, const IndexSet *indexSet)
+	 * @brief Removes the indexes of `indexSet` from this MutableIndexSet.
+	 * @param self The MutableIndexSet.
+	 * @param indexSet An IndexSet.
+	 * @memberof MutableIndexSet
+	 */
+	void (*removeIndexSet)(MutableIndexSet *self, const IndexSet *indexSet);
+};
+
+/**
+ * @fn Class *MutableIndexSet::_MutableIndexSet(void)
+ * @brief The MutableIndexSet archetype.
+ * @return The MutableIndexSet Class.
+ * @memberof MutableIndexSet
+ */
+OBJECTIVELY_EXPORT Class *_MutableIndexSet(void);
@@ -0,0 +1,218 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/MutableIntegerArray.h>
+#include <Objectively/RadixSort.h>
+
+#define _Class _MutableIntegerArray
+
+#define MUTABLEINTEGERARRAY_DEFAULT_CAPACITY 16
+
+/**
+ * @brief Ensures that `self` has room for `count` values.
+ */
+static void ensureCapacity(MutableIntegerArray *self, size_t count) {
+
+	if (count > self->capacity) {
+
+		size_t capacity = self->capacity ?: MUTABLEINTEGERARRAY_DEFAULT_CAPACITY;
+		while (capacity < count) {
+			capacity *= 2;
+		}
+
+		self->integerArray.values = realloc(self->integerArray.values, capacity * sizeof(int64_t));
+		assert(self->integerArray.values);
+
+		self->capacity = capacity;
+	}
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	return (Object *) $((IntegerArray *) self, mutableCopy);
+}
+
+#pragma mark - MutableIntegerArray
+
+/**
+ * @fn void MutableIntegerArray::addValue(MutableIntegerArray *self, int64_t value)
+ * @memberof MutableIntegerArray
+ */
+static void addValue(MutableIntegerArray *self, int64_t value) {
+
+	ensureCapacity(self, self->integerArray.count + 1);
+
+	self->integerArray.values[self->integerArray.count++] = value;
+}
+
+/**
+ * @fn void MutableIntegerArray::addValues(MutableIntegerArray *self, const int64_t *values, size_t count)
+ * @memberof MutableIntegerArray
+ */
+static void addValues(MutableIntegerArray *self, const int64_t *values, size_t count) {
+
+	if (count) {
+		assert(values);
+
+		ensureCapacity(self, self->integerArray.count + count);
+
+		memcpy(self->integerArray.values + self->integerArray.count, values, count * sizeof(int64_t));
+		self->integerArray.count += count;
+	}
+}
+
+/**
+ * @fn MutableIntegerArray *MutableIntegerArray::init(MutableIntegerArray *self)
+ * @memberof MutableIntegerArray
+ */
+static MutableIntegerArray *init(MutableIntegerArray *self) {
+
+	return $(self, initWithCapacity, MUTABLEINTEGERARRAY_DEFAULT_CAPACITY);
+}
+
+/**
+ * @fn MutableIntegerArray *MutableIntegerArray::initWithCapacity(MutableIntegerArray *self, size_t capacity)
+ * @memberof MutableIntegerArray
+ */
+static MutableIntegerArray *initWithCapacity(MutableIntegerArray *self, size_t capacity) {
+
+	self = (MutableIntegerArray *) super(Object, self, init);
+	if (self) {
+
+		self->capacity = capacity;
+		if (self->capacity) {
+
+			self->integerArray.values = malloc(self->capacity * sizeof(int64_t));
+			assert(self->integerArray.values);
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn MutableIntegerArray *MutableIntegerArray::integerArray(void)
+ * @memberof MutableIntegerArray
+ */
+static MutableIntegerArray *integerArray(void) {
+
+	return $(alloc(MutableIntegerArray), init);
+}
+
+/**
+ * @fn void MutableIntegerArray::removeAllValues(MutableIntegerArray *self)
+ * @memberof MutableIntegerArray
+ */
+static void removeAllValues(MutableIntegerArray *self) {
+
+	self->integerArray.count = 0;
+}
+
+/**
+ * @fn void MutableIntegerArray::removeValueAtIndex(MutableIntegerArray *self, size_t index)
+ * @memberof MutableIntegerArray
+ */
+static void removeValueAtIndex(MutableIntegerArray *self, size_t index) {
+
+	assert(index < self->integerArray.count);
+
+	int64_t *values = self->integerArray.values;
+	memmove(values + index, values + index + 1, (self->integerArray.count - index - 1) * sizeof(int64_t));
+
+	self->integerArray.count--;
+}
+
+/**
+ * @fn void MutableIntegerArray::setValueAtIndex(MutableIntegerArray *self, int64_t value, size_t index)
+ * @memberof MutableIntegerArray
+ */
+static void setValueAtIndex(MutableIntegerArray *self, int64_t value, size_t index) {
+
+	assert(index < self->integerArray.count);
+
+	self->integerArray.values[index] = value;
+}
+
+/**
+ * @fn void MutableIntegerArray::sort(MutableIntegerArray *self)
+ * @memberof MutableIntegerArray
+ */
+static void sort(MutableIntegerArray *self) {
+
+	RadixSortIntegers(self->integerArray.values, self->integerArray.count);
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+
+	MutableIntegerArrayInterface *mutableIntegerArray = (MutableIntegerArrayInterface *) clazz->def->interface;
+
+	mutableIntegerArray->addValue = addValue;
+	mutableIntegerArray->addValues = addValues;
+	mutableIntegerArray->init = init;
+	mutableIntegerArray->initWithCapacity = initWithCapacity;
+	mutableIntegerArray->integerArray = integerArray;
+	mutableIntegerArray->removeAllValues = removeAllValues;
+	mutableIntegerArray->removeValueAtIndex = removeValueAtIndex;
+	mutableIntegerArray->setValueAtIndex = setValueAtIndex;
+	mutableIntegerArray->sort = sort;
+}
+
+/**
+ * @fn Class *MutableIntegerArray::_MutableIntegerArray(void)
+ * @memberof MutableIntegerArray
+ */
+Class *_MutableIntegerArray(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "MutableIntegerArray";
+		clazz.superclass = _IntegerArray();
+		clazz.instanceSize = sizeof(MutableIntegerArray);
+		clazz.interfaceOffset = offsetof(MutableIntegerArray, interface);
+		clazz.interfaceSize = sizeof(MutableIntegerArrayInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
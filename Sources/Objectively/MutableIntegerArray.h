@@ -0,0 +1,160 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/IntegerArray.h>
+
+/**
+ * @file
+ * @brief Mutable contiguous arrays of 64 bit integers.
+ */
+
+typedef struct MutableIntegerArrayInterface MutableIntegerArrayInterface;
+
+/**
+ * @brief Mutable contiguous arrays of 64 bit integers.
+ * @extends IntegerArray
+ * @ingroup Collections
+ */
+struct MutableIntegerArray {
+
+	/**
+	 * @brief The superclass.
+	 */
+	IntegerArray integerArray;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	MutableIntegerArrayInterface *interface;
+
+	/**
+	 * @brief The capacity, which is always `>= self->integerArray.count`.
+	 * @private
+	 */
+	size_t capacity;
+};
+
+/**
+ * @brief The MutableIntegerArray interface.
+ */
+struct MutableIntegerArrayInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	IntegerArrayInterface integerArrayInterface;
+
+	/**
+	 * @fn void MutableIntegerArray::addValue(MutableIntegerArray *self, int64_t value)
+	 * @brief Appends the specified value to this MutableIntegerArray.
+	 * @param self The MutableIntegerArray.
+	 * @param value The value to append.
+	 * @memberof MutableIntegerArray
+	 */
+	void (*addValue)(MutableIntegerArray *self, int64_t value);
+
+	/**
+	 * @fn void MutableIntegerArray::addValues(MutableIntegerArray *self, const int64_t *values, size_t count)
+	 * @brief Appends `count` of `values` to this MutableIntegerArray.
+	 * @param self The MutableIntegerArray.
+	 * @param values The values to append.
+	 * @param count The count of `values` to append.
+	 * @memberof MutableIntegerArray
+	 */
+	void (*addValues)(MutableIntegerArray *self, const int64_t *values, size_t count);
+
+	/**
+	 * @fn MutableIntegerArray *MutableIntegerArray::init(MutableIntegerArray *self)
+	 * @brief Initializes this MutableIntegerArray.
+	 * @param self The MutableIntegerArray.
+	 * @return The initialized MutableIntegerArray, or `NULL` on error.
+	 * @memberof MutableIntegerArray
+	 */
+	MutableIntegerArray *(*init)(MutableIntegerArray *self);
+
+	/**
+	 * @fn MutableIntegerArray *MutableIntegerArray::initWithCapacity(MutableIntegerArray *self, size_t capacity)
+	 * @brief Initializes this MutableIntegerArray with the specified capacity.
+	 * @param self The MutableIntegerArray.
+	 * @param capacity The desired initial capacity.
+	 * @return The initialized MutableIntegerArray, or `NULL` on error.
+	 * @memberof MutableIntegerArray
+	 */
+	MutableIntegerArray *(*initWithCapacity)(MutableIntegerArray *self, size_t capacity);
+
+	/**
+	 * @static
+	 * @fn MutableIntegerArray *MutableIntegerArray::integerArray(void)
+	 * @brief Returns a new MutableIntegerArray.
+	 * @return The new MutableIntegerArray, or `NULL` on error.
+	 * @memberof MutableIntegerArray
+	 */
+	MutableIntegerArray *(*integerArray)(void);
+
+	/**
+	 * @fn void MutableIntegerArray::removeAllValues(MutableIntegerArray *self)
+	 * @brief Removes all values from this MutableIntegerArray.
+	 * @param self The MutableIntegerArray.
+	 * @memberof MutableIntegerArray
+	 */
+	void (*removeAllValues)(MutableIntegerArray *self);
+
+	/**
+	 * @fn void MutableIntegerArray::removeValueAtIndex(MutableIntegerArray *self, size_t index)
+	 * @brief Removes the value at the specified index.
+	 * @param self The MutableIntegerArray.
+	 * @param index The index of the value to remove.
+	 * @memberof MutableIntegerArray
+	 */
+	void (*removeValueAtIndex)(MutableIntegerArray *self, size_t index);
+
+	/**
+	 * @fn void MutableIntegerArray::setValueAtIndex(MutableIntegerArray *self, int64_t value, size_t index)
+	 * @brief Replaces the value at the specified index.
+	 * @param self The MutableIntegerArray.
+	 * @param value The value.
+	 * @param index The index of the value to replace.
+	 * @memberof MutableIntegerArray
+	 */
+	void (*setValueAtIndex)(MutableIntegerArray *self, int64_t value, size_t index);
+
+	/**
+	 * @fn void MutableIntegerArray::sort(MutableIntegerArray *self)
+	 * @brief Sorts this MutableIntegerArray in place, in ascending order.
+	 * @param self The MutableIntegerArray.
+	 * @remarks Sorting is performed by a least significant digit radix sort, in linear time.
+	 * @memberof MutableIntegerArray
+	 */
+	void (*sort)(MutableIntegerArray *self);
+};
+
+/**
+ * @fn Class *MutableIntegerArray::_MutableIntegerArray(void)
+ * @brief The MutableIntegerArray archetype.
+ * @return The MutableIntegerArray Class.
+ * @memberof MutableIntegerArray
+ */
+OBJECTIVELY_EXPORT Class *_MutableIntegerArray(void);
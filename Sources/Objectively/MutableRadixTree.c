@@ -0,0 +1,848 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <Objectively/Data.h>
+#include <Objectively/MutableRadixTree.h>
+#include <Objectively/String.h>
+
+/**
+ * @return True if `child` is a leaf, false if it is a node.
+ */
+static inline _Bool isLeaf(const ident child) {
+	return ((uintptr_t) child) & 1;
+}
+
+/**
+ * @return The leaf referenced by `child`.
+ */
+static inline RadixTreeLeaf *asLeaf(const ident child) {
+	return (RadixTreeLeaf *) (((uintptr_t) child) & ~(uintptr_t) 1);
+}
+
+/**
+ * @return The child reference for `leaf`.
+ */
+static inline ident tagLeaf(const RadixTreeLeaf *leaf) {
+	return (ident) (((uintptr_t) leaf) | 1);
+}
+
+/**
+ * @return The bytes of the String or Data `key`, with their length in `length`.
+ */
+static const uint8_t *bytesForKey(const ident key, size_t *length) {
+
+	if ($((Object *) cast(Object, key), isKindOfClass, _String())) {
+		const String *string = (String *) key;
+
+		*length = string->length;
+		return (uint8_t *) string->chars;
+	}
+
+	const Data *data = cast(Data, key);
+
+	*length = data->length;
+	return data->bytes;
+}
+
+/**
+ * @return A new leaf for the given pair.
+ */
+static RadixTreeLeaf *newLeaf(MutableRadixTree *self, const ident obj, const ident key) {
+
+	RadixTreeLeaf *leaf = malloc(sizeof(RadixTreeLeaf));
+	assert(leaf);
+
+	leaf->key = retain(key);
+	leaf->obj = retain(obj);
+	leaf->bytes = bytesForKey(leaf->key, &leaf->length);
+
+	self->radixTree.count++;
+	return leaf;
+}
+
+/**
+ * @brief Replaces the Object of `leaf` with `obj`.
+ */
+static void replaceObject(RadixTreeLeaf *leaf, const ident obj) {
+
+	ident previous = leaf->obj;
+	leaf->obj = retain(obj);
+	release(previous);
+}
+
+/**
+ * @brief Releases the pair held by `leaf`, and frees it.
+ */
+static void freeLeaf(RadixTreeLeaf *leaf) {
+
+	release(leaf->key);
+	release(leaf->obj);
+
+	free(leaf);
+}
+
+/**
+ * @return True if the key of `leaf` is exactly `bytes`.
+ */
+static inline _Bool leafMatches(const RadixTreeLeaf *leaf, const uint8_t *bytes, size_t length) {
+	return leaf->length == length && memcmp(leaf->bytes, bytes, length) == 0;
+}
+
+/**
+ * @return A new, empty node of the given type.
+ */
+static RadixTreeNode *newNode(RadixTreeNodeType type) {
+
+	RadixTreeNode *node;
+
+	switch (type) {
+		case RADIXTREE_NODE_4:
+			node = calloc(1, sizeof(RadixTreeNode4));
+			break;
+		case RADIXTREE_NODE_16:
+			node = calloc(1, sizeof(RadixTreeNode16));
+			break;
+		case RADIXTREE_NODE_48:
+			node = calloc(1, sizeof(RadixTreeNode48));
+			break;
+		default:
+			node = calloc(1, sizeof(RadixTreeNode256));
+			break;
+	}
+
+	assert(node);
+
+	node->type = type;
+	return node;
+}
+
+/**
+ * @return A new node of the given type, with the header of `node`, which is freed.
+ */
+static RadixTreeNode *resizeNode(RadixTreeNode *node, RadixTreeNodeType type) {
+
+	RadixTreeNode *resized = newNode(type);
+
+	resized->count = node->count;
+	resized->prefixLength = node->prefixLength;
+	resized->leaf = node->leaf;
+	memcpy(resized->prefix, node->prefix, sizeof(node->prefix));
+
+	switch (node->type) {
+		case RADIXTREE_NODE_4: {
+			const RadixTreeNode4 *n = (RadixTreeNode4 *) node;
+			RadixTreeNode16 *r = (RadixTreeNode16 *) resized;
+
+			memcpy(r->keys, n->keys, node->count);
+			memcpy(r->children, n->children, node->count * sizeof(ident));
+		}
+			break;
+
+		case RADIXTREE_NODE_16: {
+			const RadixTreeNode16 *n = (RadixTreeNode16 *) node;
+			if (type == RADIXTREE_NODE_4) {
+				RadixTreeNode4 *r = (RadixTreeNode4 *) resized;
+
+				memcpy(r->keys, n->keys, node->count);
+				memcpy(r->children, n->children, node->count * sizeof(ident));
+			} else {
+				RadixTreeNode48 *r = (RadixTreeNode48 *) resized;
+
+				for (size_t i = 0; i < node->count; i++) {
+					r->index[n->keys[i]] = i + 1;
+					r->children[i] = n->children[i];
+				}
+			}
+		}
+			break;
+
+		case RADIXTREE_NODE_48: {
+			const RadixTreeNode48 *n = (RadixTreeNode48 *) node;
+			if (type == RADIXTREE_NODE_16) {
+				RadixTreeNode16 *r = (RadixTreeNode16 *) resized;
+
+				size_t j = 0;
+				for (size_t i = 0; i < 256; i++) {
+					if (n->index[i]) {
+						r->keys[j] = i;
+						r->children[j] = n->children[n->index[i] - 1];
+						j++;
+					}
+				}
+			} else {
+				RadixTreeNode256 *r = (RadixTreeNode256 *) resized;
+
+				for (size_t i = 0; i < 256; i++) {
+					if (n->index[i]) {
+						r->children[i] = n->children[n->index[i] - 1];
+					}
+				}
+			}
+		}
+			break;
+
+		case RADIXTREE_NODE_256: {
+			const RadixTreeNode256 *n = (RadixTreeNode256 *) node;
+			RadixTreeNode48 *r = (RadixTreeNode48 *) resized;
+
+			size_t j = 0;
+			for (size_t i = 0; i < 256; i++) {
+				if (n->children[i]) {
+					r->index[i] = j + 1;
+					r->children[j] = n->children[i];
+					j++;
+				}
+			}
+		}
+			break;
+	}
+
+	free(node);
+	return resized;
+}
+
+/**
+ * @return The address of the child of `node` for `byte`, or `NULL`.
+ */
+static ident *slotForByte(RadixTreeNode *node, uint8_t byte) {
+
+	switch (node->type) {
+		case RADIXTREE_NODE_4: {
+			RadixTreeNode4 *n = (RadixTreeNode4 *) node;
+			for (size_t i = 0; i < node->count; i++) {
+				if (n->keys[i] == byte) {
+					return &n->children[i];
+				}
+			}
+		}
+			break;
+
+		case RADIXTREE_NODE_16: {
+			RadixTreeNode16 *n = (RadixTreeNode16 *) node;
+#if defined(__SSE2__)
+			const __m128i keys = _mm_loadu_si128((const __m128i *) n->keys);
+			const __m128i matches = _mm_cmpeq_epi8(keys, _mm_set1_epi8((char) byte));
+			const int mask = _mm_movemask_epi8(matches) & ((1 << node->count) - 1);
+			if (mask) {
+				return &n->children[__builtin_ctz(mask)];
+			}
+#else
+			for (size_t i = 0; i < node->count; i++) {
+				if (n->keys[i] == byte) {
+					return &n->children[i];
+				}
+			}
+#endif
+		}
+			break;
+
+		case RADIXTREE_NODE_48: {
+			RadixTreeNode48 *n = (RadixTreeNode48 *) node;
+			if (n->index[byte]) {
+				return &n->children[n->index[byte] - 1];
+			}
+		}
+			break;
+
+		case RADIXTREE_NODE_256: {
+			RadixTreeNode256 *n = (RadixTreeNode256 *) node;
+			if (n->children[byte]) {
+				return &n->children[byte];
+			}
+		}
+			break;
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Inserts `child` into the sorted `keys` and `children` of a node with `count` children.
+ */
+static void insertSorted(uint8_t *keys, ident *children, size_t count, uint8_t byte, ident child) {
+
+	size_t i = 0;
+	while (i < count && keys[i] < byte) {
+		i++;
+	}
+
+	memmove(keys + i + 1, keys + i, count - i);
+	memmove(children + i + 1, children + i, (count - i) * sizeof(ident));
+
+	keys[i] = byte;
+	children[i] = child;
+}
+
+/**
+ * @brief Adds `child` to `node` for `byte`, growing `node` in `ref` if it is full.
+ */
+static void addChild(ident *ref, RadixTreeNode *node, uint8_t byte, ident child) {
+
+	switch (node->type) {
+		case RADIXTREE_NODE_4:
+			if (node->count == 4) {
+				node = *ref = resizeNode(node, RADIXTREE_NODE_16);
+				addChild(ref, node, byte, child);
+				return;
+			}
+			insertSorted(((RadixTreeNode4 *) node)->keys, ((RadixTreeNode4 *) node)->children, node->count, byte, child);
+			break;
+
+		case RADIXTREE_NODE_16:
+			if (node->count == 16) {
+				node = *ref = resizeNode(node, RADIXTREE_NODE_48);
+				addChild(ref, node, byte, child);
+				return;
+			}
+			insertSorted(((RadixTreeNode16 *) node)->keys, ((RadixTreeNode16 *) node)->children, node->count, byte, child);
+			break;
+
+		case RADIXTREE_NODE_48:
+			if (node->count == 48) {
+				node = *ref = resizeNode(node, RADIXTREE_NODE_256);
+				addChild(ref, node, byte, child);
+				return;
+			}
+			((RadixTreeNode48 *) node)->children[node->count] = child;
+			((RadixTreeNode48 *) node)->index[byte] = node->count + 1;
+			break;
+
+		case RADIXTREE_NODE_256:
+			((RadixTreeNode256 *) node)->children[byte] = child;
+			break;
+	}
+
+	node->count++;
+}
+
+/**
+ * @brief Removes the child of `node` for `byte`, shrinking `node` in `ref` if it is sparse.
+ */
+static void removeChild(ident *ref, RadixTreeNode *node, uint8_t byte) {
+
+	switch (node->type) {
+		case RADIXTREE_NODE_4:
+		case RADIXTREE_NODE_16: {
+			uint8_t *keys;
+			ident *children;
+
+			if (node->type == RADIXTREE_NODE_4) {
+				keys = ((RadixTreeNode4 *) node)->keys;
+				children = ((RadixTreeNode4 *) node)->children;
+			} else {
+				keys = ((RadixTreeNode16 *) node)->keys;
+				children = ((RadixTreeNode16 *) node)->children;
+			}
+
+			size_t i = 0;
+			while (keys[i] != byte) {
+				i++;
+			}
+
+			memmove(keys + i, keys + i + 1, node->count - i - 1);
+			memmove(children + i, children + i + 1, (node->count - i - 1) * sizeof(ident));
+
+			node->count--;
+
+			if (node->type == RADIXTREE_NODE_16 && node->count <= 3) {
+				*ref = resizeNode(node, RADIXTREE_NODE_4);
+			}
+		}
+			break;
+
+		case RADIXTREE_NODE_48: {
+			RadixTreeNode48 *n = (RadixTreeNode48 *) node;
+
+			const size_t i = n->index[byte] - 1;
+			const size_t last = node->count - 1;
+
+			n->index[byte] = 0;
+
+			if (i != last) {
+				n->children[i] = n->children[last];
+				for (size_t b = 0; b < 256; b++) {
+					if (n->index[b] == last + 1) {
+						n->index[b] = i + 1;
+						break;
+					}
+				}
+			}
+
+			n->children[last] = NULL;
+			node->count--;
+
+			if (node->count <= 12) {
+				*ref = resizeNode(node, RADIXTREE_NODE_16);
+			}
+		}
+			break;
+
+		case RADIXTREE_NODE_256:
+			((RadixTreeNode256 *) node)->children[byte] = NULL;
+			node->count--;
+
+			if (node->count <= 37) {
+				*ref = resizeNode(node, RADIXTREE_NODE_48);
+			}
+			break;
+	}
+}
+
+/**
+ * @brief Replaces `node` in `ref` with its only descendant, if it no longer branches.
+ */
+static void compress(ident *ref, RadixTreeNode *node) {
+
+	if (node->count == 0) {
+		*ref = node->leaf ? tagLeaf(node->leaf) : NULL;
+		free(node);
+	} else if (node->count == 1 && node->leaf == NULL) {
+
+		assert(node->type == RADIXTREE_NODE_4);
+
+		const uint8_t byte = ((RadixTreeNode4 *) node)->keys[0];
+		const ident child = ((RadixTreeNode4 *) node)->children[0];
+
+		if (!isLeaf(child)) {
+			RadixTreeNode *descendant = child;
+
+			uint8_t prefix[RADIXTREE_MAX_PREFIX_LENGTH];
+
+			size_t length = min((size_t) node->prefixLength, (size_t) RADIXTREE_MAX_PREFIX_LENGTH);
+			memcpy(prefix, node->prefix, length);
+
+			if (length < RADIXTREE_MAX_PREFIX_LENGTH) {
+				prefix[length++] = byte;
+			}
+
+			const size_t remaining = min((size_t) descendant->prefixLength, RADIXTREE_MAX_PREFIX_LENGTH - length);
+			memcpy(prefix + length, descendant->prefix, remaining);
+			length += remaining;
+
+			memcpy(descendant->prefix, prefix, length);
+			descendant->prefixLength += node->prefixLength + 1;
+		}
+
+		*ref = child;
+		free(node);
+	}
+}
+
+/**
+ * @return A leaf beneath `child`, whose key spells out every compressed path above it.
+ */
+static const RadixTreeLeaf *anyLeaf(ident child) {
+
+	while (!isLeaf(child)) {
+
+		RadixTreeNode *node = child;
+		if (node->leaf) {
+			return node->leaf;
+		}
+
+		if (node->type == RADIXTREE_NODE_256) {
+			for (size_t i = 0; i < 256; i++) {
+				if (((RadixTreeNode256 *) node)->children[i]) {
+					child = ((RadixTreeNode256 *) node)->children[i];
+					break;
+				}
+			}
+		} else if (node->type == RADIXTREE_NODE_48) {
+			child = ((RadixTreeNode48 *) node)->children[0];
+		} else if (node->type == RADIXTREE_NODE_16) {
+			child = ((RadixTreeNode16 *) node)->children[0];
+		} else {
+			child = ((RadixTreeNode4 *) node)->children[0];
+		}
+	}
+
+	return asLeaf(child);
+}
+
+/**
+ * @return The length of the compressed path of `node` that matches `bytes` at `depth`.
+ */
+static size_t prefixMismatch(RadixTreeNode *node, const uint8_t *bytes, size_t length, size_t depth) {
+
+	size_t count = min(min((size_t) node->prefixLength, (size_t) RADIXTREE_MAX_PREFIX_LENGTH), length - depth);
+
+	size_t i = 0;
+	for (; i < count; i++) {
+		if (node->prefix[i] != bytes[depth + i]) {
+			return i;
+		}
+	}
+
+	if (node->prefixLength > RADIXTREE_MAX_PREFIX_LENGTH) {
+
+		const RadixTreeLeaf *leaf = anyLeaf(node);
+
+		count = min(min(leaf->length, length) - depth, (size_t) node->prefixLength);
+		for (; i < count; i++) {
+			if (leaf->bytes[depth + i] != bytes[depth + i]) {
+				return i;
+			}
+		}
+	}
+
+	return i;
+}
+
+/**
+ * @brief Inserts the given pair beneath `ref`, which is at `depth` of the key.
+ */
+static void insert(MutableRadixTree *self, ident *ref, const ident obj, const ident key, const uint8_t *bytes, size_t length, size_t depth) {
+
+	if (*ref == NULL) {
+		*ref = tagLeaf(newLeaf(self, obj, key));
+		return;
+	}
+
+	if (isLeaf(*ref)) {
+		RadixTreeLeaf *existing = asLeaf(*ref);
+
+		if (leafMatches(existing, bytes, length)) {
+			replaceObject(existing, obj);
+			return;
+		}
+
+		ident node = newNode(RADIXTREE_NODE_4);
+
+		const size_t count = min(existing->length, length) - depth;
+
+		size_t prefixLength = 0;
+		while (prefixLength < count && existing->bytes[depth + prefixLength] == bytes[depth + prefixLength]) {
+			prefixLength++;
+		}
+
+		((RadixTreeNode *) node)->prefixLength = prefixLength;
+		memcpy(((RadixTreeNode *) node)->prefix, bytes + depth, min(prefixLength, (size_t) RADIXTREE_MAX_PREFIX_LENGTH));
+
+		depth += prefixLength;
+
+		RadixTreeLeaf *leaf = newLeaf(self, obj, key);
+
+		if (existing->length == depth) {
+			((RadixTreeNode *) node)->leaf = existing;
+		} else {
+			addChild(&node, node, existing->bytes[depth], tagLeaf(existing));
+		}
+
+		if (length == depth) {
+			((RadixTreeNode *) node)->leaf = leaf;
+		} else {
+			addChild(&node, node, bytes[depth], tagLeaf(leaf));
+		}
+
+		*ref = node;
+		return;
+	}
+
+	RadixTreeNode *node = *ref;
+
+	if (node->prefixLength) {
+
+		const size_t mismatch = prefixMismatch(node, bytes, length, depth);
+		if (mismatch < node->prefixLength) {
+
+			ident parent = newNode(RADIXTREE_NODE_4);
+
+			((RadixTreeNode *) parent)->prefixLength = mismatch;
+			memcpy(((RadixTreeNode *) parent)->prefix, node->prefix, min(mismatch, (size_t) RADIXTREE_MAX_PREFIX_LENGTH));
+
+			uint8_t byte;
+			if (node->prefixLength <= RADIXTREE_MAX_PREFIX_LENGTH) {
+				byte = node->prefix[mismatch];
+				node->prefixLength -= mismatch + 1;
+				memmove(node->prefix, node->prefix + mismatch + 1, node->prefixLength);
+			} else {
+				const RadixTreeLeaf *leaf = anyLeaf(node);
+				byte = leaf->bytes[depth + mismatch];
+				node->prefixLength -= mismatch + 1;
+				memcpy(node->prefix, leaf->bytes + depth + mismatch + 1, min((size_t) node->prefixLength, (size_t) RADIXTREE_MAX_PREFIX_LENGTH));
+			}
+
+			addChild(&parent, parent, byte, node);
+
+			RadixTreeLeaf *leaf = newLeaf(self, obj, key);
+
+			if (length == depth + mismatch) {
+				((RadixTreeNode *) parent)->leaf = leaf;
+			} else {
+				addChild(&parent, parent, bytes[depth + mismatch], tagLeaf(leaf));
+			}
+
+			*ref = parent;
+			return;
+		}
+
+		depth += node->prefixLength;
+	}
+
+	if (depth == length) {
+		if (node->leaf) {
+			replaceObject(node->leaf, obj);
+		} else {
+			node->leaf = newLeaf(self, obj, key);
+		}
+		return;
+	}
+
+	ident *slot = slotForByte(node, bytes[depth]);
+	if (slot) {
+		insert(self, slot, obj, key, bytes, length, depth + 1);
+	} else {
+		addChild(ref, node, bytes[depth], tagLeaf(newLeaf(self, obj, key)));
+	}
+}
+
+/**
+ * @brief Removes the leaf for `bytes` beneath `ref`, which is at `depth` of the key.
+ * @return The removed leaf, or `NULL`.
+ */
+static RadixTreeLeaf *removeLeaf(ident *ref, const uint8_t *bytes, size_t length, size_t depth) {
+
+	if (*ref == NULL) {
+		return NULL;
+	}
+
+	if (isLeaf(*ref)) {
+		RadixTreeLeaf *leaf = asLeaf(*ref);
+
+		if (leafMatches(leaf, bytes, length)) {
+			*ref = NULL;
+			return leaf;
+		}
+
+		return NULL;
+	}
+
+	RadixTreeNode *node = *ref;
+
+	if (node->prefixLength) {
+
+		const size_t count = min((size_t) node->prefixLength, (size_t) RADIXTREE_MAX_PREFIX_LENGTH);
+		if (depth + count > length || memcmp(node->prefix, bytes + depth, count)) {
+			return NULL;
+		}
+
+		depth += node->prefixLength;
+	}
+
+	if (depth >= length) {
+
+		RadixTreeLeaf *leaf = node->leaf;
+		if (depth == length && leaf && leafMatches(leaf, bytes, length)) {
+			node->leaf = NULL;
+			compress(ref, node);
+			return leaf;
+		}
+
+		return NULL;
+	}
+
+	ident *slot = slotForByte(node, bytes[depth]);
+	if (slot == NULL) {
+		return NULL;
+	}
+
+	RadixTreeLeaf *leaf = removeLeaf(slot, bytes, length, depth + 1);
+	if (leaf) {
+		if (*slot == NULL) {
+			removeChild(ref, node, bytes[depth]);
+		}
+		compress(ref, *ref);
+	}
+
+	return leaf;
+}
+
+/**
+ * @brief Releases the pairs beneath `child`, and frees it.
+ */
+static void freeChild(ident child) {
+
+	if (child == NULL) {
+		return;
+	}
+
+	if (isLeaf(child)) {
+		freeLeaf(asLeaf(child));
+		return;
+	}
+
+	RadixTreeNode *node = child;
+
+	if (node->leaf) {
+		freeLeaf(node->leaf);
+	}
+
+	switch (node->type) {
+		case RADIXTREE_NODE_4:
+			for (size_t i = 0; i < node->count; i++) {
+				freeChild(((RadixTreeNode4 *) node)->children[i]);
+			}
+			break;
+		case RADIXTREE_NODE_16:
+			for (size_t i = 0; i < node->count; i++) {
+				freeChild(((RadixTreeNode16 *) node)->children[i]);
+			}
+			break;
+		case RADIXTREE_NODE_48:
+			for (size_t i = 0; i < node->count; i++) {
+				freeChild(((RadixTreeNode48 *) node)->children[i]);
+			}
+			break;
+		case RADIXTREE_NODE_256:
+			for (size_t i = 0; i < 256; i++) {
+				freeChild(((RadixTreeNode256 *) node)->children[i]);
+			}
+			break;
+	}
+
+	free(node);
+}
+
+#define _Class _MutableRadixTree
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	return (Object *) $((RadixTree *) self, mutableCopy);
+}
+
+#pragma mark - MutableRadixTree
+
+/**
+ * @fn MutableRadixTree *MutableRadixTree::init(MutableRadixTree *self)
+ * @memberof MutableRadixTree
+ */
+static MutableRadixTree *init(MutableRadixTree *self) {
+
+	return (MutableRadixTree *) super(Object, self, init);
+}
+
+/**
+ * @fn MutableRadixTree *MutableRadixTree::radixTree(void)
+ * @memberof MutableRadixTree
+ */
+static MutableRadixTree *radixTree(void) {
+
+	return $(alloc(MutableRadixTree), init);
+}
+
+/**
+ * @fn void MutableRadixTree::removeAllObjects(MutableRadixTree *self)
+ * @memberof MutableRadixTree
+ */
+static void removeAllObjects(MutableRadixTree *self) {
+
+	freeChild(self->radixTree.root);
+
+	self->radixTree.root = NULL;
+	self->radixTree.count = 0;
+}
+
+/**
+ * @fn void MutableRadixTree::removeObjectForKey(MutableRadixTree *self, const ident key)
+ * @memberof MutableRadixTree
+ */
+static void removeObjectForKey(MutableRadixTree *self, const ident key) {
+
+	size_t length;
+	const uint8_t *bytes = bytesForKey(key, &length);
+
+	RadixTreeLeaf *leaf = removeLeaf(&self->radixTree.root, bytes, length, 0);
+	if (leaf) {
+		freeLeaf(leaf);
+		self->radixTree.count--;
+	}
+}
+
+/**
+ * @fn void MutableRadixTree::setObjectForKey(MutableRadixTree *self, const ident obj, const ident key)
+ * @memberof MutableRadixTree
+ */
+static void setObjectForKey(MutableRadixTree *self, const ident obj, const ident key) {
+
+	assert(obj);
+
+	size_t length;
+	const uint8_t *bytes = bytesForKey(key, &length);
+
+	insert(self, &self->radixTree.root, obj, key, bytes, length, 0);
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+
+	MutableRadixTreeInterface *mutableRadixTree = (MutableRadixTreeInterface *) clazz->def->interface;
+
+	mutableRadixTree->init = init;
+	mutableRadixTree->radixTree = radixTree;
+	mutableRadixTree->removeAllObjects = removeAllObjects;
+	mutableRadixTree->removeObjectForKey = removeObjectForKey;
+	mutableRadixTree->setObjectForKey = setObjectForKey;
+}
+
+/**
+ * @fn Class *MutableRadixTree::_MutableRadixTree(void)
+ * @memberof MutableRadixTree
+ */
+Class *_MutableRadixTree(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "MutableRadixTree";
+		clazz.superclass = _RadixTree();
+		clazz.instanceSize = sizeof(MutableRadixTree);
+		clazz.interfaceOffset = offsetof(MutableRadixTree, interface);
+		clazz.interfaceSize = sizeof(MutableRadixTreeInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
@@ -0,0 +1,116 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/RadixTree.h>
+
+/**
+ * @file
+ * @brief Mutable adaptive radix trees.
+ */
+
+typedef struct MutableRadixTreeInterface MutableRadixTreeInterface;
+
+/**
+ * @brief Mutable adaptive radix trees.
+ * @extends RadixTree
+ * @ingroup Collections
+ */
+struct MutableRadixTree {
+
+	/**
+	 * @brief The superclass.
+	 */
+	RadixTree radixTree;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	MutableRadixTreeInterface *interface;
+};
+
+/**
+ * @brief The MutableRadixTree interface.
+ */
+struct MutableRadixTreeInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	RadixTreeInterface radixTreeInterface;
+
+	/**
+	 * @fn MutableRadixTree *MutableRadixTree::init(MutableRadixTree *self)
+	 * @brief Initializes this MutableRadixTree.
+	 * @param self The MutableRadixTree.
+	 * @return The initialized MutableRadixTree, or `NULL` on error.
+	 * @memberof MutableRadixTree
+	 */
+	MutableRadixTree *(*init)(MutableRadixTree *self);
+
+	/**
+	 * @static
+	 * @fn MutableRadixTree *MutableRadixTree::radixTree(void)
+	 * @brief Returns a new MutableRadixTree.
+	 * @return The new MutableRadixTree, or `NULL` on error.
+	 * @memberof MutableRadixTree
+	 */
+	MutableRadixTree *(*radixTree)(void);
+
+	/**
+	 * @fn void MutableRadixTree::removeAllObjects(MutableRadixTree *self)
+	 * @brief Removes all key-value pairs from this MutableRadixTree.
+	 * @param self The MutableRadixTree.
+	 * @memberof MutableRadixTree
+	 */
+	void (*removeAllObjects)(MutableRadixTree *self);
+
+	/**
+	 * @fn void MutableRadixTree::removeObjectForKey(MutableRadixTree *self, const ident key)
+	 * @brief Removes the Object with the specified key from this MutableRadixTree.
+	 * @param self The MutableRadixTree.
+	 * @param key The String or Data key of the Object to remove.
+	 * @memberof MutableRadixTree
+	 */
+	void (*removeObjectForKey)(MutableRadixTree *self, const ident key);
+
+	/**
+	 * @fn void MutableRadixTree::setObjectForKey(MutableRadixTree *self, const ident obj, const ident key)
+	 * @brief Sets a key-value pair in this MutableRadixTree.
+	 * @param self The MutableRadixTree.
+	 * @param obj The Object to set.
+	 * @param key The String or Data key.
+	 * @memberof MutableRadixTree
+	 */
+	void (*setObjectForKey)(MutableRadixTree *self, const ident obj, const ident key);
+};
+
+/**
+ * @fn Class *MutableRadixTree::_MutableRadixTree(void)
+ * @brief The MutableRadixTree archetype.
+ * @return The MutableRadixTree Class.
+ * @memberof MutableRadixTree
+ */
+OBJECTIVELY_EXPORT Class *_MutableRadixTree(void);
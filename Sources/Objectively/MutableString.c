@@ -22,12 +22,159 @@
  */
 
 #include <assert.h>
+#include <math.h>
 #include <stdarg.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 
 #include <Objectively/MutableString.h>
+#include <Objectively/StringSearcher.h>
+
+/**
+ * @brief Ensures that `self` can hold `length` bytes and a null terminator, growing its capacity
+ * geometrically.
+ */
+static void reserve(MutableString *self, size_t length) {
+
+	String *string = (String *) self;
+
+	if (string->chars == string->inlineChars) {
+		self->capacity = STRING_INLINE_CAPACITY;
+	} else if (string->chars && self->capacity <= string->length) {
+		self->capacity = string->length + 1;
+	}
+
+	if (length >= self->capacity) {
+
+		const size_t capacity = max(self->capacity * 2, length + 1);
+
+		if (string->chars == NULL || string->chars == string->inlineChars) {
+			char *chars = malloc(capacity);
+			assert(chars);
+
+			if (string->chars) {
+				memcpy(chars, string->chars, string->length);
+			}
+
+			chars[string->length] = '\0';
+			string->chars = chars;
+		} else {
+			string->chars = realloc(string->chars, capacity);
+			assert(string->chars);
+		}
+
+		self->capacity = capacity;
+	}
+}
+
+/**
+ * @brief Replaces the characters within `range` of `self` with `length` bytes of `chars`, in place.
+ */
+static void replaceBytesInRange(MutableString *self, const Range range, const char *chars, size_t length) {
+
+	String *string = (String *) self;
+
+	assert(range.location >= 0);
+	assert(range.location + range.length <= string->length);
+
+	char *copy = NULL;
+
+	const uintptr_t address = (uintptr_t) chars;
+	const uintptr_t start = (uintptr_t) string->chars;
+
+	if (length && string->chars && address >= start && address < start + string->length + 1) {
+		copy = malloc(length);
+		assert(copy);
+
+		memcpy(copy, chars, length);
+		chars = copy;
+	}
+
+	const size_t newLength = string->length - range.length + length;
+
+	reserve(self, newLength);
+
+	char *ptr = string->chars + range.location;
+	memmove(ptr + length, ptr + range.length, string->length - range.location - range.length + 1);
+
+	if (length) {
+		memcpy(ptr, chars, length);
+	}
+
+	string->length = newLength;
+
+	free(copy);
+}
+
+/**
+ * @brief Replaces the occurrences of the pattern of `searcher` within `range` of `self` with
+ * `length` bytes of `replacement`, in a single pass.
+ */
+static void replaceOccurrences(MutableString *self, const StringSearcher *searcher, const Range range, const char *replacement, size_t length) {
+
+	Range *ranges;
+	const size_t count = $(searcher, rangesInString, (String *) self, range, &ranges);
+	if (count) {
+
+		const size_t newLength = self->string.length - count * searcher->length + count * length;
+
+		char *chars = malloc(newLength + 1);
+		assert(chars);
+
+		char *out = chars;
+		const char *in = self->string.chars;
+
+		for (size_t i = 0; i < count; i++) {
+
+			const char *match = self->string.chars + ranges[i].location;
+
+			memcpy(out, in, match - in);
+			out += match - in;
+
+			memcpy(out, replacement, length);
+			out += length;
+
+			in = match + ranges[i].length;
+		}
+
+		const char *end = self->string.chars + self->string.length;
+
+		memcpy(out, in, end - in);
+		out += end - in;
+
+		*out = '\0';
+
+		if (self->string.chars != self->string.inlineChars) {
+			free(self->string.chars);
+		}
+
+		self->string.chars = chars;
+		self->string.length = newLength;
+		self->capacity = newLength + 1;
+	}
+
+	free(ranges);
+}
+
+/**
+ * @brief Maps the case of `self` in place.
+ */
+static void mapCase(MutableString *self, CaseMapping mapping) {
+
+	String *string = (String *) self;
+
+	if (string->length) {
+
+		const size_t length = CaseMapCharacters(string->chars, string->length, NULL, mapping);
+
+		reserve(self, length);
+		CaseMapCharacters(string->chars, string->length, string->chars, mapping);
+
+		string->length = length;
+		string->chars[length] = '\0';
+	}
+}
 
 #define _Class _MutableString
 
@@ -45,6 +192,15 @@ static Object *copy(const Object *self) {
 
 #pragma mark - MutableString
 
+/**
+ * @fn void MutableString::appendBytes(MutableString *self, const uint8_t *bytes, size_t length)
+ * @memberof MutableString
+ */
+static void appendBytes(MutableString *self, const uint8_t *bytes, size_t length) {
+
+	replaceBytesInRange(self, (Range) { .location = self->string.length }, (const char *) bytes, length);
+}
+
 /**
  * @fn void MutableString::appendCharacters(MutableString *self, const char *chars)
  * @memberof MutableString
@@ -52,32 +208,73 @@ static Object *copy(const Object *self) {
 static void appendCharacters(MutableString *self, const char *chars) {
 
 	if (chars) {
+		$(self, appendBytes, (const uint8_t *) chars, strlen(chars));
+	}
+}
+
+/**
+ * @fn void MutableString::appendDouble(MutableString *self, double value, int precision)
+ * @memberof MutableString
+ */
+static void appendDouble(MutableString *self, double value, int precision) {
+
+	static const uint64_t powers[] = {
+		1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+		1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+		100000000000000ull, 1000000000000000ull
+	};
+
+	assert(precision >= 0);
 
-		const size_t len = strlen(chars);
-		if (len) {
+	if (isfinite(value) && precision < (int) lengthof(powers)) {
 
-			const size_t newSize = self->string.length + strlen(chars) + 1;
-			const size_t newCapacity = (newSize / _pageSize + 1) * _pageSize;
+		const double factor = powers[precision];
+		const double product = fabs(value) * factor;
 
-			if (newCapacity > self->capacity) {
+		if (product < 4503599627370496.0) {
 
-				if (self->string.length) {
-					self->string.chars = realloc(self->string.chars, newCapacity);
-				} else {
-					self->string.chars = malloc(newCapacity);
+			double scaled = floor(product);
+
+			const double remainder = product - scaled;
+			if (remainder > 0.5) {
+				scaled += 1.0;
+			} else if (remainder == 0.5) {
+				const double error = fma(fabs(value), factor, -product);
+				if (error > 0.0 || (error == 0.0 && fmod(scaled, 2.0) != 0.0)) {
+					scaled += 1.0;
 				}
+			}
 
-				assert(self->string.chars);
-				self->capacity = newCapacity;
+			uint64_t integer = (uint64_t) scaled / powers[precision];
+			uint64_t fraction = (uint64_t) scaled % powers[precision];
+
+			char buffer[40];
+			char *c = buffer + sizeof(buffer);
+
+			for (int i = 0; i < precision; i++) {
+				*--c = '0' + fraction % 10;
+				fraction /= 10;
 			}
 
-			ident ptr = self->string.chars + self->string.length;
-			memmove(ptr, chars, len);
+			if (precision) {
+				*--c = '.';
+			}
+
+			do {
+				*--c = '0' + integer % 10;
+				integer /= 10;
+			} while (integer);
+
+			if (signbit(value)) {
+				*--c = '-';
+			}
 
-			self->string.chars[newSize - 1] = '\0';
-			self->string.length += len;
+			$(self, appendBytes, (const uint8_t *) c, buffer + sizeof(buffer) - c);
+			return;
 		}
 	}
+
+	$(self, appendFormat, "%.*f", precision, value);
 }
 
 /**
@@ -94,6 +291,46 @@ static void appendFormat(MutableString *self, const char *fmt, ...) {
 	va_end(args);
 }
 
+/**
+ * @fn void MutableString::appendHex(MutableString *self, uint64_t value)
+ * @memberof MutableString
+ */
+static void appendHex(MutableString *self, uint64_t value) {
+
+	char buffer[16];
+	char *c = buffer + sizeof(buffer);
+
+	do {
+		*--c = "0123456789abcdef"[value & 0xf];
+		value >>= 4;
+	} while (value);
+
+	$(self, appendBytes, (const uint8_t *) c, buffer + sizeof(buffer) - c);
+}
+
+/**
+ * @fn void MutableString::appendInteger(MutableString *self, int64_t value)
+ * @memberof MutableString
+ */
+static void appendInteger(MutableString *self, int64_t value) {
+
+	uint64_t magnitude = value < 0 ? -(uint64_t) value : (uint64_t) value;
+
+	char buffer[20];
+	char *c = buffer + sizeof(buffer);
+
+	do {
+		*--c = '0' + magnitude % 10;
+		magnitude /= 10;
+	} while (magnitude);
+
+	if (value < 0) {
+		*--c = '-';
+	}
+
+	$(self, appendBytes, (const uint8_t *) c, buffer + sizeof(buffer) - c);
+}
+
 /**
  * @fn void MutableString::appendString(MutableString *self, const String *string)
  * @memberof MutableString
@@ -101,7 +338,7 @@ static void appendFormat(MutableString *self, const char *fmt, ...) {
 static void appendString(MutableString *self, const String *string) {
 
 	if (string) {
-		$(self, appendCharacters, string->chars);
+		$(self, appendBytes, (const uint8_t *) string->chars, string->length);
 	}
 }
 
@@ -110,14 +347,28 @@ static void appendString(MutableString *self, const String *string) {
  * @memberof MutableString
  */
 static void appendVaList(MutableString *self, const char *fmt, va_list args) {
-	char *chars;
 
-	const int len = vasprintf(&chars, fmt, args);
-	if (len > 0) {
-		$(self, appendCharacters, chars);
+	String *string = (String *) self;
+
+	reserve(self, string->length);
+
+	va_list copy;
+	va_copy(copy, args);
+
+	const size_t available = self->capacity - string->length;
+
+	const int len = vsnprintf(string->chars + string->length, available, fmt, copy);
+	assert(len >= 0);
+
+	va_end(copy);
+
+	if ((size_t) len >= available) {
+		reserve(self, string->length + len);
+
+		vsnprintf(string->chars + string->length, len + 1, fmt, args);
 	}
 
-	free(chars);
+	string->length += len;
 }
 
 /**
@@ -126,15 +377,7 @@ static void appendVaList(MutableString *self, const char *fmt, va_list args) {
  */
 static void deleteCharactersInRange(MutableString *self, const Range range) {
 
-	assert(range.location >= 0);
-	assert(range.length <= self->string.length);
-
-	ident ptr = self->string.chars + range.location;
-	const size_t length = self->string.length - range.location - range.length + 1;
-
-	memmove(ptr, ptr + range.length, length);
-
-	self->string.length -= range.length;
+	replaceBytesInRange(self, range, NULL, 0);
 }
 
 /**
@@ -154,12 +397,17 @@ static MutableString *initWithCapacity(MutableString *self, size_t capacity) {
 
 	self = (MutableString *) super(String, self, initWithMemory, NULL, 0);
 	if (self) {
-		if (capacity) {
-			self->string.chars = calloc(capacity, sizeof(char));
+		if (capacity > STRING_INLINE_CAPACITY) {
+			self->string.chars = malloc(capacity);
 			assert(self->string.chars);
 
 			self->capacity = capacity;
+		} else {
+			self->string.chars = self->string.inlineChars;
+			self->capacity = STRING_INLINE_CAPACITY;
 		}
+
+		self->string.chars[0] = '\0';
 	}
 
 	return self;
@@ -171,7 +419,7 @@ static MutableString *initWithCapacity(MutableString *self, size_t capacity) {
  */
 static MutableString *initWithString(MutableString *self, const String *string) {
 
-	self = $(self, init);
+	self = $(self, initWithCapacity, string ? string->length + 1 : 0);
 	if (self) {
 		$(self, appendString, string);
 	}
@@ -185,9 +433,9 @@ static MutableString *initWithString(MutableString *self, const String *string)
  */
 static void insertCharactersAtIndex(MutableString *self, const char *chars, size_t index) {
 
-	const Range range = { .location = index };
+	assert(chars);
 
-	$(self, replaceCharactersInRange, range, chars);
+	replaceBytesInRange(self, (Range) { .location = index }, chars, strlen(chars));
 }
 
 /**
@@ -196,27 +444,29 @@ static void insertCharactersAtIndex(MutableString *self, const char *chars, size
  */
 static void insertStringAtIndex(MutableString *self, const String *string, size_t index) {
 
-	$(self, insertCharactersAtIndex, string->chars, index);
+	assert(string);
+
+	replaceBytesInRange(self, (Range) { .location = index }, string->chars, string->length);
 }
 
 /**
- * @fn void MutableString::replaceCharactersInRange(MutableString *self, const Range range, const char *chars)
+ * @fn void MutableString::lowercase(MutableString *self)
  * @memberof MutableString
  */
-static void replaceCharactersInRange(MutableString *self, const Range range, const char *chars) {
-
-	assert(range.location >= 0);
-	assert(range.location + range.length <= self->string.length);
+static void lowercase(MutableString *self) {
 
-	char *remainder = strdup(self->string.chars + range.location + range.length);
+	mapCase(self, CASE_MAPPING_LOWERCASE);
+}
 
-	self->string.length = range.location;
-	self->string.chars[range.location + 1] = '\0';
+/**
+ * @fn void MutableString::replaceCharactersInRange(MutableString *self, const Range range, const char *chars)
+ * @memberof MutableString
+ */
+static void replaceCharactersInRange(MutableString *self, const Range range, const char *chars) {
 
-	$(self, appendCharacters, chars);
-	$(self, appendCharacters, remainder);
+	assert(chars);
 
-	free(remainder);
+	replaceBytesInRange(self, range, chars, strlen(chars));
 }
 
 /**
@@ -239,22 +489,11 @@ static void replaceOccurrencesOfCharactersInRange(MutableString *self, const cha
 	assert(range.location >= 0);
 	assert(range.location + range.length <= self->string.length);
 
-	Range search = range;
-	while (true) {
+	StringSearcher *searcher = $(alloc(StringSearcher), initWithCharacters, chars);
 
-		const Range result = $((String *) self, rangeOfCharacters, chars, search);
-		if (result.location == -1) {
-			break;
-		}
+	replaceOccurrences(self, searcher, range, replacement, strlen(replacement));
 
-		$(self, replaceCharactersInRange, result, replacement);
-
-		search.length -= (result.location - search.location);
-		search.length -= strlen(replacement);
-		search.length += ((int) strlen(replacement) - (int) strlen(chars));
-
-		search.location = result.location + strlen(replacement);
-	}
+	release(searcher);
 }
 
 /**
@@ -274,7 +513,14 @@ static void replaceOccurrencesOfStringInRange(MutableString *self, const String
 	assert(string);
 	assert(replacement);
 
-	$(self, replaceOccurrencesOfCharactersInRange, string->chars, range, replacement->chars);
+	assert(range.location >= 0);
+	assert(range.location + range.length <= self->string.length);
+
+	StringSearcher *searcher = $(alloc(StringSearcher), initWithString, string);
+
+	replaceOccurrences(self, searcher, range, replacement->chars, replacement->length);
+
+	release(searcher);
 }
 
 /**
@@ -283,7 +529,9 @@ static void replaceOccurrencesOfStringInRange(MutableString *self, const String
  */
 static void replaceStringInRange(MutableString *self, const Range range, const String *string) {
 
-	$(self, replaceCharactersInRange, range, string->chars);
+	assert(string);
+
+	replaceBytesInRange(self, range, string->chars, string->length);
 }
 
 /**
@@ -310,11 +558,29 @@ static MutableString *stringWithCapacity(size_t capacity) {
  */
 static void trim(MutableString *self) {
 
-	String *trimmed = $((String *) self, trimmedString);
+	const String *string = (String *) self;
 
-	$(self, replaceStringInRange, (const Range) { .length = self->string.length }, trimmed);
+	size_t end = string->length;
+	while (end && isspace(string->chars[end - 1])) {
+		end--;
+	}
+
+	size_t start = 0;
+	while (start < end && isspace(string->chars[start])) {
+		start++;
+	}
+
+	replaceBytesInRange(self, (Range) { .location = end, .length = string->length - end }, NULL, 0);
+	replaceBytesInRange(self, (Range) { .location = 0, .length = start }, NULL, 0);
+}
+
+/**
+ * @fn void MutableString::uppercase(MutableString *self)
+ * @memberof MutableString
+ */
+static void uppercase(MutableString *self) {
 
-	release(trimmed);
+	mapCase(self, CASE_MAPPING_UPPERCASE);
 }
 
 #pragma mark - Class lifecycle
@@ -330,8 +596,12 @@ static void initialize(Class *clazz) {
 
 	MutableStringInterface *mutableString = (MutableStringInterface *) clazz->def->interface;
 
+	mutableString->appendBytes = appendBytes;
 	mutableString->appendCharacters = appendCharacters;
+	mutableString->appendDouble = appendDouble;
 	mutableString->appendFormat = appendFormat;
+	mutableString->appendHex = appendHex;
+	mutableString->appendInteger = appendInteger;
 	mutableString->appendString = appendString;
 	mutableString->appendVaList = appendVaList;
 	mutableString->deleteCharactersInRange = deleteCharactersInRange;
@@ -340,6 +610,7 @@ static void initialize(Class *clazz) {
 	mutableString->initWithString = initWithString;
 	mutableString->insertCharactersAtIndex = insertCharactersAtIndex;
 	mutableString->insertStringAtIndex = insertStringAtIndex;
+	mutableString->lowercase = lowercase;
 	mutableString->replaceCharactersInRange = replaceCharactersInRange;
 	mutableString->replaceOccurrencesOfCharacters = replaceOccurrencesOfCharacters;
 	mutableString->replaceOccurrencesOfCharactersInRange = replaceOccurrencesOfCharactersInRange;
@@ -349,6 +620,7 @@ static void initialize(Class *clazz) {
 	mutableString->string = string;
 	mutableString->stringWithCapacity = stringWithCapacity;
 	mutableString->trim = trim;
+	mutableString->uppercase = uppercase;
 }
 
 /**
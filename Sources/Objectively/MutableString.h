@@ -52,7 +52,8 @@ struct MutableString {
 
 	/**
 	 * @brief The capacity of the String, in bytes.
-	 * @remarks The capacity is always `>= self->string.length`.
+	 * @remarks The capacity is always `>= self->string.length`, and grows geometrically. Small
+	 * MutableStrings use the String's inline storage.
 	 * @private
 	 */
 	size_t capacity;
@@ -68,6 +69,16 @@ struct MutableStringInterface {
 	 */
 	StringInterface stringInterface;
 
+	/**
+	 * @fn void MutableString::appendBytes(MutableString *self, const uint8_t *bytes, size_t length)
+	 * @brief Appends `length` bytes of UTF-8 encoded characters, which need not be null-terminated.
+	 * @param self The MutableString.
+	 * @param bytes The UTF-8 encoded characters.
+	 * @param length The length of `bytes`.
+	 * @memberof MutableString
+	 */
+	void (*appendBytes)(MutableString *self, const uint8_t *bytes, size_t length);
+
 	/**
 	 * @fn void MutableString::appendCharacters(MutableString *self, const char *chars)
 	 * @brief Appends the specified UTF-8 encoded C string.
@@ -77,6 +88,18 @@ struct MutableStringInterface {
 	 */
 	void (*appendCharacters)(MutableString *self, const char *chars);
 
+	/**
+	 * @fn void MutableString::appendDouble(MutableString *self, double value, int precision)
+	 * @brief Appends the decimal representation of `value`, as by the format `%.*f`.
+	 * @param self The MutableString.
+	 * @param value The value.
+	 * @param precision The count of digits after the decimal point.
+	 * @remarks Values whose scaled magnitude is below 2^52 are formatted without `printf`, rounding
+	 * exactly as `printf` does.
+	 * @memberof MutableString
+	 */
+	void (*appendDouble)(MutableString *self, double value, int precision);
+
 	/**
 	 * @fn void MutableString::appendFormat(MutableString *self, const char *fmt, ...)
 	 * @brief Appends the specified formatted string.
@@ -86,6 +109,24 @@ struct MutableStringInterface {
 	 */
 	void (*appendFormat)(MutableString *self, const char *fmt, ...);
 
+	/**
+	 * @fn void MutableString::appendHex(MutableString *self, uint64_t value)
+	 * @brief Appends the lowercase hexadecimal representation of `value`, without prefix.
+	 * @param self The MutableString.
+	 * @param value The value.
+	 * @memberof MutableString
+	 */
+	void (*appendHex)(MutableString *self, uint64_t value);
+
+	/**
+	 * @fn void MutableString::appendInteger(MutableString *self, int64_t value)
+	 * @brief Appends the decimal representation of `value`.
+	 * @param self The MutableString.
+	 * @param value The value.
+	 * @memberof MutableString
+	 */
+	void (*appendInteger)(MutableString *self, int64_t value);
+
 	/**
 	 * @fn void MutableString::appendString(MutableString *self, const String *string)
 	 * @brief Appends the specified String to this MutableString.
@@ -101,6 +142,8 @@ struct MutableStringInterface {
 	 * @param self The MutableString.
 	 * @param fmt The format string.
 	 * @param args The format arguments.
+	 * @remarks The string is formatted directly into this MutableString's spare capacity, so
+	 * `args` must not reference its characters.
 	 * @memberof MutableString
 	 */
 	void (*appendVaList)(MutableString *self, const char *fmt, va_list args);
@@ -163,6 +206,15 @@ struct MutableStringInterface {
 	 */
 	void (*insertStringAtIndex)(MutableString *self, const String *string, size_t index);
 
+	/**
+	 * @fn void MutableString::lowercase(MutableString *self)
+	 * @brief Maps this MutableString to lowercase in place, in the current locale.
+	 * @param self The MutableString.
+	 * @remarks ASCII letters are mapped without regard to locale.
+	 * @memberof MutableString
+	 */
+	void (*lowercase)(MutableString *self);
+
 	/**
 	 * @fn void MutableString::replaceCharactersInRange(MutableString *self, const Range range, const char *chars)
 	 * @brief Replaces the characters in `range` with the given characters.
@@ -251,6 +303,15 @@ struct MutableStringInterface {
 	 * @memberof MutableString
 	 */
 	void (*trim)(MutableString *self);
+
+	/**
+	 * @fn void MutableString::uppercase(MutableString *self)
+	 * @brief Maps this MutableString to uppercase in place, in the current locale.
+	 * @param self The MutableString.
+	 * @remarks ASCII letters are mapped without regard to locale.
+	 * @memberof MutableString
+	 */
+	void (*uppercase)(MutableString *self);
 };
 
 /**
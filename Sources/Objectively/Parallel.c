@@ -0,0 +1,225 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <Objectively/Config.h>
+
+#include <assert.h>
+#include <stdlib.h>
+
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <Objectively/Condition.h>
+#include <Objectively/Once.h>
+#include <Objectively/Parallel.h>
+#include <Objectively/Thread.h>
+
+size_t ParallelChunkSize = PARALLEL_DEFAULT_CHUNK_SIZE;
+
+size_t ParallelThreadCount;
+
+/**
+ * @brief The shared state of a parallel loop.
+ */
+typedef struct {
+	size_t count;
+	size_t chunks;
+	size_t chunkSize;
+	volatile long next;
+	ParallelFunction function;
+	ident data;
+	size_t slots;
+	size_t active;
+} Parallel;
+
+/**
+ * @brief The persistent pool of worker Threads, started on first use.
+ */
+static struct {
+	Condition *condition;
+	Thread **threads;
+	size_t size;
+	Parallel *parallel;
+	unsigned long generation;
+} _pool;
+
+/**
+ * @return The number of online processors.
+ */
+static size_t processors(void) {
+
+#if defined(_SC_NPROCESSORS_ONLN)
+	const long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return n > 0 ? n : 1;
+#else
+	return 1;
+#endif
+}
+
+/**
+ * @brief Claims and processes chunks until none remain.
+ */
+static void work(Parallel *parallel) {
+
+	while (true) {
+
+		const size_t chunk = __sync_add_and_fetch(&parallel->next, 1) - 1;
+		if (chunk >= parallel->chunks) {
+			break;
+		}
+
+		const size_t location = chunk * parallel->chunkSize;
+		const Range range = {
+			.location = location,
+			.length = min(parallel->chunkSize, parallel->count - location)
+		};
+
+		parallel->function(range, chunk, parallel->data);
+	}
+}
+
+/**
+ * @brief ThreadFunction for worker Threads.
+ * @details Workers wait for a loop to be published to the pool, and join it while it has free
+ * slots. The publishing thread waits for every worker that joined to finish before returning.
+ */
+static ident run(Thread *thread) {
+
+	unsigned long generation = 0;
+
+	while (true) {
+
+		Parallel *parallel = NULL;
+
+		synchronized(_pool.condition, {
+			while (_pool.parallel == NULL || _pool.generation == generation) {
+				$(_pool.condition, wait);
+			}
+
+			generation = _pool.generation;
+
+			if (_pool.parallel->slots) {
+				_pool.parallel->slots--;
+				_pool.parallel->active++;
+				parallel = _pool.parallel;
+			}
+		});
+
+		if (parallel) {
+			work(parallel);
+
+			synchronized(_pool.condition, {
+				if (--parallel->active == 0) {
+					$(_pool.condition, broadcast);
+				}
+			});
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Starts the worker Threads.
+ */
+static void startPool(void) {
+
+	_pool.condition = $(alloc(Condition), init);
+	assert(_pool.condition);
+
+	_pool.size = max(ParallelThreadCount, processors()) - 1;
+	if (_pool.size) {
+
+		_pool.threads = calloc(_pool.size, sizeof(Thread *));
+		assert(_pool.threads);
+
+		for (size_t i = 0; i < _pool.size; i++) {
+			_pool.threads[i] = $(alloc(Thread), initWithFunction, run, NULL);
+			assert(_pool.threads[i]);
+
+			$(_pool.threads[i], start);
+			$(_pool.threads[i], detach);
+		}
+	}
+}
+
+size_t ParallelChunkCount(size_t count) {
+
+	const size_t chunkSize = ParallelChunkSize ?: PARALLEL_DEFAULT_CHUNK_SIZE;
+
+	return (count + chunkSize - 1) / chunkSize;
+}
+
+void ParallelFor(size_t count, ParallelFunction function, ident data) {
+
+	assert(function);
+
+	Parallel parallel = {
+		.count = count,
+		.chunks = ParallelChunkCount(count),
+		.chunkSize = ParallelChunkSize ?: PARALLEL_DEFAULT_CHUNK_SIZE,
+		.function = function,
+		.data = data
+	};
+
+	if (parallel.chunks < 2) {
+		if (count) {
+			function((Range) { .location = 0, .length = count }, 0, data);
+		}
+		return;
+	}
+
+	static Once once;
+	do_once(&once, startPool());
+
+	const size_t threadCount = min(ParallelThreadCount ?: processors(), parallel.chunks);
+
+	parallel.slots = min(threadCount - 1, _pool.size);
+
+	bool dispatched = false;
+
+	if (parallel.slots) {
+		synchronized(_pool.condition, {
+			if (_pool.parallel == NULL) {
+				_pool.parallel = &parallel;
+				_pool.generation++;
+				dispatched = true;
+
+				$(_pool.condition, broadcast);
+			}
+		});
+	}
+
+	work(&parallel);
+
+	if (dispatched) {
+		synchronized(_pool.condition, {
+			_pool.parallel = NULL;
+
+			while (parallel.active) {
+				$(_pool.condition, wait);
+			}
+		});
+	}
+}
@@ -0,0 +1,81 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Types.h>
+
+/**
+ * @file
+ * @brief Data-parallel helpers for partitioning work across Threads.
+ * @ingroup Concurrency
+ */
+
+/**
+ * @brief The default number of elements per chunk.
+ */
+#define PARALLEL_DEFAULT_CHUNK_SIZE 4096
+
+/**
+ * @brief The function type for processing one chunk of a parallel loop.
+ * @param range The Range of indexes comprising the chunk.
+ * @param chunk The ordinal of the chunk, in `[0, ParallelChunkCount(count))`.
+ * @param data User data.
+ */
+typedef void (*ParallelFunction)(const Range range, size_t chunk, ident data);
+
+/**
+ * @brief The number of elements per chunk for parallel operations.
+ * @details Inputs that fit within a single chunk are processed serially on the calling thread.
+ * Defaults to `PARALLEL_DEFAULT_CHUNK_SIZE`.
+ * @ingroup Concurrency
+ */
+OBJECTIVELY_EXPORT size_t ParallelChunkSize;
+
+/**
+ * @brief The maximum number of threads (including the calling thread) for parallel operations.
+ * @details Defaults to `0`, meaning the number of online processors. Worker Threads are started
+ * once, on first use, so raising this value afterwards can not exceed the size of the pool.
+ * @ingroup Concurrency
+ */
+OBJECTIVELY_EXPORT size_t ParallelThreadCount;
+
+/**
+ * @param count The number of elements.
+ * @return The number of chunks that `count` elements are partitioned into.
+ * @ingroup Concurrency
+ */
+OBJECTIVELY_EXPORT size_t ParallelChunkCount(size_t count);
+
+/**
+ * @brief Partitions `[0, count)` into chunks, and invokes `function` for each chunk, in parallel.
+ * @param count The number of elements.
+ * @param function The ParallelFunction.
+ * @param data User data.
+ * @remarks This function returns once all chunks have been processed. Chunks are not processed
+ * in any particular order, but each chunk is identified by its ordinal, so that results may be
+ * merged in order. Chunks are dispatched to a persistent pool of worker Threads; calls made while
+ * the pool is busy, including nested calls from within `function`, run on the calling thread.
+ * @ingroup Concurrency
+ */
+OBJECTIVELY_EXPORT void ParallelFor(size_t count, ParallelFunction function, ident data);
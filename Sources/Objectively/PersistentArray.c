@@ -0,0 +1,747 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/Hash.h>
+#include <Objectively/MutableArray.h>
+#include <Objectively/PersistentArray.h>
+
+#define _Class _PersistentArray
+
+#define VECTOR_BITS 5
+#define VECTOR_WIDTH (1 << VECTOR_BITS)
+#define VECTOR_MASK (VECTOR_WIDTH - 1)
+
+/**
+ * @brief A trie node. Leaf nodes (level `0`) hold Objects; inner nodes hold child nodes.
+ */
+typedef struct PersistentArrayNode {
+
+	/**
+	 * @brief The reference count, updated atomically.
+	 */
+	volatile long refs;
+
+	/**
+	 * @brief The edit token of the transient that owns this node, or `0`.
+	 */
+	uintptr_t edit;
+
+	/**
+	 * @brief The Objects or child nodes.
+	 */
+	ident slots[VECTOR_WIDTH];
+} Node;
+
+static volatile long _edits;
+
+/**
+ * @return A new, unique edit token.
+ */
+static uintptr_t nextEdit(void) {
+	return (uintptr_t) __sync_add_and_fetch(&_edits, 1);
+}
+
+static Node *allocNode(uintptr_t edit) {
+
+	Node *node = calloc(1, sizeof(Node));
+	assert(node);
+
+	node->refs = 1;
+	node->edit = edit;
+
+	return node;
+}
+
+static Node *retainNode(Node *node) {
+
+	if (node) {
+		__sync_add_and_fetch(&node->refs, 1);
+	}
+
+	return node;
+}
+
+/**
+ * @brief Releases `node`, which resides at `level`.
+ */
+static void releaseNode(Node *node, unsigned level) {
+
+	if (node && __sync_add_and_fetch(&node->refs, -1) == 0) {
+
+		for (size_t i = 0; i < VECTOR_WIDTH; i++) {
+			if (level) {
+				releaseNode(node->slots[i], level - VECTOR_BITS);
+			} else {
+				release(node->slots[i]);
+			}
+		}
+
+		free(node);
+	}
+}
+
+/**
+ * @return `node` itself if it is owned by `edit`, or a copy of it owned by `edit`.
+ */
+static Node *editableNode(Node *node, uintptr_t edit, unsigned level) {
+
+	if (edit && node->edit == edit) {
+		return retainNode(node);
+	}
+
+	Node *copy = malloc(sizeof(Node));
+	assert(copy);
+
+	memcpy(copy, node, sizeof(Node));
+
+	copy->refs = 1;
+	copy->edit = edit;
+
+	for (size_t i = 0; i < VECTOR_WIDTH; i++) {
+		if (copy->slots[i]) {
+			if (level) {
+				retainNode(copy->slots[i]);
+			} else {
+				retain(copy->slots[i]);
+			}
+		}
+	}
+
+	return copy;
+}
+
+/**
+ * @return The offset of the first element of the tail.
+ */
+static inline size_t tailOffset(size_t count) {
+	return count < VECTOR_WIDTH ? 0 : ((count - 1) >> VECTOR_BITS) << VECTOR_BITS;
+}
+
+/**
+ * @return The leaf node containing the element at `index`.
+ */
+static Node *leafFor(const PersistentArray *self, size_t index) {
+
+	if (index >= tailOffset(self->count)) {
+		return self->locals.tail;
+	}
+
+	Node *node = self->locals.root;
+	for (unsigned level = self->locals.shift; level > 0; level -= VECTOR_BITS) {
+		node = node->slots[(index >> level) & VECTOR_MASK];
+	}
+
+	return node;
+}
+
+/**
+ * @return A chain of new nodes from `level` down to `leaf`, which is adopted.
+ */
+static Node *newPath(uintptr_t edit, unsigned level, Node *leaf) {
+
+	if (level == 0) {
+		return leaf;
+	}
+
+	Node *node = allocNode(edit);
+	node->slots[0] = newPath(edit, level - VECTOR_BITS, leaf);
+
+	return node;
+}
+
+/**
+ * @brief Pushes the full `tail`, which is adopted, into the subtree `parent` at `level`.
+ * @return The resulting node, retained.
+ */
+static Node *pushTail(Node *parent, uintptr_t edit, unsigned level, size_t count, Node *tail) {
+
+	Node *node = parent ? editableNode(parent, edit, level) : allocNode(edit);
+
+	const size_t index = ((count - 1) >> level) & VECTOR_MASK;
+	Node *child = node->slots[index];
+
+	if (level == VECTOR_BITS) {
+		node->slots[index] = tail;
+	} else if (child) {
+		node->slots[index] = pushTail(child, edit, level - VECTOR_BITS, count, tail);
+	} else {
+		node->slots[index] = newPath(edit, level - VECTOR_BITS, tail);
+	}
+
+	releaseNode(child, level - VECTOR_BITS);
+	return node;
+}
+
+/**
+ * @brief Replaces the element at `index` beneath `node` at `level`.
+ * @return The resulting node, retained.
+ */
+static Node *assocNode(Node *node, uintptr_t edit, unsigned level, size_t index, const ident obj) {
+
+	Node *editable = editableNode(node, edit, level);
+
+	const size_t i = (index >> level) & VECTOR_MASK;
+
+	if (level == 0) {
+		retain(obj);
+		release(editable->slots[i]);
+		editable->slots[i] = obj;
+	} else {
+		Node *child = editable->slots[i];
+		editable->slots[i] = assocNode(child, edit, level - VECTOR_BITS, index, obj);
+		releaseNode(child, level - VECTOR_BITS);
+	}
+
+	return editable;
+}
+
+/**
+ * @brief Removes the rightmost leaf beneath `node` at `level`.
+ * @return The resulting node, retained, or `NULL` if it is empty.
+ */
+static Node *popTail(Node *node, uintptr_t edit, unsigned level, size_t count) {
+
+	const size_t index = ((count - 2) >> level) & VECTOR_MASK;
+
+	if (level > VECTOR_BITS) {
+		Node *child = popTail(node->slots[index], edit, level - VECTOR_BITS, count);
+		if (child == NULL && index == 0) {
+			return NULL;
+		}
+
+		Node *editable = editableNode(node, edit, level);
+		releaseNode(editable->slots[index], level - VECTOR_BITS);
+		editable->slots[index] = child;
+
+		return editable;
+	}
+
+	if (index == 0) {
+		return NULL;
+	}
+
+	Node *editable = editableNode(node, edit, level);
+	releaseNode(editable->slots[index], 0);
+	editable->slots[index] = NULL;
+
+	return editable;
+}
+
+/**
+ * @brief Appends `obj` to `self` using `edit`.
+ */
+static void append(PersistentArray *self, uintptr_t edit, const ident obj) {
+
+	Node *tail;
+
+	const size_t count = self->count;
+	if (count - tailOffset(count) < VECTOR_WIDTH) {
+
+		tail = editableNode(self->locals.tail, edit, 0);
+		tail->slots[count - tailOffset(count)] = retain(obj);
+
+	} else {
+		Node *root;
+		unsigned shift = self->locals.shift;
+
+		if ((count >> VECTOR_BITS) > (1u << shift)) {
+			root = allocNode(edit);
+			root->slots[0] = retainNode(self->locals.root);
+			root->slots[1] = newPath(edit, shift, retainNode(self->locals.tail));
+			shift += VECTOR_BITS;
+		} else {
+			root = pushTail(self->locals.root, edit, shift, count, retainNode(self->locals.tail));
+		}
+
+		releaseNode(self->locals.root, self->locals.shift);
+		self->locals.root = root;
+		self->locals.shift = shift;
+
+		tail = allocNode(edit);
+		tail->slots[0] = retain(obj);
+	}
+
+	releaseNode(self->locals.tail, 0);
+	self->locals.tail = tail;
+
+	self->count++;
+}
+
+/**
+ * @brief Sets `obj` at `index` of `self` using `edit`.
+ */
+static void assoc(PersistentArray *self, uintptr_t edit, const ident obj, size_t index) {
+
+	assert(obj);
+	assert(index <= self->count);
+
+	if (index == self->count) {
+		append(self, edit, obj);
+	} else if (index >= tailOffset(self->count)) {
+		Node *tail = assocNode(self->locals.tail, edit, 0, index, obj);
+		releaseNode(self->locals.tail, 0);
+		self->locals.tail = tail;
+	} else {
+		Node *root = assocNode(self->locals.root, edit, self->locals.shift, index, obj);
+		releaseNode(self->locals.root, self->locals.shift);
+		self->locals.root = root;
+	}
+}
+
+/**
+ * @brief Removes the last element of `self` using `edit`.
+ */
+static void pop(PersistentArray *self, uintptr_t edit) {
+
+	assert(self->count);
+
+	const size_t count = self->count;
+	if (count == 1 || count - tailOffset(count) > 1) {
+
+		Node *tail = editableNode(self->locals.tail, edit, 0);
+		const size_t i = (count - 1) & VECTOR_MASK;
+
+		release(tail->slots[i]);
+		tail->slots[i] = NULL;
+
+		releaseNode(self->locals.tail, 0);
+		self->locals.tail = tail;
+
+	} else {
+		Node *tail = retainNode(leafFor(self, count - 2));
+
+		unsigned shift = self->locals.shift;
+
+		Node *root = popTail(self->locals.root, edit, shift, count);
+		if (root && shift > VECTOR_BITS && root->slots[1] == NULL) {
+			Node *child = retainNode(root->slots[0]);
+			releaseNode(root, shift);
+			root = child;
+			shift -= VECTOR_BITS;
+		}
+
+		releaseNode(self->locals.root, self->locals.shift);
+		self->locals.root = root;
+		self->locals.shift = root ? shift : VECTOR_BITS;
+
+		releaseNode(self->locals.tail, 0);
+		self->locals.tail = tail;
+	}
+
+	self->count--;
+}
+
+/**
+ * @brief Creates an unowned PersistentArray sharing the trie of `self`.
+ * @details If `self` is transient, its edit token is rotated so that it may no longer mutate the
+ * nodes it now shares.
+ */
+static PersistentArray *snapshot(const PersistentArray *self) {
+
+	PersistentArray *that = $(alloc(PersistentArray), init);
+
+	releaseNode(that->locals.tail, 0);
+
+	that->locals.root = retainNode(self->locals.root);
+	that->locals.tail = retainNode(self->locals.tail);
+	that->locals.shift = self->locals.shift;
+	that->count = self->count;
+
+	if (self->locals.edit) {
+		((PersistentArray *) self)->locals.edit = nextEdit();
+	}
+
+	return that;
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	PersistentArray *this = (PersistentArray *) self;
+
+	if (this->locals.edit == 0) {
+		return (Object *) retain(this);
+	}
+
+	return (Object *) snapshot(this);
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	PersistentArray *this = (PersistentArray *) self;
+
+	releaseNode(this->locals.root, this->locals.shift);
+	releaseNode(this->locals.tail, 0);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	Array *array = $((PersistentArray *) self, allObjects);
+
+	String *description = $((Object *) array, description);
+
+	release(array);
+
+	return description;
+}
+
+/**
+ * @brief PersistentArrayEnumerator for hash.
+ */
+static void hash_enumerator(const PersistentArray *array, ident obj, ident data) {
+	*(int *) data = HashForObject(*(int *) data, obj);
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	const PersistentArray *this = (PersistentArray *) self;
+
+	int hash = HashForInteger(HASH_SEED, this->count);
+
+	$(this, enumerateObjects, hash_enumerator, &hash);
+
+	return hash;
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, _PersistentArray())) {
+
+		const PersistentArray *this = (PersistentArray *) self;
+		const PersistentArray *that = (PersistentArray *) other;
+
+		if (this->count == that->count) {
+
+			const Node *a = NULL, *b = NULL;
+			for (size_t i = 0; i < this->count; i++) {
+
+				if ((i & VECTOR_MASK) == 0) {
+					a = leafFor(this, i);
+					b = leafFor(that, i);
+					if (a == b) {
+						i += VECTOR_MASK;
+						continue;
+					}
+				}
+
+				const Object *obj = a->slots[i & VECTOR_MASK];
+				if ($(obj, isEqual, b->slots[i & VECTOR_MASK]) == false) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+#pragma mark - PersistentArray
+
+/**
+ * @fn void PersistentArray::addObject(PersistentArray *self, const ident obj)
+ * @memberof PersistentArray
+ */
+static void addObject(PersistentArray *self, const ident obj) {
+
+	assert(self->locals.edit);
+	assert(obj);
+
+	append(self, self->locals.edit, obj);
+}
+
+/**
+ * @brief PersistentArrayEnumerator for allObjects.
+ */
+static void allObjects_enumerator(const PersistentArray *array, ident obj, ident data) {
+	$((MutableArray *) data, addObject, obj);
+}
+
+/**
+ * @fn Array *PersistentArray::allObjects(const PersistentArray *self)
+ * @memberof PersistentArray
+ */
+static Array *allObjects(const PersistentArray *self) {
+
+	MutableArray *objects = $(alloc(MutableArray), initWithCapacity, self->count);
+
+	$(self, enumerateObjects, allObjects_enumerator, objects);
+
+	return (Array *) objects;
+}
+
+/**
+ * @fn void PersistentArray::enumerateObjects(const PersistentArray *self, PersistentArrayEnumerator enumerator, ident data)
+ * @memberof PersistentArray
+ */
+static void enumerateObjects(const PersistentArray *self, PersistentArrayEnumerator enumerator, ident data) {
+
+	assert(enumerator);
+
+	for (size_t i = 0; i < self->count; i += VECTOR_WIDTH) {
+
+		const Node *leaf = leafFor(self, i);
+		const size_t count = min(self->count - i, (size_t) VECTOR_WIDTH);
+
+		for (size_t j = 0; j < count; j++) {
+			enumerator(self, leaf->slots[j], data);
+		}
+	}
+}
+
+/**
+ * @fn PersistentArray *PersistentArray::init(PersistentArray *self)
+ * @memberof PersistentArray
+ */
+static PersistentArray *init(PersistentArray *self) {
+
+	self = (PersistentArray *) super(Object, self, init);
+	if (self) {
+		self->locals.shift = VECTOR_BITS;
+		self->locals.tail = allocNode(0);
+	}
+
+	return self;
+}
+
+/**
+ * @fn PersistentArray *PersistentArray::initWithArray(PersistentArray *self, const Array *array)
+ * @memberof PersistentArray
+ */
+static PersistentArray *initWithArray(PersistentArray *self, const Array *array) {
+
+	self = $(self, init);
+	if (self) {
+		if (array) {
+			const uintptr_t edit = nextEdit();
+
+			for (size_t i = 0; i < array->count; i++) {
+				append(self, edit, array->elements[i]);
+			}
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn PersistentArray *PersistentArray::initWithObjects(PersistentArray *self, ...)
+ * @memberof PersistentArray
+ */
+static PersistentArray *initWithObjects(PersistentArray *self, ...) {
+
+	self = $(self, init);
+	if (self) {
+		const uintptr_t edit = nextEdit();
+
+		va_list args;
+		va_start(args, self);
+
+		ident obj;
+		while ((obj = va_arg(args, ident))) {
+			append(self, edit, obj);
+		}
+
+		va_end(args);
+	}
+
+	return self;
+}
+
+/**
+ * @fn ident PersistentArray::objectAtIndex(const PersistentArray *self, size_t index)
+ * @memberof PersistentArray
+ */
+static ident objectAtIndex(const PersistentArray *self, size_t index) {
+
+	assert(index < self->count);
+
+	return leafFor(self, index)->slots[index & VECTOR_MASK];
+}
+
+/**
+ * @fn void PersistentArray::persistent(PersistentArray *self)
+ * @memberof PersistentArray
+ */
+static void persistent(PersistentArray *self) {
+	self->locals.edit = 0;
+}
+
+/**
+ * @fn void PersistentArray::removeLastObject(PersistentArray *self)
+ * @memberof PersistentArray
+ */
+static void removeLastObject(PersistentArray *self) {
+
+	assert(self->locals.edit);
+
+	pop(self, self->locals.edit);
+}
+
+/**
+ * @fn void PersistentArray::setObjectAtIndex(PersistentArray *self, const ident obj, size_t index)
+ * @memberof PersistentArray
+ */
+static void setObjectAtIndex(PersistentArray *self, const ident obj, size_t index) {
+
+	assert(self->locals.edit);
+
+	assoc(self, self->locals.edit, obj, index);
+}
+
+/**
+ * @fn PersistentArray *PersistentArray::transient(const PersistentArray *self)
+ * @memberof PersistentArray
+ */
+static PersistentArray *transient(const PersistentArray *self) {
+
+	PersistentArray *that = snapshot(self);
+
+	that->locals.edit = nextEdit();
+
+	return that;
+}
+
+/**
+ * @fn PersistentArray *PersistentArray::withObject(const PersistentArray *self, const ident obj)
+ * @memberof PersistentArray
+ */
+static PersistentArray *withObject(const PersistentArray *self, const ident obj) {
+
+	assert(obj);
+
+	PersistentArray *that = snapshot(self);
+
+	append(that, 0, obj);
+
+	return that;
+}
+
+/**
+ * @fn PersistentArray *PersistentArray::withObjectAtIndex(const PersistentArray *self, const ident obj, size_t index)
+ * @memberof PersistentArray
+ */
+static PersistentArray *withObjectAtIndex(const PersistentArray *self, const ident obj, size_t index) {
+
+	PersistentArray *that = snapshot(self);
+
+	assoc(that, 0, obj, index);
+
+	return that;
+}
+
+/**
+ * @fn PersistentArray *PersistentArray::withoutLastObject(const PersistentArray *self)
+ * @memberof PersistentArray
+ */
+static PersistentArray *withoutLastObject(const PersistentArray *self) {
+
+	PersistentArray *that = snapshot(self);
+
+	pop(that, 0);
+
+	return that;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->description = description;
+	object->hash = hash;
+	object->isEqual = isEqual;
+
+	PersistentArrayInterface *array = (PersistentArrayInterface *) clazz->def->interface;
+
+	array->addObject = addObject;
+	array->allObjects = allObjects;
+	array->enumerateObjects = enumerateObjects;
+	array->init = init;
+	array->initWithArray = initWithArray;
+	array->initWithObjects = initWithObjects;
+	array->objectAtIndex = objectAtIndex;
+	array->persistent = persistent;
+	array->removeLastObject = removeLastObject;
+	array->setObjectAtIndex = setObjectAtIndex;
+	array->transient = transient;
+	array->withObject = withObject;
+	array->withObjectAtIndex = withObjectAtIndex;
+	array->withoutLastObject = withoutLastObject;
+}
+
+/**
+ * @fn Class *PersistentArray::_PersistentArray(void)
+ * @memberof PersistentArray
+ */
+Class *_PersistentArray(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "PersistentArray";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(PersistentArray);
+		clazz.interfaceOffset = offsetof(PersistentArray, interface);
+		clazz.interfaceSize = sizeof(PersistentArrayInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
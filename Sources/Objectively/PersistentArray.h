@@ -0,0 +1,245 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+
+/**
+ * @file
+ * @brief Persistent (immutable, structurally shared) arrays.
+ */
+
+typedef struct PersistentArray PersistentArray;
+typedef struct PersistentArrayInterface PersistentArrayInterface;
+
+/**
+ * @brief A function type for PersistentArray enumeration (iteration).
+ * @param array The PersistentArray.
+ * @param obj The Object for the current iteration.
+ * @param data User data.
+ */
+typedef void (*PersistentArrayEnumerator)(const PersistentArray *array, ident obj, ident data);
+
+/**
+ * @brief Persistent arrays, backed by a 32-way vector trie with a tail.
+ * @details Each version of a PersistentArray is immutable. Appending, replacing or removing the
+ * last element returns a new version in `O(log32 n)` that shares all untouched trie nodes with its
+ * predecessor. Trie nodes are reference counted atomically, so versions may be shared across
+ * threads without locking. Copying a PersistentArray is `O(1)`.
+ * @details For bulk construction, PersistentArray::transient returns an editable version that
+ * mutates the nodes it owns in place, until it is sealed with PersistentArray::persistent.
+ * @extends Object
+ * @ingroup Collections
+ */
+struct PersistentArray {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	PersistentArrayInterface *interface;
+
+	/**
+	 * @brief The count of elements.
+	 */
+	size_t count;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The edit token of a transient, or `0` once persistent.
+		 */
+		uintptr_t edit;
+
+		/**
+		 * @brief The bit shift of the root node's level.
+		 */
+		unsigned shift;
+
+		/**
+		 * @brief The root node of the trie, or `NULL`.
+		 */
+		struct PersistentArrayNode *root;
+
+		/**
+		 * @brief The tail node, holding the last (up to) 32 elements.
+		 */
+		struct PersistentArrayNode *tail;
+	} locals;
+};
+
+/**
+ * @brief The PersistentArray interface.
+ */
+struct PersistentArrayInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn void PersistentArray::addObject(PersistentArray *self, const ident obj)
+	 * @brief Appends the given Object to this transient PersistentArray.
+	 * @param self The transient PersistentArray.
+	 * @param obj The Object.
+	 * @memberof PersistentArray
+	 */
+	void (*addObject)(PersistentArray *self, const ident obj);
+
+	/**
+	 * @fn Array *PersistentArray::allObjects(const PersistentArray *self)
+	 * @param self The PersistentArray.
+	 * @return An Array containing all Objects in this PersistentArray, in order.
+	 * @memberof PersistentArray
+	 */
+	Array *(*allObjects)(const PersistentArray *self);
+
+	/**
+	 * @fn void PersistentArray::enumerateObjects(const PersistentArray *self, PersistentArrayEnumerator enumerator, ident data)
+	 * @brief Enumerate the elements of this PersistentArray with the given function.
+	 * @param self The PersistentArray.
+	 * @param enumerator The enumerator function.
+	 * @param data User data.
+	 * @memberof PersistentArray
+	 */
+	void (*enumerateObjects)(const PersistentArray *self, PersistentArrayEnumerator enumerator, ident data);
+
+	/**
+	 * @fn PersistentArray *PersistentArray::init(PersistentArray *self)
+	 * @brief Initializes this PersistentArray to be empty.
+	 * @param self The PersistentArray.
+	 * @return The initialized PersistentArray, or `NULL` on error.
+	 * @memberof PersistentArray
+	 */
+	PersistentArray *(*init)(PersistentArray *self);
+
+	/**
+	 * @fn PersistentArray *PersistentArray::initWithArray(PersistentArray *self, const Array *array)
+	 * @brief Initializes this PersistentArray with the contents of `array`.
+	 * @param self The PersistentArray.
+	 * @param array An Array.
+	 * @return The initialized PersistentArray, or `NULL` on error.
+	 * @memberof PersistentArray
+	 */
+	PersistentArray *(*initWithArray)(PersistentArray *self, const Array *array);
+
+	/**
+	 * @fn PersistentArray *PersistentArray::initWithObjects(PersistentArray *self, ...)
+	 * @brief Initializes this PersistentArray with the specified `NULL`-terminated Objects.
+	 * @param self The PersistentArray.
+	 * @return The initialized PersistentArray, or `NULL` on error.
+	 * @memberof PersistentArray
+	 */
+	PersistentArray *(*initWithObjects)(PersistentArray *self, ...);
+
+	/**
+	 * @fn ident PersistentArray::objectAtIndex(const PersistentArray *self, size_t index)
+	 * @param self The PersistentArray.
+	 * @param index The index of the desired Object.
+	 * @return The Object at the specified index.
+	 * @memberof PersistentArray
+	 */
+	ident (*objectAtIndex)(const PersistentArray *self, size_t index);
+
+	/**
+	 * @fn void PersistentArray::persistent(PersistentArray *self)
+	 * @brief Seals this transient PersistentArray, making it immutable.
+	 * @param self The transient PersistentArray.
+	 * @remarks This is `O(1)`. Sealing a PersistentArray that is not transient has no effect.
+	 * @memberof PersistentArray
+	 */
+	void (*persistent)(PersistentArray *self);
+
+	/**
+	 * @fn void PersistentArray::removeLastObject(PersistentArray *self)
+	 * @brief Removes the last Object from this transient PersistentArray.
+	 * @param self The transient PersistentArray.
+	 * @memberof PersistentArray
+	 */
+	void (*removeLastObject)(PersistentArray *self);
+
+	/**
+	 * @fn void PersistentArray::setObjectAtIndex(PersistentArray *self, const ident obj, size_t index)
+	 * @brief Replaces the Object at `index` in this transient PersistentArray.
+	 * @param self The transient PersistentArray.
+	 * @param obj The Object.
+	 * @param index The index, which may equal the count to append.
+	 * @memberof PersistentArray
+	 */
+	void (*setObjectAtIndex)(PersistentArray *self, const ident obj, size_t index);
+
+	/**
+	 * @fn PersistentArray *PersistentArray::transient(const PersistentArray *self)
+	 * @brief Creates a transient (editable) version of this PersistentArray.
+	 * @param self The PersistentArray.
+	 * @return The transient PersistentArray, which shares structure with this one.
+	 * @see PersistentArray::persistent(PersistentArray *)
+	 * @memberof PersistentArray
+	 */
+	PersistentArray *(*transient)(const PersistentArray *self);
+
+	/**
+	 * @fn PersistentArray *PersistentArray::withObject(const PersistentArray *self, const ident obj)
+	 * @param self The PersistentArray.
+	 * @param obj The Object.
+	 * @return A new version of this PersistentArray with `obj` appended.
+	 * @memberof PersistentArray
+	 */
+	PersistentArray *(*withObject)(const PersistentArray *self, const ident obj);
+
+	/**
+	 * @fn PersistentArray *PersistentArray::withObjectAtIndex(const PersistentArray *self, const ident obj, size_t index)
+	 * @param self The PersistentArray.
+	 * @param obj The Object.
+	 * @param index The index, which may equal the count to append.
+	 * @return A new version of this PersistentArray with `obj` at `index`.
+	 * @memberof PersistentArray
+	 */
+	PersistentArray *(*withObjectAtIndex)(const PersistentArray *self, const ident obj, size_t index);
+
+	/**
+	 * @fn PersistentArray *PersistentArray::withoutLastObject(const PersistentArray *self)
+	 * @param self The PersistentArray, which must not be empty.
+	 * @return A new version of this PersistentArray without its last Object.
+	 * @memberof PersistentArray
+	 */
+	PersistentArray *(*withoutLastObject)(const PersistentArray *self);
+};
+
+/**
+ * @fn Class *PersistentArray::_PersistentArray(void)
+ * @brief The PersistentArray archetype.
+ * @return The PersistentArray Class.
+ * @memberof PersistentArray
+ */
+OBJECTIVELY_EXPORT Class *_PersistentArray(void);
@@ -0,0 +1,1086 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/Hash.h>
+#include <Objectively/MutableArray.h>
+#include <Objectively/MutableString.h>
+#include <Objectively/PersistentDictionary.h>
+
+#define _Class _PersistentDictionary
+
+#define HAMT_BITS 5
+#define HAMT_MASK 0x1f
+#define HAMT_HASH_BITS 32
+
+/**
+ * @brief A trie node. Pairs occupy the first `2 * dataCount` slots, followed by child nodes.
+ * @details Collision nodes hold pairs whose hashes are identical in all bits.
+ */
+typedef struct PersistentDictionaryNode {
+
+	/**
+	 * @brief The reference count, updated atomically.
+	 */
+	volatile long refs;
+
+	/**
+	 * @brief The edit token of the transient that owns this node, or `0`.
+	 */
+	uintptr_t edit;
+
+	/**
+	 * @brief The bitmaps of pairs and of child nodes.
+	 */
+	uint32_t dataMap, nodeMap;
+
+	/**
+	 * @brief The count of pairs, for collision nodes only.
+	 */
+	uint32_t collisions;
+
+	/**
+	 * @brief True if this is a collision node.
+	 */
+	_Bool collision;
+
+	/**
+	 * @brief The pairs, followed by the child nodes.
+	 */
+	ident slots[];
+} Node;
+
+static volatile long _edits;
+
+/**
+ * @return A new, unique edit token.
+ */
+static uintptr_t nextEdit(void) {
+	return (uintptr_t) __sync_add_and_fetch(&_edits, 1);
+}
+
+/**
+ * @return The count of set bits in `map`.
+ */
+static inline unsigned popcount(uint32_t map) {
+#if defined(__GNUC__)
+	return __builtin_popcount(map);
+#else
+	map = map - ((map >> 1) & 0x55555555);
+	map = (map & 0x33333333) + ((map >> 2) & 0x33333333);
+	return (((map + (map >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24;
+#endif
+}
+
+/**
+ * @return The well-distributed 32 bit hash of `key`.
+ */
+static uint32_t hashKey(const ident key) {
+
+	uint32_t hash = (uint32_t) $((Object *) key, hash);
+
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6b;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35;
+	hash ^= hash >> 16;
+
+	return hash;
+}
+
+/**
+ * @return True if `a` and `b` are equal keys.
+ */
+static inline _Bool keysEqual(const ident a, const ident b) {
+	return a == b || $((Object *) a, isEqual, b);
+}
+
+static inline uint32_t bitpos(uint32_t hash, unsigned shift) {
+	return 1u << ((hash >> shift) & HAMT_MASK);
+}
+
+static inline unsigned indexOf(uint32_t map, uint32_t bit) {
+	return popcount(map & (bit - 1));
+}
+
+static inline unsigned dataCount(const Node *node) {
+	return node->collision ? node->collisions : popcount(node->dataMap);
+}
+
+static inline unsigned nodeCount(const Node *node) {
+	return node->collision ? 0 : popcount(node->nodeMap);
+}
+
+static inline Node **children(const Node *node) {
+	return (Node **) (node->slots + 2 * dataCount(node));
+}
+
+/**
+ * @brief Allocates a node with room for `pairs` pairs and `nodes` children.
+ */
+static Node *allocNode(uintptr_t edit, uint32_t dataMap, uint32_t nodeMap, unsigned pairs, unsigned nodes) {
+
+	Node *node = calloc(1, sizeof(Node) + (2 * pairs + nodes) * sizeof(ident));
+	assert(node);
+
+	node->refs = 1;
+	node->edit = edit;
+	node->dataMap = dataMap;
+	node->nodeMap = nodeMap;
+
+	return node;
+}
+
+/**
+ * @brief Allocates a collision node with room for `pairs` pairs.
+ */
+static Node *allocCollisionNode(uintptr_t edit, unsigned pairs) {
+
+	Node *node = allocNode(edit, 0, 0, pairs, 0);
+
+	node->collision = true;
+	node->collisions = pairs;
+
+	return node;
+}
+
+static Node *retainNode(Node *node) {
+
+	if (node) {
+		__sync_add_and_fetch(&node->refs, 1);
+	}
+
+	return node;
+}
+
+static void releaseNode(Node *node) {
+
+	if (node && __sync_add_and_fetch(&node->refs, -1) == 0) {
+
+		const unsigned pairs = dataCount(node), nodes = nodeCount(node);
+
+		for (unsigned i = 0; i < 2 * pairs; i++) {
+			release(node->slots[i]);
+		}
+
+		Node **nodeChildren = children(node);
+		for (unsigned i = 0; i < nodes; i++) {
+			releaseNode(nodeChildren[i]);
+		}
+
+		free(node);
+	}
+}
+
+/**
+ * @brief Retains the pairs and children of a freshly copied node, skipping vacant slots.
+ */
+static void retainContents(Node *node) {
+
+	const unsigned pairs = dataCount(node), nodes = nodeCount(node);
+
+	for (unsigned i = 0; i < 2 * pairs; i++) {
+		if (node->slots[i]) {
+			retain(node->slots[i]);
+		}
+	}
+
+	Node **nodeChildren = children(node);
+	for (unsigned i = 0; i < nodes; i++) {
+		retainNode(nodeChildren[i]);
+	}
+}
+
+/**
+ * @return `node` itself if it is owned by `edit`, or a copy of it owned by `edit`.
+ */
+static Node *editableNode(Node *node, uintptr_t edit) {
+
+	if (edit && node->edit == edit) {
+		return retainNode(node);
+	}
+
+	const size_t slots = 2 * dataCount(node) + nodeCount(node);
+
+	Node *copy = malloc(sizeof(Node) + slots * sizeof(ident));
+	assert(copy);
+
+	memcpy(copy, node, sizeof(Node) + slots * sizeof(ident));
+
+	copy->refs = 1;
+	copy->edit = edit;
+
+	retainContents(copy);
+
+	return copy;
+}
+
+/**
+ * @return A copy of `node` with the pair for `bit` inserted.
+ */
+static Node *insertPair(const Node *node, uintptr_t edit, uint32_t bit, const ident key, const ident obj) {
+
+	const unsigned pairs = dataCount(node), nodes = nodeCount(node);
+	const unsigned index = indexOf(node->dataMap, bit);
+
+	Node *copy = allocNode(edit, node->dataMap | bit, node->nodeMap, pairs + 1, nodes);
+
+	memcpy(copy->slots, node->slots, 2 * index * sizeof(ident));
+	memcpy(copy->slots + 2 * index + 2, node->slots + 2 * index, (2 * (pairs - index) + nodes) * sizeof(ident));
+
+	retainContents(copy);
+
+	copy->slots[2 * index] = retain(key);
+	copy->slots[2 * index + 1] = retain(obj);
+
+	return copy;
+}
+
+/**
+ * @return A copy of `node` with the pair for `bit` removed.
+ */
+static Node *removePair(const Node *node, uintptr_t edit, uint32_t bit) {
+
+	const unsigned pairs = dataCount(node), nodes = nodeCount(node);
+	const unsigned index = indexOf(node->dataMap, bit);
+
+	Node *copy = allocNode(edit, node->dataMap & ~bit, node->nodeMap, pairs - 1, nodes);
+
+	memcpy(copy->slots, node->slots, 2 * index * sizeof(ident));
+	memcpy(copy->slots + 2 * index, node->slots + 2 * index + 2, (2 * (pairs - index - 1) + nodes) * sizeof(ident));
+
+	retainContents(copy);
+
+	return copy;
+}
+
+/**
+ * @return A copy of `node` with the pair for `bit` replaced by `child`, whose reference is adopted.
+ */
+static Node *pairToNode(const Node *node, uintptr_t edit, uint32_t bit, Node *child) {
+
+	const unsigned pairs = dataCount(node), nodes = nodeCount(node);
+	const unsigned index = indexOf(node->dataMap, bit);
+	const unsigned childIndex = indexOf(node->nodeMap, bit);
+
+	Node *copy = allocNode(edit, node->dataMap & ~bit, node->nodeMap | bit, pairs - 1, nodes + 1);
+
+	memcpy(copy->slots, node->slots, 2 * index * sizeof(ident));
+	memcpy(copy->slots + 2 * index, node->slots + 2 * index + 2, 2 * (pairs - index - 1) * sizeof(ident));
+
+	Node **src = children(node), **dest = children(copy);
+
+	memcpy(dest, src, childIndex * sizeof(Node *));
+	memcpy(dest + childIndex + 1, src + childIndex, (nodes - childIndex) * sizeof(Node *));
+	dest[childIndex] = NULL;
+
+	retainContents(copy);
+
+	dest[childIndex] = child;
+	return copy;
+}
+
+/**
+ * @return A copy of `node` with the child for `bit` replaced by the given pair.
+ */
+static Node *nodeToPair(const Node *node, uintptr_t edit, uint32_t bit, const ident key, const ident obj) {
+
+	const unsigned pairs = dataCount(node), nodes = nodeCount(node);
+	const unsigned index = indexOf(node->dataMap, bit);
+	const unsigned childIndex = indexOf(node->nodeMap, bit);
+
+	Node *copy = allocNode(edit, node->dataMap | bit, node->nodeMap & ~bit, pairs + 1, nodes - 1);
+
+	memcpy(copy->slots, node->slots, 2 * index * sizeof(ident));
+	memcpy(copy->slots + 2 * index + 2, node->slots + 2 * index, 2 * (pairs - index) * sizeof(ident));
+
+	Node **src = children(node), **dest = children(copy);
+
+	memcpy(dest, src, childIndex * sizeof(Node *));
+	memcpy(dest + childIndex, src + childIndex + 1, (nodes - childIndex - 1) * sizeof(Node *));
+
+	retainContents(copy);
+
+	copy->slots[2 * index] = retain(key);
+	copy->slots[2 * index + 1] = retain(obj);
+
+	return copy;
+}
+
+/**
+ * @return A copy of `node` with the child for `bit` removed.
+ */
+static Node *removeChild(const Node *node, uintptr_t edit, uint32_t bit) {
+
+	const unsigned pairs = dataCount(node), nodes = nodeCount(node);
+	const unsigned childIndex = indexOf(node->nodeMap, bit);
+
+	Node *copy = allocNode(edit, node->dataMap, node->nodeMap & ~bit, pairs, nodes - 1);
+
+	memcpy(copy->slots, node->slots, 2 * pairs * sizeof(ident));
+
+	Node **src = children(node), **dest = children(copy);
+
+	memcpy(dest, src, childIndex * sizeof(Node *));
+	memcpy(dest + childIndex, src + childIndex + 1, (nodes - childIndex - 1) * sizeof(Node *));
+
+	retainContents(copy);
+
+	return copy;
+}
+
+/**
+ * @return `node`, or an editable copy of it, with the child for `bit` replaced by `child`.
+ */
+static Node *replaceChild(Node *node, uintptr_t edit, uint32_t bit, Node *child) {
+
+	Node *editable = editableNode(node, edit);
+
+	Node **slot = children(editable) + indexOf(editable->nodeMap, bit);
+
+	releaseNode(*slot);
+	*slot = child;
+
+	return editable;
+}
+
+/**
+ * @return `node`, or an editable copy of it, with the Object at pair `index` replaced by `obj`.
+ */
+static Node *replaceObject(Node *node, uintptr_t edit, unsigned index, const ident obj) {
+
+	if (node->slots[2 * index + 1] == obj) {
+		return retainNode(node);
+	}
+
+	Node *editable = editableNode(node, edit);
+
+	retain(obj);
+	release(editable->slots[2 * index + 1]);
+
+	editable->slots[2 * index + 1] = obj;
+	return editable;
+}
+
+/**
+ * @return A new subtree containing both pairs, whose keys collide at all prior levels.
+ */
+static Node *mergePairs(uintptr_t edit, ident k1, ident v1, uint32_t h1, ident k2, ident v2, uint32_t h2, unsigned shift) {
+
+	if (shift >= HAMT_HASH_BITS) {
+		Node *node = allocCollisionNode(edit, 2);
+
+		node->slots[0] = retain(k1);
+		node->slots[1] = retain(v1);
+		node->slots[2] = retain(k2);
+		node->slots[3] = retain(v2);
+
+		return node;
+	}
+
+	const uint32_t b1 = bitpos(h1, shift), b2 = bitpos(h2, shift);
+	if (b1 != b2) {
+		Node *node = allocNode(edit, b1 | b2, 0, 2, 0);
+
+		const unsigned i1 = b1 < b2 ? 0 : 2, i2 = 2 - i1;
+
+		node->slots[i1] = retain(k1);
+		node->slots[i1 + 1] = retain(v1);
+		node->slots[i2] = retain(k2);
+		node->slots[i2 + 1] = retain(v2);
+
+		return node;
+	}
+
+	Node *node = allocNode(edit, 0, b1, 0, 1);
+
+	node->slots[0] = mergePairs(edit, k1, v1, h1, k2, v2, h2, shift + HAMT_BITS);
+	return node;
+}
+
+/**
+ * @return The Object for `key` beneath `node`, or `NULL`.
+ */
+static ident find(const Node *node, const ident key, uint32_t hash) {
+
+	for (unsigned shift = 0; node; shift += HAMT_BITS) {
+
+		if (node->collision) {
+			for (unsigned i = 0; i < node->collisions; i++) {
+				if (keysEqual(node->slots[2 * i], key)) {
+					return node->slots[2 * i + 1];
+				}
+			}
+			return NULL;
+		}
+
+		const uint32_t bit = bitpos(hash, shift);
+
+		if (node->dataMap & bit) {
+			const unsigned index = indexOf(node->dataMap, bit);
+			return keysEqual(node->slots[2 * index], key) ? node->slots[2 * index + 1] : NULL;
+		}
+
+		if (node->nodeMap & bit) {
+			node = children(node)[indexOf(node->nodeMap, bit)];
+		} else {
+			node = NULL;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Associates `key` with `obj` beneath `node`.
+ * @return The resulting node, retained. If it is `node` itself, the caller need not update its slot.
+ */
+static Node *assoc(Node *node, uintptr_t edit, const ident key, const ident obj, uint32_t hash, unsigned shift, _Bool *added) {
+
+	if (node->collision) {
+
+		for (unsigned i = 0; i < node->collisions; i++) {
+			if (keysEqual(node->slots[2 * i], key)) {
+				return replaceObject(node, edit, i, obj);
+			}
+		}
+
+		Node *copy = allocCollisionNode(edit, node->collisions + 1);
+
+		memcpy(copy->slots, node->slots, 2 * node->collisions * sizeof(ident));
+		copy->collisions = node->collisions;
+		retainContents(copy);
+
+		copy->slots[2 * copy->collisions] = retain(key);
+		copy->slots[2 * copy->collisions + 1] = retain(obj);
+		copy->collisions++;
+
+		*added = true;
+		return copy;
+	}
+
+	const uint32_t bit = bitpos(hash, shift);
+
+	if (node->dataMap & bit) {
+		const unsigned index = indexOf(node->dataMap, bit);
+
+		const ident k = node->slots[2 * index];
+		if (keysEqual(k, key)) {
+			return replaceObject(node, edit, index, obj);
+		}
+
+		const ident v = node->slots[2 * index + 1];
+
+		Node *child = mergePairs(edit, k, v, hashKey(k), key, obj, hash, shift + HAMT_BITS);
+
+		*added = true;
+		return pairToNode(node, edit, bit, child);
+	}
+
+	if (node->nodeMap & bit) {
+		Node *child = children(node)[indexOf(node->nodeMap, bit)];
+
+		Node *result = assoc(child, edit, key, obj, hash, shift + HAMT_BITS, added);
+		if (result == child) {
+			releaseNode(result);
+			return retainNode(node);
+		}
+
+		return replaceChild(node, edit, bit, result);
+	}
+
+	*added = true;
+	return insertPair(node, edit, bit, key, obj);
+}
+
+/**
+ * @return True if `node` holds exactly one pair and no children, and may be inlined by its parent.
+ */
+static inline _Bool isSingleton(const Node *node) {
+	return dataCount(node) == 1 && nodeCount(node) == 0;
+}
+
+/**
+ * @brief Removes `key` from beneath `node`.
+ * @return The resulting node, retained, or `NULL` if it is empty.
+ */
+static Node *dissoc(Node *node, uintptr_t edit, const ident key, uint32_t hash, unsigned shift, _Bool *removed) {
+
+	if (node->collision) {
+
+		for (unsigned i = 0; i < node->collisions; i++) {
+			if (keysEqual(node->slots[2 * i], key)) {
+
+				*removed = true;
+
+				if (node->collisions == 1) {
+					return NULL;
+				}
+
+				Node *copy = allocCollisionNode(edit, node->collisions - 1);
+
+				memcpy(copy->slots, node->slots, 2 * i * sizeof(ident));
+				memcpy(copy->slots + 2 * i, node->slots + 2 * i + 2, 2 * (node->collisions - i - 1) * sizeof(ident));
+				retainContents(copy);
+
+				return copy;
+			}
+		}
+
+		return retainNode(node);
+	}
+
+	const uint32_t bit = bitpos(hash, shift);
+
+	if (node->dataMap & bit) {
+		const unsigned index = indexOf(node->dataMap, bit);
+
+		if (keysEqual(node->slots[2 * index], key) == false) {
+			return retainNode(node);
+		}
+
+		*removed = true;
+
+		if (isSingleton(node)) {
+			return NULL;
+		}
+
+		return removePair(node, edit, bit);
+	}
+
+	if (node->nodeMap & bit) {
+		Node *child = children(node)[indexOf(node->nodeMap, bit)];
+
+		Node *result = dissoc(child, edit, key, hash, shift + HAMT_BITS, removed);
+		if (result == child) {
+			releaseNode(result);
+			return retainNode(node);
+		}
+
+		if (result == NULL) {
+			if (dataCount(node) == 0 && nodeCount(node) == 1) {
+				return NULL;
+			}
+			return removeChild(node, edit, bit);
+		}
+
+		if (isSingleton(result)) {
+			Node *copy = nodeToPair(node, edit, bit, result->slots[0], result->slots[1]);
+			releaseNode(result);
+			return copy;
+		}
+
+		return replaceChild(node, edit, bit, result);
+	}
+
+	return retainNode(node);
+}
+
+/**
+ * @brief Enumerates the pairs beneath `node`.
+ */
+static void enumerateNode(const PersistentDictionary *self, const Node *node, PersistentDictionaryEnumerator enumerator, ident data) {
+
+	if (node) {
+		const unsigned pairs = dataCount(node), nodes = nodeCount(node);
+
+		for (unsigned i = 0; i < pairs; i++) {
+			enumerator(self, node->slots[2 * i + 1], node->slots[2 * i], data);
+		}
+
+		Node **nodeChildren = children(node);
+		for (unsigned i = 0; i < nodes; i++) {
+			enumerateNode(self, nodeChildren[i], enumerator, data);
+		}
+	}
+}
+
+/**
+ * @brief Associates `key` with `obj` in the given trie, updating `root` and `count`.
+ */
+static void put(Node **root, size_t *count, uintptr_t edit, const ident obj, const ident key) {
+
+	assert(key);
+	assert(obj);
+
+	const uint32_t hash = hashKey(key);
+
+	if (*root == NULL) {
+		Node *node = allocNode(edit, bitpos(hash, 0), 0, 1, 0);
+
+		node->slots[0] = retain(key);
+		node->slots[1] = retain(obj);
+
+		*root = node;
+		*count = 1;
+		return;
+	}
+
+	_Bool added = false;
+
+	Node *node = assoc(*root, edit, key, obj, hash, 0, &added);
+
+	releaseNode(*root);
+	*root = node;
+
+	if (added) {
+		(*count)++;
+	}
+}
+
+/**
+ * @brief Removes `key` from the given trie, updating `root` and `count`.
+ */
+static void delete(Node **root, size_t *count, uintptr_t edit, const ident key) {
+
+	assert(key);
+
+	if (*root) {
+		_Bool removed = false;
+
+		Node *node = dissoc(*root, edit, key, hashKey(key), 0, &removed);
+
+		releaseNode(*root);
+		*root = node;
+
+		if (removed) {
+			(*count)--;
+		}
+	}
+}
+
+/**
+ * @brief Creates an unowned PersistentDictionary sharing the trie of `self`.
+ * @details If `self` is transient, its edit token is rotated so that it may no longer mutate the
+ * nodes it now shares.
+ */
+static PersistentDictionary *snapshot(const PersistentDictionary *self) {
+
+	PersistentDictionary *that = $(alloc(PersistentDictionary), init);
+
+	that->locals.root = retainNode(self->locals.root);
+	that->count = self->count;
+
+	if (self->locals.edit) {
+		((PersistentDictionary *) self)->locals.edit = nextEdit();
+	}
+
+	return that;
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	PersistentDictionary *this = (PersistentDictionary *) self;
+
+	if (this->locals.edit == 0) {
+		return (Object *) retain(this);
+	}
+
+	return (Object *) snapshot(this);
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	PersistentDictionary *this = (PersistentDictionary *) self;
+
+	releaseNode(this->locals.root);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @brief PersistentDictionaryEnumerator for description.
+ */
+static void description_enumerator(const PersistentDictionary *dict, ident obj, ident key, ident data) {
+
+	MutableString *desc = (MutableString *) data;
+
+	String *objDesc = $((Object *) obj, description);
+	String *keyDesc = $((Object *) key, description);
+
+	$(desc, appendFormat, "%s: %s, ", keyDesc->chars, objDesc->chars);
+
+	release(objDesc);
+	release(keyDesc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	const PersistentDictionary *this = (PersistentDictionary *) self;
+
+	MutableString *desc = $(alloc(MutableString), init);
+
+	$(desc, appendCharacters, "{");
+
+	$(this, enumerateObjectsAndKeys, description_enumerator, desc);
+
+	$(desc, appendCharacters, "}");
+
+	return (String *) desc;
+}
+
+/**
+ * @brief PersistentDictionaryEnumerator for hash.
+ */
+static void hash_enumerator(const PersistentDictionary *dict, ident obj, ident key, ident data) {
+	*(unsigned int *) data += (unsigned int) HashForObject(HashForObject(HASH_SEED, key), obj);
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	const PersistentDictionary *this = (PersistentDictionary *) self;
+
+	unsigned int pairs = 0;
+
+	$(this, enumerateObjectsAndKeys, hash_enumerator, &pairs);
+
+	return (int) ((unsigned int) HashForInteger(HASH_SEED, this->count) + pairs);
+}
+
+/**
+ * @brief PersistentDictionaryEnumerator for isEqual.
+ */
+static void isEqual_enumerator(const PersistentDictionary *dict, ident obj, ident key, ident data) {
+
+	const PersistentDictionary *that = ((const PersistentDictionary **) data)[0];
+
+	const ident thatObject = $(that, objectForKey, key);
+	if (thatObject == NULL || $((Object *) obj, isEqual, thatObject) == false) {
+		((const PersistentDictionary **) data)[1] = NULL;
+	}
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, _PersistentDictionary())) {
+
+		const PersistentDictionary *this = (PersistentDictionary *) self;
+		const PersistentDictionary *that = (PersistentDictionary *) other;
+
+		if (this->count == that->count) {
+
+			if (this->locals.root == that->locals.root) {
+				return true;
+			}
+
+			const PersistentDictionary *data[] = { that, that };
+
+			$(this, enumerateObjectsAndKeys, isEqual_enumerator, data);
+
+			return data[1] != NULL;
+		}
+	}
+
+	return false;
+}
+
+#pragma mark - PersistentDictionary
+
+/**
+ * @brief PersistentDictionaryEnumerator for allKeys.
+ */
+static void allKeys_enumerator(const PersistentDictionary *dict, ident obj, ident key, ident data) {
+	$((MutableArray *) data, addObject, key);
+}
+
+/**
+ * @fn Array *PersistentDictionary::allKeys(const PersistentDictionary *self)
+ * @memberof PersistentDictionary
+ */
+static Array *allKeys(const PersistentDictionary *self) {
+
+	MutableArray *keys = $(alloc(MutableArray), initWithCapacity, self->count);
+
+	$(self, enumerateObjectsAndKeys, allKeys_enumerator, keys);
+
+	return (Array *) keys;
+}
+
+/**
+ * @brief PersistentDictionaryEnumerator for allObjects.
+ */
+static void allObjects_enumerator(const PersistentDictionary *dict, ident obj, ident key, ident data) {
+	$((MutableArray *) data, addObject, obj);
+}
+
+/**
+ * @fn Array *PersistentDictionary::allObjects(const PersistentDictionary *self)
+ * @memberof PersistentDictionary
+ */
+static Array *allObjects(const PersistentDictionary *self) {
+
+	MutableArray *objects = $(alloc(MutableArray), initWithCapacity, self->count);
+
+	$(self, enumerateObjectsAndKeys, allObjects_enumerator, objects);
+
+	return (Array *) objects;
+}
+
+/**
+ * @fn _Bool PersistentDictionary::containsKey(const PersistentDictionary *self, const ident key)
+ * @memberof PersistentDictionary
+ */
+static _Bool containsKey(const PersistentDictionary *self, const ident key) {
+	return $(self, objectForKey, key) != NULL;
+}
+
+/**
+ * @fn void PersistentDictionary::enumerateObjectsAndKeys(const PersistentDictionary *self, PersistentDictionaryEnumerator enumerator, ident data)
+ * @memberof PersistentDictionary
+ */
+static void enumerateObjectsAndKeys(const PersistentDictionary *self, PersistentDictionaryEnumerator enumerator, ident data) {
+
+	assert(enumerator);
+
+	enumerateNode(self, self->locals.root, enumerator, data);
+}
+
+/**
+ * @fn PersistentDictionary *PersistentDictionary::init(PersistentDictionary *self)
+ * @memberof PersistentDictionary
+ */
+static PersistentDictionary *init(PersistentDictionary *self) {
+
+	return (PersistentDictionary *) super(Object, self, init);
+}
+
+/**
+ * @brief DictionaryEnumerator for initWithDictionary.
+ */
+static void initWithDictionary_enumerator(const Dictionary *dictionary, ident obj, ident key, ident data) {
+	$((PersistentDictionary *) data, setObjectForKey, obj, key);
+}
+
+/**
+ * @fn PersistentDictionary *PersistentDictionary::initWithDictionary(PersistentDictionary *self, const Dictionary *dictionary)
+ * @memberof PersistentDictionary
+ */
+static PersistentDictionary *initWithDictionary(PersistentDictionary *self, const Dictionary *dictionary) {
+
+	self = $(self, init);
+	if (self) {
+		if (dictionary) {
+			self->locals.edit = nextEdit();
+
+			$(dictionary, enumerateObjectsAndKeys, initWithDictionary_enumerator, self);
+
+			$(self, persistent);
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn PersistentDictionary *PersistentDictionary::initWithObjectsAndKeys(PersistentDictionary *self, ...)
+ * @memberof PersistentDictionary
+ */
+static PersistentDictionary *initWithObjectsAndKeys(PersistentDictionary *self, ...) {
+
+	self = $(self, init);
+	if (self) {
+		self->locals.edit = nextEdit();
+
+		va_list args;
+		va_start(args, self);
+
+		while (true) {
+
+			ident obj = va_arg(args, ident);
+			if (obj) {
+				ident key = va_arg(args, ident);
+				$(self, setObjectForKey, obj, key);
+			} else {
+				break;
+			}
+		}
+
+		va_end(args);
+
+		$(self, persistent);
+	}
+
+	return self;
+}
+
+/**
+ * @fn ident PersistentDictionary::objectForKey(const PersistentDictionary *self, const ident key)
+ * @memberof PersistentDictionary
+ */
+static ident objectForKey(const PersistentDictionary *self, const ident key) {
+
+	if (self->locals.root == NULL) {
+		return NULL;
+	}
+
+	return find(self->locals.root, key, hashKey(key));
+}
+
+/**
+ * @fn void PersistentDictionary::persistent(PersistentDictionary *self)
+ * @memberof PersistentDictionary
+ */
+static void persistent(PersistentDictionary *self) {
+	self->locals.edit = 0;
+}
+
+/**
+ * @fn void PersistentDictionary::removeObjectForKey(PersistentDictionary *self, const ident key)
+ * @memberof PersistentDictionary
+ */
+static void removeObjectForKey(PersistentDictionary *self, const ident key) {
+
+	assert(self->locals.edit);
+
+	delete(&self->locals.root, &self->count, self->locals.edit, key);
+}
+
+/**
+ * @fn void PersistentDictionary::setObjectForKey(PersistentDictionary *self, const ident obj, const ident key)
+ * @memberof PersistentDictionary
+ */
+static void setObjectForKey(PersistentDictionary *self, const ident obj, const ident key) {
+
+	assert(self->locals.edit);
+
+	put(&self->locals.root, &self->count, self->locals.edit, obj, key);
+}
+
+/**
+ * @fn PersistentDictionary *PersistentDictionary::transient(const PersistentDictionary *self)
+ * @memberof PersistentDictionary
+ */
+static PersistentDictionary *transient(const PersistentDictionary *self) {
+
+	PersistentDictionary *that = snapshot(self);
+
+	that->locals.edit = nextEdit();
+
+	return that;
+}
+
+/**
+ * @fn PersistentDictionary *PersistentDictionary::withObjectForKey(const PersistentDictionary *self, const ident obj, const ident key)
+ * @memberof PersistentDictionary
+ */
+static PersistentDictionary *withObjectForKey(const PersistentDictionary *self, const ident obj, const ident key) {
+
+	PersistentDictionary *that = snapshot(self);
+
+	put(&that->locals.root, &that->count, 0, obj, key);
+
+	return that;
+}
+
+/**
+ * @fn PersistentDictionary *PersistentDictionary::withoutObjectForKey(const PersistentDictionary *self, const ident key)
+ * @memberof PersistentDictionary
+ */
+static PersistentDictionary *withoutObjectForKey(const PersistentDictionary *self, const ident key) {
+
+	PersistentDictionary *that = snapshot(self);
+
+	delete(&that->locals.root, &that->count, 0, key);
+
+	return that;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->description = description;
+	object->hash = hash;
+	object->isEqual = isEqual;
+
+	PersistentDictionaryInterface *dictionary = (PersistentDictionaryInterface *) clazz->def->interface;
+
+	dictionary->allKeys = allKeys;
+	dictionary->allObjects = allObjects;
+	dictionary->containsKey = containsKey;
+	dictionary->enumerateObjectsAndKeys = enumerateObjectsAndKeys;
+	dictionary->init = init;
+	dictionary->initWithDictionary = initWithDictionary;
+	dictionary->initWithObjectsAndKeys = initWithObjectsAndKeys;
+	dictionary->objectForKey = objectForKey;
+	dictionary->persistent = persistent;
+	dictionary->removeObjectForKey = removeObjectForKey;
+	dictionary->setObjectForKey = setObjectForKey;
+	dictionary->transient = transient;
+	dictionary->withObjectForKey = withObjectForKey;
+	dictionary->withoutObjectForKey = withoutObjectForKey;
+}
+
+/**
+ * @fn Class *PersistentDictionary::_PersistentDictionary(void)
+ * @memberof PersistentDictionary
+ */
+Class *_PersistentDictionary(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "PersistentDictionary";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(PersistentDictionary);
+		clazz.interfaceOffset = offsetof(PersistentDictionary, interface);
+		clazz.interfaceSize = sizeof(PersistentDictionaryInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
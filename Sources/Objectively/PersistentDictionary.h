@@ -0,0 +1,239 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+#include <Objectively/Dictionary.h>
+
+/**
+ * @file
+ * @brief Persistent (immutable, structurally shared) key-value stores.
+ */
+
+typedef struct PersistentDictionary PersistentDictionary;
+typedef struct PersistentDictionaryInterface PersistentDictionaryInterface;
+
+/**
+ * @brief A function type for PersistentDictionary enumeration (iteration).
+ * @param dictionary The PersistentDictionary.
+ * @param obj The Object for the current iteration.
+ * @param key The key for the current iteration.
+ * @param data User data.
+ */
+typedef void (*PersistentDictionaryEnumerator)(const PersistentDictionary *dictionary, ident obj, ident key, ident data);
+
+/**
+ * @brief Persistent key-value stores, backed by a hash array mapped trie.
+ * @details Each version of a PersistentDictionary is immutable. Adding or removing a pair
+ * returns a new version in `O(log n)` that shares all untouched trie nodes with its
+ * predecessor. Trie nodes are reference counted atomically, so versions may be handed to, and
+ * released by, other threads without locking. Copying a PersistentDictionary is `O(1)`.
+ * @details For bulk construction, PersistentDictionary::transient returns an editable version
+ * that mutates the nodes it owns in place, until it is sealed with
+ * PersistentDictionary::persistent. A transient must not be shared across threads.
+ * @extends Object
+ * @ingroup Collections
+ */
+struct PersistentDictionary {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	PersistentDictionaryInterface *interface;
+
+	/**
+	 * @brief The count of pairs.
+	 */
+	size_t count;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The edit token of a transient, or `0` once persistent.
+		 */
+		uintptr_t edit;
+
+		/**
+		 * @brief The root node of the trie.
+		 */
+		struct PersistentDictionaryNode *root;
+	} locals;
+};
+
+/**
+ * @brief The PersistentDictionary interface.
+ */
+struct PersistentDictionaryInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn Array *PersistentDictionary::allKeys(const PersistentDictionary *self)
+	 * @param self The PersistentDictionary.
+	 * @return An Array containing all keys in this PersistentDictionary.
+	 * @memberof PersistentDictionary
+	 */
+	Array *(*allKeys)(const PersistentDictionary *self);
+
+	/**
+	 * @fn Array *PersistentDictionary::allObjects(const PersistentDictionary *self)
+	 * @param self The PersistentDictionary.
+	 * @return An Array containing all Objects in this PersistentDictionary.
+	 * @memberof PersistentDictionary
+	 */
+	Array *(*allObjects)(const PersistentDictionary *self);
+
+	/**
+	 * @fn _Bool PersistentDictionary::containsKey(const PersistentDictionary *self, const ident key)
+	 * @param self The PersistentDictionary.
+	 * @param key The key.
+	 * @return `true` if this PersistentDictionary contains the given key, `false` otherwise.
+	 * @memberof PersistentDictionary
+	 */
+	_Bool (*containsKey)(const PersistentDictionary *self, const ident key);
+
+	/**
+	 * @fn void PersistentDictionary::enumerateObjectsAndKeys(const PersistentDictionary *self, PersistentDictionaryEnumerator enumerator, ident data)
+	 * @brief Enumerate the pairs of this PersistentDictionary with the given function.
+	 * @param self The PersistentDictionary.
+	 * @param enumerator The enumerator function.
+	 * @param data User data.
+	 * @memberof PersistentDictionary
+	 */
+	void (*enumerateObjectsAndKeys)(const PersistentDictionary *self, PersistentDictionaryEnumerator enumerator, ident data);
+
+	/**
+	 * @fn PersistentDictionary *PersistentDictionary::init(PersistentDictionary *self)
+	 * @brief Initializes this PersistentDictionary to be empty.
+	 * @param self The PersistentDictionary.
+	 * @return The initialized PersistentDictionary, or `NULL` on error.
+	 * @memberof PersistentDictionary
+	 */
+	PersistentDictionary *(*init)(PersistentDictionary *self);
+
+	/**
+	 * @fn PersistentDictionary *PersistentDictionary::initWithDictionary(PersistentDictionary *self, const Dictionary *dictionary)
+	 * @brief Initializes this PersistentDictionary with the pairs of `dictionary`.
+	 * @param self The PersistentDictionary.
+	 * @param dictionary A Dictionary.
+	 * @return The initialized PersistentDictionary, or `NULL` on error.
+	 * @memberof PersistentDictionary
+	 */
+	PersistentDictionary *(*initWithDictionary)(PersistentDictionary *self, const Dictionary *dictionary);
+
+	/**
+	 * @fn PersistentDictionary *PersistentDictionary::initWithObjectsAndKeys(PersistentDictionary *self, ...)
+	 * @brief Initializes this PersistentDictionary with the `NULL`-terminated list of Objects and keys.
+	 * @param self The PersistentDictionary.
+	 * @return The initialized PersistentDictionary, or `NULL` on error.
+	 * @memberof PersistentDictionary
+	 */
+	PersistentDictionary *(*initWithObjectsAndKeys)(PersistentDictionary *self, ...);
+
+	/**
+	 * @fn ident PersistentDictionary::objectForKey(const PersistentDictionary *self, const ident key)
+	 * @param self The PersistentDictionary.
+	 * @param key The key.
+	 * @return The Object for the given key, or `NULL` if not found.
+	 * @memberof PersistentDictionary
+	 */
+	ident (*objectForKey)(const PersistentDictionary *self, const ident key);
+
+	/**
+	 * @fn void PersistentDictionary::persistent(PersistentDictionary *self)
+	 * @brief Seals this transient PersistentDictionary, making it immutable.
+	 * @param self The transient PersistentDictionary.
+	 * @remarks This is `O(1)`. Sealing a PersistentDictionary that is not transient has no effect.
+	 * @memberof PersistentDictionary
+	 */
+	void (*persistent)(PersistentDictionary *self);
+
+	/**
+	 * @fn void PersistentDictionary::removeObjectForKey(PersistentDictionary *self, const ident key)
+	 * @brief Removes the Object for `key` from this transient PersistentDictionary.
+	 * @param self The transient PersistentDictionary.
+	 * @param key The key.
+	 * @memberof PersistentDictionary
+	 */
+	void (*removeObjectForKey)(PersistentDictionary *self, const ident key);
+
+	/**
+	 * @fn void PersistentDictionary::setObjectForKey(PersistentDictionary *self, const ident obj, const ident key)
+	 * @brief Sets the pair in this transient PersistentDictionary.
+	 * @param self The transient PersistentDictionary.
+	 * @param obj The Object.
+	 * @param key The key.
+	 * @memberof PersistentDictionary
+	 */
+	void (*setObjectForKey)(PersistentDictionary *self, const ident obj, const ident key);
+
+	/**
+	 * @fn PersistentDictionary *PersistentDictionary::transient(const PersistentDictionary *self)
+	 * @brief Creates a transient (editable) version of this PersistentDictionary.
+	 * @param self The PersistentDictionary.
+	 * @return The transient PersistentDictionary, which shares structure with this one.
+	 * @see PersistentDictionary::persistent(PersistentDictionary *)
+	 * @memberof PersistentDictionary
+	 */
+	PersistentDictionary *(*transient)(const PersistentDictionary *self);
+
+	/**
+	 * @fn PersistentDictionary *PersistentDictionary::withObjectForKey(const PersistentDictionary *self, const ident obj, const ident key)
+	 * @param self The PersistentDictionary.
+	 * @param obj The Object.
+	 * @param key The key.
+	 * @return A new version of this PersistentDictionary containing the given pair.
+	 * @memberof PersistentDictionary
+	 */
+	PersistentDictionary *(*withObjectForKey)(const PersistentDictionary *self, const ident obj, const ident key);
+
+	/**
+	 * @fn PersistentDictionary *PersistentDictionary::withoutObjectForKey(const PersistentDictionary *self, const ident key)
+	 * @param self The PersistentDictionary.
+	 * @param key The key.
+	 * @return A new version of this PersistentDictionary without the given key.
+	 * @memberof PersistentDictionary
+	 */
+	PersistentDictionary *(*withoutObjectForKey)(const PersistentDictionary *self, const ident key);
+};
+
+/**
+ * @fn Class *PersistentDictionary::_PersistentDictionary(void)
+ * @brief The PersistentDictionary archetype.
+ * @return The PersistentDictionary Class.
+ * @memberof PersistentDictionary
+ */
+OBJECTIVELY_EXPORT Class *_PersistentDictionary(void);
@@ -0,0 +1,378 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdlib.h>
+
+#include <Objectively/Hash.h>
+#include <Objectively/PersistentSet.h>
+
+#define _Class _PersistentSet
+
+/**
+ * @return A new PersistentSet adopting `dictionary`.
+ */
+static PersistentSet *setWithDictionary(PersistentDictionary *dictionary) {
+
+	PersistentSet *set = (PersistentSet *) $((Object *) alloc(PersistentSet), init);
+	if (set) {
+		set->dictionary = dictionary;
+	} else {
+		release(dictionary);
+	}
+
+	return set;
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	const PersistentSet *this = (PersistentSet *) self;
+
+	if (this->dictionary->locals.edit == 0) {
+		return (Object *) retain((ident) this);
+	}
+
+	return (Object *) setWithDictionary((PersistentDictionary *) $((Object *) this->dictionary, copy));
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	PersistentSet *this = (PersistentSet *) self;
+
+	release(this->dictionary);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	Array *array = $((PersistentSet *) self, allObjects);
+
+	String *description = $((Object *) array, description);
+
+	release(array);
+
+	return description;
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	const PersistentSet *this = (PersistentSet *) self;
+
+	return HashForObject(HASH_SEED, this->dictionary);
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, _PersistentSet())) {
+
+		const PersistentSet *this = (PersistentSet *) self;
+		const PersistentSet *that = (PersistentSet *) other;
+
+		return $((Object *) this->dictionary, isEqual, (Object *) that->dictionary);
+	}
+
+	return false;
+}
+
+#pragma mark - PersistentSet
+
+/**
+ * @fn void PersistentSet::addObject(PersistentSet *self, const ident obj)
+ * @memberof PersistentSet
+ */
+static void addObject(PersistentSet *self, const ident obj) {
+	$(self->dictionary, setObjectForKey, obj, obj);
+}
+
+/**
+ * @fn Array *PersistentSet::allObjects(const PersistentSet *self)
+ * @memberof PersistentSet
+ */
+static Array *allObjects(const PersistentSet *self) {
+	return $(self->dictionary, allKeys);
+}
+
+/**
+ * @fn _Bool PersistentSet::containsObject(const PersistentSet *self, const ident obj)
+ * @memberof PersistentSet
+ */
+static _Bool containsObject(const PersistentSet *self, const ident obj) {
+	return $(self->dictionary, containsKey, obj);
+}
+
+/**
+ * @fn size_t PersistentSet::count(const PersistentSet *self)
+ * @memberof PersistentSet
+ */
+static size_t count(const PersistentSet *self) {
+	return self->dictionary->count;
+}
+
+/**
+ * @brief The enumeration context, adapting PersistentDictionaryEnumerator to PersistentSetEnumerator.
+ */
+typedef struct {
+	const PersistentSet *set;
+	PersistentSetEnumerator enumerator;
+	ident data;
+} EnumerateObjects;
+
+/**
+ * @brief PersistentDictionaryEnumerator for enumerateObjects.
+ */
+static void enumerateObjects_enumerator(const PersistentDictionary *dictionary, ident obj, ident key, ident data) {
+
+	const EnumerateObjects *context = data;
+
+	context->enumerator(context->set, key, context->data);
+}
+
+/**
+ * @fn void PersistentSet::enumerateObjects(const PersistentSet *self, PersistentSetEnumerator enumerator, ident data)
+ * @memberof PersistentSet
+ */
+static void enumerateObjects(const PersistentSet *self, PersistentSetEnumerator enumerator, ident data) {
+
+	assert(enumerator);
+
+	EnumerateObjects context = { .set = self, .enumerator = enumerator, .data = data };
+
+	$(self->dictionary, enumerateObjectsAndKeys, enumerateObjects_enumerator, &context);
+}
+
+/**
+ * @fn PersistentSet *PersistentSet::init(PersistentSet *self)
+ * @memberof PersistentSet
+ */
+static PersistentSet *init(PersistentSet *self) {
+
+	self = (PersistentSet *) super(Object, self, init);
+	if (self) {
+		self->dictionary = $(alloc(PersistentDictionary), init);
+		assert(self->dictionary);
+	}
+
+	return self;
+}
+
+/**
+ * @fn PersistentSet *PersistentSet::initWithArray(PersistentSet *self, const Array *array)
+ * @memberof PersistentSet
+ */
+static PersistentSet *initWithArray(PersistentSet *self, const Array *array) {
+
+	self = $(self, init);
+	if (self) {
+		if (array) {
+			PersistentDictionary *dictionary = $(self->dictionary, transient);
+
+			for (size_t i = 0; i < array->count; i++) {
+				$(dictionary, setObjectForKey, array->elements[i], array->elements[i]);
+			}
+
+			$(dictionary, persistent);
+
+			release(self->dictionary);
+			self->dictionary = dictionary;
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn PersistentSet *PersistentSet::initWithObjects(PersistentSet *self, ...)
+ * @memberof PersistentSet
+ */
+static PersistentSet *initWithObjects(PersistentSet *self, ...) {
+
+	self = $(self, init);
+	if (self) {
+		PersistentDictionary *dictionary = $(self->dictionary, transient);
+
+		va_list args;
+		va_start(args, self);
+
+		ident obj;
+		while ((obj = va_arg(args, ident))) {
+			$(dictionary, setObjectForKey, obj, obj);
+		}
+
+		va_end(args);
+
+		$(dictionary, persistent);
+
+		release(self->dictionary);
+		self->dictionary = dictionary;
+	}
+
+	return self;
+}
+
+/**
+ * @brief SetEnumerator for initWithSet.
+ */
+static void initWithSet_enumerator(const Set *set, ident obj, ident data) {
+	$((PersistentDictionary *) data, setObjectForKey, obj, obj);
+}
+
+/**
+ * @fn PersistentSet *PersistentSet::initWithSet(PersistentSet *self, const Set *set)
+ * @memberof PersistentSet
+ */
+static PersistentSet *initWithSet(PersistentSet *self, const Set *set) {
+
+	self = $(self, init);
+	if (self) {
+		if (set) {
+			PersistentDictionary *dictionary = $(self->dictionary, transient);
+
+			$(set, enumerateObjects, initWithSet_enumerator, dictionary);
+
+			$(dictionary, persistent);
+
+			release(self->dictionary);
+			self->dictionary = dictionary;
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn void PersistentSet::persistent(PersistentSet *self)
+ * @memberof PersistentSet
+ */
+static void persistent(PersistentSet *self) {
+	$(self->dictionary, persistent);
+}
+
+/**
+ * @fn void PersistentSet::removeObject(PersistentSet *self, const ident obj)
+ * @memberof PersistentSet
+ */
+static void removeObject(PersistentSet *self, const ident obj) {
+	$(self->dictionary, removeObjectForKey, obj);
+}
+
+/**
+ * @fn PersistentSet *PersistentSet::transient(const PersistentSet *self)
+ * @memberof PersistentSet
+ */
+static PersistentSet *transient(const PersistentSet *self) {
+	return setWithDictionary($(self->dictionary, transient));
+}
+
+/**
+ * @fn PersistentSet *PersistentSet::withObject(const PersistentSet *self, const ident obj)
+ * @memberof PersistentSet
+ */
+static PersistentSet *withObject(const PersistentSet *self, const ident obj) {
+	return setWithDictionary($(self->dictionary, withObjectForKey, obj, obj));
+}
+
+/**
+ * @fn PersistentSet *PersistentSet::withoutObject(const PersistentSet *self, const ident obj)
+ * @memberof PersistentSet
+ */
+static PersistentSet *withoutObject(const PersistentSet *self, const ident obj) {
+	return setWithDictionary($(self->dictionary, withoutObjectForKey, obj));
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->description = description;
+	object->hash = hash;
+	object->isEqual = isEqual;
+
+	PersistentSetInterface *set = (PersistentSetInterface *) clazz->def->interface;
+
+	set->addObject = addObject;
+	set->allObjects = allObjects;
+	set->containsObject = containsObject;
+	set->count = count;
+	set->enumerateObjects = enumerateObjects;
+	set->init = init;
+	set->initWithArray = initWithArray;
+	set->initWithObjects = initWithObjects;
+	set->initWithSet = initWithSet;
+	set->persistent = persistent;
+	set->removeObject = removeObject;
+	set->transient = transient;
+	set->withObject = withObject;
+	set->withoutObject = withoutObject;
+}
+
+/**
+ * @fn Class *PersistentSet::_PersistentSet(void)
+ * @memberof PersistentSet
+ */
+Class *_PersistentSet(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "PersistentSet";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(PersistentSet);
+		clazz.interfaceOffset = offsetof(PersistentSet, interface);
+		clazz.interfaceSize = sizeof(PersistentSetInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
@@ -0,0 +1,216 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/PersistentDictionary.h>
+#include <Objectively/Set.h>
+
+/**
+ * @file
+ * @brief Persistent (immutable, structurally shared) sets.
+ */
+
+typedef struct PersistentSet PersistentSet;
+typedef struct PersistentSetInterface PersistentSetInterface;
+
+/**
+ * @brief A function type for PersistentSet enumeration (iteration).
+ * @param set The PersistentSet.
+ * @param obj The Object for the current iteration.
+ * @param data User data.
+ */
+typedef void (*PersistentSetEnumerator)(const PersistentSet *set, ident obj, ident data);
+
+/**
+ * @brief Persistent sets, backed by a PersistentDictionary.
+ * @details Adding or removing an Object returns a new version in `O(log n)` that shares
+ * structure with its predecessor. Versions are safe to share across threads without locking.
+ * @extends Object
+ * @ingroup Collections
+ */
+struct PersistentSet {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	PersistentSetInterface *interface;
+
+	/**
+	 * @brief The backing PersistentDictionary, mapping each Object to itself.
+	 * @private
+	 */
+	PersistentDictionary *dictionary;
+};
+
+/**
+ * @brief The PersistentSet interface.
+ */
+struct PersistentSetInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn void PersistentSet::addObject(PersistentSet *self, const ident obj)
+	 * @brief Adds the given Object to this transient PersistentSet.
+	 * @param self The transient PersistentSet.
+	 * @param obj The Object.
+	 * @memberof PersistentSet
+	 */
+	void (*addObject)(PersistentSet *self, const ident obj);
+
+	/**
+	 * @fn Array *PersistentSet::allObjects(const PersistentSet *self)
+	 * @param self The PersistentSet.
+	 * @return An Array containing all Objects in this PersistentSet.
+	 * @memberof PersistentSet
+	 */
+	Array *(*allObjects)(const PersistentSet *self);
+
+	/**
+	 * @fn _Bool PersistentSet::containsObject(const PersistentSet *self, const ident obj)
+	 * @param self The PersistentSet.
+	 * @param obj An Object.
+	 * @return `true` if this PersistentSet contains the given Object, `false` otherwise.
+	 * @memberof PersistentSet
+	 */
+	_Bool (*containsObject)(const PersistentSet *self, const ident obj);
+
+	/**
+	 * @fn size_t PersistentSet::count(const PersistentSet *self)
+	 * @param self The PersistentSet.
+	 * @return The count of Objects in this PersistentSet.
+	 * @memberof PersistentSet
+	 */
+	size_t (*count)(const PersistentSet *self);
+
+	/**
+	 * @fn void PersistentSet::enumerateObjects(const PersistentSet *self, PersistentSetEnumerator enumerator, ident data)
+	 * @brief Enumerate the elements of this PersistentSet with the given function.
+	 * @param self The PersistentSet.
+	 * @param enumerator The enumerator function.
+	 * @param data User data.
+	 * @memberof PersistentSet
+	 */
+	void (*enumerateObjects)(const PersistentSet *self, PersistentSetEnumerator enumerator, ident data);
+
+	/**
+	 * @fn PersistentSet *PersistentSet::init(PersistentSet *self)
+	 * @brief Initializes this PersistentSet to be empty.
+	 * @param self The PersistentSet.
+	 * @return The initialized PersistentSet, or `NULL` on error.
+	 * @memberof PersistentSet
+	 */
+	PersistentSet *(*init)(PersistentSet *self);
+
+	/**
+	 * @fn PersistentSet *PersistentSet::initWithArray(PersistentSet *self, const Array *array)
+	 * @brief Initializes this PersistentSet with the contents of `array`.
+	 * @param self The PersistentSet.
+	 * @param array An Array.
+	 * @return The initialized PersistentSet, or `NULL` on error.
+	 * @memberof PersistentSet
+	 */
+	PersistentSet *(*initWithArray)(PersistentSet *self, const Array *array);
+
+	/**
+	 * @fn PersistentSet *PersistentSet::initWithObjects(PersistentSet *self, ...)
+	 * @brief Initializes this PersistentSet with the specified `NULL`-terminated Objects.
+	 * @param self The PersistentSet.
+	 * @return The initialized PersistentSet, or `NULL` on error.
+	 * @memberof PersistentSet
+	 */
+	PersistentSet *(*initWithObjects)(PersistentSet *self, ...);
+
+	/**
+	 * @fn PersistentSet *PersistentSet::initWithSet(PersistentSet *self, const Set *set)
+	 * @brief Initializes this PersistentSet with the contents of `set`.
+	 * @param self The PersistentSet.
+	 * @param set A Set.
+	 * @return The initialized PersistentSet, or `NULL` on error.
+	 * @memberof PersistentSet
+	 */
+	PersistentSet *(*initWithSet)(PersistentSet *self, const Set *set);
+
+	/**
+	 * @fn void PersistentSet::persistent(PersistentSet *self)
+	 * @brief Seals this transient PersistentSet, making it immutable.
+	 * @param self The transient PersistentSet.
+	 * @memberof PersistentSet
+	 */
+	void (*persistent)(PersistentSet *self);
+
+	/**
+	 * @fn void PersistentSet::removeObject(PersistentSet *self, const ident obj)
+	 * @brief Removes the given Object from this transient PersistentSet.
+	 * @param self The transient PersistentSet.
+	 * @param obj The Object.
+	 * @memberof PersistentSet
+	 */
+	void (*removeObject)(PersistentSet *self, const ident obj);
+
+	/**
+	 * @fn PersistentSet *PersistentSet::transient(const PersistentSet *self)
+	 * @brief Creates a transient (editable) version of this PersistentSet.
+	 * @param self The PersistentSet.
+	 * @return The transient PersistentSet, which shares structure with this one.
+	 * @see PersistentSet::persistent(PersistentSet *)
+	 * @memberof PersistentSet
+	 */
+	PersistentSet *(*transient)(const PersistentSet *self);
+
+	/**
+	 * @fn PersistentSet *PersistentSet::withObject(const PersistentSet *self, const ident obj)
+	 * @param self The PersistentSet.
+	 * @param obj The Object.
+	 * @return A new version of this PersistentSet containing `obj`.
+	 * @memberof PersistentSet
+	 */
+	PersistentSet *(*withObject)(const PersistentSet *self, const ident obj);
+
+	/**
+	 * @fn PersistentSet *PersistentSet::withoutObject(const PersistentSet *self, const ident obj)
+	 * @param self The PersistentSet.
+	 * @param obj The Object.
+	 * @return A new version of this PersistentSet without `obj`.
+	 * @memberof PersistentSet
+	 */
+	PersistentSet *(*withoutObject)(const PersistentSet *self, const ident obj);
+};
+
+/**
+ * @fn Class *PersistentSet::_PersistentSet(void)
+ * @brief The PersistentSet archetype.
+ * @return The PersistentSet Class.
+ * @memberof PersistentSet
+ */
+OBJECTIVELY_EXPORT Class *_PersistentSet(void);
@@ -0,0 +1,395 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include <Objectively/PriorityQueue.h>
+
+#define _Class _PriorityQueue
+
+#define PRIORITY_QUEUE_ARITY 4
+
+#define PRIORITY_QUEUE_MIN_CAPACITY 16
+
+/**
+ * @brief A heap entry.
+ */
+struct PriorityQueueEntry {
+
+	/**
+	 * @brief The Object.
+	 */
+	ident obj;
+
+	/**
+	 * @brief The handle.
+	 */
+	PriorityQueueHandle handle;
+};
+
+typedef struct PriorityQueueEntry Entry;
+
+/**
+ * @return True if `a` orders before `b`.
+ */
+static inline _Bool before(const PriorityQueue *self, const ident a, const ident b) {
+	return self->comparator(a, b) == OrderAscending;
+}
+
+/**
+ * @brief Places `entry` at heap position `i`, updating its handle's position.
+ */
+static inline void place(PriorityQueue *self, size_t i, const Entry entry) {
+
+	self->locals.entries[i] = entry;
+	self->locals.positions[entry.handle] = i;
+}
+
+/**
+ * @brief Moves the entry at heap position `i` toward the root until the heap is ordered.
+ */
+static void siftUp(PriorityQueue *self, size_t i) {
+
+	const Entry entry = self->locals.entries[i];
+
+	while (i > 0) {
+		const size_t parent = (i - 1) / PRIORITY_QUEUE_ARITY;
+		if (!before(self, entry.obj, self->locals.entries[parent].obj)) {
+			break;
+		}
+
+		place(self, i, self->locals.entries[parent]);
+		i = parent;
+	}
+
+	place(self, i, entry);
+}
+
+/**
+ * @brief Moves the entry at heap position `i` toward the leaves until the heap is ordered.
+ */
+static void siftDown(PriorityQueue *self, size_t i) {
+
+	const Entry entry = self->locals.entries[i];
+
+	while (true) {
+		const size_t first = i * PRIORITY_QUEUE_ARITY + 1;
+		if (first >= self->count) {
+			break;
+		}
+
+		const size_t last = min(first + PRIORITY_QUEUE_ARITY, self->count);
+
+		size_t child = first;
+		for (size_t c = first + 1; c < last; c++) {
+			if (before(self, self->locals.entries[c].obj, self->locals.entries[child].obj)) {
+				child = c;
+			}
+		}
+
+		if (!before(self, self->locals.entries[child].obj, entry.obj)) {
+			break;
+		}
+
+		place(self, i, self->locals.entries[child]);
+		i = child;
+	}
+
+	place(self, i, entry);
+}
+
+/**
+ * @brief Ensures capacity for `count` entries.
+ */
+static void reserve(PriorityQueue *self, size_t count) {
+
+	if (count > self->locals.capacity) {
+
+		size_t capacity = self->locals.capacity ?: PRIORITY_QUEUE_MIN_CAPACITY;
+		while (capacity < count) {
+			capacity <<= 1;
+		}
+
+		self->locals.entries = realloc(self->locals.entries, capacity * sizeof(Entry));
+		assert(self->locals.entries);
+
+		self->locals.positions = realloc(self->locals.positions, capacity * sizeof(size_t));
+		assert(self->locals.positions);
+
+		self->locals.capacity = capacity;
+	}
+}
+
+/**
+ * @return A free handle.
+ * @remarks Since there are never more live handles than entries, handles fit in `positions`.
+ */
+static PriorityQueueHandle allocateHandle(PriorityQueue *self) {
+
+	const PriorityQueueHandle handle = self->locals.freeHandle;
+	if (handle != PRIORITY_QUEUE_HANDLE_NONE) {
+		self->locals.freeHandle = self->locals.positions[handle];
+		return handle;
+	}
+
+	return self->locals.handles++;
+}
+
+/**
+ * @brief Returns `handle` to the free list.
+ */
+static void freeHandle(PriorityQueue *self, PriorityQueueHandle handle) {
+
+	self->locals.positions[handle] = self->locals.freeHandle;
+	self->locals.freeHandle = handle;
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	PriorityQueue *this = (PriorityQueue *) self;
+
+	$(this, removeAllObjects);
+
+	free(this->locals.entries);
+	free(this->locals.positions);
+
+	super(Object, self, dealloc);
+}
+
+#pragma mark - PriorityQueue
+
+/**
+ * @fn void PriorityQueue::decreaseKey(PriorityQueue *self, PriorityQueueHandle handle, const ident obj)
+ * @memberof PriorityQueue
+ */
+static void decreaseKey(PriorityQueue *self, PriorityQueueHandle handle, const ident obj) {
+
+	assert(handle < self->locals.handles);
+	assert(obj);
+
+	const size_t i = self->locals.positions[handle];
+
+	assert(i < self->count);
+	assert(self->locals.entries[i].handle == handle);
+
+	retain(obj);
+	release(self->locals.entries[i].obj);
+
+	self->locals.entries[i].obj = obj;
+
+	siftUp(self, i);
+}
+
+/**
+ * @fn PriorityQueue *PriorityQueue::initWithArray(PriorityQueue *self, const Array *array, Comparator comparator)
+ * @memberof PriorityQueue
+ */
+static PriorityQueue *initWithArray(PriorityQueue *self, const Array *array, Comparator comparator) {
+
+	assert(array);
+
+	self = $(self, initWithComparator, comparator);
+	if (self) {
+
+		reserve(self, array->count);
+
+		for (size_t i = 0; i < array->count; i++) {
+			self->locals.entries[i] = (Entry) {
+				.obj = retain(array->elements[i]),
+				.handle = i
+			};
+			self->locals.positions[i] = i;
+		}
+
+		self->count = self->locals.handles = array->count;
+
+		if (self->count > 1) {
+			for (size_t i = (self->count - 2) / PRIORITY_QUEUE_ARITY + 1; i > 0; i--) {
+				siftDown(self, i - 1);
+			}
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn PriorityQueue *PriorityQueue::initWithComparator(PriorityQueue *self, Comparator comparator)
+ * @memberof PriorityQueue
+ */
+static PriorityQueue *initWithComparator(PriorityQueue *self, Comparator comparator) {
+
+	assert(comparator);
+
+	self = (PriorityQueue *) super(Object, self, init);
+	if (self) {
+		self->comparator = comparator;
+		self->locals.freeHandle = PRIORITY_QUEUE_HANDLE_NONE;
+	}
+
+	return self;
+}
+
+/**
+ * @fn PriorityQueue *PriorityQueue::initWithLimit(PriorityQueue *self, Comparator comparator, size_t limit)
+ * @memberof PriorityQueue
+ */
+static PriorityQueue *initWithLimit(PriorityQueue *self, Comparator comparator, size_t limit) {
+
+	assert(limit);
+
+	self = $(self, initWithComparator, comparator);
+	if (self) {
+		self->limit = limit;
+		reserve(self, limit);
+	}
+
+	return self;
+}
+
+/**
+ * @fn ident PriorityQueue::peek(const PriorityQueue *self)
+ * @memberof PriorityQueue
+ */
+static ident peek(const PriorityQueue *self) {
+	return self->count ? self->locals.entries[0].obj : NULL;
+}
+
+/**
+ * @fn ident PriorityQueue::pop(PriorityQueue *self)
+ * @memberof PriorityQueue
+ */
+static ident pop(PriorityQueue *self) {
+
+	if (self->count == 0) {
+		return NULL;
+	}
+
+	const Entry head = self->locals.entries[0];
+
+	freeHandle(self, head.handle);
+
+	self->count--;
+	if (self->count) {
+		place(self, 0, self->locals.entries[self->count]);
+		siftDown(self, 0);
+	}
+
+	return head.obj;
+}
+
+/**
+ * @fn PriorityQueueHandle PriorityQueue::push(PriorityQueue *self, const ident obj)
+ * @memberof PriorityQueue
+ */
+static PriorityQueueHandle push(PriorityQueue *self, const ident obj) {
+
+	assert(obj);
+
+	if (self->limit && self->count == self->limit) {
+
+		if (!before(self, self->locals.entries[0].obj, obj)) {
+			return PRIORITY_QUEUE_HANDLE_NONE;
+		}
+
+		release(self->locals.entries[0].obj);
+		freeHandle(self, self->locals.entries[0].handle);
+
+		const PriorityQueueHandle handle = allocateHandle(self);
+		place(self, 0, (Entry) { .obj = retain(obj), .handle = handle });
+		siftDown(self, 0);
+
+		return handle;
+	}
+
+	reserve(self, self->count + 1);
+
+	const PriorityQueueHandle handle = allocateHandle(self);
+	place(self, self->count, (Entry) { .obj = retain(obj), .handle = handle });
+	siftUp(self, self->count++);
+
+	return handle;
+}
+
+/**
+ * @fn void PriorityQueue::removeAllObjects(PriorityQueue *self)
+ * @memberof PriorityQueue
+ */
+static void removeAllObjects(PriorityQueue *self) {
+
+	for (size_t i = 0; i < self->count; i++) {
+		release(self->locals.entries[i].obj);
+	}
+
+	self->count = self->locals.handles = 0;
+	self->locals.freeHandle = PRIORITY_QUEUE_HANDLE_NONE;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ObjectInterface *) clazz->def->interface)->dealloc = dealloc;
+
+	PriorityQueueInterface *priorityQueue = (PriorityQueueInterface *) clazz->def->interface;
+
+	priorityQueue->decreaseKey = decreaseKey;
+	priorityQueue->initWithArray = initWithArray;
+	priorityQueue->initWithComparator = initWithComparator;
+	priorityQueue->initWithLimit = initWithLimit;
+	priorityQueue->peek = peek;
+	priorityQueue->pop = pop;
+	priorityQueue->push = push;
+	priorityQueue->removeAllObjects = removeAllObjects;
+}
+
+/**
+ * @fn Class *PriorityQueue::_PriorityQueue(void)
+ * @memberof PriorityQueue
+ */
+Class *_PriorityQueue(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "PriorityQueue";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(PriorityQueue);
+		clazz.interfaceOffset = offsetof(PriorityQueue, interface);
+		clazz.interfaceSize = sizeof(PriorityQueueInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
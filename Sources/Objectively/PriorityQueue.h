@@ -0,0 +1,213 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+
+/**
+ * @file
+ * @brief Priority queues.
+ */
+
+typedef struct PriorityQueue PriorityQueue;
+typedef struct PriorityQueueInterface PriorityQueueInterface;
+
+/**
+ * @brief A handle to an Object in a PriorityQueue, for use with `decreaseKey`.
+ * @details Handles remain valid until their Object is popped or evicted from the queue.
+ */
+typedef size_t PriorityQueueHandle;
+
+/**
+ * @brief The handle returned when an Object is not added to a bounded PriorityQueue.
+ */
+#define PRIORITY_QUEUE_HANDLE_NONE ((PriorityQueueHandle) -1)
+
+/**
+ * @brief Priority queues.
+ * @details PriorityQueues are contiguous 4-ary heaps ordered by a Comparator. The Object that
+ * orders first (`OrderAscending`) is at the head of the queue. Push and pop are `O(log n)`.
+ * @extends Object
+ * @ingroup Collections
+ */
+struct PriorityQueue {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	PriorityQueueInterface *interface;
+
+	/**
+	 * @brief The count of elements.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The Comparator.
+	 */
+	Comparator comparator;
+
+	/**
+	 * @brief The maximum count of elements, or `0` for unbounded.
+	 */
+	size_t limit;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The heap capacity.
+		 */
+		size_t capacity;
+
+		/**
+		 * @brief The heap.
+		 */
+		struct PriorityQueueEntry *entries;
+
+		/**
+		 * @brief The heap position of each handle, or the next free handle for free handles.
+		 */
+		size_t *positions;
+
+		/**
+		 * @brief The count of allocated handles.
+		 */
+		size_t handles;
+
+		/**
+		 * @brief The head of the free handle list.
+		 */
+		PriorityQueueHandle freeHandle;
+
+	} locals;
+};
+
+/**
+ * @brief The PriorityQueue interface.
+ */
+struct PriorityQueueInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn void PriorityQueue::decreaseKey(PriorityQueue *self, PriorityQueueHandle handle, const ident obj)
+	 * @brief Replaces the Object for `handle` with `obj`, which must not order after it.
+	 * @param self The PriorityQueue.
+	 * @param handle The handle returned by `push`.
+	 * @param obj The replacement Object, which may be the same (mutated) Object.
+	 * @memberof PriorityQueue
+	 */
+	void (*decreaseKey)(PriorityQueue *self, PriorityQueueHandle handle, const ident obj);
+
+	/**
+	 * @fn PriorityQueue *PriorityQueue::initWithArray(PriorityQueue *self, const Array *array, Comparator comparator)
+	 * @brief Initializes this PriorityQueue with the Objects in `array`.
+	 * @param self The PriorityQueue.
+	 * @param array An Array.
+	 * @param comparator The Comparator.
+	 * @return The initialized PriorityQueue, or `NULL` on error.
+	 * @remarks The heap is built in `O(n)`. The handle of each Object is its index in `array`.
+	 * @memberof PriorityQueue
+	 */
+	PriorityQueue *(*initWithArray)(PriorityQueue *self, const Array *array, Comparator comparator);
+
+	/**
+	 * @fn PriorityQueue *PriorityQueue::initWithComparator(PriorityQueue *self, Comparator comparator)
+	 * @brief Initializes this PriorityQueue with the given Comparator.
+	 * @param self The PriorityQueue.
+	 * @param comparator The Comparator.
+	 * @return The initialized PriorityQueue, or `NULL` on error.
+	 * @memberof PriorityQueue
+	 */
+	PriorityQueue *(*initWithComparator)(PriorityQueue *self, Comparator comparator);
+
+	/**
+	 * @fn PriorityQueue *PriorityQueue::initWithLimit(PriorityQueue *self, Comparator comparator, size_t limit)
+	 * @brief Initializes this PriorityQueue to retain only the `limit` Objects that order last.
+	 * @param self The PriorityQueue.
+	 * @param comparator The Comparator.
+	 * @param limit The maximum count of elements.
+	 * @return The initialized PriorityQueue, or `NULL` on error.
+	 * @remarks This is the top-K mode: pushing onto a full queue evicts the head, if the pushed
+	 * Object orders after it. Use a descending Comparator to retain the `limit` smallest Objects.
+	 * @memberof PriorityQueue
+	 */
+	PriorityQueue *(*initWithLimit)(PriorityQueue *self, Comparator comparator, size_t limit);
+
+	/**
+	 * @fn ident PriorityQueue::peek(const PriorityQueue *self)
+	 * @param self The PriorityQueue.
+	 * @return The Object at the head of this PriorityQueue, or `NULL` if it is empty.
+	 * @memberof PriorityQueue
+	 */
+	ident (*peek)(const PriorityQueue *self);
+
+	/**
+	 * @fn ident PriorityQueue::pop(PriorityQueue *self)
+	 * @brief Removes the Object at the head of this PriorityQueue.
+	 * @param self The PriorityQueue.
+	 * @return The removed Object, retained, or `NULL` if this PriorityQueue is empty.
+	 * @memberof PriorityQueue
+	 */
+	ident (*pop)(PriorityQueue *self);
+
+	/**
+	 * @fn PriorityQueueHandle PriorityQueue::push(PriorityQueue *self, const ident obj)
+	 * @brief Adds the specified Object to this PriorityQueue.
+	 * @param self The PriorityQueue.
+	 * @param obj The Object.
+	 * @return A handle to the Object, or `PRIORITY_QUEUE_HANDLE_NONE` if this PriorityQueue is
+	 * bounded and full, and `obj` does not order after its head.
+	 * @memberof PriorityQueue
+	 */
+	PriorityQueueHandle (*push)(PriorityQueue *self, const ident obj);
+
+	/**
+	 * @fn void PriorityQueue::removeAllObjects(PriorityQueue *self)
+	 * @brief Removes all Objects from this PriorityQueue, invalidating all handles.
+	 * @param self The PriorityQueue.
+	 * @memberof PriorityQueue
+	 */
+	void (*removeAllObjects)(PriorityQueue *self);
+};
+
+/**
+ * @fn Class *PriorityQueue::_PriorityQueue(void)
+ * @brief The PriorityQueue archetype.
+ * @return The PriorityQueue Class.
+ * @memberof PriorityQueue
+ */
+OBJECTIVELY_EXPORT Class *_PriorityQueue(void);
@@ -0,0 +1,155 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/RadixSort.h>
+
+#define RADIX_SORT_INSERTION_SORT_THRESHOLD 64
+
+/**
+ * @brief The most significant bit of a key.
+ */
+#define SIGN_BIT (1ULL << 63)
+
+/**
+ * @brief Sorts `keys` in ascending unsigned order, by insertion for small counts and by
+ * least significant byte radix otherwise. Passes in which every key shares a digit are skipped.
+ */
+static void sortKeys(uint64_t *keys, size_t count) {
+
+	if (count < RADIX_SORT_INSERTION_SORT_THRESHOLD) {
+		for (size_t i = 1; i < count; i++) {
+			const uint64_t key = keys[i];
+
+			size_t j = i;
+			while (j && keys[j - 1] > key) {
+				keys[j] = keys[j - 1];
+				j--;
+			}
+
+			keys[j] = key;
+		}
+		return;
+	}
+
+	size_t histograms[sizeof(uint64_t)][256];
+	memset(histograms, 0, sizeof(histograms));
+
+	for (size_t i = 0; i < count; i++) {
+		for (size_t d = 0; d < sizeof(uint64_t); d++) {
+			histograms[d][(keys[i] >> (d * 8)) & 0xff]++;
+		}
+	}
+
+	uint64_t *buffer = malloc(count * sizeof(uint64_t));
+	assert(buffer);
+
+	uint64_t *src = keys, *dest = buffer;
+
+	for (size_t d = 0; d < sizeof(uint64_t); d++) {
+
+		size_t *histogram = histograms[d];
+		if (histogram[(src[0] >> (d * 8)) & 0xff] == count) {
+			continue;
+		}
+
+		size_t offset = 0;
+		for (size_t i = 0; i < 256; i++) {
+			const size_t n = histogram[i];
+			histogram[i] = offset;
+			offset += n;
+		}
+
+		for (size_t i = 0; i < count; i++) {
+			dest[histogram[(src[i] >> (d * 8)) & 0xff]++] = src[i];
+		}
+
+		uint64_t *swap = src;
+		src = dest;
+		dest = swap;
+	}
+
+	if (src != keys) {
+		memcpy(keys, src, count * sizeof(uint64_t));
+	}
+
+	free(buffer);
+}
+
+/**
+ * @return The key of the IEEE 754 `bits` of a double, which orders as the double does.
+ */
+static inline uint64_t keyForDouble(uint64_t bits) {
+	return (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+}
+
+/**
+ * @return The IEEE 754 bits of the double ordered by `key`.
+ */
+static inline uint64_t doubleForKey(uint64_t key) {
+	return (key & SIGN_BIT) ? key & ~SIGN_BIT : ~key;
+}
+
+void RadixSortDoubles(double *values, size_t count) {
+
+	if (count == 0) {
+		return;
+	}
+
+	uint64_t *keys = malloc(count * sizeof(uint64_t));
+	assert(keys);
+
+	memcpy(keys, values, count * sizeof(uint64_t));
+
+	for (size_t i = 0; i < count; i++) {
+		keys[i] = keyForDouble(keys[i]);
+	}
+
+	sortKeys(keys, count);
+
+	for (size_t i = 0; i < count; i++) {
+		keys[i] = doubleForKey(keys[i]);
+	}
+
+	memcpy(values, keys, count * sizeof(uint64_t));
+
+	free(keys);
+}
+
+void RadixSortIntegers(int64_t *values, size_t count) {
+
+	uint64_t *keys = (uint64_t *) values;
+
+	for (size_t i = 0; i < count; i++) {
+		keys[i] ^= SIGN_BIT;
+	}
+
+	sortKeys(keys, count);
+
+	for (size_t i = 0; i < count; i++) {
+		keys[i] ^= SIGN_BIT;
+	}
+}
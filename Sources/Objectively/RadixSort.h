@@ -0,0 +1,46 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Types.h>
+
+/**
+ * @file
+ * @brief Radix sorting shared by IntegerArray, DoubleArray and their mutable variants.
+ * @remarks This header is private to the library, and is not installed.
+ */
+
+/**
+ * @brief Sorts `values` in ascending order, in place.
+ * @param values The values.
+ * @param count The count of `values`.
+ */
+void RadixSortDoubles(double *values, size_t count);
+
+/**
+ * @brief Sorts `values` in ascending order, in place.
+ * @param values The values.
+ * @param count The count of `values`.
+ */
+void RadixSortIntegers(int64_t *values, size_t count);
@@ -0,0 +1,676 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <Objectively/Data.h>
+#include <Objectively/Hash.h>
+#include <Objectively/MutableArray.h>
+#include <Objectively/MutableRadixTree.h>
+#include <Objectively/MutableString.h>
+
+/**
+ * @return True if `child` is a leaf, false if it is a node.
+ */
+static inline _Bool isLeaf(const ident child) {
+	return ((uintptr_t) child) & 1;
+}
+
+/**
+ * @return The leaf referenced by `child`.
+ */
+static inline RadixTreeLeaf *asLeaf(const ident child) {
+	return (RadixTreeLeaf *) (((uintptr_t) child) & ~(uintptr_t) 1);
+}
+
+/**
+ * @return The bytes of the String or Data `key`, with their length in `length`.
+ */
+static const uint8_t *bytesForKey(const ident key, size_t *length) {
+
+	if ($((Object *) cast(Object, key), isKindOfClass, _String())) {
+		const String *string = (String *) key;
+
+		*length = string->length;
+		return (uint8_t *) string->chars;
+	}
+
+	const Data *data = cast(Data, key);
+
+	*length = data->length;
+	return data->bytes;
+}
+
+/**
+ * @return The child of `node` for `byte`, or `NULL`.
+ */
+static ident childForByte(const RadixTreeNode *node, uint8_t byte) {
+
+	switch (node->type) {
+		case RADIXTREE_NODE_4: {
+			const RadixTreeNode4 *n = (RadixTreeNode4 *) node;
+			for (size_t i = 0; i < node->count; i++) {
+				if (n->keys[i] == byte) {
+					return n->children[i];
+				}
+			}
+		}
+			break;
+
+		case RADIXTREE_NODE_16: {
+			const RadixTreeNode16 *n = (RadixTreeNode16 *) node;
+#if defined(__SSE2__)
+			const __m128i keys = _mm_loadu_si128((const __m128i *) n->keys);
+			const __m128i matches = _mm_cmpeq_epi8(keys, _mm_set1_epi8((char) byte));
+			const int mask = _mm_movemask_epi8(matches) & ((1 << node->count) - 1);
+			if (mask) {
+				return n->children[__builtin_ctz(mask)];
+			}
+#else
+			for (size_t i = 0; i < node->count; i++) {
+				if (n->keys[i] == byte) {
+					return n->children[i];
+				}
+			}
+#endif
+		}
+			break;
+
+		case RADIXTREE_NODE_48: {
+			const RadixTreeNode48 *n = (RadixTreeNode48 *) node;
+			if (n->index[byte]) {
+				return n->children[n->index[byte] - 1];
+			}
+		}
+			break;
+
+		case RADIXTREE_NODE_256:
+			return ((RadixTreeNode256 *) node)->children[byte];
+	}
+
+	return NULL;
+}
+
+/**
+ * @return A leaf beneath `child`, whose key spells out every compressed path above it.
+ */
+static const RadixTreeLeaf *anyLeaf(ident child) {
+
+	while (!isLeaf(child)) {
+
+		const RadixTreeNode *node = child;
+		if (node->leaf) {
+			return node->leaf;
+		}
+
+		switch (node->type) {
+			case RADIXTREE_NODE_4:
+				child = ((RadixTreeNode4 *) node)->children[0];
+				break;
+			case RADIXTREE_NODE_16:
+				child = ((RadixTreeNode16 *) node)->children[0];
+				break;
+			case RADIXTREE_NODE_48:
+				child = ((RadixTreeNode48 *) node)->children[0];
+				break;
+			case RADIXTREE_NODE_256:
+				for (size_t i = 0; i < 256; i++) {
+					if (((RadixTreeNode256 *) node)->children[i]) {
+						child = ((RadixTreeNode256 *) node)->children[i];
+						break;
+					}
+				}
+				break;
+		}
+	}
+
+	return asLeaf(child);
+}
+
+/**
+ * @return True if the key of `leaf` is exactly `bytes`.
+ */
+static inline _Bool leafMatches(const RadixTreeLeaf *leaf, const uint8_t *bytes, size_t length) {
+	return leaf->length == length && memcmp(leaf->bytes, bytes, length) == 0;
+}
+
+/**
+ * @return True if the key of `leaf` is a prefix of `bytes`.
+ */
+static inline _Bool leafIsPrefix(const RadixTreeLeaf *leaf, const uint8_t *bytes, size_t length) {
+	return leaf->length <= length && memcmp(leaf->bytes, bytes, leaf->length) == 0;
+}
+
+/**
+ * @return True if the inline prefix of `node` matches `bytes` at `depth`. Bytes beyond the inline
+ * prefix are not compared, and must be verified against the eventual leaf.
+ */
+static _Bool prefixMatches(const RadixTreeNode *node, const uint8_t *bytes, size_t length, size_t depth) {
+
+	const size_t count = min(node->prefixLength, RADIXTREE_MAX_PREFIX_LENGTH);
+	if (depth + count > length) {
+		return false;
+	}
+
+	return memcmp(node->prefix, bytes + depth, count) == 0;
+}
+
+/**
+ * @return The leaf for `bytes`, or `NULL`.
+ */
+static const RadixTreeLeaf *leafForBytes(const RadixTree *self, const uint8_t *bytes, size_t length) {
+
+	ident child = self->root;
+	size_t depth = 0;
+
+	while (child) {
+
+		if (isLeaf(child)) {
+			const RadixTreeLeaf *leaf = asLeaf(child);
+			return leafMatches(leaf, bytes, length) ? leaf : NULL;
+		}
+
+		const RadixTreeNode *node = child;
+
+		if (node->prefixLength) {
+			if (!prefixMatches(node, bytes, length, depth)) {
+				return NULL;
+			}
+			depth += node->prefixLength;
+		}
+
+		if (depth >= length) {
+			if (depth == length && node->leaf && leafMatches(node->leaf, bytes, length)) {
+				return node->leaf;
+			}
+			return NULL;
+		}
+
+		child = childForByte(node, bytes[depth++]);
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Enumerates the pairs beneath `child` in ascending order of their keys.
+ */
+static void enumerate(const RadixTree *self, const ident child, RadixTreeEnumerator enumerator, ident data) {
+
+	if (child == NULL) {
+		return;
+	}
+
+	if (isLeaf(child)) {
+		const RadixTreeLeaf *leaf = asLeaf(child);
+		enumerator(self, leaf->obj, leaf->key, data);
+		return;
+	}
+
+	const RadixTreeNode *node = child;
+
+	if (node->leaf) {
+		enumerator(self, node->leaf->obj, node->leaf->key, data);
+	}
+
+	switch (node->type) {
+		case RADIXTREE_NODE_4:
+			for (size_t i = 0; i < node->count; i++) {
+				enumerate(self, ((RadixTreeNode4 *) node)->children[i], enumerator, data);
+			}
+			break;
+		case RADIXTREE_NODE_16:
+			for (size_t i = 0; i < node->count; i++) {
+				enumerate(self, ((RadixTreeNode16 *) node)->children[i], enumerator, data);
+			}
+			break;
+		case RADIXTREE_NODE_48: {
+			const RadixTreeNode48 *n = (RadixTreeNode48 *) node;
+			for (size_t i = 0; i < 256; i++) {
+				if (n->index[i]) {
+					enumerate(self, n->children[n->index[i] - 1], enumerator, data);
+				}
+			}
+		}
+			break;
+		case RADIXTREE_NODE_256:
+			for (size_t i = 0; i < 256; i++) {
+				enumerate(self, ((RadixTreeNode256 *) node)->children[i], enumerator, data);
+			}
+			break;
+	}
+}
+
+#define _Class _RadixTree
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	const RadixTree *this = (RadixTree *) self;
+
+	if (classof(this) == _RadixTree()) {
+		return (Object *) retain((ident) this);
+	}
+
+	return (Object *) $(alloc(RadixTree), initWithRadixTree, this);
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	$$(MutableRadixTree, removeAllObjects, (MutableRadixTree *) self);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @brief RadixTreeEnumerator for description.
+ */
+static void description_enumerator(const RadixTree *tree, ident obj, ident key, ident data) {
+
+	String *objDesc = $((Object *) obj, description);
+	String *keyDesc = $((Object *) key, description);
+
+	$((MutableString *) data, appendFormat, "%s: %s, ", keyDesc->chars, objDesc->chars);
+
+	release(objDesc);
+	release(keyDesc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	MutableString *desc = $(alloc(MutableString), init);
+
+	$(desc, appendCharacters, "{");
+
+	$((RadixTree *) self, enumerateObjectsAndKeys, description_enumerator, desc);
+
+	$(desc, appendCharacters, "}");
+
+	return (String *) desc;
+}
+
+/**
+ * @brief RadixTreeEnumerator for hash.
+ */
+static void hash_enumerator(const RadixTree *tree, ident obj, ident key, ident data) {
+
+	int *hash = data;
+
+	*hash = HashForObject(*hash, key);
+	*hash = HashForObject(*hash, obj);
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	const RadixTree *this = (RadixTree *) self;
+
+	int hash = HashForInteger(HASH_SEED, this->count);
+
+	$(this, enumerateObjectsAndKeys, hash_enumerator, &hash);
+
+	return hash;
+}
+
+/**
+ * @brief RadixTreeEnumerator for isEqual.
+ */
+static void isEqual_enumerator(const RadixTree *tree, ident obj, ident key, ident data) {
+
+	const RadixTree **that = data;
+
+	if (*that) {
+		const ident other = $(*that, objectForKey, key);
+		if (other == NULL || !$((Object *) obj, isEqual, other)) {
+			*that = NULL;
+		}
+	}
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, _RadixTree())) {
+
+		const RadixTree *this = (RadixTree *) self;
+		const RadixTree *that = (RadixTree *) other;
+
+		if (this->count == that->count) {
+			$(this, enumerateObjectsAndKeys, isEqual_enumerator, &that);
+			return that != NULL;
+		}
+	}
+
+	return false;
+}
+
+#pragma mark - RadixTree
+
+/**
+ * @brief RadixTreeEnumerator for allKeys.
+ */
+static void allKeys_enumerator(const RadixTree *tree, ident obj, ident key, ident data) {
+	$((MutableArray *) data, addObject, key);
+}
+
+/**
+ * @fn Array *RadixTree::allKeys(const RadixTree *self)
+ * @memberof RadixTree
+ */
+static Array *allKeys(const RadixTree *self) {
+
+	MutableArray *keys = $(alloc(MutableArray), initWithCapacity, self->count);
+
+	$(self, enumerateObjectsAndKeys, allKeys_enumerator, keys);
+
+	return (Array *) keys;
+}
+
+/**
+ * @brief RadixTreeEnumerator for allObjects.
+ */
+static void allObjects_enumerator(const RadixTree *tree, ident obj, ident key, ident data) {
+	$((MutableArray *) data, addObject, obj);
+}
+
+/**
+ * @fn Array *RadixTree::allObjects(const RadixTree *self)
+ * @memberof RadixTree
+ */
+static Array *allObjects(const RadixTree *self) {
+
+	MutableArray *objects = $(alloc(MutableArray), initWithCapacity, self->count);
+
+	$(self, enumerateObjectsAndKeys, allObjects_enumerator, objects);
+
+	return (Array *) objects;
+}
+
+/**
+ * @fn _Bool RadixTree::containsKey(const RadixTree *self, const ident key)
+ * @memberof RadixTree
+ */
+static _Bool containsKey(const RadixTree *self, const ident key) {
+	return $(self, objectForKey, key) != NULL;
+}
+
+/**
+ * @fn void RadixTree::enumerateObjectsAndKeys(const RadixTree *self, RadixTreeEnumerator enumerator, ident data)
+ * @memberof RadixTree
+ */
+static void enumerateObjectsAndKeys(const RadixTree *self, RadixTreeEnumerator enumerator, ident data) {
+
+	assert(enumerator);
+
+	enumerate(self, self->root, enumerator, data);
+}
+
+/**
+ * @fn void RadixTree::enumerateObjectsAndKeysWithPrefix(const RadixTree *self, const ident prefix, RadixTreeEnumerator enumerator, ident data)
+ * @memberof RadixTree
+ */
+static void enumerateObjectsAndKeysWithPrefix(const RadixTree *self, const ident prefix, RadixTreeEnumerator enumerator, ident data) {
+
+	assert(enumerator);
+
+	size_t length;
+	const uint8_t *bytes = bytesForKey(prefix, &length);
+
+	ident child = self->root;
+	size_t depth = 0;
+
+	while (child) {
+
+		if (isLeaf(child)) {
+			const RadixTreeLeaf *leaf = asLeaf(child);
+			if (leaf->length >= length && memcmp(leaf->bytes, bytes, length) == 0) {
+				enumerator(self, leaf->obj, leaf->key, data);
+			}
+			return;
+		}
+
+		const RadixTreeNode *node = child;
+
+		if (node->prefixLength) {
+
+			const size_t count = min((size_t) node->prefixLength, length - depth);
+			if (count <= RADIXTREE_MAX_PREFIX_LENGTH) {
+				if (memcmp(node->prefix, bytes + depth, count)) {
+					return;
+				}
+			} else {
+				const RadixTreeLeaf *leaf = anyLeaf(child);
+				if (memcmp(leaf->bytes + depth, bytes + depth, count)) {
+					return;
+				}
+			}
+
+			depth += node->prefixLength;
+		}
+
+		if (depth >= length) {
+			enumerate(self, child, enumerator, data);
+			return;
+		}
+
+		child = childForByte(node, bytes[depth++]);
+	}
+}
+
+/**
+ * @brief DictionaryEnumerator for initWithDictionary.
+ */
+static void initWithDictionary_enumerator(const Dictionary *dictionary, ident obj, ident key, ident data) {
+	$$(MutableRadixTree, setObjectForKey, (MutableRadixTree *) data, obj, key);
+}
+
+/**
+ * @fn RadixTree *RadixTree::initWithDictionary(RadixTree *self, const Dictionary *dictionary)
+ * @memberof RadixTree
+ */
+static RadixTree *initWithDictionary(RadixTree *self, const Dictionary *dictionary) {
+
+	self = (RadixTree *) super(Object, self, init);
+	if (self) {
+		if (dictionary) {
+			$(dictionary, enumerateObjectsAndKeys, initWithDictionary_enumerator, self);
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @brief RadixTreeEnumerator for initWithRadixTree.
+ */
+static void initWithRadixTree_enumerator(const RadixTree *tree, ident obj, ident key, ident data) {
+	$$(MutableRadixTree, setObjectForKey, (MutableRadixTree *) data, obj, key);
+}
+
+/**
+ * @fn RadixTree *RadixTree::initWithRadixTree(RadixTree *self, const RadixTree *tree)
+ * @memberof RadixTree
+ */
+static RadixTree *initWithRadixTree(RadixTree *self, const RadixTree *tree) {
+
+	self = (RadixTree *) super(Object, self, init);
+	if (self) {
+		if (tree) {
+			$(tree, enumerateObjectsAndKeys, initWithRadixTree_enumerator, self);
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn MutableRadixTree *RadixTree::mutableCopy(const RadixTree *self)
+ * @memberof RadixTree
+ */
+static MutableRadixTree *mutableCopy(const RadixTree *self) {
+
+	return (MutableRadixTree *) $((RadixTree *) alloc(MutableRadixTree), initWithRadixTree, self);
+}
+
+/**
+ * @fn ident RadixTree::objectForKey(const RadixTree *self, const ident key)
+ * @memberof RadixTree
+ */
+static ident objectForKey(const RadixTree *self, const ident key) {
+
+	size_t length;
+	const uint8_t *bytes = bytesForKey(key, &length);
+
+	const RadixTreeLeaf *leaf = leafForBytes(self, bytes, length);
+	if (leaf) {
+		return leaf->obj;
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn ident RadixTree::objectForLongestPrefixOfKey(const RadixTree *self, const ident key)
+ * @memberof RadixTree
+ */
+static ident objectForLongestPrefixOfKey(const RadixTree *self, const ident key) {
+
+	size_t length;
+	const uint8_t *bytes = bytesForKey(key, &length);
+
+	const RadixTreeLeaf *match = NULL;
+
+	ident child = self->root;
+	size_t depth = 0;
+
+	while (child) {
+
+		if (isLeaf(child)) {
+			const RadixTreeLeaf *leaf = asLeaf(child);
+			if (leafIsPrefix(leaf, bytes, length)) {
+				match = leaf;
+			}
+			break;
+		}
+
+		const RadixTreeNode *node = child;
+
+		if (node->prefixLength) {
+			if (!prefixMatches(node, bytes, length, depth)) {
+				break;
+			}
+			depth += node->prefixLength;
+		}
+
+		if (depth > length) {
+			break;
+		}
+
+		if (node->leaf && leafIsPrefix(node->leaf, bytes, length)) {
+			match = node->leaf;
+		}
+
+		if (depth == length) {
+			break;
+		}
+
+		child = childForByte(node, bytes[depth++]);
+	}
+
+	return match ? match->obj : NULL;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->description = description;
+	object->hash = hash;
+	object->isEqual = isEqual;
+
+	RadixTreeInterface *radixTree = (RadixTreeInterface *) clazz->def->interface;
+
+	radixTree->allKeys = allKeys;
+	radixTree->allObjects = allObjects;
+	radixTree->containsKey = containsKey;
+	radixTree->enumerateObjectsAndKeys = enumerateObjectsAndKeys;
+	radixTree->enumerateObjectsAndKeysWithPrefix = enumerateObjectsAndKeysWithPrefix;
+	radixTree->initWithDictionary = initWithDictionary;
+	radixTree->initWithRadixTree = initWithRadixTree;
+	radixTree->mutableCopy = mutableCopy;
+	radixTree->objectForKey = objectForKey;
+	radixTree->objectForLongestPrefixOfKey = objectForLongestPrefixOfKey;
+}
+
+/**
+ * @fn Class *RadixTree::_RadixTree(void)
+ * @memberof RadixTree
+ */
+Class *_RadixTree(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "RadixTree";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(RadixTree);
+		clazz.interfaceOffset = offsetof(RadixTree, interface);
+		clazz.interfaceSize = sizeof(RadixTreeInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
@@ -0,0 +1,303 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+#include <Objectively/Dictionary.h>
+
+/**
+ * @file
+ * @brief Adaptive radix trees, mapping String or Data keys to Objects in key order.
+ */
+
+/**
+ * @brief The count of prefix bytes stored inline in each RadixTree node. Longer prefixes are
+ * compared optimistically, and verified against the key of a descendant leaf.
+ */
+#define RADIXTREE_MAX_PREFIX_LENGTH 10
+
+typedef struct RadixTree RadixTree;
+typedef struct RadixTreeInterface RadixTreeInterface;
+
+/**
+ * @brief A function type for RadixTree enumeration (iteration).
+ * @param tree The RadixTree.
+ * @param obj The Object for the current iteration.
+ * @param key The key for the current iteration.
+ * @param data User data.
+ */
+typedef void (*RadixTreeEnumerator)(const RadixTree *tree, ident obj, ident key, ident data);
+
+/**
+ * @brief A RadixTree leaf, holding one key-value pair.
+ */
+typedef struct {
+
+	/**
+	 * @brief The key, a String or Data.
+	 */
+	ident key;
+
+	/**
+	 * @brief The Object.
+	 */
+	ident obj;
+
+	/**
+	 * @brief The bytes of `key`.
+	 */
+	const uint8_t *bytes;
+
+	/**
+	 * @brief The length of `bytes`.
+	 */
+	size_t length;
+} RadixTreeLeaf;
+
+/**
+ * @brief RadixTree node types, which grow and shrink with their count of children.
+ */
+typedef enum {
+	RADIXTREE_NODE_4,
+	RADIXTREE_NODE_16,
+	RADIXTREE_NODE_48,
+	RADIXTREE_NODE_256
+} RadixTreeNodeType;
+
+/**
+ * @brief The header common to all RadixTree nodes.
+ * @remarks Children are either nodes or leaves. Leaves are distinguished by the low bit of
+ * their address, which is set.
+ */
+typedef struct {
+
+	/**
+	 * @brief The node type.
+	 */
+	RadixTreeNodeType type;
+
+	/**
+	 * @brief The count of children.
+	 */
+	uint16_t count;
+
+	/**
+	 * @brief The length of the compressed path preceding this node's children.
+	 */
+	uint32_t prefixLength;
+
+	/**
+	 * @brief The first bytes of the compressed path.
+	 */
+	uint8_t prefix[RADIXTREE_MAX_PREFIX_LENGTH];
+
+	/**
+	 * @brief The leaf whose key ends at this node, or `NULL`.
+	 */
+	RadixTreeLeaf *leaf;
+} RadixTreeNode;
+
+/**
+ * @brief A RadixTree node with up to 4 children, keyed in ascending order.
+ */
+typedef struct {
+	RadixTreeNode node;
+	uint8_t keys[4];
+	ident children[4];
+} RadixTreeNode4;
+
+/**
+ * @brief A RadixTree node with up to 16 children, keyed in ascending order.
+ */
+typedef struct {
+	RadixTreeNode node;
+	uint8_t keys[16];
+	ident children[16];
+} RadixTreeNode16;
+
+/**
+ * @brief A RadixTree node with up to 48 children, indexed by byte. Indexes are offset by one.
+ */
+typedef struct {
+	RadixTreeNode node;
+	uint8_t index[256];
+	ident children[48];
+} RadixTreeNode48;
+
+/**
+ * @brief A RadixTree node with up to 256 children, addressed directly by byte.
+ */
+typedef struct {
+	RadixTreeNode node;
+	ident children[256];
+} RadixTreeNode256;
+
+/**
+ * @brief Adaptive radix trees, mapping String or Data keys to Objects in key order.
+ * @details Keys are compared by their bytes. Paths are compressed, and nodes adapt their layout
+ * to their count of children, so that memory is proportional to the count of keys. Lookups
+ * visit at most one node per byte of the key, independent of the count of keys.
+ * @remarks Keys are retained, and must not be mutated while they are in the tree.
+ * @extends Object
+ * @ingroup Collections
+ */
+struct RadixTree {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	RadixTreeInterface *interface;
+
+	/**
+	 * @brief The count of key-value pairs.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The root node or leaf, or `NULL`.
+	 * @private
+	 */
+	ident root;
+};
+
+typedef struct MutableRadixTree MutableRadixTree;
+
+/**
+ * @brief The RadixTree interface.
+ */
+struct RadixTreeInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn Array *RadixTree::allKeys(const RadixTree *self)
+	 * @param self The RadixTree.
+	 * @return An Array containing all keys in this RadixTree, in ascending order.
+	 * @memberof RadixTree
+	 */
+	Array *(*allKeys)(const RadixTree *self);
+
+	/**
+	 * @fn Array *RadixTree::allObjects(const RadixTree *self)
+	 * @param self The RadixTree.
+	 * @return An Array containing all Objects in this RadixTree, in the order of their keys.
+	 * @memberof RadixTree
+	 */
+	Array *(*allObjects)(const RadixTree *self);
+
+	/**
+	 * @fn _Bool RadixTree::containsKey(const RadixTree *self, const ident key)
+	 * @param self The RadixTree.
+	 * @param key The String or Data key.
+	 * @return `true` if this RadixTree contains `key`, `false` otherwise.
+	 * @memberof RadixTree
+	 */
+	_Bool (*containsKey)(const RadixTree *self, const ident key);
+
+	/**
+	 * @fn void RadixTree::enumerateObjectsAndKeys(const RadixTree *self, RadixTreeEnumerator enumerator, ident data)
+	 * @brief Enumerates the pairs of this RadixTree, in ascending order of their keys.
+	 * @param self The RadixTree.
+	 * @param enumerator The enumerator function.
+	 * @param data User data.
+	 * @memberof RadixTree
+	 */
+	void (*enumerateObjectsAndKeys)(const RadixTree *self, RadixTreeEnumerator enumerator, ident data);
+
+	/**
+	 * @fn void RadixTree::enumerateObjectsAndKeysWithPrefix(const RadixTree *self, const ident prefix, RadixTreeEnumerator enumerator, ident data)
+	 * @brief Enumerates the pairs of this RadixTree whose keys begin with `prefix`, in ascending order.
+	 * @param self The RadixTree.
+	 * @param prefix The String or Data prefix.
+	 * @param enumerator The enumerator function.
+	 * @param data User data.
+	 * @memberof RadixTree
+	 */
+	void (*enumerateObjectsAndKeysWithPrefix)(const RadixTree *self, const ident prefix, RadixTreeEnumerator enumerator, ident data);
+
+	/**
+	 * @fn RadixTree *RadixTree::initWithDictionary(RadixTree *self, const Dictionary *dictionary)
+	 * @brief Initializes this RadixTree with the pairs of `dictionary`.
+	 * @param self The RadixTree.
+	 * @param dictionary A Dictionary with String or Data keys.
+	 * @return The initialized RadixTree, or `NULL` on error.
+	 * @memberof RadixTree
+	 */
+	RadixTree *(*initWithDictionary)(RadixTree *self, const Dictionary *dictionary);
+
+	/**
+	 * @fn RadixTree *RadixTree::initWithRadixTree(RadixTree *self, const RadixTree *tree)
+	 * @brief Initializes this RadixTree with the pairs of `tree`.
+	 * @param self The RadixTree.
+	 * @param tree A RadixTree.
+	 * @return The initialized RadixTree, or `NULL` on error.
+	 * @memberof RadixTree
+	 */
+	RadixTree *(*initWithRadixTree)(RadixTree *self, const RadixTree *tree);
+
+	/**
+	 * @fn MutableRadixTree *RadixTree::mutableCopy(const RadixTree *self)
+	 * @param self The RadixTree.
+	 * @return A MutableRadixTree with the contents of this RadixTree.
+	 * @memberof RadixTree
+	 */
+	MutableRadixTree *(*mutableCopy)(const RadixTree *self);
+
+	/**
+	 * @fn ident RadixTree::objectForKey(const RadixTree *self, const ident key)
+	 * @param self The RadixTree.
+	 * @param key The String or Data key.
+	 * @return The Object stored at `key`, or `NULL`.
+	 * @memberof RadixTree
+	 */
+	ident (*objectForKey)(const RadixTree *self, const ident key);
+
+	/**
+	 * @fn ident RadixTree::objectForLongestPrefixOfKey(const RadixTree *self, const ident key)
+	 * @brief Performs a longest prefix match, as for routing tables.
+	 * @param self The RadixTree.
+	 * @param key The String or Data key.
+	 * @return The Object stored at the longest key in this RadixTree that is a prefix of `key`,
+	 * or `NULL` if no key is a prefix of `key`.
+	 * @memberof RadixTree
+	 */
+	ident (*objectForLongestPrefixOfKey)(const RadixTree *self, const ident key);
+};
+
+/**
+ * @fn Class *RadixTree::_RadixTree(void)
+ * @brief The RadixTree archetype.
+ * @return The RadixTree Class.
+ * @memberof RadixTree
+ */
+OBJECTIVELY_EXPORT Class *_RadixTree(void);
@@ -0,0 +1,804 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/Config.h>
+
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <io.h>
+#endif
+
+#if HAVE_SYS_UIO_H
+#include <sys/uio.h>
+#endif
+
+#include <Objectively/Rope.h>
+
+#define ROPE_IOVEC_COUNT 64
+
+/**
+ * @brief A Rope piece, and the root of the subtree of pieces around it.
+ */
+typedef struct RopeNode {
+	String *string;
+	Range range;
+	size_t length;
+	int height;
+	struct RopeNode *left;
+	struct RopeNode *right;
+} RopeNode;
+
+/**
+ * @brief A function type for visiting the characters of a Rope, piece by piece.
+ * @return `true` to continue visiting, `false` to stop.
+ */
+typedef _Bool (*RopeVisitor)(const char *chars, size_t length, ident data);
+
+/**
+ * @return The height of the subtree at `node`.
+ */
+static inline int height(const RopeNode *node) {
+	return node ? node->height : 0;
+}
+
+/**
+ * @return The length of the subtree at `node`, in bytes.
+ */
+static inline size_t lengthOf(const RopeNode *node) {
+	return node ? node->length : 0;
+}
+
+/**
+ * @brief Updates the height and length of `node` from its children.
+ */
+static void update(RopeNode *node) {
+
+	node->height = max(height(node->left), height(node->right)) + 1;
+	node->length = lengthOf(node->left) + node->range.length + lengthOf(node->right);
+}
+
+/**
+ * @return A new node for `range` of `string`, which is retained.
+ */
+static RopeNode *newNode(String *string, const Range range) {
+
+	RopeNode *node = calloc(1, sizeof(RopeNode));
+	assert(node);
+
+	node->string = retain(string);
+	node->range = range;
+
+	update(node);
+	return node;
+}
+
+/**
+ * @brief Frees the subtree at `node`, releasing its Strings.
+ */
+static void freeNode(RopeNode *node) {
+
+	if (node) {
+		freeNode(node->left);
+		freeNode(node->right);
+
+		release(node->string);
+		free(node);
+	}
+}
+
+/**
+ * @return A copy of the subtree at `node`.
+ */
+static RopeNode *copyNode(const RopeNode *node) {
+
+	if (node == NULL) {
+		return NULL;
+	}
+
+	RopeNode *copy = malloc(sizeof(RopeNode));
+	assert(copy);
+
+	*copy = *node;
+
+	retain(copy->string);
+	copy->left = copyNode(node->left);
+	copy->right = copyNode(node->right);
+
+	return copy;
+}
+
+static RopeNode *rotateLeft(RopeNode *node) {
+
+	RopeNode *right = node->right;
+
+	node->right = right->left;
+	right->left = node;
+
+	update(node);
+	update(right);
+
+	return right;
+}
+
+static RopeNode *rotateRight(RopeNode *node) {
+
+	RopeNode *left = node->left;
+
+	node->left = left->right;
+	left->right = node;
+
+	update(node);
+	update(left);
+
+	return left;
+}
+
+/**
+ * @brief Restores the AVL balance of `node`, whose subtrees differ in height by at most two.
+ * @return The new root of the subtree.
+ */
+static RopeNode *rebalance(RopeNode *node) {
+
+	update(node);
+
+	const int balance = height(node->left) - height(node->right);
+	if (balance > 1) {
+		if (height(node->left->left) < height(node->left->right)) {
+			node->left = rotateLeft(node->left);
+		}
+		return rotateRight(node);
+	}
+
+	if (balance < -1) {
+		if (height(node->right->right) < height(node->right->left)) {
+			node->right = rotateRight(node->right);
+		}
+		return rotateLeft(node);
+	}
+
+	return node;
+}
+
+/**
+ * @brief Joins `left`, `node` and `right`, in that order, in `O(|height(left) - height(right)|)`.
+ * @return The root of the joined tree.
+ */
+static RopeNode *join(RopeNode *left, RopeNode *node, RopeNode *right) {
+
+	if (height(left) > height(right) + 1) {
+		left->right = join(left->right, node, right);
+		return rebalance(left);
+	}
+
+	if (height(right) > height(left) + 1) {
+		right->left = join(left, node, right->left);
+		return rebalance(right);
+	}
+
+	node->left = left;
+	node->right = right;
+
+	update(node);
+	return node;
+}
+
+/**
+ * @brief Removes the first node of the subtree at `node`, returning it in `first`.
+ * @return The new root of the subtree.
+ */
+static RopeNode *removeFirst(RopeNode *node, RopeNode **first) {
+
+	if (node->left == NULL) {
+		*first = node;
+		return node->right;
+	}
+
+	node->left = removeFirst(node->left, first);
+	return rebalance(node);
+}
+
+/**
+ * @return The root of the tree joining `left` and `right`, in that order.
+ */
+static RopeNode *concatenate(RopeNode *left, RopeNode *right) {
+
+	if (left == NULL) {
+		return right;
+	}
+
+	if (right == NULL) {
+		return left;
+	}
+
+	RopeNode *first;
+	right = removeFirst(right, &first);
+
+	return join(left, first, right);
+}
+
+/**
+ * @brief Splits the subtree at `node` into the characters before `index`, and those after it.
+ * @remarks A piece spanning `index` is split in two, both referencing its String.
+ */
+static void split(RopeNode *node, size_t index, RopeNode **left, RopeNode **right) {
+
+	if (node == NULL) {
+		*left = *right = NULL;
+		return;
+	}
+
+	RopeNode *l = node->left, *r = node->right;
+	const size_t leftLength = lengthOf(l);
+
+	if (index <= leftLength) {
+		RopeNode *middle;
+		split(l, index, left, &middle);
+		*right = join(middle, node, r);
+	} else if (index >= leftLength + node->range.length) {
+		RopeNode *middle;
+		split(r, index - leftLength - node->range.length, &middle, right);
+		*left = join(l, node, middle);
+	} else {
+		const size_t offset = index - leftLength;
+
+		RopeNode *tail = newNode(node->string, (Range) {
+			.location = node->range.location + offset,
+			.length = node->range.length - offset
+		});
+
+		node->range.length = offset;
+
+		*left = join(l, node, NULL);
+		*right = join(NULL, tail, r);
+	}
+}
+
+/**
+ * @return A balanced tree of `count` `nodes`, in order.
+ */
+static RopeNode *build(RopeNode **nodes, size_t count) {
+
+	if (count == 0) {
+		return NULL;
+	}
+
+	const size_t mid = count / 2;
+	RopeNode *node = nodes[mid];
+
+	node->left = build(nodes, mid);
+	node->right = build(nodes + mid + 1, count - mid - 1);
+
+	update(node);
+	return node;
+}
+
+/**
+ * @brief Visits the characters of the subtree at `node`, which begins at `start`, within `range`.
+ */
+static _Bool visitNode(const RopeNode *node, size_t start, const Range range, RopeVisitor visitor, ident data) {
+
+	if (node == NULL) {
+		return true;
+	}
+
+	const size_t end = range.location + range.length;
+	if (start >= end || start + node->length <= (size_t) range.location) {
+		return true;
+	}
+
+	if (visitNode(node->left, start, range, visitor, data) == false) {
+		return false;
+	}
+
+	const size_t pieceStart = start + lengthOf(node->left);
+	const size_t pieceEnd = pieceStart + node->range.length;
+
+	const size_t from = max(pieceStart, (size_t) range.location);
+	const size_t to = min(pieceEnd, end);
+
+	if (from < to) {
+		const char *chars = node->string->chars + node->range.location + (from - pieceStart);
+		if (visitor(chars, to - from, data) == false) {
+			return false;
+		}
+	}
+
+	return visitNode(node->right, pieceEnd, range, visitor, data);
+}
+
+/**
+ * @brief Visits the characters of `self` within `range`, in order.
+ * @return `true` if all pieces were visited, `false` if `visitor` stopped.
+ */
+static _Bool visit(const Rope *self, const Range range, RopeVisitor visitor, ident data) {
+
+	assert(range.location >= 0);
+	assert(range.location + range.length <= self->length);
+
+	const RopeNode *root = self->locals.root;
+
+	if (visitNode(root, 0, range, visitor, data) == false) {
+		return false;
+	}
+
+	size_t start = lengthOf(root);
+
+	RopeNode **pending = self->locals.pending;
+	for (size_t i = 0; i < self->locals.numberOfPending; i++) {
+		if (visitNode(pending[i], start, range, visitor, data) == false) {
+			return false;
+		}
+		start += pending[i]->range.length;
+	}
+
+	return true;
+}
+
+/**
+ * @brief A RopeVisitor copying characters to the cursor at `data`.
+ */
+static _Bool copyCharacters(const char *chars, size_t length, ident data) {
+
+	char **cursor = data;
+
+	memcpy(*cursor, chars, length);
+	*cursor += length;
+
+	return true;
+}
+
+/**
+ * @return A null-terminated copy of the characters of `self` within `range`.
+ */
+static char *flatten(const Rope *self, const Range range) {
+
+	char *chars = malloc(range.length + 1);
+	assert(chars);
+
+	char *cursor = chars;
+	visit(self, range, copyCharacters, &cursor);
+
+	*cursor = '\0';
+	return chars;
+}
+
+/**
+ * @brief Joins the pending pieces of `self` to its tree.
+ */
+static void flush(Rope *self) {
+
+	if (self->locals.numberOfPending) {
+
+		RopeNode *pending = build(self->locals.pending, self->locals.numberOfPending);
+		self->locals.root = concatenate(self->locals.root, pending);
+
+		self->locals.numberOfPending = 0;
+	}
+}
+
+/**
+ * @return An immutable String with the contents of `string`, which is retained if possible.
+ */
+static String *immutableString(const String *string) {
+
+	if (classof(string) == _String()) {
+		return retain((ident) string);
+	}
+
+	return $(string, compact);
+}
+
+#if HAVE_SYS_UIO_H
+
+/**
+ * @brief The state of a Rope being written with `writev`.
+ */
+typedef struct {
+	int fd;
+	struct iovec iov[ROPE_IOVEC_COUNT];
+	int count;
+} RopeWriter;
+
+/**
+ * @brief Writes the pending vectors of `writer`, resuming after partial writes.
+ * @return `true` on success, `false` on error.
+ */
+static _Bool writeVectors(RopeWriter *writer) {
+
+	struct iovec *iov = writer->iov;
+	int count = writer->count;
+
+	writer->count = 0;
+
+	while (count) {
+
+		const ssize_t n = writev(writer->fd, iov, count);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+
+		size_t written = n;
+		while (count && written >= iov->iov_len) {
+			written -= iov->iov_len;
+			iov++;
+			count--;
+		}
+
+		if (count) {
+			iov->iov_base = (char *) iov->iov_base + written;
+			iov->iov_len -= written;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief A RopeVisitor batching characters into the RopeWriter at `data`.
+ */
+static _Bool writeCharacters(const char *chars, size_t length, ident data) {
+
+	RopeWriter *writer = data;
+
+	writer->iov[writer->count].iov_base = (char *) chars;
+	writer->iov[writer->count].iov_len = length;
+
+	if (++writer->count == ROPE_IOVEC_COUNT) {
+		return writeVectors(writer);
+	}
+
+	return true;
+}
+
+#else
+
+/**
+ * @brief A RopeVisitor writing characters to the file descriptor at `data`.
+ */
+static _Bool writeCharacters(const char *chars, size_t length, ident data) {
+
+	const int fd = *(int *) data;
+
+	while (length) {
+
+		const ssize_t n = write(fd, chars, length);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+
+		chars += n;
+		length -= n;
+	}
+
+	return true;
+}
+
+#endif
+
+#define _Class _Rope
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	const Rope *this = (Rope *) self;
+
+	Rope *that = $(alloc(Rope), init);
+	if (that) {
+
+		that->locals.root = copyNode(this->locals.root);
+
+		RopeNode **pending = this->locals.pending;
+		for (size_t i = 0; i < this->locals.numberOfPending; i++) {
+			RopeNode *node = newNode(pending[i]->string, pending[i]->range);
+			that->locals.root = concatenate(that->locals.root, node);
+		}
+
+		that->length = this->length;
+	}
+
+	return (Object *) that;
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	Rope *this = (Rope *) self;
+
+	freeNode(this->locals.root);
+
+	RopeNode **pending = this->locals.pending;
+	for (size_t i = 0; i < this->locals.numberOfPending; i++) {
+		freeNode(pending[i]);
+	}
+
+	free(pending);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	return $((Rope *) self, string);
+}
+
+#pragma mark - Rope
+
+/**
+ * @fn void Rope::appendCharacters(Rope *self, const char *chars)
+ * @memberof Rope
+ */
+static void appendCharacters(Rope *self, const char *chars) {
+
+	assert(chars);
+
+	String *string = $$(String, stringWithCharacters, chars);
+
+	$(self, appendString, string);
+
+	release(string);
+}
+
+/**
+ * @fn void Rope::appendString(Rope *self, const String *string)
+ * @memberof Rope
+ */
+static void appendString(Rope *self, const String *string) {
+
+	assert(string);
+
+	if (string->length == 0) {
+		return;
+	}
+
+	if (self->locals.numberOfPending == self->locals.pendingCapacity) {
+
+		self->locals.pendingCapacity = self->locals.pendingCapacity ? self->locals.pendingCapacity * 2 : 16;
+
+		self->locals.pending = realloc(self->locals.pending, self->locals.pendingCapacity * sizeof(RopeNode *));
+		assert(self->locals.pending);
+	}
+
+	String *piece = immutableString(string);
+
+	RopeNode **pending = self->locals.pending;
+	pending[self->locals.numberOfPending++] = newNode(piece, (Range) { .length = piece->length });
+
+	release(piece);
+
+	self->length += string->length;
+}
+
+/**
+ * @fn Data *Rope::data(const Rope *self)
+ * @memberof Rope
+ */
+static Data *data(const Rope *self) {
+
+	char *chars = flatten(self, (Range) { .length = self->length });
+
+	return $$(Data, dataWithMemory, chars, self->length);
+}
+
+/**
+ * @fn void Rope::deleteCharactersInRange(Rope *self, const Range range)
+ * @memberof Rope
+ */
+static void deleteCharactersInRange(Rope *self, const Range range) {
+
+	assert(range.location >= 0);
+	assert(range.location + range.length <= self->length);
+
+	if (range.length == 0) {
+		return;
+	}
+
+	flush(self);
+
+	RopeNode *left, *middle, *deleted, *right;
+
+	split(self->locals.root, range.location, &left, &middle);
+	split(middle, range.length, &deleted, &right);
+
+	freeNode(deleted);
+
+	self->locals.root = concatenate(left, right);
+	self->length -= range.length;
+}
+
+/**
+ * @fn Rope *Rope::init(Rope *self)
+ * @memberof Rope
+ */
+static Rope *init(Rope *self) {
+
+	return (Rope *) super(Object, self, init);
+}
+
+/**
+ * @fn Rope *Rope::initWithString(Rope *self, const String *string)
+ * @memberof Rope
+ */
+static Rope *initWithString(Rope *self, const String *string) {
+
+	self = $(self, init);
+	if (self) {
+		$(self, appendString, string);
+	}
+
+	return self;
+}
+
+/**
+ * @fn void Rope::insertCharactersAtIndex(Rope *self, const char *chars, size_t index)
+ * @memberof Rope
+ */
+static void insertCharactersAtIndex(Rope *self, const char *chars, size_t index) {
+
+	assert(chars);
+
+	String *string = $$(String, stringWithCharacters, chars);
+
+	$(self, insertStringAtIndex, string, index);
+
+	release(string);
+}
+
+/**
+ * @fn void Rope::insertStringAtIndex(Rope *self, const String *string, size_t index)
+ * @memberof Rope
+ */
+static void insertStringAtIndex(Rope *self, const String *string, size_t index) {
+
+	assert(string);
+	assert(index <= self->length);
+
+	if (string->length == 0) {
+		return;
+	}
+
+	flush(self);
+
+	RopeNode *left, *right;
+	split(self->locals.root, index, &left, &right);
+
+	String *piece = immutableString(string);
+
+	RopeNode *node = newNode(piece, (Range) { .length = piece->length });
+	self->locals.root = join(left, node, right);
+
+	release(piece);
+
+	self->length += string->length;
+}
+
+/**
+ * @fn String *Rope::string(const Rope *self)
+ * @memberof Rope
+ */
+static String *string(const Rope *self) {
+
+	return $(self, substring, (Range) { .length = self->length });
+}
+
+/**
+ * @fn String *Rope::substring(const Rope *self, const Range range)
+ * @memberof Rope
+ */
+static String *substring(const Rope *self, const Range range) {
+
+	char *chars = flatten(self, range);
+
+	return $$(String, stringWithMemory, chars, range.length);
+}
+
+/**
+ * @fn _Bool Rope::writeToFileDescriptor(const Rope *self, int fd)
+ * @memberof Rope
+ */
+static _Bool writeToFileDescriptor(const Rope *self, int fd) {
+
+	const Range range = { .length = self->length };
+
+#if HAVE_SYS_UIO_H
+	RopeWriter writer = { .fd = fd };
+
+	if (visit(self, range, writeCharacters, &writer)) {
+		return writeVectors(&writer);
+	}
+
+	return false;
+#else
+	return visit(self, range, writeCharacters, &fd);
+#endif
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->description = description;
+
+	RopeInterface *rope = (RopeInterface *) clazz->def->interface;
+
+	rope->appendCharacters = appendCharacters;
+	rope->appendString = appendString;
+	rope->data = data;
+	rope->deleteCharactersInRange = deleteCharactersInRange;
+	rope->init = init;
+	rope->initWithString = initWithString;
+	rope->insertCharactersAtIndex = insertCharactersAtIndex;
+	rope->insertStringAtIndex = insertStringAtIndex;
+	rope->string = string;
+	rope->substring = substring;
+	rope->writeToFileDescriptor = writeToFileDescriptor;
+}
+
+/**
+ * @fn Class *Rope::_Rope(void)
+ * @memberof Rope
+ */
+Class *_Rope(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "Rope";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(Rope);
+		clazz.interfaceOffset = offsetof(Rope, interface);
+		clazz.interfaceSize = sizeof(RopeInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
@@ -0,0 +1,212 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Data.h>
+#include <Objectively/Object.h>
+#include <Objectively/String.h>
+
+/**
+ * @file
+ * @brief Ropes assemble large texts from Strings, without copying them.
+ */
+
+typedef struct Rope Rope;
+typedef struct RopeInterface RopeInterface;
+
+/**
+ * @brief Ropes assemble large texts from Strings, without copying them.
+ * @details A Rope is a balanced tree of pieces, each referencing a Range of a retained String.
+ * Inserting or deleting characters at any index splits and joins the tree in `O(log n)` time.
+ * Appended Strings are queued, and joined to the tree in bulk before the next insertion or
+ * deletion, so that appending is `O(1)` amortized. Flattening a Rope to a String or Data, or
+ * writing it to a file descriptor, visits each piece once.
+ * @remarks MutableStrings are copied when added to a Rope; all other Strings are retained.
+ * @extends Object
+ */
+struct Rope {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	RopeInterface *interface;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The root of the tree.
+		 */
+		ident root;
+
+		/**
+		 * @brief The pieces appended since the tree was last modified.
+		 */
+		ident pending;
+
+		/**
+		 * @brief The count of pending pieces.
+		 */
+		size_t numberOfPending;
+
+		/**
+		 * @brief The capacity of `pending`.
+		 */
+		size_t pendingCapacity;
+	} locals;
+
+	/**
+	 * @brief The length of this Rope in bytes.
+	 */
+	size_t length;
+};
+
+/**
+ * @brief The Rope interface.
+ */
+struct RopeInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn void Rope::appendCharacters(Rope *self, const char *chars)
+	 * @brief Appends a copy of the specified UTF-8 encoded C string.
+	 * @param self The Rope.
+	 * @param chars A UTF-8 encoded C string.
+	 * @memberof Rope
+	 */
+	void (*appendCharacters)(Rope *self, const char *chars);
+
+	/**
+	 * @fn void Rope::appendString(Rope *self, const String *string)
+	 * @brief Appends the specified String, by reference.
+	 * @param self The Rope.
+	 * @param string The String to append.
+	 * @memberof Rope
+	 */
+	void (*appendString)(Rope *self, const String *string);
+
+	/**
+	 * @fn Data *Rope::data(const Rope *self)
+	 * @param self The Rope.
+	 * @return A Data with the UTF-8 encoded contents of this Rope.
+	 * @memberof Rope
+	 */
+	Data *(*data)(const Rope *self);
+
+	/**
+	 * @fn void Rope::deleteCharactersInRange(Rope *self, const Range range)
+	 * @brief Deletes the characters within `range` from this Rope.
+	 * @param self The Rope.
+	 * @param range The Range of characters to delete.
+	 * @memberof Rope
+	 */
+	void (*deleteCharactersInRange)(Rope *self, const Range range);
+
+	/**
+	 * @fn Rope *Rope::init(Rope *self)
+	 * @brief Initializes this Rope.
+	 * @param self The Rope.
+	 * @return The initialized Rope, or `NULL` on error.
+	 * @memberof Rope
+	 */
+	Rope *(*init)(Rope *self);
+
+	/**
+	 * @fn Rope *Rope::initWithString(Rope *self, const String *string)
+	 * @brief Initializes this Rope with the specified String.
+	 * @param self The Rope.
+	 * @param string The String.
+	 * @return The initialized Rope, or `NULL` on error.
+	 * @memberof Rope
+	 */
+	Rope *(*initWithString)(Rope *self, const String *string);
+
+	/**
+	 * @fn void Rope::insertCharactersAtIndex(Rope *self, const char *chars, size_t index)
+	 * @brief Inserts a copy of the specified UTF-8 encoded C string at the given index.
+	 * @param self The Rope.
+	 * @param chars A UTF-8 encoded C string.
+	 * @param index The index, in bytes.
+	 * @memberof Rope
+	 */
+	void (*insertCharactersAtIndex)(Rope *self, const char *chars, size_t index);
+
+	/**
+	 * @fn void Rope::insertStringAtIndex(Rope *self, const String *string, size_t index)
+	 * @brief Inserts the specified String, by reference, at the given index.
+	 * @param self The Rope.
+	 * @param string The String to insert.
+	 * @param index The index, in bytes.
+	 * @memberof Rope
+	 */
+	void (*insertStringAtIndex)(Rope *self, const String *string, size_t index);
+
+	/**
+	 * @fn String *Rope::string(const Rope *self)
+	 * @param self The Rope.
+	 * @return A String with the contents of this Rope.
+	 * @memberof Rope
+	 */
+	String *(*string)(const Rope *self);
+
+	/**
+	 * @fn String *Rope::substring(const Rope *self, const Range range)
+	 * @param self The Rope.
+	 * @param range The character Range.
+	 * @return A String with the contents of `range` of this Rope.
+	 * @memberof Rope
+	 */
+	String *(*substring)(const Rope *self, const Range range);
+
+	/**
+	 * @fn _Bool Rope::writeToFileDescriptor(const Rope *self, int fd)
+	 * @brief Writes the contents of this Rope to the specified file descriptor.
+	 * @param self The Rope.
+	 * @param fd The file descriptor.
+	 * @return `true` on success, `false` on error.
+	 * @remarks Pieces are written in batches with `writev`, where available.
+	 * @memberof Rope
+	 */
+	_Bool (*writeToFileDescriptor)(const Rope *self, int fd);
+};
+
+/**
+ * @fn Class *Rope::_Rope(void)
+ * @brief The Rope archetype.
+ * @return The Rope Class.
+ * @memberof Rope
+ */
+OBJECTIVELY_EXPORT Class *_Rope(void);
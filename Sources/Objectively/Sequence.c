@@ -0,0 +1,613 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include <Objectively/MutableArray.h>
+#include <Objectively/Number.h>
+#include <Objectively/Sequence.h>
+
+/**
+ * @brief Sequence source and stage kinds.
+ */
+enum {
+	SequenceKindArray,
+	SequenceKindDictionary,
+	SequenceKindGenerator,
+	SequenceKindIndexSet,
+	SequenceKindSet,
+	SequenceKindFilter,
+	SequenceKindFlatMap,
+	SequenceKindMap,
+	SequenceKindSkip,
+	SequenceKindTake,
+	SequenceKindZip,
+};
+
+/**
+ * @brief The evaluation state of a Sequence, mirroring its stage chain.
+ */
+typedef struct Iterator Iterator;
+
+struct Iterator {
+
+	/**
+	 * @brief The Sequence being evaluated.
+	 */
+	const Sequence *sequence;
+
+	/**
+	 * @brief The upstream Iterator, for stages.
+	 */
+	Iterator *upstream;
+
+	/**
+	 * @brief The other Iterator, for `zip`.
+	 */
+	Iterator *other;
+
+	/**
+	 * @brief The current inner Sequence, for `flatMap`.
+	 */
+	Sequence *innerSequence;
+
+	/**
+	 * @brief The current inner Iterator, for `flatMap`.
+	 */
+	Iterator *inner;
+
+	/**
+	 * @brief The element, bin or Range index.
+	 */
+	size_t index;
+
+	/**
+	 * @brief The position within the current bin or Range.
+	 */
+	size_t position;
+
+	/**
+	 * @brief True once this Iterator has been exhausted.
+	 */
+	_Bool done;
+};
+
+/**
+ * @brief Creates an Iterator for the given Sequence.
+ */
+static Iterator *createIterator(const Sequence *sequence) {
+
+	Iterator *it = calloc(1, sizeof(Iterator));
+	assert(it);
+
+	it->sequence = sequence;
+
+	if (sequence->locals.upstream) {
+		it->upstream = createIterator(sequence->locals.upstream);
+	}
+
+	if (sequence->locals.other) {
+		it->other = createIterator(sequence->locals.other);
+	}
+
+	return it;
+}
+
+/**
+ * @brief Frees the given Iterator and its upstream Iterators.
+ */
+static void freeIterator(Iterator *it) {
+
+	if (it) {
+		freeIterator(it->upstream);
+		freeIterator(it->other);
+		freeIterator(it->inner);
+
+		release(it->innerSequence);
+
+		free(it);
+	}
+}
+
+/**
+ * @brief Coerces the given collection to a Sequence.
+ * @return A retained Sequence.
+ */
+static Sequence *sequenceForObject(ident obj) {
+
+	assert(obj);
+
+	if ($((Object *) obj, isKindOfClass, _Sequence())) {
+		return retain(obj);
+	} else if ($((Object *) obj, isKindOfClass, _Array())) {
+		return $(alloc(Sequence), initWithArray, obj);
+	} else if ($((Object *) obj, isKindOfClass, _Dictionary())) {
+		return $(alloc(Sequence), initWithDictionary, obj);
+	} else if ($((Object *) obj, isKindOfClass, _IndexSet())) {
+		return $(alloc(Sequence), initWithIndexSet, obj);
+	} else if ($((Object *) obj, isKindOfClass, _Set())) {
+		return $(alloc(Sequence), initWithSet, obj);
+	}
+
+	assert(false);
+	return NULL;
+}
+
+/**
+ * @brief Pulls the next element through the given Iterator.
+ * @return The next element, retained, or `NULL` if the Iterator is exhausted.
+ */
+static ident next(Iterator *it) {
+
+	if (it->done) {
+		return NULL;
+	}
+
+	const Sequence *sequence = it->sequence;
+	ident obj = NULL;
+
+	switch (sequence->locals.kind) {
+
+		case SequenceKindArray: {
+			const Array *array = (Array *) sequence->locals.source;
+			if (it->index < array->count) {
+				obj = retain(array->elements[it->index++]);
+			}
+		}
+			break;
+
+		case SequenceKindDictionary: {
+			const Dictionary *dictionary = (Dictionary *) sequence->locals.source;
+			while (it->index < dictionary->capacity) {
+				const Array *array = dictionary->elements[it->index];
+				if (array && it->position < array->count) {
+					obj = retain(array->elements[it->position]);
+					it->position += 2;
+					break;
+				}
+				it->index++;
+				it->position = 0;
+			}
+		}
+			break;
+
+		case SequenceKindGenerator: {
+			const SequenceGenerator generator = sequence->locals.function;
+			obj = generator(it->index++, sequence->locals.data);
+		}
+			break;
+
+		case SequenceKindIndexSet: {
+			const IndexSet *indexSet = (IndexSet *) sequence->locals.source;
+			while (it->index < indexSet->numberOfRanges) {
+				const Range range = indexSet->ranges[it->index];
+				if (it->position < range.length) {
+					obj = $$(Number, numberWithValue, range.location + it->position++);
+					break;
+				}
+				it->index++;
+				it->position = 0;
+			}
+		}
+			break;
+
+		case SequenceKindSet: {
+			const Set *set = (Set *) sequence->locals.source;
+			while (it->index < set->capacity) {
+				const Array *array = set->elements[it->index];
+				if (array && it->position < array->count) {
+					obj = retain(array->elements[it->position++]);
+					break;
+				}
+				it->index++;
+				it->position = 0;
+			}
+		}
+			break;
+
+		case SequenceKindFilter: {
+			const Predicate predicate = sequence->locals.function;
+			while ((obj = next(it->upstream))) {
+				if (predicate(obj, sequence->locals.data)) {
+					break;
+				}
+				release(obj);
+			}
+		}
+			break;
+
+		case SequenceKindFlatMap: {
+			const Functor functor = sequence->locals.function;
+			while (true) {
+				if (it->inner) {
+					obj = next(it->inner);
+					if (obj) {
+						break;
+					}
+
+					freeIterator(it->inner);
+					it->inner = NULL;
+
+					release(it->innerSequence);
+					it->innerSequence = NULL;
+				}
+
+				ident element = next(it->upstream);
+				if (element == NULL) {
+					break;
+				}
+
+				ident result = functor(element, sequence->locals.data);
+				release(element);
+
+				it->innerSequence = sequenceForObject(result);
+				release(result);
+
+				it->inner = createIterator(it->innerSequence);
+			}
+		}
+			break;
+
+		case SequenceKindMap: {
+			const Functor functor = sequence->locals.function;
+			ident element = next(it->upstream);
+			if (element) {
+				obj = functor(element, sequence->locals.data);
+				assert(obj);
+
+				release(element);
+			}
+		}
+			break;
+
+		case SequenceKindSkip:
+			while (it->index < sequence->locals.limit) {
+				ident element = next(it->upstream);
+				if (element == NULL) {
+					break;
+				}
+				release(element);
+				it->index++;
+			}
+			obj = next(it->upstream);
+			break;
+
+		case SequenceKindTake:
+			if (it->index < sequence->locals.limit) {
+				obj = next(it->upstream);
+				it->index++;
+			}
+			break;
+
+		case SequenceKindZip: {
+			ident a = next(it->upstream);
+			if (a) {
+				ident b = next(it->other);
+				if (b) {
+					obj = $(alloc(Array), initWithObjects, a, b, NULL);
+					release(b);
+				}
+				release(a);
+			}
+		}
+			break;
+	}
+
+	if (obj == NULL) {
+		it->done = true;
+	}
+
+	return obj;
+}
+
+#define _Class _Sequence
+
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	Sequence *this = (Sequence *) self;
+
+	release(this->locals.source);
+	release(this->locals.upstream);
+	release(this->locals.other);
+
+	super(Object, self, dealloc);
+}
+
+#pragma mark - Sequence
+
+/**
+ * @brief Creates a new stage Sequence downstream of the given Sequence.
+ */
+static Sequence *stage(const Sequence *self, int kind, ident function, ident data, size_t limit) {
+
+	Sequence *sequence = (Sequence *) super(Object, alloc(Sequence), init);
+	if (sequence) {
+		sequence->locals.kind = kind;
+		sequence->locals.upstream = retain((Sequence *) self);
+		sequence->locals.function = function;
+		sequence->locals.data = data;
+		sequence->locals.limit = limit;
+	}
+
+	return sequence;
+}
+
+/**
+ * @brief Initializes the given Sequence with a source collection.
+ */
+static Sequence *source(Sequence *self, int kind, const ident collection) {
+
+	assert(collection);
+
+	self = (Sequence *) super(Object, self, init);
+	if (self) {
+		self->locals.kind = kind;
+		self->locals.source = retain(collection);
+	}
+
+	return self;
+}
+
+/**
+ * @fn size_t Sequence::count(const Sequence *self)
+ * @memberof Sequence
+ */
+static size_t count(const Sequence *self) {
+
+	Iterator *it = createIterator(self);
+	size_t count = 0;
+
+	ident obj;
+	while ((obj = next(it))) {
+		release(obj);
+		count++;
+	}
+
+	freeIterator(it);
+	return count;
+}
+
+/**
+ * @fn Sequence *Sequence::filter(const Sequence *self, Predicate predicate, ident data)
+ * @memberof Sequence
+ */
+static Sequence *filter(const Sequence *self, Predicate predicate, ident data) {
+
+	assert(predicate);
+
+	return stage(self, SequenceKindFilter, predicate, data, 0);
+}
+
+/**
+ * @fn ident Sequence::first(const Sequence *self)
+ * @memberof Sequence
+ */
+static ident first(const Sequence *self) {
+
+	Iterator *it = createIterator(self);
+
+	ident obj = next(it);
+
+	freeIterator(it);
+	return obj;
+}
+
+/**
+ * @fn Sequence *Sequence::flatMap(const Sequence *self, Functor functor, ident data)
+ * @memberof Sequence
+ */
+static Sequence *flatMap(const Sequence *self, Functor functor, ident data) {
+
+	assert(functor);
+
+	return stage(self, SequenceKindFlatMap, functor, data, 0);
+}
+
+/**
+ * @fn Sequence *Sequence::initWithArray(Sequence *self, const Array *array)
+ * @memberof Sequence
+ */
+static Sequence *initWithArray(Sequence *self, const Array *array) {
+	return source(self, SequenceKindArray, (ident) array);
+}
+
+/**
+ * @fn Sequence *Sequence::initWithDictionary(Sequence *self, const Dictionary *dictionary)
+ * @memberof Sequence
+ */
+static Sequence *initWithDictionary(Sequence *self, const Dictionary *dictionary) {
+	return source(self, SequenceKindDictionary, (ident) dictionary);
+}
+
+/**
+ * @fn Sequence *Sequence::initWithGenerator(Sequence *self, SequenceGenerator generator, ident data)
+ * @memberof Sequence
+ */
+static Sequence *initWithGenerator(Sequence *self, SequenceGenerator generator, ident data) {
+
+	assert(generator);
+
+	self = (Sequence *) super(Object, self, init);
+	if (self) {
+		self->locals.kind = SequenceKindGenerator;
+		self->locals.function = generator;
+		self->locals.data = data;
+	}
+
+	return self;
+}
+
+/**
+ * @fn Sequence *Sequence::initWithIndexSet(Sequence *self, const IndexSet *indexSet)
+ * @memberof Sequence
+ */
+static Sequence *initWithIndexSet(Sequence *self, const IndexSet *indexSet) {
+	return source(self, SequenceKindIndexSet, (ident) indexSet);
+}
+
+/**
+ * @fn Sequence *Sequence::initWithSet(Sequence *self, const Set *set)
+ * @memberof Sequence
+ */
+static Sequence *initWithSet(Sequence *self, const Set *set) {
+	return source(self, SequenceKindSet, (ident) set);
+}
+
+/**
+ * @fn Sequence *Sequence::map(const Sequence *self, Functor functor, ident data)
+ * @memberof Sequence
+ */
+static Sequence *map(const Sequence *self, Functor functor, ident data) {
+
+	assert(functor);
+
+	return stage(self, SequenceKindMap, functor, data, 0);
+}
+
+/**
+ * @fn ident Sequence::reduce(const Sequence *self, Reducer reducer, ident accumulator, ident data)
+ * @memberof Sequence
+ */
+static ident reduce(const Sequence *self, Reducer reducer, ident accumulator, ident data) {
+
+	assert(reducer);
+
+	Iterator *it = createIterator(self);
+
+	ident obj;
+	while ((obj = next(it))) {
+		accumulator = reducer(obj, accumulator, data);
+		release(obj);
+	}
+
+	freeIterator(it);
+	return accumulator;
+}
+
+/**
+ * @fn Sequence *Sequence::skip(const Sequence *self, size_t count)
+ * @memberof Sequence
+ */
+static Sequence *skip(const Sequence *self, size_t count) {
+	return stage(self, SequenceKindSkip, NULL, NULL, count);
+}
+
+/**
+ * @fn Sequence *Sequence::take(const Sequence *self, size_t count)
+ * @memberof Sequence
+ */
+static Sequence *take(const Sequence *self, size_t count) {
+	return stage(self, SequenceKindTake, NULL, NULL, count);
+}
+
+/**
+ * @fn Array *Sequence::toArray(const Sequence *self)
+ * @memberof Sequence
+ */
+static Array *toArray(const Sequence *self) {
+
+	MutableArray *array = $(alloc(MutableArray), init);
+
+	Iterator *it = createIterator(self);
+
+	ident obj;
+	while ((obj = next(it))) {
+		$(array, addObject, obj);
+		release(obj);
+	}
+
+	freeIterator(it);
+	return (Array *) array;
+}
+
+/**
+ * @fn Sequence *Sequence::zip(const Sequence *self, const Sequence *other)
+ * @memberof Sequence
+ */
+static Sequence *zip(const Sequence *self, const Sequence *other) {
+
+	assert(other);
+
+	Sequence *sequence = stage(self, SequenceKindZip, NULL, NULL, 0);
+	if (sequence) {
+		sequence->locals.other = retain((Sequence *) other);
+	}
+
+	return sequence;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ObjectInterface *) clazz->def->interface)->dealloc = dealloc;
+
+	SequenceInterface *sequence = (SequenceInterface *) clazz->def->interface;
+
+	sequence->count = count;
+	sequence->filter = filter;
+	sequence->first = first;
+	sequence->flatMap = flatMap;
+	sequence->initWithArray = initWithArray;
+	sequence->initWithDictionary = initWithDictionary;
+	sequence->initWithGenerator = initWithGenerator;
+	sequence->initWithIndexSet = initWithIndexSet;
+	sequence->initWithSet = initWithSet;
+	sequence->map = map;
+	sequence->reduce = reduce;
+	sequence->skip = skip;
+	sequence->take = take;
+	sequence->toArray = toArray;
+	sequence->zip = zip;
+}
+
+/**
+ * @fn Class *Sequence::_Sequence(void)
+ * @memberof Sequence
+ */
+Class *_Sequence(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "Sequence";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(Sequence);
+		clazz.interfaceOffset = offsetof(Sequence, interface);
+		clazz.interfaceSize = sizeof(SequenceInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
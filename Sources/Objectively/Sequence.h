@@ -0,0 +1,278 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+#include <Objectively/Dictionary.h>
+#include <Objectively/IndexSet.h>
+#include <Objectively/Set.h>
+
+/**
+ * @file
+ * @brief Sequences are lazy, composable pipelines over collections and generators.
+ */
+
+typedef struct Sequence Sequence;
+typedef struct SequenceInterface SequenceInterface;
+
+/**
+ * @brief The generator function type for Sequences.
+ * @param index The index of the element to generate.
+ * @param data User data.
+ * @return The element at `index`, retained, or `NULL` to end the Sequence.
+ */
+typedef ident (*SequenceGenerator)(size_t index, ident data);
+
+/**
+ * @brief Sequences are lazy, composable pipelines over collections and generators.
+ * @details Stages such as `map` and `filter` do no work when they are created. Instead, each
+ * element is pulled through every stage in a single pass when a terminal operation (`toArray`,
+ * `reduce`, `first` or `count`) is invoked, so no intermediate collections are allocated.
+ * Sequences are immutable, and may be evaluated any number of times.
+ * @extends Object
+ */
+struct Sequence {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	SequenceInterface *interface;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The stage or source kind.
+		 */
+		int kind;
+
+		/**
+		 * @brief The source collection, for collection Sequences.
+		 */
+		Object *source;
+
+		/**
+		 * @brief The upstream Sequence, for stages.
+		 */
+		Sequence *upstream;
+
+		/**
+		 * @brief The other Sequence, for `zip`.
+		 */
+		Sequence *other;
+
+		/**
+		 * @brief The Functor, Predicate or SequenceGenerator.
+		 */
+		ident function;
+
+		/**
+		 * @brief The user data for `function`.
+		 */
+		ident data;
+
+		/**
+		 * @brief The limit, for `take` and `skip`.
+		 */
+		size_t limit;
+
+	} locals;
+};
+
+/**
+ * @brief The Sequence interface.
+ */
+struct SequenceInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn size_t Sequence::count(const Sequence *self)
+	 * @brief Evaluates this Sequence, counting its elements.
+	 * @param self The Sequence.
+	 * @return The number of elements in this Sequence.
+	 * @memberof Sequence
+	 */
+	size_t (*count)(const Sequence *self);
+
+	/**
+	 * @fn Sequence *Sequence::filter(const Sequence *self, Predicate predicate, ident data)
+	 * @param self The Sequence.
+	 * @param predicate The Predicate.
+	 * @param data User data.
+	 * @return A new Sequence of the elements of this Sequence that pass `predicate`.
+	 * @memberof Sequence
+	 */
+	Sequence *(*filter)(const Sequence *self, Predicate predicate, ident data);
+
+	/**
+	 * @fn ident Sequence::first(const Sequence *self)
+	 * @brief Evaluates this Sequence up to and including its first element.
+	 * @param self The Sequence.
+	 * @return The first element of this Sequence, retained, or `NULL` if it is empty.
+	 * @memberof Sequence
+	 */
+	ident (*first)(const Sequence *self);
+
+	/**
+	 * @fn Sequence *Sequence::flatMap(const Sequence *self, Functor functor, ident data)
+	 * @param self The Sequence.
+	 * @param functor A Functor returning a Sequence, Array, Set, Dictionary or IndexSet.
+	 * @param data User data.
+	 * @return A new Sequence of the concatenated elements of the results of `functor`.
+	 * @memberof Sequence
+	 */
+	Sequence *(*flatMap)(const Sequence *self, Functor functor, ident data);
+
+	/**
+	 * @fn Sequence *Sequence::initWithArray(Sequence *self, const Array *array)
+	 * @brief Initializes this Sequence with the elements of the given Array.
+	 * @param self The Sequence.
+	 * @param array The Array.
+	 * @return The initialized Sequence, or `NULL` on error.
+	 * @memberof Sequence
+	 */
+	Sequence *(*initWithArray)(Sequence *self, const Array *array);
+
+	/**
+	 * @fn Sequence *Sequence::initWithDictionary(Sequence *self, const Dictionary *dictionary)
+	 * @brief Initializes this Sequence with the keys of the given Dictionary.
+	 * @param self The Sequence.
+	 * @param dictionary The Dictionary.
+	 * @return The initialized Sequence, or `NULL` on error.
+	 * @memberof Sequence
+	 */
+	Sequence *(*initWithDictionary)(Sequence *self, const Dictionary *dictionary);
+
+	/**
+	 * @fn Sequence *Sequence::initWithGenerator(Sequence *self, SequenceGenerator generator, ident data)
+	 * @brief Initializes this Sequence with the given SequenceGenerator.
+	 * @param self The Sequence.
+	 * @param generator The SequenceGenerator.
+	 * @param data User data.
+	 * @return The initialized Sequence, or `NULL` on error.
+	 * @remarks Infinite generators must be bounded by `take` before evaluation.
+	 * @memberof Sequence
+	 */
+	Sequence *(*initWithGenerator)(Sequence *self, SequenceGenerator generator, ident data);
+
+	/**
+	 * @fn Sequence *Sequence::initWithIndexSet(Sequence *self, const IndexSet *indexSet)
+	 * @brief Initializes this Sequence with the indexes of the given IndexSet, as Numbers.
+	 * @param self The Sequence.
+	 * @param indexSet The IndexSet.
+	 * @return The initialized Sequence, or `NULL` on error.
+	 * @memberof Sequence
+	 */
+	Sequence *(*initWithIndexSet)(Sequence *self, const IndexSet *indexSet);
+
+	/**
+	 * @fn Sequence *Sequence::initWithSet(Sequence *self, const Set *set)
+	 * @brief Initializes this Sequence with the elements of the given Set.
+	 * @param self The Sequence.
+	 * @param set The Set.
+	 * @return The initialized Sequence, or `NULL` on error.
+	 * @memberof Sequence
+	 */
+	Sequence *(*initWithSet)(Sequence *self, const Set *set);
+
+	/**
+	 * @fn Sequence *Sequence::map(const Sequence *self, Functor functor, ident data)
+	 * @param self The Sequence.
+	 * @param functor The Functor, which must return a retained, non-`NULL` Object.
+	 * @param data User data.
+	 * @return A new Sequence of the results of `functor` applied to the elements of this Sequence.
+	 * @memberof Sequence
+	 */
+	Sequence *(*map)(const Sequence *self, Functor functor, ident data);
+
+	/**
+	 * @fn ident Sequence::reduce(const Sequence *self, Reducer reducer, ident accumulator, ident data)
+	 * @brief Evaluates this Sequence, reducing its elements.
+	 * @param self The Sequence.
+	 * @param reducer The Reducer.
+	 * @param accumulator The initial accumulator value.
+	 * @param data User data.
+	 * @return The reduction result.
+	 * @memberof Sequence
+	 */
+	ident (*reduce)(const Sequence *self, Reducer reducer, ident accumulator, ident data);
+
+	/**
+	 * @fn Sequence *Sequence::skip(const Sequence *self, size_t count)
+	 * @param self The Sequence.
+	 * @param count The number of elements to skip.
+	 * @return A new Sequence of the elements of this Sequence after the first `count`.
+	 * @memberof Sequence
+	 */
+	Sequence *(*skip)(const Sequence *self, size_t count);
+
+	/**
+	 * @fn Sequence *Sequence::take(const Sequence *self, size_t count)
+	 * @param self The Sequence.
+	 * @param count The maximum number of elements to take.
+	 * @return A new Sequence of at most the first `count` elements of this Sequence.
+	 * @remarks Upstream stages are not evaluated beyond the `count`th element.
+	 * @memberof Sequence
+	 */
+	Sequence *(*take)(const Sequence *self, size_t count);
+
+	/**
+	 * @fn Array *Sequence::toArray(const Sequence *self)
+	 * @brief Evaluates this Sequence, collecting its elements.
+	 * @param self The Sequence.
+	 * @return An Array containing the elements of this Sequence.
+	 * @memberof Sequence
+	 */
+	Array *(*toArray)(const Sequence *self);
+
+	/**
+	 * @fn Sequence *Sequence::zip(const Sequence *self, const Sequence *other)
+	 * @param self The Sequence.
+	 * @param other The other Sequence.
+	 * @return A new Sequence of two-element Arrays pairing the elements of this Sequence with
+	 * those of `other`, ending with the shorter of the two.
+	 * @memberof Sequence
+	 */
+	Sequence *(*zip)(const Sequence *self, const Sequence *other);
+};
+
+/**
+ * @fn Class *Sequence::_Sequence(void)
+ * @brief The Sequence archetype.
+ * @return The Sequence Class.
+ * @memberof Sequence
+ */
+OBJECTIVELY_EXPORT Class *_Sequence(void);
@@ -25,9 +25,11 @@
 #include <stdarg.h>
 #include <stdlib.h>
 
+#include <Objectively/FrozenSet.h>
 #include <Objectively/Hash.h>
 #include <Objectively/MutableArray.h>
 #include <Objectively/MutableSet.h>
+#include <Objectively/Parallel.h>
 #include <Objectively/Set.h>
 #include <Objectively/String.h>
 
@@ -42,6 +44,10 @@ static Object *copy(const Object *self) {
 
 	const Set *this = (Set *) self;
 
+	if (classof(this) == _Set()) {
+		return (Object *) retain((ident) this);
+	}
+
 	Set *that = $(alloc(Set), initWithSet, this);
 
 	return (Object *) that;
@@ -107,18 +113,12 @@ static _Bool isEqual(const Object *self, const Object *other) {
 
 		if (this->count == that->count) {
 
-			Array *objects = $(this, allObjects);
-
-			for (size_t i = 0; i < objects->count; i++) {
-				const ident obj = $(objects, objectAtIndex, i);
-
+			foreach(const ident obj, this) {
 				if ($(that, containsObject, obj) == false) {
-					release(objects);
 					return false;
 				}
 			}
 
-			release(objects);
 			return true;
 		}
 	}
@@ -164,6 +164,24 @@ static _Bool containsObject(const Set *self, const ident obj) {
 	return false;
 }
 
+/**
+ * @fn size_t Set::countByEnumerating(const Set *self, FastEnumerationState *state)
+ * @memberof Set
+ */
+static size_t countByEnumerating(const Set *self, FastEnumerationState *state) {
+
+	while (state->cursor[0] < self->capacity) {
+
+		const Array *array = self->elements[state->cursor[0]++];
+		if (array && array->count) {
+			state->items = array->elements;
+			return array->count;
+		}
+	}
+
+	return 0;
+}
+
 /**
  * @fn void Set::enumerateObjects(const Set *self, SetEnumerator enumerator, ident data)
  * @memberof Set
@@ -178,7 +196,7 @@ static void enumerateObjects(const Set *self, SetEnumerator enumerator, ident da
 		if (array) {
 
 			for (size_t j = 0; j < array->count; j++) {
-				enumerator(self, $(array, objectAtIndex, j), data);
+				enumerator(self, array->elements[j], data);
 			}
 		}
 	}
@@ -200,7 +218,7 @@ static Set *filteredSet(const Set *self, Predicate predicate, ident data) {
 		if (array) {
 
 			for (size_t j = 0; j < array->count; j++) {
-				ident obj = $(array, objectAtIndex, j);
+				ident obj = array->elements[j];
 
 				if (predicate(obj, data)) {
 					$(set, addObject, obj);
@@ -212,6 +230,14 @@ static Set *filteredSet(const Set *self, Predicate predicate, ident data) {
 	return (Set *) set;
 }
 
+/**
+ * @fn FrozenSet *Set::freeze(const Set *self)
+ * @memberof Set
+ */
+static FrozenSet *freeze(const Set *self) {
+	return $(alloc(FrozenSet), initWithSet, self);
+}
+
 /**
  * @brief ArrayEnumerator for initWithArray.
  */
@@ -329,6 +355,190 @@ static MutableSet *mutableCopy(const Set *self) {
 	return copy;
 }
 
+/**
+ * @return A flat, dynamically allocated copy of this Set's element pointers.
+ */
+static ident *gatherObjects(const Set *self) {
+
+	ident *objects = calloc(self->count, sizeof(ident));
+	assert(objects);
+
+	ident *obj = objects;
+	for (size_t i = 0; i < self->capacity; i++) {
+
+		const Array *array = self->elements[i];
+		if (array) {
+			for (size_t j = 0; j < array->count; j++) {
+				*obj++ = array->elements[j];
+			}
+		}
+	}
+
+	return objects;
+}
+
+/**
+ * @brief The context of parallel Set operations.
+ */
+typedef struct {
+	ident *objects;
+	ident function;
+	ident accumulator;
+	ident data;
+	ident *results;
+} ParallelSet;
+
+/**
+ * @brief ParallelFunction for parallelFilteredSet.
+ */
+static void parallelFilteredSet_function(const Range range, size_t chunk, ident data) {
+
+	ParallelSet *parallel = (ParallelSet *) data;
+	const Predicate predicate = (Predicate) parallel->function;
+
+	for (size_t i = range.location; i < range.location + range.length; i++) {
+		if (predicate(parallel->objects[i], parallel->data) == false) {
+			parallel->objects[i] = NULL;
+		}
+	}
+}
+
+/**
+ * @fn Set *Set::parallelFilteredSet(const Set *self, Predicate predicate, ident data)
+ * @memberof Set
+ */
+static Set *parallelFilteredSet(const Set *self, Predicate predicate, ident data) {
+
+	assert(predicate);
+
+	if (ParallelChunkCount(self->count) < 2) {
+		return $(self, filteredSet, predicate, data);
+	}
+
+	ParallelSet parallel = {
+		.objects = gatherObjects(self),
+		.function = predicate,
+		.data = data
+	};
+
+	ParallelFor(self->count, parallelFilteredSet_function, &parallel);
+
+	MutableSet *set = $(alloc(MutableSet), initWithCapacity, self->capacity);
+	assert(set);
+
+	for (size_t i = 0; i < self->count; i++) {
+		if (parallel.objects[i]) {
+			$(set, addObject, parallel.objects[i]);
+		}
+	}
+
+	free(parallel.objects);
+
+	return (Set *) set;
+}
+
+/**
+ * @brief ParallelFunction for parallelMappedSet.
+ */
+static void parallelMappedSet_function(const Range range, size_t chunk, ident data) {
+
+	ParallelSet *parallel = (ParallelSet *) data;
+	const Functor functor = (Functor) parallel->function;
+
+	for (size_t i = range.location; i < range.location + range.length; i++) {
+		parallel->objects[i] = functor(parallel->objects[i], parallel->data);
+		assert(parallel->objects[i]);
+	}
+}
+
+/**
+ * @fn Set *Set::parallelMappedSet(const Set *self, Functor functor, ident data)
+ * @memberof Set
+ */
+static Set *parallelMappedSet(const Set *self, Functor functor, ident data) {
+
+	assert(functor);
+
+	if (ParallelChunkCount(self->count) < 2) {
+		return $(self, mappedSet, functor, data);
+	}
+
+	ParallelSet parallel = {
+		.objects = gatherObjects(self),
+		.function = functor,
+		.data = data
+	};
+
+	ParallelFor(self->count, parallelMappedSet_function, &parallel);
+
+	MutableSet *set = $(alloc(MutableSet), initWithCapacity, self->capacity);
+	assert(set);
+
+	for (size_t i = 0; i < self->count; i++) {
+		$(set, addObject, parallel.objects[i]);
+		release(parallel.objects[i]);
+	}
+
+	free(parallel.objects);
+
+	return (Set *) set;
+}
+
+/**
+ * @brief ParallelFunction for parallelReduce.
+ */
+static void parallelReduce_function(const Range range, size_t chunk, ident data) {
+
+	ParallelSet *parallel = (ParallelSet *) data;
+	const Reducer reducer = (Reducer) parallel->function;
+
+	ident accumulator = parallel->accumulator;
+
+	for (size_t i = range.location; i < range.location + range.length; i++) {
+		accumulator = reducer(parallel->objects[i], accumulator, parallel->data);
+	}
+
+	parallel->results[chunk] = accumulator;
+}
+
+/**
+ * @fn ident Set::parallelReduce(const Set *self, Reducer reducer, Reducer combiner, ident accumulator, ident data)
+ * @memberof Set
+ */
+static ident parallelReduce(const Set *self, Reducer reducer, Reducer combiner, ident accumulator, ident data) {
+
+	assert(reducer);
+	assert(combiner);
+
+	const size_t chunks = ParallelChunkCount(self->count);
+	if (chunks < 2) {
+		return $(self, reduce, reducer, accumulator, data);
+	}
+
+	ParallelSet parallel = {
+		.objects = gatherObjects(self),
+		.function = reducer,
+		.accumulator = accumulator,
+		.data = data,
+		.results = calloc(chunks, sizeof(ident))
+	};
+
+	assert(parallel.results);
+
+	ParallelFor(self->count, parallelReduce_function, &parallel);
+
+	accumulator = parallel.results[0];
+
+	for (size_t i = 1; i < chunks; i++) {
+		accumulator = combiner(parallel.results[i], accumulator, data);
+	}
+
+	free(parallel.results);
+	free(parallel.objects);
+
+	return accumulator;
+}
+
 /**
  * @fn ident Set::reduce(const Set *self, Reducer reducer, ident accumulator, ident data)
  * @memberof Set
@@ -411,13 +621,18 @@ static void initialize(Class *clazz) {
 
 	set->allObjects = allObjects;
 	set->containsObject = containsObject;
+	set->countByEnumerating = countByEnumerating;
 	set->enumerateObjects = enumerateObjects;
 	set->filteredSet = filteredSet;
+	set->freeze = freeze;
 	set->initWithArray = initWithArray;
 	set->initWithSet = initWithSet;
 	set->initWithObjects = initWithObjects;
 	set->mappedSet = mappedSet;
 	set->mutableCopy = mutableCopy;
+	set->parallelFilteredSet = parallelFilteredSet;
+	set->parallelMappedSet = parallelMappedSet;
+	set->parallelReduce = parallelReduce;
 	set->reduce = reduce;
 	set->setWithArray = setWithArray;
 	set->setWithObjects = setWithObjects;
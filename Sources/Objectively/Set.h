@@ -24,6 +24,7 @@
 #pragma once
 
 #include <Objectively/Array.h>
+#include <Objectively/FastEnumeration.h>
 #include <Objectively/Object.h>
 
 /**
@@ -83,6 +84,7 @@ struct Set {
 	ident *elements;
 };
 
+typedef struct FrozenSet FrozenSet;
 typedef struct MutableSet MutableSet;
 
 /**
@@ -112,6 +114,17 @@ struct SetInterface {
 	 */
 	_Bool (*containsObject)(const Set *self, const ident obj);
 
+	/**
+	 * @fn size_t Set::countByEnumerating(const Set *self, FastEnumerationState *state)
+	 * @brief Fetches the next batch of elements for fast enumeration.
+	 * @param self The Set.
+	 * @param state The FastEnumerationState.
+	 * @return The number of elements available at `state->items`, or `0` when enumeration is complete.
+	 * @see foreach
+	 * @memberof Set
+	 */
+	size_t (*countByEnumerating)(const Set *self, FastEnumerationState *state);
+
 	/**
 	 * @fn void Set::enumerateObjects(const Set *self, SetEnumerator enumerator, ident data)
 	 * @brief Enumerate the elements of this Set with the given function.
@@ -134,6 +147,15 @@ struct SetInterface {
 	 */
 	Set *(*filteredSet)(const Set *self, Predicate predicate, ident data);
 
+	/**
+	 * @fn FrozenSet *Set::freeze(const Set *self)
+	 * @brief Creates a read-only FrozenSet with the elements of this Set.
+	 * @param self The Set.
+	 * @return The FrozenSet.
+	 * @memberof Set
+	 */
+	FrozenSet *(*freeze)(const Set *self);
+
 	/**
 	 * @fn Set *Set::initWithArray(Set *self, const Array *array)
 	 * @brief Initializes this Set to contain the Objects in `array`.
@@ -182,6 +204,44 @@ struct SetInterface {
 	 */
 	MutableSet *(*mutableCopy)(const Set *self);
 
+	/**
+	 * @fn Set *Set::parallelFilteredSet(const Set *self, Predicate predicate, ident data)
+	 * @brief Creates a new Set with elements that pass `predicate`, evaluated in parallel.
+	 * @param self The Set.
+	 * @param predicate The predicate function, which must be safe to call from multiple threads.
+	 * @param data User data.
+	 * @return The new, filtered Set.
+	 * @see ParallelFor(size_t, ParallelFunction, ident)
+	 * @memberof Set
+	 */
+	Set *(*parallelFilteredSet)(const Set *self, Predicate predicate, ident data);
+
+	/**
+	 * @fn Set *Set::parallelMappedSet(const Set *self, Functor functor, ident data)
+	 * @brief Transforms the elements in this Set by `functor`, evaluated in parallel.
+	 * @param self The Set.
+	 * @param functor The Functor, which must be safe to call from multiple threads.
+	 * @param data User data.
+	 * @return A Set containing the transformed elements of this Set.
+	 * @see ParallelFor(size_t, ParallelFunction, ident)
+	 * @memberof Set
+	 */
+	Set *(*parallelMappedSet)(const Set *self, Functor functor, ident data);
+
+	/**
+	 * @fn ident Set::parallelReduce(const Set *self, Reducer reducer, Reducer combiner, ident accumulator, ident data)
+	 * @brief Reduces this Set in parallel chunks, and then combines the partial results.
+	 * @param self The Set.
+	 * @param reducer The Reducer, which must be safe to call from multiple threads.
+	 * @param combiner The associative Reducer that folds each partial result into the accumulator.
+	 * @param accumulator The initial accumulator value for each chunk, which must be an identity.
+	 * @param data User data.
+	 * @return The reduction result.
+	 * @see Array::parallelReduce(const Array *, Reducer, Reducer, ident, ident)
+	 * @memberof Set
+	 */
+	ident (*parallelReduce)(const Set *self, Reducer reducer, Reducer combiner, ident accumulator, ident data);
+
 	/**
 	 * @fn ident Set::reduce(const Set *self, Reducer reducer, ident accumulator, ident data)
 	 * @param self The Set.
@@ -22,6 +22,7 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 #include <iconv.h>
 #include <locale.h>
 #include <stdarg.h>
@@ -30,15 +31,18 @@
 #include <string.h>
 #include <wchar.h>
 
+#include <pthread.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <Objectively/Hash.h>
 #include <Objectively/MutableArray.h>
 #include <Objectively/MutableString.h>
+#include <Objectively/Once.h>
 #include <Objectively/String.h>
-
-#if defined(__MINGW32__)
-#define towlower_l _towlower_l
-#define towupper_l _towupper_l
-#endif
+#include <Objectively/StringSearcher.h>
 
 #define _Class _String
 
@@ -50,7 +54,12 @@
 static Object *copy(const Object *self) {
 
 	String *this = (String *) self;
-	String *that = $$(String, stringWithCharacters, this->chars);
+
+	if (classof(this) == _String()) {
+		return (Object *) retain((ident) this);
+	}
+
+	String *that = $$(String, stringWithBytes, (uint8_t *) this->chars, this->length, STRING_ENCODING_UTF8);
 
 	return (Object *) that;
 }
@@ -62,7 +71,11 @@ static void dealloc(Object *self) {
 
 	String *this = (String *) self;
 
-	free(this->chars);
+	if (this->parent) {
+		release(this->parent);
+	} else if (this->chars != this->inlineChars) {
+		free(this->chars);
+	}
 
 	super(Object, self, dealloc);
 }
@@ -72,6 +85,12 @@ static void dealloc(Object *self) {
  */
 static String *description(const Object *self) {
 
+	const String *this = (String *) self;
+
+	if (this->parent) {
+		return $(this, compact);
+	}
+
 	return (String *) $(self, copy);
 }
 
@@ -82,7 +101,8 @@ static int hash(const Object *self) {
 
 	String *this = (String *) self;
 
-	return HashForCString(HASH_SEED, this->chars);
+	const Range range = { 0, this->length };
+	return HashForCharacters(HASH_SEED, this->chars, range);
 }
 
 /**
@@ -112,82 +132,640 @@ static _Bool isEqual(const Object *self, const Object *other) {
 #pragma mark - String
 
 /**
- * @brief Character transcoding context for `iconv`.
- * @see iconv(3)
+ * @brief The number of StringEncodings, for tables indexed by encoding.
  */
-typedef struct {
-	StringEncoding to;
-	StringEncoding from;
-	char *in;
-	size_t length;
-	char *out;
-	size_t size;
-} Transcode;
+#define STRING_ENCODING_COUNT (STRING_ENCODING_WCHAR + 1)
 
 /**
- * @brief Transcodes input from one character encoding to another via `iconv`.
- * @param trans A Transcode struct.
- * @return The number of bytes written to `trans->out`.
+ * @brief The Unicode byte order mark.
  */
-static size_t transcode(Transcode *trans) {
+#define BYTE_ORDER_MARK 0xfeff
+
+static Once _iconvOnce;
+static pthread_key_t _iconvKey;
+
+/**
+ * @brief Closes the `iconv` descriptors cached by an exiting thread.
+ */
+static void closeDescriptors(ident data) {
+
+	iconv_t *descriptors = data;
+
+	for (size_t i = 0; i < STRING_ENCODING_COUNT * STRING_ENCODING_COUNT; i++) {
+		if (descriptors[i]) {
+			iconv_close(descriptors[i]);
+		}
+	}
+
+	free(descriptors);
+}
+
+/**
+ * @return The calling thread's `iconv` descriptor for the given encodings, or `(iconv_t) -1` if
+ * the conversion is not supported.
+ */
+static iconv_t descriptor(StringEncoding to, StringEncoding from) {
+
+	do_once(&_iconvOnce, {
+		const int err = pthread_key_create(&_iconvKey, closeDescriptors);
+		assert(err == 0);
+	});
 
-	assert(trans);
-	assert(trans->to);
-	assert(trans->from);
-	assert(trans->out);
-	assert(trans->size);
+	iconv_t *descriptors = pthread_getspecific(_iconvKey);
+	if (descriptors == NULL) {
 
-	iconv_t cd = iconv_open(NameForStringEncoding(trans->to), NameForStringEncoding(trans->from));
-	assert(cd != (iconv_t ) -1);
+		descriptors = calloc(STRING_ENCODING_COUNT * STRING_ENCODING_COUNT, sizeof(iconv_t));
+		assert(descriptors);
 
-	char *in = trans->in;
-	char *out = trans->out;
+		const int err = pthread_setspecific(_iconvKey, descriptors);
+		assert(err == 0);
+	}
 
-	size_t inBytesRemaining = trans->length;
-	size_t outBytesRemaining = trans->size;
+	iconv_t *cd = &descriptors[to * STRING_ENCODING_COUNT + from];
+	if (*cd == NULL) {
 
-	const size_t ret = iconv(cd, &in, &inBytesRemaining, &out, &outBytesRemaining);
-	assert(ret != (size_t ) -1);
+		const iconv_t opened = iconv_open(NameForStringEncoding(to), NameForStringEncoding(from));
+		if (opened == (iconv_t) -1) {
+			return opened;
+		}
 
-	int err = iconv_close(cd);
-	assert(err == 0);
+		*cd = opened;
+	}
 
-	return trans->size - outBytesRemaining;
+	return *cd;
 }
 
 /**
- * @fn Order String::compareTo(const String *self, const String *other, const Range range)
- * @memberof String
+ * @brief Transcodes `length` bytes of `in` from one character encoding to another via `iconv`.
+ * @param out The output buffer, allocated by this function and null-terminated.
+ * @return The number of bytes written to `out`, which is empty if `in` can not be transcoded, or
+ * if the conversion is not supported.
  */
-static Order compareTo(const String *self, const String *other, const Range range) {
+static size_t transcodeWithIconv(StringEncoding to, StringEncoding from, const uint8_t *in, size_t length, char **out) {
 
-	assert(range.location + range.length <= self->length);
+	iconv_t cd = descriptor(to, from);
 
-	if (other) {
-		const int i = strncmp(self->chars + range.location, other->chars, range.length);
-		if (i == 0) {
-			return OrderSame;
+	size_t size = length + 16;
+
+	*out = malloc(size);
+	assert(*out);
+
+	if (cd == (iconv_t) -1) {
+		**out = '\0';
+		return 0;
+	}
+
+	iconv(cd, NULL, NULL, NULL, NULL);
+
+	char *input = (char *) in;
+	char *output = *out;
+
+	size_t inBytesRemaining = length;
+	size_t outBytesRemaining = size - 1;
+
+	while (true) {
+
+		size_t res = iconv(cd, &input, &inBytesRemaining, &output, &outBytesRemaining);
+		if (res != (size_t) -1) {
+			res = iconv(cd, NULL, NULL, &output, &outBytesRemaining);
+			if (res != (size_t) -1) {
+				break;
+			}
 		}
-		if (i > 0) {
-			return OrderDescending;
+
+		if (errno != E2BIG) {
+			output = *out;
+			break;
+		}
+
+		const size_t written = output - *out;
+
+		size *= 2;
+
+		*out = realloc(*out, size);
+		assert(*out);
+
+		output = *out + written;
+		outBytesRemaining = size - written - 1;
+	}
+
+	*output = '\0';
+	return output - *out;
+}
+
+/**
+ * @return True if `encoding` is transcoded natively, rather than via `iconv`.
+ */
+static _Bool isNativeEncoding(StringEncoding encoding) {
+
+	switch (encoding) {
+		case STRING_ENCODING_ASCII:
+		case STRING_ENCODING_LATIN1:
+		case STRING_ENCODING_UTF16:
+		case STRING_ENCODING_UTF32:
+		case STRING_ENCODING_UTF8:
+		case STRING_ENCODING_WCHAR:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/**
+ * @return True if `encoding` encodes ASCII characters as themselves, one byte each.
+ */
+static _Bool isASCIICompatible(StringEncoding encoding) {
+	return encoding == STRING_ENCODING_ASCII || encoding == STRING_ENCODING_LATIN1 || encoding == STRING_ENCODING_UTF8;
+}
+
+/**
+ * @return The fixed-width encoding of `wchar_t` for the host.
+ */
+static StringEncoding unitEncoding(StringEncoding encoding) {
+
+	if (encoding == STRING_ENCODING_WCHAR) {
+		return sizeof(wchar_t) == 2 ? STRING_ENCODING_UTF16 : STRING_ENCODING_UTF32;
+	}
+
+	return encoding;
+}
+
+/**
+ * @return The length of the leading run of ASCII characters in `bytes`.
+ */
+static size_t asciiLength(const uint8_t *bytes, size_t length) {
+
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	for (; i + 16 <= length; i += 16) {
+		const unsigned mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) (bytes + i)));
+		if (mask) {
+			return i + __builtin_ctz(mask);
+		}
+	}
+#endif
+
+	while (i < length && bytes[i] < 0x80) {
+		i++;
+	}
+
+	return i;
+}
+
+/**
+ * @return True if the host is little-endian.
+ */
+static inline _Bool isLittleEndian(void) {
+	const uint16_t one = 1;
+	return *(const uint8_t *) &one;
+}
+
+static inline uint16_t swap16(uint16_t unit) {
+	return (uint16_t) ((unit << 8) | (unit >> 8));
+}
+
+static inline uint32_t swap32(uint32_t unit) {
+	return (unit << 24) | ((unit << 8) & 0xff0000) | ((unit >> 8) & 0xff00) | (unit >> 24);
+}
+
+/**
+ * @brief Decodes the code point at `*in` in the given encoding, advancing `*in` past it.
+ * @param swap True if UTF-16 and UTF-32 input is in the opposite byte order of the host.
+ * @return The code point, or -1 if the input is not valid.
+ */
+static int32_t readCodepoint(StringEncoding encoding, _Bool swap, const uint8_t **in, const uint8_t *end) {
+
+	const uint8_t *s = *in;
+	int32_t codepoint = -1;
+
+	switch (encoding) {
+		case STRING_ENCODING_ASCII:
+			if (*s < 0x80) {
+				codepoint = *s++;
+			}
+			break;
+
+		case STRING_ENCODING_LATIN1:
+			codepoint = *s++;
+			break;
+
+		case STRING_ENCODING_UTF8: {
+			const uint8_t c = *s++;
+			int32_t minimum;
+			int n;
+
+			if (c < 0x80) {
+				codepoint = c;
+				break;
+			} else if ((c & 0xe0) == 0xc0) {
+				codepoint = c & 0x1f, n = 1, minimum = 0x80;
+			} else if ((c & 0xf0) == 0xe0) {
+				codepoint = c & 0x0f, n = 2, minimum = 0x800;
+			} else if ((c & 0xf8) == 0xf0) {
+				codepoint = c & 0x07, n = 3, minimum = 0x10000;
+			} else {
+				return -1;
+			}
+
+			if (end - s < n) {
+				return -1;
+			}
+
+			while (n--) {
+				if ((*s & 0xc0) != 0x80) {
+					return -1;
+				}
+				codepoint = (codepoint << 6) | (*s++ & 0x3f);
+			}
+
+			if (codepoint < minimum || codepoint > 0x10ffff || (codepoint >= 0xd800 && codepoint < 0xe000)) {
+				return -1;
+			}
+		}
+			break;
+
+		case STRING_ENCODING_UTF16: {
+			uint16_t unit;
+
+			if (end - s < 2) {
+				return -1;
+			}
+
+			memcpy(&unit, s, 2), s += 2;
+			codepoint = swap ? swap16(unit) : unit;
+
+			if (codepoint >= 0xd800 && codepoint < 0xdc00) {
+
+				if (end - s < 2) {
+					return -1;
+				}
+
+				memcpy(&unit, s, 2), s += 2;
+				unit = swap ? swap16(unit) : unit;
+
+				if (unit < 0xdc00 || unit >= 0xe000) {
+					return -1;
+				}
+
+				codepoint = 0x10000 + ((codepoint - 0xd800) << 10) + (unit - 0xdc00);
+			} else if (codepoint >= 0xdc00 && codepoint < 0xe000) {
+				return -1;
+			}
+		}
+			break;
+
+		case STRING_ENCODING_UTF32: {
+			uint32_t unit;
+
+			if (end - s < 4) {
+				return -1;
+			}
+
+			memcpy(&unit, s, 4), s += 4;
+			unit = swap ? swap32(unit) : unit;
+
+			if (unit > 0x10ffff || (unit >= 0xd800 && unit < 0xe000)) {
+				return -1;
+			}
+
+			codepoint = unit;
+		}
+			break;
+
+		default:
+			break;
+	}
+
+	*in = s;
+	return codepoint;
+}
+
+/**
+ * @brief Encodes `codepoint` in the given encoding, in host byte order.
+ * @param out The output buffer, or `NULL` to only measure the encoded code point.
+ * @return The length of the encoded code point in bytes, or -1 if it is not representable.
+ */
+static ssize_t writeCodepoint(StringEncoding encoding, int32_t codepoint, uint8_t *out) {
+
+	switch (encoding) {
+		case STRING_ENCODING_ASCII:
+		case STRING_ENCODING_LATIN1:
+			if (codepoint >= (encoding == STRING_ENCODING_ASCII ? 0x80 : 0x100)) {
+				return -1;
+			}
+			if (out) {
+				*out = (uint8_t) codepoint;
+			}
+			return 1;
+
+		case STRING_ENCODING_UTF8:
+			if (codepoint < 0x80) {
+				if (out) {
+					out[0] = (uint8_t) codepoint;
+				}
+				return 1;
+			} else if (codepoint < 0x800) {
+				if (out) {
+					out[0] = (uint8_t) (0xc0 | (codepoint >> 6));
+					out[1] = (uint8_t) (0x80 | (codepoint & 0x3f));
+				}
+				return 2;
+			} else if (codepoint < 0x10000) {
+				if (out) {
+					out[0] = (uint8_t) (0xe0 | (codepoint >> 12));
+					out[1] = (uint8_t) (0x80 | ((codepoint >> 6) & 0x3f));
+					out[2] = (uint8_t) (0x80 | (codepoint & 0x3f));
+				}
+				return 3;
+			} else {
+				if (out) {
+					out[0] = (uint8_t) (0xf0 | (codepoint >> 18));
+					out[1] = (uint8_t) (0x80 | ((codepoint >> 12) & 0x3f));
+					out[2] = (uint8_t) (0x80 | ((codepoint >> 6) & 0x3f));
+					out[3] = (uint8_t) (0x80 | (codepoint & 0x3f));
+				}
+				return 4;
+			}
+
+		case STRING_ENCODING_UTF16:
+			if (codepoint < 0x10000) {
+				if (out) {
+					const uint16_t unit = (uint16_t) codepoint;
+					memcpy(out, &unit, 2);
+				}
+				return 2;
+			} else {
+				if (out) {
+					const uint16_t units[] = {
+						(uint16_t) (0xd800 + ((codepoint - 0x10000) >> 10)),
+						(uint16_t) (0xdc00 + ((codepoint - 0x10000) & 0x3ff))
+					};
+					memcpy(out, units, 4);
+				}
+				return 4;
+			}
+
+		case STRING_ENCODING_UTF32:
+			if (out) {
+				const uint32_t unit = (uint32_t) codepoint;
+				memcpy(out, &unit, 4);
+			}
+			return 4;
+
+		default:
+			return -1;
+	}
+}
+
+/**
+ * @brief Transcodes `length` bytes of `in` from one natively supported encoding to another.
+ * @param out The output buffer, or `NULL` to only validate and measure the output.
+ * @return The number of bytes written to `out`, or -1 if the input is not valid in `from`, or not
+ * representable in `to`.
+ * @remarks UTF-16 and UTF-32 input is read in the byte order of its byte order mark, or in host byte
+ * order if it has none. UTF-16 and UTF-32 output is written in host byte order, with a byte order mark.
+ * This matches the behavior of GNU `iconv`.
+ */
+static ssize_t transcodeNatively(StringEncoding to, StringEncoding from, const uint8_t *in, size_t length, uint8_t *out) {
+
+	const uint8_t *end = in + length;
+	size_t size = 0;
+
+	_Bool swap = false;
+
+	if (from == STRING_ENCODING_UTF16 && length >= 2) {
+		if (in[0] == 0xff && in[1] == 0xfe) {
+			swap = !isLittleEndian(), in += 2;
+		} else if (in[0] == 0xfe && in[1] == 0xff) {
+			swap = isLittleEndian(), in += 2;
+		}
+	} else if (from == STRING_ENCODING_UTF32 && length >= 4) {
+		if (memcmp(in, "\xff\xfe\0\0", 4) == 0) {
+			swap = !isLittleEndian(), in += 4;
+		} else if (memcmp(in, "\0\0\xfe\xff", 4) == 0) {
+			swap = isLittleEndian(), in += 4;
+		}
+	}
+
+	if ((to == STRING_ENCODING_UTF16 || to == STRING_ENCODING_UTF32) && length) {
+		size += writeCodepoint(to, BYTE_ORDER_MARK, out);
+	}
+
+	from = unitEncoding(from);
+	to = unitEncoding(to);
+
+	const _Bool ascii = isASCIICompatible(from) && isASCIICompatible(to);
+
+	while (in < end) {
+
+		if (ascii) {
+			const size_t n = asciiLength(in, end - in);
+			if (out) {
+				memcpy(out + size, in, n);
+			}
+			size += n;
+			in += n;
+
+			if (in == end) {
+				break;
+			}
+		}
+
+		const int32_t codepoint = readCodepoint(from, swap, &in, end);
+		if (codepoint == -1) {
+			return -1;
+		}
+
+		const ssize_t n = writeCodepoint(to, codepoint, out ? out + size : NULL);
+		if (n == -1) {
+			return -1;
+		}
+
+		size += n;
+	}
+
+	return size;
+}
+
+/**
+ * @brief Transcodes `length` bytes of `in` from one character encoding to another.
+ * @param out The output buffer, allocated to fit by this function and null-terminated.
+ * @return The number of bytes written to `out`.
+ */
+static size_t transcode(StringEncoding to, StringEncoding from, const uint8_t *in, size_t length, char **out) {
+
+	if (isNativeEncoding(to) && isNativeEncoding(from)) {
+
+		ssize_t size = transcodeNatively(to, from, in, length, NULL);
+		if (size == -1) {
+			length = size = 0;
+		}
+
+		*out = malloc(size + 1);
+		assert(*out);
+
+		if (from == to && from != STRING_ENCODING_UTF16 && from != STRING_ENCODING_UTF32) {
+			memcpy(*out, in, size);
+		} else {
+			transcodeNatively(to, from, in, length, (uint8_t *) *out);
+		}
+
+		(*out)[size] = '\0';
+		return size;
+	}
+
+	return transcodeWithIconv(to, from, in, length, out);
+}
+
+/**
+ * @brief Initializes `self` with a copy of `length` bytes of `chars`, stored inline if they fit.
+ */
+static String *initWithCharactersOfLength(String *self, const char *chars, size_t length) {
+
+	self = (String *) super(Object, self, init);
+	if (self) {
+
+		if (length < STRING_INLINE_CAPACITY) {
+			self->chars = self->inlineChars;
+		} else {
+			self->chars = malloc(length + 1);
+			assert(self->chars);
+		}
+
+		memcpy(self->chars, chars, length);
+		self->chars[length] = '\0';
+
+		self->length = length;
+	}
+
+	return self;
+}
+
+/**
+ * @brief Maps the case of the leading run of ASCII characters in `in`.
+ * @param out The output buffer, or `NULL` to only measure the run.
+ * @return The length of the run.
+ */
+static size_t mapASCII(const uint8_t *in, size_t length, uint8_t *out, CaseMapping mapping) {
+
+	const uint8_t first = mapping == CASE_MAPPING_LOWERCASE ? 'A' : 'a';
+
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	const __m128i below = _mm_set1_epi8(first - 1);
+	const __m128i above = _mm_set1_epi8(first + 26);
+	const __m128i bit = _mm_set1_epi8(0x20);
+
+	for (; i + 16 <= length; i += 16) {
+
+		const __m128i chars = _mm_loadu_si128((const __m128i *) (in + i));
+		if (_mm_movemask_epi8(chars)) {
+			break;
+		}
+
+		if (out) {
+			const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(chars, below), _mm_cmplt_epi8(chars, above));
+			_mm_storeu_si128((__m128i *) (out + i), _mm_xor_si128(chars, _mm_and_si128(letters, bit)));
+		}
+	}
+#endif
+
+	for (; i < length && in[i] < 0x80; i++) {
+		if (out) {
+			out[i] = (in[i] >= first && in[i] < first + 26) ? in[i] ^ 0x20 : in[i];
+		}
+	}
+
+	return i;
+}
+
+/**
+ * @brief Decodes the UTF-8 code point at `*in` and maps it to lowercase, advancing `*in` past it.
+ * @return The lowercase code point. Invalid bytes are returned as they are.
+ */
+static int32_t foldCodepoint(const uint8_t **in, const uint8_t *end) {
+
+	const uint8_t c = **in;
+
+	if (c < 0x80) {
+		(*in)++;
+		return c >= 'A' && c <= 'Z' ? c | 0x20 : c;
+	}
+
+	const int32_t codepoint = readCodepoint(STRING_ENCODING_UTF8, false, in, end);
+	if (codepoint == -1) {
+		(*in)++;
+		return c;
+	}
+
+	return towlower(codepoint);
+}
+
+/**
+ * @brief Compares `a` to `b` lexicographically, ignoring case.
+ * @param prefix If `true`, `a` need only begin with `b` to be ordered the same.
+ * @return The ordering of `a` compared to `b`.
+ */
+static Order compareCaseInsensitive(const char *a, size_t aLength, const char *b, size_t bLength, _Bool prefix) {
+
+	const uint8_t *s = (const uint8_t *) a, *sEnd = s + aLength;
+	const uint8_t *t = (const uint8_t *) b, *tEnd = t + bLength;
+
+	while (s < sEnd && t < tEnd) {
+
+		if (*s == *t && *s < 0x80) {
+			s++, t++;
+			continue;
+		}
+
+		const int32_t c = foldCodepoint(&s, sEnd);
+		const int32_t d = foldCodepoint(&t, tEnd);
+
+		if (c != d) {
+			return c < d ? OrderAscending : OrderDescending;
 		}
 	}
 
+	if (t == tEnd) {
+		return (s == sEnd || prefix) ? OrderSame : OrderDescending;
+	}
+
 	return OrderAscending;
 }
 
 /**
- * @fn Array *String::componentsSeparatedByCharacters(const String *self, const char *chars)
- * @memberof String
+ * @return A new String with the contents of `self` mapped to the given case.
  */
-static Array *componentsSeparatedByCharacters(const String *self, const char *chars) {
+static String *stringWithCaseMapping(const String *self, CaseMapping mapping) {
+
+	const size_t length = CaseMapCharacters(self->chars, self->length, NULL, mapping);
 
+	if (length < STRING_INLINE_CAPACITY) {
+		char chars[STRING_INLINE_CAPACITY];
+		CaseMapCharacters(self->chars, self->length, chars, mapping);
+		return initWithCharactersOfLength((String *) alloc(String), chars, length);
+	}
+
+	char *chars = malloc(length + 1);
 	assert(chars);
 
+	CaseMapCharacters(self->chars, self->length, chars, mapping);
+	chars[length] = '\0';
+
+	return $$(String, stringWithMemory, chars, length);
+}
+
+/**
+ * @return The components of `self` that were separated by the pattern of `searcher`.
+ */
+static Array *componentsSeparatedBySearcher(const String *self, const StringSearcher *searcher) {
+
 	MutableArray *components = $(alloc(MutableArray), init);
 
 	Range search = { 0, self->length };
-	Range result = $(self, rangeOfCharacters, chars, search);
+	Range result = $(searcher, rangeInString, self, search);
 
 	while (result.length) {
 		search.length = result.location - search.location;
@@ -199,7 +777,7 @@ static Array *componentsSeparatedByCharacters(const String *self, const char *ch
 		search.location = result.location + result.length;
 		search.length = self->length - search.location;
 
-		result = $(self, rangeOfCharacters, chars, search);
+		result = $(searcher, rangeInString, self, search);
 	}
 
 	String *component = $(self, substring, search);
@@ -209,15 +787,87 @@ static Array *componentsSeparatedByCharacters(const String *self, const char *ch
 	return (Array *) components;
 }
 
+/**
+ * @fn String *String::compact(const String *self)
+ * @memberof String
+ */
+static String *compact(const String *self) {
+
+	if (self->parent == NULL && classof(self) == _String()) {
+		return retain((ident) self);
+	}
+
+	return initWithCharactersOfLength((String *) alloc(String), self->chars, self->length);
+}
+
+/**
+ * @fn Order String::compareTo(const String *self, const String *other, const Range range)
+ * @memberof String
+ */
+static Order compareTo(const String *self, const String *other, const Range range) {
+
+	assert(range.location + range.length <= self->length);
+
+	if (other) {
+		const size_t length = min(range.length, other->length);
+
+		int i = memcmp(self->chars + range.location, other->chars, length);
+		if (i == 0 && length < range.length) {
+			i = 1;
+		}
+
+		if (i == 0) {
+			return OrderSame;
+		}
+		if (i > 0) {
+			return OrderDescending;
+		}
+	}
+
+	return OrderAscending;
+}
+
+/**
+ * @fn Order String::compareToCaseInsensitive(const String *self, const String *other, const Range range)
+ * @memberof String
+ */
+static Order compareToCaseInsensitive(const String *self, const String *other, const Range range) {
+
+	assert(range.location + range.length <= self->length);
+
+	if (other) {
+		return compareCaseInsensitive(self->chars + range.location, range.length, other->chars, other->length, false);
+	}
+
+	return OrderAscending;
+}
+
+/**
+ * @fn Array *String::componentsSeparatedByCharacters(const String *self, const char *chars)
+ * @memberof String
+ */
+static Array *componentsSeparatedByCharacters(const String *self, const char *chars) {
+
+	StringSearcher *searcher = $(alloc(StringSearcher), initWithCharacters, chars);
+
+	Array *components = componentsSeparatedBySearcher(self, searcher);
+
+	release(searcher);
+	return components;
+}
+
 /**
  * @fn Array *String::componentsSeparatedByString(const String *self, const String *string)
  * @memberof String
  */
 static Array *componentsSeparatedByString(const String *self, const String *string) {
 
-	assert(string);
+	StringSearcher *searcher = $(alloc(StringSearcher), initWithString, string);
+
+	Array *components = componentsSeparatedBySearcher(self, searcher);
 
-	return $(self, componentsSeparatedByCharacters, string->chars);
+	release(searcher);
+	return components;
 }
 
 /**
@@ -226,21 +876,10 @@ static Array *componentsSeparatedByString(const String *self, const String *stri
  */
 static Data *getData(const String *self, StringEncoding encoding) {
 
-	Transcode trans = {
-		.to = encoding,
-		.from = STRING_ENCODING_UTF8,
-		.in = self->chars,
-		.length = self->length,
-		.out = calloc(self->length, sizeof(Unicode) / sizeof(char)),
-		.size = self->length * sizeof(Unicode)
-	};
-
-	assert(trans.out);
-
-	const size_t size = transcode(&trans);
-	assert(size <= trans.size);
+	char *out;
+	const size_t size = transcode(encoding, STRING_ENCODING_UTF8, (uint8_t *) self->chars, self->length, &out);
 
-	return $$(Data, dataWithMemory, trans.out, size);
+	return $$(Data, dataWithMemory, out, size);
 }
 
 /**
@@ -257,6 +896,15 @@ static _Bool hasPrefix(const String *self, const String *prefix) {
 	return $(self, compareTo, prefix, range) == OrderSame;
 }
 
+/**
+ * @fn _Bool String::hasPrefixCaseInsensitive(const String *self, const String *prefix)
+ * @memberof String
+ */
+static _Bool hasPrefixCaseInsensitive(const String *self, const String *prefix) {
+
+	return compareCaseInsensitive(self->chars, self->length, prefix->chars, prefix->length, true) == OrderSame;
+}
+
 /**
  * @fn _Bool String::hasSuffix(const String *self, const String *suffix)
  * @memberof String
@@ -279,24 +927,36 @@ static String *initWithBytes(String *self, const uint8_t *bytes, size_t length,
 
 	if (bytes) {
 
-		Transcode trans = {
-			.to = STRING_ENCODING_UTF8,
-			.from = encoding,
-			.in = (char *) bytes,
-			.length = length,
-			.out = calloc(length * sizeof(Unicode) + 1, sizeof(char)),
-			.size = length * sizeof(Unicode) + 1
-		};
+		if (isNativeEncoding(encoding)) {
+
+			const ssize_t size = transcodeNatively(STRING_ENCODING_UTF8, encoding, bytes, length, NULL);
+			if (size == -1) {
+				return initWithCharactersOfLength(self, "", 0);
+			}
+
+			if (encoding == STRING_ENCODING_UTF8 || encoding == STRING_ENCODING_ASCII) {
+				return initWithCharactersOfLength(self, (char *) bytes, length);
+			}
 
-		assert(trans.out);
+			if (size < STRING_INLINE_CAPACITY) {
+				char chars[STRING_INLINE_CAPACITY];
+				transcodeNatively(STRING_ENCODING_UTF8, encoding, bytes, length, (uint8_t *) chars);
+				return initWithCharactersOfLength(self, chars, size);
+			}
 
-		const size_t size = transcode(&trans);
-		assert(size < trans.size);
+			char *chars = malloc(size + 1);
+			assert(chars);
 
-		ident mem = realloc(trans.out, size + 1);
-		assert(mem);
+			transcodeNatively(STRING_ENCODING_UTF8, encoding, bytes, length, (uint8_t *) chars);
+			chars[size] = '\0';
 
-		return $(self, initWithMemory, mem, size);
+			return $(self, initWithMemory, chars, size);
+		}
+
+		char *chars;
+		const size_t size = transcodeWithIconv(STRING_ENCODING_UTF8, encoding, bytes, length, &chars);
+
+		return $(self, initWithMemory, chars, size);
 	}
 
 	return $(self, initWithMemory, NULL, 0);
@@ -309,13 +969,7 @@ static String *initWithBytes(String *self, const uint8_t *bytes, size_t length,
 static String *initWithCharacters(String *self, const char *chars) {
 
 	if (chars) {
-
-		ident mem = strdup(chars);
-		assert(mem);
-
-		size_t length = strlen(chars);
-
-		return $(self, initWithMemory, mem, length);
+		return initWithCharactersOfLength(self, chars, strlen(chars));
 	}
 
 	return $(self, initWithMemory, NULL, 0);
@@ -383,6 +1037,31 @@ static String *initWithMemory(String *self, const ident mem, size_t length) {
 	return self;
 }
 
+/**
+ * @fn String *String::initWithSliceOfData(String *self, const Data *data, const Range range)
+ * @memberof String
+ */
+static String *initWithSliceOfData(String *self, const Data *data, const Range range) {
+
+	assert(data);
+	assert(range.location + range.length <= data->length);
+
+	const char *chars = (const char *) data->bytes + range.location;
+
+	if (range.length < STRING_INLINE_CAPACITY || classof(data) != _Data()) {
+		return initWithCharactersOfLength(self, chars, range.length);
+	}
+
+	self = $(self, initWithMemory, NULL, 0);
+	if (self) {
+		self->parent = retain((ident) data);
+		self->chars = (char *) chars;
+		self->length = range.length;
+	}
+
+	return self;
+}
+
 /**
  * @fn String *String::initWithVaList(String *self, const char *fmt, va_list args)
  * @memberof String
@@ -393,9 +1072,23 @@ static String *initWithVaList(String *self, const char *fmt, va_list args) {
 	if (self) {
 
 		if (fmt) {
-			const int len = vasprintf(&self->chars, fmt, args);
+			va_list copy;
+			va_copy(copy, args);
+
+			const int len = vsnprintf(self->inlineChars, sizeof(self->inlineChars), fmt, copy);
 			assert(len >= 0);
 
+			va_end(copy);
+
+			if (len < STRING_INLINE_CAPACITY) {
+				self->chars = self->inlineChars;
+			} else {
+				self->chars = malloc(len + 1);
+				assert(self->chars);
+
+				vsnprintf(self->chars, len + 1, fmt, args);
+			}
+
 			self->length = len;
 		}
 	}
@@ -404,25 +1097,29 @@ static String *initWithVaList(String *self, const char *fmt, va_list args) {
 }
 
 /**
- * @fn String *String::lowercaseString(const String *self)
+ * @fn _Bool String::isEqualCaseInsensitive(const String *self, const String *other)
  * @memberof String
  */
-static String *lowercaseString(const String *self) {
+static _Bool isEqualCaseInsensitive(const String *self, const String *other) {
 
-	Data *data = $(self, getData, STRING_ENCODING_WCHAR);
-	assert(data);
-
-	const size_t codepoints = data->length / sizeof(Unicode);
-	Unicode *unicode = (Unicode *) data->bytes;
+	if (other) {
+		if (self->length == other->length && memcmp(self->chars, other->chars, self->length) == 0) {
+			return true;
+		}
 
-	for (size_t i = 0; i < codepoints; i++, unicode++) {
-		*unicode = towlower(*unicode);
+		return compareCaseInsensitive(self->chars, self->length, other->chars, other->length, false) == OrderSame;
 	}
 
-	String *lowercase = $$(String, stringWithData, data, STRING_ENCODING_WCHAR);
+	return false;
+}
 
-	release(data);
-	return lowercase;
+/**
+ * @fn String *String::lowercaseString(const String *self)
+ * @memberof String
+ */
+static String *lowercaseString(const String *self) {
+
+	return stringWithCaseMapping(self, CASE_MAPPING_LOWERCASE);
 }
 
 /**
@@ -445,19 +1142,7 @@ static Range rangeOfCharacters(const String *self, const char *chars, const Rang
 	assert(range.length > 0);
 	assert(range.location + range.length <= self->length);
 
-	Range match = { -1, 0 };
-	const size_t len = strlen(chars);
-
-	const char *str = self->chars + range.location;
-	for (size_t i = 0; i < range.length; i++, str++) {
-		if (strncmp(str, chars, len) == 0) {
-			match.location = range.location + i;
-			match.length = len;
-			break;
-		}
-	}
-
-	return match;
+	return StringSearchRange(self, range, chars, strlen(chars));
 }
 
 /**
@@ -466,9 +1151,57 @@ static Range rangeOfCharacters(const String *self, const char *chars, const Rang
  */
 static Range rangeOfString(const String *self, const String *string, const Range range) {
 
+	assert(range.location > -1);
+	assert(range.length > 0);
+	assert(range.location + range.length <= self->length);
+
 	assert(string);
 
-	return $(self, rangeOfCharacters, string->chars, range);
+	return StringSearchRange(self, range, string->chars, string->length);
+}
+
+/**
+ * @fn size_t String::rangesOfCharacters(const String *self, const char *chars, const Range range, Range **ranges)
+ * @memberof String
+ */
+static size_t rangesOfCharacters(const String *self, const char *chars, const Range range, Range **ranges) {
+
+	assert(chars);
+
+	return StringSearchRanges(self, range, chars, strlen(chars), ranges);
+}
+
+/**
+ * @fn size_t String::rangesOfString(const String *self, const String *string, const Range range, Range **ranges)
+ * @memberof String
+ */
+static size_t rangesOfString(const String *self, const String *string, const Range range, Range **ranges) {
+
+	assert(string);
+
+	return StringSearchRanges(self, range, string->chars, string->length, ranges);
+}
+
+/**
+ * @fn String *String::slice(const String *self, const Range range)
+ * @memberof String
+ */
+static String *slice(const String *self, const Range range) {
+
+	assert(range.location + range.length <= self->length);
+
+	if (range.length < STRING_INLINE_CAPACITY || classof(self) != _String()) {
+		return $(self, substring, range);
+	}
+
+	String *slice = $(alloc(String), initWithMemory, NULL, 0);
+	if (slice) {
+		slice->parent = retain(self->parent ?: (Object *) self);
+		slice->chars = self->chars + range.location;
+		slice->length = range.length;
+	}
+
+	return slice;
 }
 
 /**
@@ -540,12 +1273,7 @@ static String *substring(const String *self, const Range range) {
 
 	assert(range.location + range.length <= self->length);
 
-	ident mem = calloc(range.length + 1, sizeof(char));
-	assert(mem);
-
-	strncpy(mem, self->chars + range.location, range.length);
-
-	return $(alloc(String), initWithMemory, mem, range.length);
+	return initWithCharactersOfLength((String *) alloc(String), self->chars + range.location, range.length);
 }
 
 /**
@@ -556,11 +1284,11 @@ static String *trimmedString(const String *self) {
 
 	Range range = { .location = 0, .length = self->length };
 
-	while (isspace(self->chars[range.location])) {
+	while (range.length && isspace(self->chars[range.location])) {
 		range.location++, range.length--;
 	}
 
-	while (isspace(self->chars[range.length])) {
+	while (range.length && isspace(self->chars[range.location + range.length - 1])) {
 		range.length--;
 	}
 
@@ -573,20 +1301,7 @@ static String *trimmedString(const String *self) {
  */
 static String *uppercaseString(const String *self) {
 
-	Data *data = $(self, getData, STRING_ENCODING_WCHAR);
-	assert(data);
-
-	const size_t codepoints = data->length / sizeof(Unicode);
-	Unicode *unicode = (Unicode *) data->bytes;
-
-	for (size_t i = 0; i < codepoints; i++, unicode++) {
-		*unicode = towupper(*unicode);
-	}
-
-	String *uppercase = $$(String, stringWithData, data, STRING_ENCODING_WCHAR);
-
-	release(data);
-	return uppercase;
+	return stringWithCaseMapping(self, CASE_MAPPING_UPPERCASE);
 }
 
 /**
@@ -621,11 +1336,14 @@ static void initialize(Class *clazz) {
 
 	StringInterface *string = (StringInterface *) clazz->def->interface;
 
+	string->compact = compact;
 	string->compareTo = compareTo;
+	string->compareToCaseInsensitive = compareToCaseInsensitive;
 	string->componentsSeparatedByCharacters = componentsSeparatedByCharacters;
 	string->componentsSeparatedByString = componentsSeparatedByString;
 	string->getData = getData;
 	string->hasPrefix = hasPrefix;
+	string->hasPrefixCaseInsensitive = hasPrefixCaseInsensitive;
 	string->hasSuffix = hasSuffix;
 	string->initWithBytes = initWithBytes;
 	string->initWithCharacters = initWithCharacters;
@@ -633,11 +1351,16 @@ static void initialize(Class *clazz) {
 	string->initWithData = initWithData;
 	string->initWithFormat = initWithFormat;
 	string->initWithMemory = initWithMemory;
+	string->initWithSliceOfData = initWithSliceOfData;
 	string->initWithVaList = initWithVaList;
+	string->isEqualCaseInsensitive = isEqualCaseInsensitive;
 	string->lowercaseString = lowercaseString;
 	string->mutableCopy = mutableCopy;
 	string->rangeOfCharacters = rangeOfCharacters;
 	string->rangeOfString = rangeOfString;
+	string->rangesOfCharacters = rangesOfCharacters;
+	string->rangesOfString = rangesOfString;
+	string->slice = slice;
 	string->stringWithBytes = stringWithBytes;
 	string->stringWithCharacters = stringWithCharacters;
 	string->stringWithContentsOfFile = stringWithContentsOfFile;
@@ -721,6 +1444,55 @@ StringEncoding StringEncodingForName(const char *name) {
 	return STRING_ENCODING_ASCII;
 }
 
+size_t CaseMapCharacters(const char *chars, size_t length, char *out, CaseMapping mapping) {
+
+	const uint8_t *in = (const uint8_t *) chars, *end = in + length;
+	uint8_t *output = (uint8_t *) out;
+
+	size_t size = 0;
+
+	while (in < end) {
+
+		const size_t n = mapASCII(in, end - in, output ? output + size : NULL, mapping);
+
+		in += n;
+		size += n;
+
+		if (in == end) {
+			break;
+		}
+
+		if (out == chars) {
+
+			const size_t remaining = end - in;
+			const size_t tail = CaseMapCharacters((const char *) in, remaining, NULL, mapping);
+
+			char *mapped = malloc(tail);
+			assert(mapped);
+
+			CaseMapCharacters((const char *) in, remaining, mapped, mapping);
+			memcpy(output + size, mapped, tail);
+
+			free(mapped);
+			return size + tail;
+		}
+
+		int32_t codepoint = readCodepoint(STRING_ENCODING_UTF8, false, &in, end);
+		if (codepoint == -1) {
+			if (output) {
+				output[size] = *in;
+			}
+			size++, in++;
+			continue;
+		}
+
+		codepoint = mapping == CASE_MAPPING_LOWERCASE ? towlower(codepoint) : towupper(codepoint);
+		size += writeCodepoint(STRING_ENCODING_UTF8, codepoint, output ? output + size : NULL);
+	}
+
+	return size;
+}
+
 String *str(const char *fmt, ...) {
 
 	va_list args;
@@ -54,6 +54,19 @@ typedef enum {
 	STRING_ENCODING_WCHAR,
 } StringEncoding;
 
+/**
+ * @brief Case mappings for CaseMapCharacters.
+ */
+typedef enum {
+	CASE_MAPPING_LOWERCASE,
+	CASE_MAPPING_UPPERCASE,
+} CaseMapping;
+
+/**
+ * @brief The size of the inline buffer of a String, including the null terminator.
+ */
+#define STRING_INLINE_CAPACITY 24
+
 typedef struct StringInterface StringInterface;
 
 /**
@@ -61,6 +74,11 @@ typedef struct StringInterface StringInterface;
  * @remarks Because Strings are encoded using UTF-8, they must not be treated as ASCII C strings.
  * That is, a single Unicode code point will often span multiple `char`s. Be mindful of this when
  * executing Range operations.
+ * @remarks Strings shorter than `STRING_INLINE_CAPACITY` bytes are stored within the instance
+ * itself, with `chars` pointing to that inline storage.
+ * @remarks Slices reference a Range of their parent's characters rather than copying them. Their
+ * `chars` are not null-terminated, so use `length`, or String::compact, when passing them to C
+ * string functions.
  * @extends Object
  * @ingroup ByteStreams
  */
@@ -78,7 +96,8 @@ struct String {
 	StringInterface *interface;
 
 	/**
-	 * @brief The backing null-terminated UTF-8 encoded character array.
+	 * @brief The backing UTF-8 encoded character array.
+	 * @remarks This array is null-terminated, unless this String is a slice.
 	 */
 	char *chars;
 
@@ -86,6 +105,18 @@ struct String {
 	 * @brief The length of the String in bytes.
 	 */
 	size_t length;
+
+	/**
+	 * @brief The String or Data whose characters this slice references, or `NULL`.
+	 * @private
+	 */
+	Object *parent;
+
+	/**
+	 * @brief Inline storage for short Strings, avoiding a separate allocation for `chars`.
+	 * @private
+	 */
+	char inlineChars[STRING_INLINE_CAPACITY];
 };
 
 typedef struct MutableString MutableString;
@@ -100,6 +131,16 @@ struct StringInterface {
 	 */
 	ObjectInterface objectInterface;
 
+	/**
+	 * @fn String *String::compact(const String *self)
+	 * @brief Returns a String with its own null-terminated copy of this String's characters.
+	 * @param self The String.
+	 * @return A String that references no parent, which may be this String.
+	 * @remarks Use this to release the parent of a long-lived slice.
+	 * @memberof String
+	 */
+	String *(*compact)(const String *self);
+
 	/**
 	 * @fn Order String::compareTo(const String *self, const String *other, const Range range)
 	 * @brief Compares this String lexicographically to another.
@@ -111,6 +152,18 @@ struct StringInterface {
 	 */
 	Order (*compareTo)(const String *self, const String *other, const Range range);
 
+	/**
+	 * @fn Order String::compareToCaseInsensitive(const String *self, const String *other, const Range range)
+	 * @brief Compares this String lexicographically to another, ignoring case.
+	 * @param self The String.
+	 * @param other The String to compare to.
+	 * @param range The character Range to compare.
+	 * @return The ordering of this String compared to `other`.
+	 * @remarks This method does not allocate memory.
+	 * @memberof String
+	 */
+	Order (*compareToCaseInsensitive)(const String *self, const String *other, const Range range);
+
 	/**
 	 * @fn Array *String::componentsSeparatedByCharacters(const String *self, const char *chars)
 	 * @brief Returns the components of this String that were separated by `chars`.
@@ -137,6 +190,7 @@ struct StringInterface {
 	 * @param self The String.
 	 * @param encoding The desired StringEncoding.
 	 * @return A Data with this String's contents in the given encoding.
+	 * @remarks UTF-16 and UTF-32 are written in host byte order, with a byte order mark.
 	 * @memberof String
 	 */
 	Data *(*getData)(const String *self, StringEncoding encoding);
@@ -151,6 +205,17 @@ struct StringInterface {
 	 */
 	_Bool (*hasPrefix)(const String *self, const String *prefix);
 
+	/**
+	 * @fn _Bool String::hasPrefixCaseInsensitive(const String *self, const String *prefix)
+	 * @brief Checks this String for the given prefix, ignoring case.
+	 * @param self The String.
+	 * @param prefix The Prefix to check.
+	 * @return true if this String starts with prefix, ignoring case, false otherwise.
+	 * @remarks This method does not allocate memory.
+	 * @memberof String
+	 */
+	_Bool (*hasPrefixCaseInsensitive)(const String *self, const String *prefix);
+
 	/**
 	 * @fn _Bool String::hasSuffix(const String *self, const String *suffix)
 	 * @brief Checks this String for the given suffix.
@@ -169,6 +234,8 @@ struct StringInterface {
 	 * @param length The length of `bytes` to decode.
 	 * @param encoding The character encoding.
 	 * @return The initialized String, or `NULL` on error.
+	 * @remarks UTF-16 and UTF-32 are read in the byte order of their byte order mark, if any, and
+	 * in host byte order otherwise.
 	 * @memberof String
 	 */
 	String *(*initWithBytes)(String *self, const uint8_t *bytes, size_t length, StringEncoding encoding);
@@ -227,6 +294,18 @@ struct StringInterface {
 	 */
 	String *(*initWithMemory)(String *self, const ident mem, size_t length);
 
+	/**
+	 * @fn String *String::initWithSliceOfData(String *self, const Data *data, const Range range)
+	 * @brief Initializes this String as a slice of the UTF-8 encoded bytes of `data`.
+	 * @param self The String.
+	 * @param data The Data, which is retained rather than copied.
+	 * @param range The Range of `data` to reference.
+	 * @return The initialized String, or `NULL` on error.
+	 * @remarks The bytes are not validated. Short slices, and slices of MutableData, are copied.
+	 * @memberof String
+	 */
+	String *(*initWithSliceOfData)(String *self, const Data *data, const Range range);
+
 	/**
 	 * @fn String *String::initWithVaList(String *self, const char *fmt, va_list args)
 	 * @brief Initializes this String with the specified arguments list.
@@ -235,14 +314,26 @@ struct StringInterface {
 	 * @param args The format arguments.
 	 * @return The initialized String, or `NULL` on error.
 	 * @memberof String
-	 * @see vasprintf(3)
+	 * @see vsnprintf(3)
 	 */
 	String *(*initWithVaList)(String *self, const char *fmt, va_list args);
 
+	/**
+	 * @fn _Bool String::isEqualCaseInsensitive(const String *self, const String *other)
+	 * @brief Tests this String for equality with another, ignoring case.
+	 * @param self The String.
+	 * @param other The String to test.
+	 * @return True if the Strings are equal, ignoring case, false otherwise.
+	 * @remarks This method does not allocate memory.
+	 * @memberof String
+	 */
+	_Bool (*isEqualCaseInsensitive)(const String *self, const String *other);
+
 	/**
 	 * @fn String *String::lowercaseString(const String *self)
 	 * @param self The String.
 	 * @return A lowercase representation of this String in the current locale.
+	 * @remarks ASCII letters are mapped without regard to locale.
 	 * @memberof String
 	 */
 	String *(*lowercaseString)(const String *self);
@@ -277,6 +368,46 @@ struct StringInterface {
 	 */
 	Range (*rangeOfString)(const String *self, const String *string, const Range range);
 
+	/**
+	 * @fn size_t String::rangesOfCharacters(const String *self, const char *chars, const Range range, Range **ranges)
+	 * @brief Finds all non-overlapping occurrences of `chars` in this String.
+	 * @param self The String.
+	 * @param chars The characters to search for.
+	 * @param range The Range in which to search.
+	 * @param ranges An optional pointer to return the Range of each occurrence.
+	 * @return The count of occurrences.
+	 * @remarks If provided, `ranges` will be dynamically allocated, or `NULL` if there were no
+	 * occurrences. The caller must free `ranges` when done with it.
+	 * @remarks To search many Strings for the same characters, use a StringSearcher.
+	 * @memberof String
+	 */
+	size_t (*rangesOfCharacters)(const String *self, const char *chars, const Range range, Range **ranges);
+
+	/**
+	 * @fn size_t String::rangesOfString(const String *self, const String *string, const Range range, Range **ranges)
+	 * @brief Finds all non-overlapping occurrences of `string` in this String.
+	 * @param self The String.
+	 * @param string The String to search for.
+	 * @param range The Range in which to search.
+	 * @param ranges An optional pointer to return the Range of each occurrence.
+	 * @return The count of occurrences.
+	 * @remarks If provided, `ranges` will be dynamically allocated, or `NULL` if there were no
+	 * occurrences. The caller must free `ranges` when done with it.
+	 * @memberof String
+	 */
+	size_t (*rangesOfString)(const String *self, const String *string, const Range range, Range **ranges);
+
+	/**
+	 * @fn String *String::slice(const String *self, const Range range)
+	 * @brief Creates a new String referencing a subset of this one, without copying it.
+	 * @param self The String.
+	 * @param range The character Range.
+	 * @return The new String, which retains this String's characters.
+	 * @remarks Short slices, and slices of MutableStrings, are copied, as by String::substring.
+	 * @memberof String
+	 */
+	String *(*slice)(const String *self, const Range range);
+
 	/**
 	 * @static
 	 * @fn String *String::stringWithBytes(const uint8_t *bytes, size_t length, StringEncoding encoding)
@@ -366,6 +497,7 @@ struct StringInterface {
 	 * @fn String *String::uppercaseString(const String *self)
 	 * @param self The String.
 	 * @return An uppercase representation of this String in the current locale.
+	 * @remarks ASCII letters are mapped without regard to locale.
 	 * @memberof String
 	 */
 	String *(*uppercaseString)(const String *self);
@@ -390,6 +522,18 @@ struct StringInterface {
  */
 OBJECTIVELY_EXPORT Class *_String(void);
 
+/**
+ * @brief Maps the case of UTF-8 characters in the current locale, one code point at a time.
+ * @param chars The characters.
+ * @param length The length of `chars`, in bytes.
+ * @param out The output buffer, or `NULL` to only measure the output. The output is not null-terminated.
+ * @param mapping The CaseMapping.
+ * @return The length of the output in bytes, which may differ from `length`.
+ * @remarks `out` may be `chars`, provided that it is large enough to hold the output.
+ * @relates String
+ */
+OBJECTIVELY_EXPORT size_t CaseMapCharacters(const char *chars, size_t length, char *out, CaseMapping mapping);
+
 /**
  * @param encoding A StringEncoding.
  * @return The canonical name for the given encoding.
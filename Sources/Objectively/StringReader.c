@@ -22,13 +22,259 @@
  */
 
 #include <assert.h>
+#include <locale.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <wchar.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <Objectively/StringReader.h>
 
+#if defined(_WIN32)
+typedef _locale_t locale_t;
+#endif
+
+/**
+ * @brief The Unicode replacement character, returned for invalid UTF-8.
+ */
+#define REPLACEMENT_CHARACTER 0xfffd
+
+/**
+ * @brief A charset compiled for membership tests.
+ */
+typedef struct {
+
+	/**
+	 * @brief The bitmap of ASCII members.
+	 */
+	uint64_t ascii[2];
+
+	/**
+	 * @brief The ASCII members, if there are few enough to scan for with SSE2.
+	 */
+	uint8_t bytes[STRING_READER_VECTOR_CHARACTERS];
+
+	/**
+	 * @brief The count of ASCII members.
+	 */
+	size_t numberOfBytes;
+
+	/**
+	 * @brief The charset, which is searched for non-ASCII members.
+	 */
+	const Unicode *charset;
+
+	/**
+	 * @brief True if the charset has non-ASCII members.
+	 */
+	_Bool unicode;
+} Charset;
+
+/**
+ * @brief Compiles `charset` to `set`.
+ */
+static void compileCharset(Charset *set, const Unicode *charset) {
+
+	memset(set, 0, sizeof(*set));
+	set->charset = charset;
+
+	for (const Unicode *c = charset; *c; c++) {
+
+		const uint32_t codepoint = (uint32_t) *c;
+		if (codepoint < 0x80) {
+
+			const uint64_t bit = 1ull << (codepoint & 63);
+			if ((set->ascii[codepoint >> 6] & bit) == 0) {
+				set->ascii[codepoint >> 6] |= bit;
+
+				if (set->numberOfBytes < STRING_READER_VECTOR_CHARACTERS) {
+					set->bytes[set->numberOfBytes] = (uint8_t) codepoint;
+				}
+
+				set->numberOfBytes++;
+			}
+		} else {
+			set->unicode = true;
+		}
+	}
+}
+
+/**
+ * @return True if `c` is a member of `set`.
+ */
+static inline _Bool isMember(const Charset *set, Unicode c) {
+
+	const uint32_t codepoint = (uint32_t) c;
+	if (codepoint < 0x80) {
+		return (set->ascii[codepoint >> 6] >> (codepoint & 63)) & 1;
+	}
+
+	return set->unicode && c != READER_EOF && wcschr(set->charset, c) != NULL;
+}
+
+/**
+ * @return The first ASCII member of `set` in `[s, end)`, or `end`.
+ * @remarks Bytes of multibyte code points are never ASCII, so only ASCII members are found.
+ */
+static const char *scanUntil(const Charset *set, const char *s, const char *end) {
+
+	const size_t count = set->numberOfBytes;
+
+	if (count == 0) {
+		return end;
+	}
+
+	if (count == 1) {
+		const char *c = memchr(s, set->bytes[0], end - s);
+		return c ?: end;
+	}
+
+#if defined(__SSE2__)
+	if (count <= STRING_READER_VECTOR_CHARACTERS) {
+
+		__m128i bytes[STRING_READER_VECTOR_CHARACTERS];
+		for (size_t i = 0; i < count; i++) {
+			bytes[i] = _mm_set1_epi8(set->bytes[i]);
+		}
+
+		for (; end - s >= 16; s += 16) {
+
+			const __m128i chars = _mm_loadu_si128((const __m128i *) s);
+
+			__m128i matches = _mm_cmpeq_epi8(chars, bytes[0]);
+			for (size_t i = 1; i < count; i++) {
+				matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chars, bytes[i]));
+			}
+
+			const unsigned mask = _mm_movemask_epi8(matches);
+			if (mask) {
+				return s + __builtin_ctz(mask);
+			}
+		}
+	}
+#endif
+
+	while (s < end && isMember(set, (uint8_t) *s) == false) {
+		s++;
+	}
+
+	return s;
+}
+
+/**
+ * @return The first non-whitespace character at or after `head`.
+ */
+static const char *skipWhitespace(const StringReader *self) {
+
+	const char *s = self->head, *end = self->chars + self->length;
+
+	while (s < end && (*s == ' ' || (*s >= '\t' && *s <= '\r'))) {
+		s++;
+	}
+
+	return s;
+}
+
+/**
+ * @brief Decodes the UTF-8 code point at `head`, independent of the current locale.
+ * @param length Returns the length of the code point in bytes.
+ * @return The code point, `REPLACEMENT_CHARACTER` for invalid input, or `READER_EOF`.
+ */
+static Unicode decode(const StringReader *self, size_t *length) {
+
+	const uint8_t *s = (const uint8_t *) self->head;
+	const uint8_t *end = (const uint8_t *) self->chars + self->length;
+
+	if (s == end) {
+		*length = 0;
+		return READER_EOF;
+	}
+
+	const uint8_t c = *s;
+	if (c < 0x80) {
+		*length = 1;
+		return c;
+	}
+
+	uint32_t codepoint, minimum;
+	size_t n;
+
+	if ((c & 0xe0) == 0xc0) {
+		codepoint = c & 0x1f, n = 1, minimum = 0x80;
+	} else if ((c & 0xf0) == 0xe0) {
+		codepoint = c & 0x0f, n = 2, minimum = 0x800;
+	} else if ((c & 0xf8) == 0xf0) {
+		codepoint = c & 0x07, n = 3, minimum = 0x10000;
+	} else {
+		goto invalid;
+	}
+
+	if ((size_t) (end - s) <= n) {
+		goto invalid;
+	}
+
+	for (size_t i = 1; i <= n; i++) {
+		if ((s[i] & 0xc0) != 0x80) {
+			goto invalid;
+		}
+		codepoint = (codepoint << 6) | (s[i] & 0x3f);
+	}
+
+	if (codepoint < minimum || codepoint > 0x10ffff || (codepoint >= 0xd800 && codepoint < 0xe000)) {
+		goto invalid;
+	}
+
+	*length = n + 1;
+	return (Unicode) codepoint;
+
+invalid:
+	*length = 1;
+	return REPLACEMENT_CHARACTER;
+}
+
+/**
+ * @return A slice of `length` characters of the input, beginning at `start`.
+ */
+static String *sliceOfInput(const StringReader *self, const char *start, size_t length) {
+
+	const Range range = {
+		.location = start - self->chars,
+		.length = length
+	};
+
+	if (self->string) {
+		return $(self->string, slice, range);
+	}
+
+	return $(alloc(String), initWithSliceOfData, self->locals.data, range);
+}
+
+/**
+ * @return A null-terminated String with the contents of `slice`, which is released.
+ */
+static String *compactSlice(String *slice) {
+
+	if (slice) {
+		String *string = $(slice, compact);
+		release(slice);
+		return string;
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Powers of ten that are exactly representable as doubles.
+ */
+static const double powersOfTen[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
 #define _Class _StringReader
 
 #pragma mark - Object
@@ -40,7 +286,11 @@ static Object *copy(const Object *self) {
 
 	StringReader *this = (StringReader *) self;
 
-	return (Object *) $(alloc(StringReader), initWithString, this->string);
+	if (this->string) {
+		return (Object *) $(alloc(StringReader), initWithString, this->string);
+	}
+
+	return (Object *) $(alloc(StringReader), initWithData, this->locals.data);
 }
 
 /**
@@ -50,6 +300,7 @@ static void dealloc(Object *self) {
 
 	StringReader *this = (StringReader *) self;
 
+	release(this->locals.data);
 	release(this->string);
 
 	super(Object, self, dealloc);
@@ -63,7 +314,7 @@ static void dealloc(Object *self) {
  */
 static StringReader *initWithCharacters(StringReader *self, const char *chars) {
 
-	String *string = str(chars);
+	String *string = $$(String, stringWithCharacters, chars);
 
 	self = $(self, initWithString, string);
 
@@ -72,15 +323,54 @@ static StringReader *initWithCharacters(StringReader *self, const char *chars) {
 	return self;
 }
 
+/**
+ * @fn StringReader *StringReader::initWithContentsOfFile(StringReader *self, const char *path)
+ * @memberof StringReader
+ */
+static StringReader *initWithContentsOfFile(StringReader *self, const char *path) {
+
+	Data *data = $$(Data, dataWithContentsOfFile, path);
+	if (data) {
+		self = $(self, initWithData, data);
+		release(data);
+		return self;
+	}
+
+	release(self);
+	return NULL;
+}
+
+/**
+ * @fn StringReader *StringReader::initWithData(StringReader *self, const Data *data)
+ * @memberof StringReader
+ */
+static StringReader *initWithData(StringReader *self, const Data *data) {
+
+	assert(data);
+
+	self = (StringReader *) super(Object, self, init);
+	if (self) {
+		self->locals.data = retain((ident) data);
+		self->chars = (char *) data->bytes;
+		self->length = data->length;
+		$(self, reset);
+	}
+	return self;
+}
+
 /**
  * @fn StringReader *StringReader::initWithString(StringReader *self, String *string)
  * @memberof StringReader
  */
 static StringReader *initWithString(StringReader *self, String *string) {
 
+	assert(string);
+
 	self = (StringReader *) super(Object, self, init);
 	if (self) {
 		self->string = retain(string);
+		self->chars = string->chars;
+		self->length = string->length;
 		$(self, reset);
 	}
 	return self;
@@ -91,17 +381,15 @@ static StringReader *initWithString(StringReader *self, String *string) {
  * @memberof StringReader
  */
 static Unicode next(StringReader *self, StringReaderMode mode) {
-	Unicode c;
 
-	const int bytes = mbtowc(&c, self->head, sizeof(Unicode));
-	if (bytes > 0) {
-		if (mode == StringReaderRead) {
-			self->head += bytes;
-		}
-		return c;
+	size_t length;
+	const Unicode c = decode(self, &length);
+
+	if (mode == StringReaderRead) {
+		self->head += length;
 	}
 
-	return READER_EOF;
+	return c;
 }
 
 /**
@@ -121,49 +409,302 @@ static Unicode read(StringReader *self) {
 }
 
 /**
- * @fn int StringReader::readToken(StringReader *self, const Unicode *charset, Unicode *stop)
+ * @return The C locale, so that parsing numbers is independent of `LC_NUMERIC`.
+ */
+static locale_t numericLocale(void) {
+	static locale_t locale;
+	static Once once;
+
+	do_once(&once, {
+#if defined(_WIN32)
+		locale = _create_locale(LC_NUMERIC, "C");
+#else
+		locale = newlocale(LC_NUMERIC_MASK, "C", (locale_t) 0);
+#endif
+		assert(locale);
+	});
+
+	return locale;
+}
+
+/**
+ * @fn _Bool StringReader::readDouble(StringReader *self, double *value)
+ * @memberof StringReader
+ */
+static _Bool readDouble(StringReader *self, double *value) {
+
+	assert(value);
+
+	const char *start = skipWhitespace(self), *end = self->chars + self->length;
+	const char *s = start;
+
+	const _Bool negative = s < end && *s == '-';
+	if (s < end && (*s == '-' || *s == '+')) {
+		s++;
+	}
+
+	uint64_t mantissa = 0;
+	int digits = 0, significantDigits = 0, exponent = 0;
+
+	for (; s < end && *s >= '0' && *s <= '9'; s++, digits++) {
+		if (significantDigits < 19) {
+			mantissa = mantissa * 10 + (*s - '0');
+			significantDigits += mantissa > 0;
+		} else {
+			exponent++;
+		}
+	}
+
+	if (s < end && *s == '.') {
+		for (s++; s < end && *s >= '0' && *s <= '9'; s++, digits++) {
+			if (significantDigits < 19) {
+				mantissa = mantissa * 10 + (*s - '0');
+				significantDigits += mantissa > 0;
+				exponent--;
+			}
+		}
+	}
+
+	if (digits == 0) {
+		return false;
+	}
+
+	if (s < end && (*s == 'e' || *s == 'E')) {
+
+		const char *e = s + 1;
+
+		const _Bool negativeExponent = e < end && *e == '-';
+		if (e < end && (*e == '-' || *e == '+')) {
+			e++;
+		}
+
+		if (e < end && *e >= '0' && *e <= '9') {
+
+			int n = 0;
+			for (; e < end && *e >= '0' && *e <= '9'; e++) {
+				if (n < 100000) {
+					n = n * 10 + (*e - '0');
+				}
+			}
+
+			exponent += negativeExponent ? -n : n;
+			s = e;
+		}
+	}
+
+	if (significantDigits <= 15 && exponent >= -22 && exponent <= 22) {
+
+		double d = (double) mantissa;
+		if (exponent < 0) {
+			d /= powersOfTen[-exponent];
+		} else {
+			d *= powersOfTen[exponent];
+		}
+
+		*value = negative ? -d : d;
+	} else {
+
+		char buffer[64];
+
+		const size_t length = s - start;
+		char *chars = length < sizeof(buffer) ? buffer : malloc(length + 1);
+		assert(chars);
+
+		memcpy(chars, start, length);
+		chars[length] = '\0';
+
+#if defined(_WIN32)
+		*value = _strtod_l(chars, NULL, numericLocale());
+#else
+		*value = strtod_l(chars, NULL, numericLocale());
+#endif
+
+		if (chars != buffer) {
+			free(chars);
+		}
+	}
+
+	self->head = (char *) s;
+	return true;
+}
+
+/**
+ * @fn _Bool StringReader::readInteger(StringReader *self, int64_t *value)
+ * @memberof StringReader
+ */
+static _Bool readInteger(StringReader *self, int64_t *value) {
+
+	assert(value);
+
+	const char *s = skipWhitespace(self), *end = self->chars + self->length;
+
+	const _Bool negative = s < end && *s == '-';
+	if (s < end && (*s == '-' || *s == '+')) {
+		s++;
+	}
+
+	const uint64_t limit = negative ? (uint64_t) INT64_MAX + 1 : (uint64_t) INT64_MAX;
+
+	uint64_t magnitude = 0;
+	const char *digits = s;
+
+	for (; s < end && *s >= '0' && *s <= '9'; s++) {
+
+		const uint64_t digit = *s - '0';
+		if (magnitude > (limit - digit) / 10) {
+			return false;
+		}
+
+		magnitude = magnitude * 10 + digit;
+	}
+
+	if (s == digits) {
+		return false;
+	}
+
+	*value = negative ? (int64_t) (0 - magnitude) : (int64_t) magnitude;
+
+	self->head = (char *) s;
+	return true;
+}
+
+/**
+ * @fn String *StringReader::readLine(StringReader *self)
+ * @memberof StringReader
+ */
+static String *readLine(StringReader *self) {
+	return compactSlice($(self, readLineSlice));
+}
+
+/**
+ * @fn String *StringReader::readLineSlice(StringReader *self)
+ * @memberof StringReader
+ */
+static String *readLineSlice(StringReader *self) {
+
+	const char *start = self->head, *end = self->chars + self->length;
+	if (start == end) {
+		return NULL;
+	}
+
+	const char *newline = memchr(start, '\n', end - start);
+
+	size_t length;
+	if (newline) {
+		length = newline - start;
+		if (length && newline[-1] == '\r') {
+			length--;
+		}
+		self->head = (char *) newline + 1;
+	} else {
+		length = end - start;
+		self->head = (char *) end;
+	}
+
+	return sliceOfInput(self, start, length);
+}
+
+/**
+ * @fn String *StringReader::readToken(StringReader *self, const Unicode *charset, Unicode *stop)
  * @memberof StringReader
  */
 static String *readToken(StringReader *self, const Unicode *charset, Unicode *stop) {
+	return compactSlice($(self, readTokenSlice, charset, stop));
+}
+
+/**
+ * @fn String *StringReader::readTokenSlice(StringReader *self, const Unicode *charset, Unicode *stop)
+ * @memberof StringReader
+ */
+static String *readTokenSlice(StringReader *self, const Unicode *charset, Unicode *stop) {
+
+	assert(charset);
+
+	Charset set;
+	compileCharset(&set, charset);
+
+	size_t length;
 
 	while (true) {
-		const Unicode c = $(self, peek);
-		if (c == READER_EOF || wcschr(charset, c) == NULL) {
+		const Unicode c = decode(self, &length);
+		if (c == READER_EOF || isMember(&set, c) == false) {
 			break;
 		}
-		$(self, read);
+		self->head += length;
 	}
 
 	const char *start = self->head;
 
-	while (true) {
-		const Unicode c = $(self, peek);
-		if (c == READER_EOF || wcschr(charset, c)) {
-			if (stop) {
-				*stop = c;
+	if (set.unicode) {
+		while (true) {
+			const Unicode c = decode(self, &length);
+			if (c == READER_EOF || isMember(&set, c)) {
+				break;
 			}
-			break;
+			self->head += length;
 		}
-		$(self, read);
+	} else {
+		self->head = (char *) scanUntil(&set, self->head, self->chars + self->length);
+	}
+
+	if (stop) {
+		*stop = decode(self, &length);
 	}
 
-	if (self->head - start > 0) {
-		const Range range = {
-			.location = start - self->string->chars,
-			.length = self->head - start
-		};
-		return $(self->string, substring, range);
+	if (self->head > start) {
+		return sliceOfInput(self, start, self->head - start);
 	}
 
 	return NULL;
 }
 
+/**
+ * @fn String *StringReader::readUntilCharacters(StringReader *self, const char *chars)
+ * @memberof StringReader
+ */
+static String *readUntilCharacters(StringReader *self, const char *chars) {
+	return compactSlice($(self, readUntilCharactersSlice, chars));
+}
+
+/**
+ * @fn String *StringReader::readUntilCharactersSlice(StringReader *self, const char *chars)
+ * @memberof StringReader
+ */
+static String *readUntilCharactersSlice(StringReader *self, const char *chars) {
+
+	assert(chars);
+
+	const char *start = self->head, *end = self->chars + self->length;
+	if (start == end) {
+		return NULL;
+	}
+
+	const size_t length = strlen(chars);
+
+	if (length) {
+		for (const char *s = start; (s = memchr(s, chars[0], end - s)); s++) {
+
+			if ((size_t) (end - s) < length) {
+				break;
+			}
+
+			if (memcmp(s, chars, length) == 0) {
+				self->head = (char *) s + length;
+				return sliceOfInput(self, start, s - start);
+			}
+		}
+	}
+
+	self->head = (char *) end;
+	return sliceOfInput(self, start, end - start);
+}
+
 /**
  * @fn void StringReader::reset(StringReader *self)
  * @memberof StringReader
  */
 static void reset(StringReader *self) {
-	self->head = self->string->chars;
+	self->head = self->chars;
 }
 
 #pragma mark - Class lifecycle
@@ -177,11 +718,20 @@ static void initialize(Class *clazz) {
 	((ObjectInterface *) clazz->def->interface)->dealloc = dealloc;
 
 	((StringReaderInterface *) clazz->def->interface)->initWithCharacters = initWithCharacters;
+	((StringReaderInterface *) clazz->def->interface)->initWithContentsOfFile = initWithContentsOfFile;
+	((StringReaderInterface *) clazz->def->interface)->initWithData = initWithData;
 	((StringReaderInterface *) clazz->def->interface)->initWithString = initWithString;
 	((StringReaderInterface *) clazz->def->interface)->next = next;
 	((StringReaderInterface *) clazz->def->interface)->peek = peek;
 	((StringReaderInterface *) clazz->def->interface)->read = read;
+	((StringReaderInterface *) clazz->def->interface)->readDouble = readDouble;
+	((StringReaderInterface *) clazz->def->interface)->readInteger = readInteger;
+	((StringReaderInterface *) clazz->def->interface)->readLine = readLine;
+	((StringReaderInterface *) clazz->def->interface)->readLineSlice = readLineSlice;
 	((StringReaderInterface *) clazz->def->interface)->readToken = readToken;
+	((StringReaderInterface *) clazz->def->interface)->readTokenSlice = readTokenSlice;
+	((StringReaderInterface *) clazz->def->interface)->readUntilCharacters = readUntilCharacters;
+	((StringReaderInterface *) clazz->def->interface)->readUntilCharactersSlice = readUntilCharactersSlice;
 	((StringReaderInterface *) clazz->def->interface)->reset = reset;
 }
 
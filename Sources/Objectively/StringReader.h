@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <Objectively/Data.h>
 #include <Objectively/String.h>
 
 /**
@@ -37,11 +38,19 @@ typedef enum {
 
 #define READER_EOF ((Unicode) -1)
 
+/**
+ * @brief The maximum number of ASCII characters in a charset scanned for with SSE2, where available.
+ */
+#define STRING_READER_VECTOR_CHARACTERS 8
+
 typedef struct StringReader StringReader;
 typedef struct StringReaderInterface StringReaderInterface;
 
 /**
  * @brief The StringReader type.
+ * @details StringReaders decode UTF-8 independent of the current locale. They read Strings, Data or
+ * files in place. Methods suffixed with `Slice` return slices of their input, which avoid copying
+ * but are not null-terminated.
  * @extends Object
  */
 struct StringReader {
@@ -57,13 +66,34 @@ struct StringReader {
 	 */
 	StringReaderInterface *interface;
 
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The Data to read, or `NULL`.
+		 */
+		Data *data;
+	} locals;
+
+	/**
+	 * @brief The characters to read, which are not necessarily null-terminated.
+	 */
+	char *chars;
+
 	/**
 	 * @brief The StringReader head.
 	 */
 	char *head;
 
 	/**
-	 * @brief The String to read.
+	 * @brief The length of `chars` in bytes.
+	 */
+	size_t length;
+
+	/**
+	 * @brief The String to read, or `NULL` if reading Data.
 	 */
 	String *string;
 };
@@ -88,6 +118,26 @@ struct StringReaderInterface {
 	 */
 	StringReader *(*initWithCharacters)(StringReader *self, const char *chars);
 
+	/**
+	 * @fn StringReader *StringReader::initWithContentsOfFile(StringReader *self, const char *path)
+	 * @brief Initializes this StringReader with the contents of the file at `path`.
+	 * @param self The StringReader.
+	 * @param path The path of the UTF-8 encoded file to read.
+	 * @return The initialized StringReader, or `NULL` on error.
+	 * @memberof StringReader
+	 */
+	StringReader *(*initWithContentsOfFile)(StringReader *self, const char *path);
+
+	/**
+	 * @fn StringReader *StringReader::initWithData(StringReader *self, const Data *data)
+	 * @brief Initializes this StringReader with the specified Data.
+	 * @param self The StringReader.
+	 * @param data The UTF-8 encoded Data to read.
+	 * @return The initialized StringReader, or `NULL` on error.
+	 * @memberof StringReader
+	 */
+	StringReader *(*initWithData)(StringReader *self, const Data *data);
+
 	/**
 	 * @fn StringReader *StringReader::initWithString(StringReader *self, String *string)
 	 * @brief Initializes this StringReader with the specified String.
@@ -104,6 +154,7 @@ struct StringReaderInterface {
 	 * @param self The StringReader.
 	 * @param mode The StringReaderMode.
 	 * @return The next Unicode code point, or `-1` if the StringReader is exhausted.
+	 * @remarks Invalid UTF-8 is read one byte at a time, as `U+FFFD`.
 	 * @memberof StringReader
 	 */
 	Unicode (*next)(StringReader *self, StringReaderMode mode);
@@ -129,19 +180,97 @@ struct StringReaderInterface {
 	Unicode (*read)(StringReader *self);
 
 	/**
-	 * @fn String *StringReader::readToken(StringReader *self, const Unicode *charset, Unocide *stop)
+	 * @fn _Bool StringReader::readDouble(StringReader *self, double *value)
+	 * @brief Reads a decimal floating point number from this StringReader, skipping leading whitespace.
+	 * @param self The StringReader.
+	 * @param value Returns the number.
+	 * @return True if a number was read, false otherwise, in which case `head` is not advanced.
+	 * @memberof StringReader
+	 */
+	_Bool (*readDouble)(StringReader *self, double *value);
+
+	/**
+	 * @fn _Bool StringReader::readInteger(StringReader *self, int64_t *value)
+	 * @brief Reads a decimal integer from this StringReader, skipping leading whitespace.
+	 * @param self The StringReader.
+	 * @param value Returns the integer.
+	 * @return True if an integer was read, false if there was none, or if it would overflow, in
+	 * which case `head` is not advanced.
+	 * @memberof StringReader
+	 */
+	_Bool (*readInteger)(StringReader *self, int64_t *value);
+
+	/**
+	 * @fn String *StringReader::readLine(StringReader *self)
+	 * @brief Reads the next line from this StringReader.
+	 * @param self The StringReader.
+	 * @return The null-terminated line, without its `\n` or `\r\n` terminator, or `NULL` if the
+	 * StringReader is exhausted.
+	 * @memberof StringReader
+	 */
+	String *(*readLine)(StringReader *self);
+
+	/**
+	 * @fn String *StringReader::readLineSlice(StringReader *self)
+	 * @brief Reads the next line from this StringReader.
+	 * @param self The StringReader.
+	 * @return The line, without its `\n` or `\r\n` terminator, or `NULL` if the StringReader is exhausted.
+	 * @remarks The line is a slice of this StringReader's input, and is not null-terminated.
+	 * @memberof StringReader
+	 */
+	String *(*readLineSlice)(StringReader *self);
+
+	/**
+	 * @fn String *StringReader::readToken(StringReader *self, const Unicode *charset, Unicode *stop)
 	 * @brief Reads characters from this StringReader until a character in `charset` is encountered.
 	 * @param self The StringReader.
 	 * @param charset The array of potential `stop` characters.
 	 * @param stop Optionally returns the stop character from `charset`.
-	 * @return The token accumulated before `stop`, or `NULL` if the StringReader is exhausted.
+	 * @return The null-terminated token accumulated before `stop`, or `NULL` if the StringReader is
+	 * exhausted.
 	 * @memberof StringReader
 	 */
 	String *(*readToken)(StringReader *self, const Unicode *charset, Unicode *stop);
 
+	/**
+	 * @fn String *StringReader::readTokenSlice(StringReader *self, const Unicode *charset, Unicode *stop)
+	 * @brief Reads characters from this StringReader until a character in `charset` is encountered.
+	 * @param self The StringReader.
+	 * @param charset The array of potential `stop` characters.
+	 * @param stop Optionally returns the stop character from `charset`.
+	 * @return The token accumulated before `stop`, or `NULL` if the StringReader is exhausted.
+	 * @remarks The token is a slice of this StringReader's input, and is not null-terminated. Use
+	 * its `length`, or String::compact, before passing its `chars` to C string functions.
+	 * @memberof StringReader
+	 */
+	String *(*readTokenSlice)(StringReader *self, const Unicode *charset, Unicode *stop);
+
+	/**
+	 * @fn String *StringReader::readUntilCharacters(StringReader *self, const char *chars)
+	 * @brief Reads from this StringReader until the sequence `chars` is encountered, and consumes it.
+	 * @param self The StringReader.
+	 * @param chars The null-terminated sequence to read until.
+	 * @return The null-terminated characters before `chars`, or the remaining characters if `chars`
+	 * was not encountered, or `NULL` if the StringReader is exhausted.
+	 * @memberof StringReader
+	 */
+	String *(*readUntilCharacters)(StringReader *self, const char *chars);
+
+	/**
+	 * @fn String *StringReader::readUntilCharactersSlice(StringReader *self, const char *chars)
+	 * @brief Reads from this StringReader until the sequence `chars` is encountered, and consumes it.
+	 * @param self The StringReader.
+	 * @param chars The null-terminated sequence to read until.
+	 * @return The characters before `chars`, or the remaining characters if `chars` was not
+	 * encountered, or `NULL` if the StringReader is exhausted.
+	 * @remarks The characters are a slice of this StringReader's input, and are not null-terminated.
+	 * @memberof StringReader
+	 */
+	String *(*readUntilCharactersSlice)(StringReader *self, const char *chars);
+
 	/**
 	 * @fn void StringReader::reset(StringReader *self)
-	 * @brief Resets this StringReader, placing the `head` before the beginning of the String.
+	 * @brief Resets this StringReader, placing the `head` before the beginning of its input.
 	 * @param self The StringReader.
 	 * @memberof StringReader
 	 */
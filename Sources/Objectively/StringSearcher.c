@@ -0,0 +1,398 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <Objectively/StringSearcher.h>
+
+/**
+ * @brief A pattern to search for, and its optional Horspool shift table.
+ */
+typedef struct {
+	const char *chars;
+	size_t length;
+	const size_t *shift;
+} Pattern;
+
+/**
+ * @brief Computes the Horspool shift table of `length` bytes of `chars`.
+ */
+static void computeShift(const char *chars, size_t length, size_t *shift) {
+
+	for (size_t i = 0; i < 256; i++) {
+		shift[i] = length;
+	}
+
+	for (size_t i = 0; i < length - 1; i++) {
+		shift[(unsigned char) chars[i]] = length - 1 - i;
+	}
+}
+
+/**
+ * @return The offset of the first occurrence of `pattern` in `length` bytes of `chars`, found
+ * by filtering candidates on the first and last bytes of the pattern, or `-1`.
+ */
+static ssize_t filter(const Pattern *pattern, const char *chars, size_t length) {
+
+	const size_t n = pattern->length;
+	const size_t last = length - n;
+
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	const __m128i first = _mm_set1_epi8(pattern->chars[0]);
+	const __m128i final = _mm_set1_epi8(pattern->chars[n - 1]);
+
+	for (; i + 16 <= last + 1; i += 16) {
+
+		const __m128i a = _mm_loadu_si128((const __m128i *) (chars + i));
+		const __m128i b = _mm_loadu_si128((const __m128i *) (chars + i + n - 1));
+
+		unsigned mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, final)));
+		while (mask) {
+
+			const size_t j = i + __builtin_ctz(mask);
+			if (memcmp(chars + j + 1, pattern->chars + 1, n - 2) == 0) {
+				return j;
+			}
+
+			mask &= mask - 1;
+		}
+	}
+#endif
+
+	while (i <= last) {
+
+		const char *c = memchr(chars + i, pattern->chars[0], last - i + 1);
+		if (c == NULL) {
+			break;
+		}
+
+		i = c - chars;
+
+		if (chars[i + n - 1] == pattern->chars[n - 1] && memcmp(chars + i + 1, pattern->chars + 1, n - 2) == 0) {
+			return i;
+		}
+
+		i++;
+	}
+
+	return -1;
+}
+
+/**
+ * @return The offset of the first occurrence of `pattern` in `length` bytes of `chars`, found
+ * with the Boyer-Moore-Horspool algorithm, or `-1`.
+ */
+static ssize_t horspool(const Pattern *pattern, const char *chars, size_t length) {
+
+	const size_t n = pattern->length;
+	const unsigned char final = pattern->chars[n - 1];
+
+	for (size_t i = 0; i <= length - n; ) {
+
+		const unsigned char c = chars[i + n - 1];
+		if (c == final && memcmp(chars + i, pattern->chars, n - 1) == 0) {
+			return i;
+		}
+
+		i += pattern->shift[c];
+	}
+
+	return -1;
+}
+
+/**
+ * @return The offset of the first occurrence of `pattern` in `length` bytes of `chars`, or `-1`.
+ */
+static ssize_t search(const Pattern *pattern, const char *chars, size_t length) {
+
+	if (pattern->length == 0 || pattern->length > length) {
+		return -1;
+	}
+
+	if (pattern->length == 1) {
+		const char *c = memchr(chars, pattern->chars[0], length);
+		return c ? c - chars : -1;
+	}
+
+	if (pattern->shift) {
+		return horspool(pattern, chars, length);
+	}
+
+	return filter(pattern, chars, length);
+}
+
+/**
+ * @return The Range of the first occurrence of `pattern` in `range` of `string`.
+ */
+static Range rangeOfPattern(const Pattern *pattern, const String *string, const Range range) {
+
+	assert(string);
+	assert(range.location > -1);
+	assert(range.location + range.length <= string->length);
+
+	const ssize_t offset = search(pattern, string->chars + range.location, range.length);
+	if (offset == -1) {
+		return (Range) { .location = -1, .length = 0 };
+	}
+
+	return (Range) { .location = range.location + offset, .length = pattern->length };
+}
+
+/**
+ * @return The count of non-overlapping occurrences of `pattern` in `range` of `string`.
+ */
+static size_t rangesOfPattern(const Pattern *pattern, const String *string, const Range range, Range **ranges) {
+
+	assert(string);
+	assert(range.location > -1);
+	assert(range.location + range.length <= string->length);
+
+	Range *matches = NULL;
+	size_t count = 0, capacity = 0;
+
+	const char *chars = string->chars + range.location;
+	size_t i = 0;
+
+	while (true) {
+
+		const ssize_t offset = search(pattern, chars + i, range.length - i);
+		if (offset == -1) {
+			break;
+		}
+
+		if (ranges) {
+			if (count == capacity) {
+				capacity = capacity ? capacity * 2 : 8;
+
+				matches = realloc(matches, capacity * sizeof(Range));
+				assert(matches);
+			}
+
+			matches[count] = (Range) { .location = range.location + i + offset, .length = pattern->length };
+		}
+
+		count++;
+		i += offset + pattern->length;
+	}
+
+	if (ranges) {
+		*ranges = matches;
+	}
+
+	return count;
+}
+
+/**
+ * @return A Pattern for `length` bytes of `chars`, computing its shift table into `shift` if the
+ * pattern is long enough to benefit from it.
+ */
+static Pattern patternWithCharacters(const char *chars, size_t length, size_t *shift) {
+
+	if (length >= STRING_SEARCHER_HORSPOOL_LENGTH) {
+		computeShift(chars, length, shift);
+	} else {
+		shift = NULL;
+	}
+
+	return (Pattern) { .chars = chars, .length = length, .shift = shift };
+}
+
+/**
+ * @return The Pattern of the given StringSearcher.
+ */
+static inline Pattern patternOf(const StringSearcher *self) {
+	return (Pattern) { .chars = self->chars, .length = self->length, .shift = self->locals.shift };
+}
+
+#define _Class _StringSearcher
+
+/**
+ * @brief Initializes `self` with a copy of `length` bytes of `chars`.
+ */
+static StringSearcher *initWithCharactersOfLength(StringSearcher *self, const char *chars, size_t length) {
+
+	self = (StringSearcher *) super(Object, self, init);
+	if (self) {
+
+		self->chars = malloc(length + 1);
+		assert(self->chars);
+
+		memcpy(self->chars, chars, length);
+		self->chars[length] = '\0';
+
+		self->length = length;
+
+		if (length >= STRING_SEARCHER_HORSPOOL_LENGTH) {
+
+			self->locals.shift = malloc(256 * sizeof(size_t));
+			assert(self->locals.shift);
+
+			computeShift(chars, length, self->locals.shift);
+		}
+	}
+
+	return self;
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	const StringSearcher *this = (StringSearcher *) self;
+
+	return (Object *) initWithCharactersOfLength((StringSearcher *) alloc(StringSearcher), this->chars, this->length);
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	StringSearcher *this = (StringSearcher *) self;
+
+	free(this->chars);
+	free(this->locals.shift);
+
+	super(Object, self, dealloc);
+}
+
+#pragma mark - StringSearcher
+
+/**
+ * @fn StringSearcher *StringSearcher::initWithCharacters(StringSearcher *self, const char *chars)
+ * @memberof StringSearcher
+ */
+static StringSearcher *initWithCharacters(StringSearcher *self, const char *chars) {
+
+	assert(chars);
+
+	return initWithCharactersOfLength(self, chars, strlen(chars));
+}
+
+/**
+ * @fn StringSearcher *StringSearcher::initWithString(StringSearcher *self, const String *string)
+ * @memberof StringSearcher
+ */
+static StringSearcher *initWithString(StringSearcher *self, const String *string) {
+
+	assert(string);
+
+	return initWithCharactersOfLength(self, string->chars, string->length);
+}
+
+/**
+ * @fn Range StringSearcher::rangeInString(const StringSearcher *self, const String *string, const Range range)
+ * @memberof StringSearcher
+ */
+static Range rangeInString(const StringSearcher *self, const String *string, const Range range) {
+
+	const Pattern pattern = patternOf(self);
+
+	return rangeOfPattern(&pattern, string, range);
+}
+
+/**
+ * @fn size_t StringSearcher::rangesInString(const StringSearcher *self, const String *string, const Range range, Range **ranges)
+ * @memberof StringSearcher
+ */
+static size_t rangesInString(const StringSearcher *self, const String *string, const Range range, Range **ranges) {
+
+	const Pattern pattern = patternOf(self);
+
+	return rangesOfPattern(&pattern, string, range, ranges);
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+
+	StringSearcherInterface *stringSearcher = (StringSearcherInterface *) clazz->def->interface;
+
+	stringSearcher->initWithCharacters = initWithCharacters;
+	stringSearcher->initWithString = initWithString;
+	stringSearcher->rangeInString = rangeInString;
+	stringSearcher->rangesInString = rangesInString;
+}
+
+/**
+ * @fn Class *StringSearcher::_StringSearcher(void)
+ * @memberof StringSearcher
+ */
+Class *_StringSearcher(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "StringSearcher";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(StringSearcher);
+		clazz.interfaceOffset = offsetof(StringSearcher, interface);
+		clazz.interfaceSize = sizeof(StringSearcherInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
+
+Range StringSearchRange(const String *string, const Range range, const char *chars, size_t length) {
+
+	assert(chars);
+
+	size_t shift[256];
+
+	const Pattern pattern = patternWithCharacters(chars, length, shift);
+
+	return rangeOfPattern(&pattern, string, range);
+}
+
+size_t StringSearchRanges(const String *string, const Range range, const char *chars, size_t length, Range **ranges) {
+
+	assert(chars);
+
+	size_t shift[256];
+
+	const Pattern pattern = patternWithCharacters(chars, length, shift);
+
+	return rangesOfPattern(&pattern, string, range, ranges);
+}
@@ -0,0 +1,171 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Object.h>
+#include <Objectively/String.h>
+
+/**
+ * @file
+ * @brief Precompiled substring searches.
+ */
+
+/**
+ * @brief The minimum length of patterns searched with a Horspool shift table.
+ */
+#define STRING_SEARCHER_HORSPOOL_LENGTH 32
+
+typedef struct StringSearcher StringSearcher;
+typedef struct StringSearcherInterface StringSearcherInterface;
+
+/**
+ * @brief Precompiled substring searches.
+ * @details StringSearchers locate a single pattern in any number of Strings. Short patterns are
+ * located by filtering candidate positions on their first and last bytes, using SSE2 where
+ * available. Patterns of at least `STRING_SEARCHER_HORSPOOL_LENGTH` bytes are located with the
+ * Boyer-Moore-Horspool algorithm, whose shift table is computed once, at initialization.
+ * @extends Object
+ */
+struct StringSearcher {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	StringSearcherInterface *interface;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The Horspool shift table, or `NULL` for short patterns.
+		 */
+		size_t *shift;
+	} locals;
+
+	/**
+	 * @brief The null-terminated pattern.
+	 */
+	char *chars;
+
+	/**
+	 * @brief The length of the pattern in bytes.
+	 */
+	size_t length;
+};
+
+/**
+ * @brief The StringSearcher interface.
+ */
+struct StringSearcherInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn StringSearcher *StringSearcher::initWithCharacters(StringSearcher *self, const char *chars)
+	 * @brief Initializes this StringSearcher with the specified pattern.
+	 * @param self The StringSearcher.
+	 * @param chars The null-terminated pattern.
+	 * @return The initialized StringSearcher, or `NULL` on error.
+	 * @memberof StringSearcher
+	 */
+	StringSearcher *(*initWithCharacters)(StringSearcher *self, const char *chars);
+
+	/**
+	 * @fn StringSearcher *StringSearcher::initWithString(StringSearcher *self, const String *string)
+	 * @brief Initializes this StringSearcher with the specified pattern.
+	 * @param self The StringSearcher.
+	 * @param string The pattern.
+	 * @return The initialized StringSearcher, or `NULL` on error.
+	 * @memberof StringSearcher
+	 */
+	StringSearcher *(*initWithString)(StringSearcher *self, const String *string);
+
+	/**
+	 * @fn Range StringSearcher::rangeInString(const StringSearcher *self, const String *string, const Range range)
+	 * @brief Finds the first occurrence of this StringSearcher's pattern in `string`.
+	 * @param self The StringSearcher.
+	 * @param string The String to search.
+	 * @param range The Range of `string` in which to search.
+	 * @return The Range of the first occurrence, or `{ -1, 0 }` if the pattern was not found.
+	 * @memberof StringSearcher
+	 */
+	Range (*rangeInString)(const StringSearcher *self, const String *string, const Range range);
+
+	/**
+	 * @fn size_t StringSearcher::rangesInString(const StringSearcher *self, const String *string, const Range range, Range **ranges)
+	 * @brief Finds all non-overlapping occurrences of this StringSearcher's pattern in `string`.
+	 * @param self The StringSearcher.
+	 * @param string The String to search.
+	 * @param range The Range of `string` in which to search.
+	 * @param ranges An optional pointer to return the Range of each occurrence.
+	 * @return The count of occurrences.
+	 * @remarks If provided, `ranges` will be dynamically allocated, or `NULL` if there were no
+	 * occurrences. The caller must free `ranges` when done with it.
+	 * @memberof StringSearcher
+	 */
+	size_t (*rangesInString)(const StringSearcher *self, const String *string, const Range range, Range **ranges);
+};
+
+/**
+ * @fn Class *StringSearcher::_StringSearcher(void)
+ * @brief The StringSearcher archetype.
+ * @return The StringSearcher Class.
+ * @memberof StringSearcher
+ */
+OBJECTIVELY_EXPORT Class *_StringSearcher(void);
+
+/**
+ * @brief Finds the first occurrence of `length` bytes of `chars` in `range` of `string`.
+ * @param string The String to search.
+ * @param range The Range of `string` in which to search.
+ * @param chars The pattern.
+ * @param length The length of `chars` in bytes.
+ * @return The Range of the first occurrence, or `{ -1, 0 }` if the pattern was not found.
+ * @remarks Unlike StringSearcher, this function does not allocate, which suits one-shot searches.
+ */
+OBJECTIVELY_EXPORT Range StringSearchRange(const String *string, const Range range, const char *chars, size_t length);
+
+/**
+ * @brief Finds all non-overlapping occurrences of `length` bytes of `chars` in `range` of `string`.
+ * @param string The String to search.
+ * @param range The Range of `string` in which to search.
+ * @param chars The pattern.
+ * @param length The length of `chars` in bytes.
+ * @param ranges An optional pointer to return the Range of each occurrence.
+ * @return The count of occurrences.
+ * @remarks If provided, `ranges` will be dynamically allocated, or `NULL` if there were no
+ * occurrences. The caller must free `ranges` when done with it.
+ */
+OBJECTIVELY_EXPORT size_t StringSearchRanges(const String *string, const Range range, const char *chars, size_t length, Range **ranges);
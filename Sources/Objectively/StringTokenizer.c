@@ -0,0 +1,336 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <Objectively/StringTokenizer.h>
+
+/**
+ * @return The index of the first delimiter at or after `location`, or the length of the input.
+ */
+static size_t scan(const StringTokenizer *self, size_t location) {
+
+	const uint8_t *bytes = (const uint8_t *) self->chars;
+	const size_t count = self->locals.numberOfDelimiters;
+
+	if (count == 0) {
+		return self->length;
+	}
+
+	if (count == 1) {
+		const uint8_t *delimiter = memchr(bytes + location, self->locals.delimiters[0], self->length - location);
+		return delimiter ? (size_t) (delimiter - bytes) : self->length;
+	}
+
+	size_t i = location;
+
+#if defined(__SSE2__)
+	if (count <= STRING_TOKENIZER_VECTOR_DELIMITERS) {
+
+		__m128i delimiters[STRING_TOKENIZER_VECTOR_DELIMITERS];
+		for (size_t j = 0; j < count; j++) {
+			delimiters[j] = _mm_set1_epi8(self->locals.delimiters[j]);
+		}
+
+		for (; i + 16 <= self->length; i += 16) {
+
+			const __m128i chars = _mm_loadu_si128((const __m128i *) (bytes + i));
+
+			__m128i matches = _mm_cmpeq_epi8(chars, delimiters[0]);
+			for (size_t j = 1; j < count; j++) {
+				matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chars, delimiters[j]));
+			}
+
+			const unsigned mask = _mm_movemask_epi8(matches);
+			if (mask) {
+				return i + __builtin_ctz(mask);
+			}
+		}
+	}
+#endif
+
+	while (i < self->length && self->locals.table[bytes[i]] == false) {
+		i++;
+	}
+
+	return i;
+}
+
+/**
+ * @return The index of the first non-delimiter at or after `location`, or the length of the input.
+ */
+static size_t span(const StringTokenizer *self, size_t location) {
+
+	const uint8_t *bytes = (const uint8_t *) self->chars;
+
+	while (location < self->length && self->locals.table[bytes[location]]) {
+		location++;
+	}
+
+	return location;
+}
+
+#define _Class _StringTokenizer
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	StringTokenizer *that = (StringTokenizer *) super(Object, self, copy);
+
+	retain(that->locals.source);
+
+	return (Object *) that;
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	StringTokenizer *this = (StringTokenizer *) self;
+
+	release(this->locals.source);
+
+	super(Object, self, dealloc);
+}
+
+#pragma mark - StringTokenizer
+
+/**
+ * @fn StringTokenizer *StringTokenizer::initWithData(StringTokenizer *self, const Data *data, const char *delimiters)
+ * @memberof StringTokenizer
+ */
+static StringTokenizer *initWithData(StringTokenizer *self, const Data *data, const char *delimiters) {
+
+	assert(data);
+
+	self = (StringTokenizer *) super(Object, self, init);
+	if (self) {
+		self->locals.source = retain((ident) data);
+
+		self->chars = (const char *) data->bytes;
+		self->length = data->length;
+
+		$(self, setDelimiters, delimiters);
+	}
+
+	return self;
+}
+
+/**
+ * @fn StringTokenizer *StringTokenizer::initWithString(StringTokenizer *self, const String *string, const char *delimiters)
+ * @memberof StringTokenizer
+ */
+static StringTokenizer *initWithString(StringTokenizer *self, const String *string, const char *delimiters) {
+
+	assert(string);
+
+	self = (StringTokenizer *) super(Object, self, init);
+	if (self) {
+		self->locals.source = retain((ident) string);
+
+		self->chars = string->chars;
+		self->length = string->length;
+
+		$(self, setDelimiters, delimiters);
+	}
+
+	return self;
+}
+
+/**
+ * @fn _Bool StringTokenizer::nextRange(StringTokenizer *self, Range *range)
+ * @memberof StringTokenizer
+ */
+static _Bool nextRange(StringTokenizer *self, Range *range) {
+
+	assert(range);
+
+	if (self->locals.finished) {
+		return false;
+	}
+
+	size_t location = self->locals.location;
+
+	if (self->options & STRING_TOKENIZER_SKIP_EMPTY) {
+		location = span(self, location);
+		if (location == self->length) {
+			self->locals.finished = true;
+			return false;
+		}
+	}
+
+	size_t end;
+	if (self->maximumSplits && self->locals.splits == self->maximumSplits) {
+		end = self->length;
+	} else {
+		end = scan(self, location);
+	}
+
+	range->location = location;
+	range->length = end - location;
+
+	if (end == self->length) {
+		self->locals.finished = true;
+	} else {
+		self->locals.location = end + 1;
+		self->locals.splits++;
+	}
+
+	return true;
+}
+
+/**
+ * @fn String *StringTokenizer::nextToken(StringTokenizer *self)
+ * @memberof StringTokenizer
+ */
+static String *nextToken(StringTokenizer *self) {
+
+	Range range;
+	if ($(self, nextRange, &range)) {
+
+		if ($((Object *) self->locals.source, isKindOfClass, _String())) {
+
+			String *slice = $((String *) self->locals.source, slice, range);
+			String *token = $(slice, compact);
+
+			release(slice);
+			return token;
+		}
+
+		const uint8_t *bytes = (const uint8_t *) self->chars + range.location;
+		return $$(String, stringWithBytes, bytes, range.length, STRING_ENCODING_UTF8);
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn String *StringTokenizer::nextTokenSlice(StringTokenizer *self)
+ * @memberof StringTokenizer
+ */
+static String *nextTokenSlice(StringTokenizer *self) {
+
+	Range range;
+	if ($(self, nextRange, &range)) {
+
+		if ($((Object *) self->locals.source, isKindOfClass, _String())) {
+			return $((String *) self->locals.source, slice, range);
+		}
+
+		return $(alloc(String), initWithSliceOfData, (Data *) self->locals.source, range);
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn void StringTokenizer::reset(StringTokenizer *self)
+ * @memberof StringTokenizer
+ */
+static void reset(StringTokenizer *self) {
+
+	self->locals.location = 0;
+	self->locals.splits = 0;
+	self->locals.finished = false;
+}
+
+/**
+ * @fn void StringTokenizer::setDelimiters(StringTokenizer *self, const char *delimiters)
+ * @memberof StringTokenizer
+ */
+static void setDelimiters(StringTokenizer *self, const char *delimiters) {
+
+	assert(delimiters);
+
+	memset(self->locals.table, 0, sizeof(self->locals.table));
+	self->locals.numberOfDelimiters = 0;
+
+	for (const uint8_t *d = (const uint8_t *) delimiters; *d; d++) {
+
+		if (self->locals.table[*d] == false) {
+			self->locals.table[*d] = true;
+
+			if (self->locals.numberOfDelimiters < STRING_TOKENIZER_VECTOR_DELIMITERS) {
+				self->locals.delimiters[self->locals.numberOfDelimiters] = *d;
+			}
+
+			self->locals.numberOfDelimiters++;
+		}
+	}
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->def->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+
+	StringTokenizerInterface *stringTokenizer = (StringTokenizerInterface *) clazz->def->interface;
+
+	stringTokenizer->initWithData = initWithData;
+	stringTokenizer->initWithString = initWithString;
+	stringTokenizer->nextRange = nextRange;
+	stringTokenizer->nextToken = nextToken;
+	stringTokenizer->nextTokenSlice = nextTokenSlice;
+	stringTokenizer->reset = reset;
+	stringTokenizer->setDelimiters = setDelimiters;
+}
+
+/**
+ * @fn Class *StringTokenizer::_StringTokenizer(void)
+ * @memberof StringTokenizer
+ */
+Class *_StringTokenizer(void) {
+	static Class clazz;
+	static Once once;
+
+	do_once(&once, {
+		clazz.name = "StringTokenizer";
+		clazz.superclass = _Object();
+		clazz.instanceSize = sizeof(StringTokenizer);
+		clazz.interfaceOffset = offsetof(StringTokenizer, interface);
+		clazz.interfaceSize = sizeof(StringTokenizerInterface);
+		clazz.initialize = initialize;
+	});
+
+	return &clazz;
+}
+
+#undef _Class
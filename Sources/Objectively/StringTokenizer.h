@@ -0,0 +1,227 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Data.h>
+#include <Objectively/Object.h>
+#include <Objectively/String.h>
+
+/**
+ * @file
+ * @brief Streaming tokenization of Strings and Data.
+ */
+
+/**
+ * @brief The maximum number of delimiters scanned for with SSE2, where available.
+ */
+#define STRING_TOKENIZER_VECTOR_DELIMITERS 8
+
+/**
+ * @brief StringTokenizer options.
+ */
+typedef enum {
+	STRING_TOKENIZER_NONE = 0,
+
+	/**
+	 * @brief Skip empty tokens, such that runs of delimiters separate a single pair of tokens.
+	 */
+	STRING_TOKENIZER_SKIP_EMPTY = 0x1,
+} StringTokenizerOptions;
+
+typedef struct StringTokenizer StringTokenizer;
+typedef struct StringTokenizerInterface StringTokenizerInterface;
+
+/**
+ * @brief Streaming tokenization of Strings and Data.
+ * @details StringTokenizers split their input on a set of single-byte delimiters, one token at a
+ * time, without building an Array of components. Tokens are returned as Ranges, as null-terminated
+ * Strings, or as slices of the input, which avoid copying but are not null-terminated. The
+ * delimiters may be changed between tokens. The input must not be mutated while it is being
+ * tokenized.
+ * @extends Object
+ */
+struct StringTokenizer {
+
+	/**
+	 * @brief The superclass.
+	 */
+	Object object;
+
+	/**
+	 * @brief The interface.
+	 * @protected
+	 */
+	StringTokenizerInterface *interface;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The String or Data being tokenized.
+		 */
+		ident source;
+
+		/**
+		 * @brief The delimiters, if there are few enough to scan for with SSE2.
+		 */
+		uint8_t delimiters[STRING_TOKENIZER_VECTOR_DELIMITERS];
+
+		/**
+		 * @brief The count of distinct delimiters.
+		 */
+		size_t numberOfDelimiters;
+
+		/**
+		 * @brief The delimiter table, indexed by byte.
+		 */
+		_Bool table[256];
+
+		/**
+		 * @brief The location of the next token.
+		 */
+		size_t location;
+
+		/**
+		 * @brief The count of splits so far.
+		 */
+		size_t splits;
+
+		/**
+		 * @brief True when all tokens have been returned.
+		 */
+		_Bool finished;
+	} locals;
+
+	/**
+	 * @brief The input.
+	 */
+	const char *chars;
+
+	/**
+	 * @brief The length of the input in bytes.
+	 */
+	size_t length;
+
+	/**
+	 * @brief The maximum number of splits, or `0` for no limit.
+	 * @remarks Once this limit is reached, the remainder of the input is returned as the final token.
+	 */
+	size_t maximumSplits;
+
+	/**
+	 * @brief The StringTokenizerOptions.
+	 */
+	StringTokenizerOptions options;
+};
+
+/**
+ * @brief The StringTokenizer interface.
+ */
+struct StringTokenizerInterface {
+
+	/**
+	 * @brief The superclass interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn StringTokenizer *StringTokenizer::initWithData(StringTokenizer *self, const Data *data, const char *delimiters)
+	 * @brief Initializes this StringTokenizer with the specified Data.
+	 * @param self The StringTokenizer.
+	 * @param data The Data to tokenize.
+	 * @param delimiters The null-terminated set of delimiting bytes.
+	 * @return The initialized StringTokenizer, or `NULL` on error.
+	 * @memberof StringTokenizer
+	 */
+	StringTokenizer *(*initWithData)(StringTokenizer *self, const Data *data, const char *delimiters);
+
+	/**
+	 * @fn StringTokenizer *StringTokenizer::initWithString(StringTokenizer *self, const String *string, const char *delimiters)
+	 * @brief Initializes this StringTokenizer with the specified String.
+	 * @param self The StringTokenizer.
+	 * @param string The String to tokenize.
+	 * @param delimiters The null-terminated set of delimiting bytes.
+	 * @return The initialized StringTokenizer, or `NULL` on error.
+	 * @memberof StringTokenizer
+	 */
+	StringTokenizer *(*initWithString)(StringTokenizer *self, const String *string, const char *delimiters);
+
+	/**
+	 * @fn _Bool StringTokenizer::nextRange(StringTokenizer *self, Range *range)
+	 * @brief Advances this StringTokenizer to its next token.
+	 * @param self The StringTokenizer.
+	 * @param range The Range of the next token in the input.
+	 * @return True if a token was returned, false if the input is exhausted.
+	 * @memberof StringTokenizer
+	 */
+	_Bool (*nextRange)(StringTokenizer *self, Range *range);
+
+	/**
+	 * @fn String *StringTokenizer::nextToken(StringTokenizer *self)
+	 * @brief Advances this StringTokenizer to its next token.
+	 * @param self The StringTokenizer.
+	 * @return The next token, null-terminated, or `NULL` if the input is exhausted.
+	 * @remarks Tokens of Data input are decoded as UTF-8.
+	 * @memberof StringTokenizer
+	 */
+	String *(*nextToken)(StringTokenizer *self);
+
+	/**
+	 * @fn String *StringTokenizer::nextTokenSlice(StringTokenizer *self)
+	 * @brief Advances this StringTokenizer to its next token.
+	 * @param self The StringTokenizer.
+	 * @return The next token, as a slice of the input, or `NULL` if the input is exhausted.
+	 * @remarks Slices are not null-terminated. Use their `length`, or String::compact, before
+	 * passing their `chars` to C string functions. Tokens of Data input are not validated.
+	 * @memberof StringTokenizer
+	 */
+	String *(*nextTokenSlice)(StringTokenizer *self);
+
+	/**
+	 * @fn void StringTokenizer::reset(StringTokenizer *self)
+	 * @brief Resets this StringTokenizer to the beginning of its input.
+	 * @param self The StringTokenizer.
+	 * @memberof StringTokenizer
+	 */
+	void (*reset)(StringTokenizer *self);
+
+	/**
+	 * @fn void StringTokenizer::setDelimiters(StringTokenizer *self, const char *delimiters)
+	 * @brief Sets the delimiters for subsequent tokens.
+	 * @param self The StringTokenizer.
+	 * @param delimiters The null-terminated set of delimiting bytes.
+	 * @memberof StringTokenizer
+	 */
+	void (*setDelimiters)(StringTokenizer *self, const char *delimiters);
+};
+
+/**
+ * @fn Class *StringTokenizer::_StringTokenizer(void)
+ * @brief The StringTokenizer archetype.
+ * @return The StringTokenizer Class.
+ * @memberof StringTokenizer
+ */
+OBJECTIVELY_EXPORT Class *_StringTokenizer(void);
@@ -41,6 +41,22 @@ static ident reducer(const ident obj, ident accumulator, ident data) {
 	return (ident) (intptr_t) accumulator + 1;
 }
 
+static _Bool parallelPredicate(const ident obj, ident data) {
+	return $((Number *) obj, intValue) % 2 == 0;
+}
+
+static ident parallelFunctor(const ident obj, ident data) {
+	return $$(Number, numberWithValue, $((Number *) obj, intValue) * 2);
+}
+
+static ident parallelReducer(const ident obj, ident accumulator, ident data) {
+	return (ident) ((intptr_t) accumulator + $((Number *) obj, intValue));
+}
+
+static ident parallelCombiner(const ident obj, ident accumulator, ident data) {
+	return (ident) ((intptr_t) accumulator + (intptr_t) obj);
+}
+
 START_TEST(array)
 	{
 		Object *one = $(alloc(Object), init);
@@ -94,10 +110,160 @@ START_TEST(array)
 
 	}END_TEST
 
+START_TEST(parallel)
+	{
+		ParallelChunkSize = 64;
+		ParallelThreadCount = 4;
+
+		MutableArray *numbers = $$(MutableArray, arrayWithCapacity, 10000);
+		for (int i = 0; i < 10000; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(numbers, addObject, number);
+			release(number);
+		}
+
+		Array *array = (Array *) numbers;
+
+		Array *mapped = $(array, parallelMappedArray, parallelFunctor, NULL);
+		ck_assert_int_eq(10000, mapped->count);
+		for (int i = 0; i < 10000; i++) {
+			ck_assert_int_eq(i * 2, $((Number *) $(mapped, objectAtIndex, i), intValue));
+		}
+
+		Array *filtered = $(array, parallelFilteredArray, parallelPredicate, NULL);
+		ck_assert_int_eq(5000, filtered->count);
+		for (int i = 0; i < 5000; i++) {
+			ck_assert_int_eq(i * 2, $((Number *) $(filtered, objectAtIndex, i), intValue));
+		}
+
+		const intptr_t sum = (intptr_t) $(array, parallelReduce, parallelReducer, parallelCombiner, (ident) 0, NULL);
+		ck_assert_int_eq(49995000, sum);
+
+		release(filtered);
+		release(mapped);
+		release(array);
+
+		ParallelChunkSize = PARALLEL_DEFAULT_CHUNK_SIZE;
+		ParallelThreadCount = 0;
+
+	}END_TEST
+
+START_TEST(fastEnumeration)
+	{
+		String *a = str("a"), *b = str("b"), *c = str("c");
+
+		Array *array = $$(Array, arrayWithObjects, a, b, c, NULL);
+
+		String *string = (String *) $(alloc(MutableString), init);
+		foreach(String *element, array) {
+			$((MutableString *) string, appendString, element);
+		}
+		ck_assert_str_eq("abc", string->chars);
+
+		int count = 0;
+		foreach(String *element, array) {
+			if (count++ == 1) {
+				break;
+			}
+		}
+		ck_assert_int_eq(2, count);
+
+		count = 0;
+		foreach(String *element, NULL) {
+			count++;
+		}
+		ck_assert_int_eq(0, count);
+
+		release(string);
+		release(array);
+		release(c);
+		release(b);
+		release(a);
+
+	}END_TEST
+
+START_TEST(subarray)
+	{
+		MutableArray *numbers = $(alloc(MutableArray), init);
+
+		for (int i = 0; i < 10; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(numbers, addObject, number);
+			release(number);
+		}
+
+		Array *array = (Array *) $((Object *) numbers, copy);
+
+		Number *three = $(array, objectAtIndex, 3);
+		const int referenceCount = ((Object *) three)->referenceCount;
+
+		Array *subarray = $(array, subarrayWithRange, (Range) { .location = 2, .length = 5 });
+		ck_assert_int_eq(5, subarray->count);
+		ck_assert_ptr_eq(array->elements + 2, subarray->elements);
+		ck_assert_ptr_eq(three, $(subarray, objectAtIndex, 1));
+		ck_assert_int_eq(referenceCount, ((Object *) three)->referenceCount);
+
+		Array *nested = $(subarray, subarrayWithRange, (Range) { .location = 1, .length = 2 });
+		ck_assert_int_eq(2, nested->count);
+		ck_assert_ptr_eq(three, $(nested, firstObject));
+
+		release(subarray);
+
+		MutableArray *mutableCopy = $(nested, mutableCopy);
+		$(mutableCopy, addObject, three);
+		ck_assert_int_eq(3, ((Array *) mutableCopy)->count);
+		release(mutableCopy);
+
+		$(numbers, removeAllObjects);
+		release(array);
+
+		ck_assert_ptr_eq(three, $(nested, firstObject));
+		release(nested);
+
+		for (int i = 0; i < 10; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(numbers, addObject, number);
+			release(number);
+		}
+
+		Array *partitions = $((Array *) numbers, partitionedArray, 3);
+		ck_assert_int_eq(3, partitions->count);
+
+		const size_t lengths[] = { 4, 3, 3 };
+		int expected = 0;
+
+		for (size_t i = 0; i < partitions->count; i++) {
+			const Array *partition = $(partitions, objectAtIndex, i);
+			ck_assert_int_eq(lengths[i], partition->count);
+
+			for (size_t j = 0; j < partition->count; j++) {
+				const Number *number = $(partition, objectAtIndex, j);
+				ck_assert_int_eq(expected++, $(number, intValue));
+			}
+		}
+
+		$(numbers, removeAllObjects);
+
+		const Array *first = $(partitions, firstObject);
+		ck_assert_int_eq(4, first->count);
+
+		release(partitions);
+
+		Array *more = $((Array *) numbers, partitionedArray, 4);
+		ck_assert_int_eq(0, more->count);
+		release(more);
+
+		release(numbers);
+
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("array");
 	tcase_add_test(tcase, array);
+	tcase_add_test(tcase, parallel);
+	tcase_add_test(tcase, fastEnumeration);
+	tcase_add_test(tcase, subarray);
 
 	Suite *suite = suite_create("array");
 	suite_add_tcase(suite, tcase);
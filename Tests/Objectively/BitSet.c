@@ -0,0 +1,84 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+START_TEST(bitSet)
+	{
+		IndexSet *indexSet = $(alloc(IndexSet), initWithIndexesInRange, (Range) { .location = 60, .length = 70 });
+
+		BitSet *bitSet = $(alloc(BitSet), initWithIndexSet, indexSet);
+
+		ck_assert(bitSet != NULL);
+		ck_assert_int_eq(70, $(bitSet, count));
+		ck_assert(!$(bitSet, containsIndex, 59));
+		ck_assert($(bitSet, containsIndex, 60));
+		ck_assert($(bitSet, containsIndex, 129));
+		ck_assert(!$(bitSet, containsIndex, 130));
+		ck_assert(!$(bitSet, containsIndex, 100000));
+
+		ck_assert_int_eq(60, $(bitSet, nextIndex, 0));
+		ck_assert_int_eq(100, $(bitSet, nextIndex, 100));
+		ck_assert_int_eq(-1, $(bitSet, nextIndex, 130));
+
+		ck_assert_int_eq(0, $(bitSet, rank, 60));
+		ck_assert_int_eq(10, $(bitSet, rank, 70));
+		ck_assert_int_eq(70, $(bitSet, rank, 1000));
+
+		ck_assert_int_eq(60, $(bitSet, select, 0));
+		ck_assert_int_eq(129, $(bitSet, select, 69));
+		ck_assert_int_eq(-1, $(bitSet, select, 70));
+
+		IndexSet *converted = $(bitSet, indexSet);
+		ck_assert($((Object *) indexSet, isEqual, (Object *) converted));
+
+		Object *copy = $((Object *) bitSet, copy);
+		ck_assert($((Object *) bitSet, isEqual, copy));
+		ck_assert_int_eq($((Object *) bitSet, hash), $(copy, hash));
+
+		release(copy);
+		release(converted);
+		release(bitSet);
+		release(indexSet);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("bitSet");
+	tcase_add_test(tcase, bitSet);
+
+	Suite *suite = suite_create("bitSet");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,219 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+
+static void evicted(Cache *cache, ident obj, ident key, ident data) {
+
+	ck_assert_int_eq(0, $((Number *) key, compareTo, (Number *) obj));
+
+	ck_assert_ptr_eq(NULL, $(cache, objectForKey, key));
+
+	*(int *) data += $((Number *) key, intValue);
+}
+
+static Number *objectForKey(Cache *cache, int key) {
+
+	Number *number = $$(Number, numberWithValue, key);
+	Number *obj = $(cache, objectForKey, number);
+
+	release(number);
+	return obj;
+}
+
+static void setObjectForKey(Cache *cache, int key, size_t cost) {
+
+	Number *number = $$(Number, numberWithValue, key);
+	$(cache, setObjectForKeyWithCost, number, number, cost);
+
+	release(number);
+}
+
+START_TEST(cache)
+	{
+		Cache *cache = $(alloc(Cache), initWithLimits, 3, 0);
+		ck_assert(cache != NULL);
+		ck_assert_ptr_eq(_Cache(), classof(cache));
+
+		ck_assert_ptr_eq(NULL, $((Object *) cache, copy));
+
+		int sum = 0;
+
+		cache->evictionFunction = evicted;
+		cache->data = &sum;
+
+		setObjectForKey(cache, 1, 0);
+		setObjectForKey(cache, 2, 0);
+		setObjectForKey(cache, 3, 0);
+		ck_assert_int_eq(3, $(cache, count));
+
+		Number *one = objectForKey(cache, 1);
+		ck_assert(one != NULL);
+		ck_assert_int_eq(1, $(one, intValue));
+		ck_assert_int_eq(3, ((Object *) one)->referenceCount);
+		release(one);
+
+		setObjectForKey(cache, 4, 0);
+		ck_assert_int_eq(3, $(cache, count));
+		ck_assert_int_eq(2, sum);
+
+		ck_assert_ptr_eq(NULL, objectForKey(cache, 2));
+
+		setObjectForKey(cache, 3, 0);
+		setObjectForKey(cache, 5, 0);
+		ck_assert_int_eq(3, $(cache, count));
+		ck_assert_int_eq(3, sum);
+
+		Number *three = objectForKey(cache, 3);
+		ck_assert(three != NULL);
+		release(three);
+
+		Number *five = $$(Number, numberWithValue, 5);
+		$(cache, removeObjectForKey, five);
+		ck_assert_int_eq(2, $(cache, count));
+		ck_assert_ptr_eq(NULL, $(cache, objectForKey, five));
+		release(five);
+
+		ck_assert_int_eq(3, sum);
+
+		const CacheStatistics statistics = $(cache, statistics);
+		ck_assert_int_eq(2, statistics.hits);
+		ck_assert_int_eq(4, statistics.misses);
+		ck_assert_int_eq(2, statistics.evictions);
+
+		$(cache, removeAllObjects);
+		ck_assert_int_eq(0, $(cache, count));
+		ck_assert_int_eq(3, sum);
+
+		release(cache);
+
+	}END_TEST
+
+START_TEST(cost)
+	{
+		Cache *cache = $(alloc(Cache), initWithLimits, 0, 10);
+		ck_assert(cache != NULL);
+
+		setObjectForKey(cache, 1, 4);
+		setObjectForKey(cache, 2, 4);
+		ck_assert_int_eq(8, $(cache, totalCost));
+
+		setObjectForKey(cache, 1, 2);
+		ck_assert_int_eq(6, $(cache, totalCost));
+
+		for (int i = 0; i < 1000; i++) {
+			setObjectForKey(cache, i, 1);
+		}
+
+		ck_assert_int_eq(10, $(cache, totalCost));
+		ck_assert_int_eq($(cache, count), $(cache, totalCost));
+
+		ck_assert_ptr_eq(NULL, objectForKey(cache, 0));
+
+		Number *last = objectForKey(cache, 999);
+		ck_assert(last != NULL);
+		release(last);
+
+		setObjectForKey(cache, 999, 1000);
+		ck_assert_ptr_eq(NULL, objectForKey(cache, 999));
+
+		release(cache);
+
+	}END_TEST
+
+#define THREADS 4
+#define ITERATIONS 10000
+
+static ident work(Thread *thread) {
+
+	Cache *cache = thread->data;
+
+	unsigned seed = (unsigned) (intptr_t) thread;
+
+	for (int i = 0; i < ITERATIONS; i++) {
+
+		const int key = rand_r(&seed) % 2000;
+
+		Number *obj = objectForKey(cache, key);
+		if (obj) {
+			ck_assert_int_eq(key, $(obj, intValue));
+			release(obj);
+		} else {
+			setObjectForKey(cache, key, 1);
+		}
+	}
+
+	return NULL;
+}
+
+START_TEST(threads)
+	{
+		Cache *cache = $(alloc(Cache), initWithLimits, 1000, 0);
+		ck_assert(cache != NULL);
+
+		Thread *threads[THREADS];
+
+		for (int i = 0; i < THREADS; i++) {
+			threads[i] = $(alloc(Thread), initWithFunction, work, cache);
+			$(threads[i], start);
+		}
+
+		for (int i = 0; i < THREADS; i++) {
+			$(threads[i], join, NULL);
+			release(threads[i]);
+		}
+
+		ck_assert_int_le($(cache, count), 1000 + CACHE_MAX_SHARDS);
+		ck_assert_int_eq($(cache, count), $(cache, totalCost));
+
+		const CacheStatistics statistics = $(cache, statistics);
+		ck_assert_int_eq(THREADS * ITERATIONS, statistics.hits + statistics.misses);
+		ck_assert(statistics.hits > 0);
+		ck_assert(statistics.evictions > 0);
+
+		release(cache);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("cache");
+	tcase_add_test(tcase, cache);
+	tcase_add_test(tcase, cost);
+	tcase_add_test(tcase, threads);
+
+	Suite *suite = suite_create("cache");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
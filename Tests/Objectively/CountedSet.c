@@ -0,0 +1,96 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+START_TEST(countedSet)
+	{
+		String *one = str("one"), *two = str("two"), *three = str("three");
+
+		CountedSet *set = $(alloc(CountedSet), initWithObjects, one, two, one, three, one, two, NULL);
+
+		ck_assert(set != NULL);
+		ck_assert_int_eq(3, set->count);
+		ck_assert_int_eq(6, set->total);
+		ck_assert_int_eq(3, $(set, countForObject, one));
+		ck_assert_int_eq(2, $(set, countForObject, two));
+		ck_assert_int_eq(1, $(set, countForObject, three));
+		ck_assert($(set, containsObject, three));
+
+		String *four = str("four");
+		ck_assert_int_eq(0, $(set, countForObject, four));
+		release(four);
+
+		ck_assert_ptr_eq(set, $((Object *) set, copy));
+		release(set);
+
+		Array *array = $$(Array, arrayWithObjects, two, one, two, one, three, one, NULL);
+		CountedSet *other = $(alloc(CountedSet), initWithArray, array);
+		ck_assert($((Object *) set, isEqual, (Object *) other));
+		ck_assert_int_eq($((Object *) set, hash), $((Object *) other, hash));
+
+		Array *top = $(set, objectsWithHighestCounts, 2);
+		ck_assert_int_eq(2, top->count);
+		ck_assert_ptr_eq(one, $(top, objectAtIndex, 0));
+		ck_assert_ptr_eq(two, $(top, objectAtIndex, 1));
+
+		Array *all = $(set, objectsWithHighestCounts, 10);
+		ck_assert_int_eq(3, all->count);
+		ck_assert_ptr_eq(three, $(all, objectAtIndex, 2));
+
+		MutableCountedSet *mutableCopy = $(set, mutableCopy);
+		$(mutableCopy, addObject, three);
+		ck_assert_int_eq(2, $((CountedSet *) mutableCopy, countForObject, three));
+		ck_assert_int_eq(1, $(set, countForObject, three));
+
+		release(mutableCopy);
+		release(all);
+		release(top);
+		release(other);
+		release(array);
+		release(set);
+		release(three);
+		release(two);
+		release(one);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("countedSet");
+	tcase_add_test(tcase, countedSet);
+
+	Suite *suite = suite_create("countedSet");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -40,7 +40,7 @@ START_TEST(data)
 		release(data2);
 
 		data2 = (Data *) $((Object * ) data1, copy);
-		ck_assert(data2 != NULL);
+		ck_assert_ptr_eq(data1, data2);
 
 		ck_assert($((Object *) data1, isEqual, (Object *) data2) == true);
 		release(data2);
@@ -0,0 +1,89 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+START_TEST(deque)
+	{
+		Number *one = $$(Number, numberWithValue, 1);
+		Number *two = $$(Number, numberWithValue, 2);
+		Number *three = $$(Number, numberWithValue, 3);
+
+		Deque *deque = $(alloc(Deque), initWithObjects, one, two, three, NULL);
+
+		ck_assert(deque != NULL);
+		ck_assert_int_eq(3, deque->count);
+		ck_assert_ptr_eq(one, $(deque, firstObject));
+		ck_assert_ptr_eq(three, $(deque, lastObject));
+		ck_assert_ptr_eq(two, $(deque, objectAtIndex, 1));
+		ck_assert($(deque, containsObject, two));
+
+		String *description = $((Object *) deque, description);
+		ck_assert_str_eq("[1.00000, 2.00000, 3.00000]", description->chars);
+
+		Array *array = $(deque, allObjects);
+		Deque *other = $(alloc(Deque), initWithArray, array);
+		ck_assert($((Object *) deque, isEqual, (Object *) other));
+		ck_assert_int_eq($((Object *) deque, hash), $((Object *) other, hash));
+
+		int sum = 0;
+		foreach(Number *number, deque) {
+			sum += $(number, intValue);
+		}
+		ck_assert_int_eq(6, sum);
+
+		MutableDeque *mutableDeque = $(deque, mutableCopy);
+		$(mutableDeque, pushFront, three);
+		ck_assert_int_eq(4, ((Deque *) mutableDeque)->count);
+		ck_assert_int_eq(3, deque->count);
+
+		release(mutableDeque);
+		release(other);
+		release(array);
+		release(description);
+		release(deque);
+		release(three);
+		release(two);
+		release(one);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("deque");
+	tcase_add_test(tcase, deque);
+
+	Suite *suite = suite_create("deque");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -83,10 +83,41 @@ START_TEST(dictionary)
 
 	}END_TEST
 
+START_TEST(fastEnumeration)
+	{
+		MutableDictionary *dictionary = $$(MutableDictionary, dictionary);
+		for (int i = 0; i < 100; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(dictionary, setObjectForKey, number, number);
+			release(number);
+		}
+
+		int sum = 0, count = 0;
+		foreach(Number *key, dictionary) {
+			ck_assert($((Dictionary *) dictionary, objectForKey, key) == key);
+			sum += $(key, intValue);
+			count++;
+		}
+		ck_assert_int_eq(100, count);
+		ck_assert_int_eq(4950, sum);
+
+		count = 0;
+		foreach(Number *key, dictionary) {
+			if (++count == 20) {
+				break;
+			}
+		}
+		ck_assert_int_eq(20, count);
+
+		release(dictionary);
+
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("dictionary");
 	tcase_add_test(tcase, dictionary);
+	tcase_add_test(tcase, fastEnumeration);
 
 	Suite *suite = suite_create("dictionary");
 	suite_add_tcase(suite, tcase);
@@ -0,0 +1,82 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+
+START_TEST(doubleArray)
+	{
+		const double values[] = { 1.5, -2.0, 0.25, 4.0, -0.75 };
+
+		DoubleArray *array = $$(DoubleArray, doubleArrayWithValues, values, lengthof(values));
+
+		ck_assert(array != NULL);
+		ck_assert_ptr_eq(_DoubleArray(), classof(array));
+		ck_assert_int_eq(5, array->count);
+
+		ck_assert($(array, sum) == 3.0);
+		ck_assert($(array, mean) == 0.6);
+		ck_assert($(array, minimum) == -2.0);
+		ck_assert($(array, maximum) == 4.0);
+		ck_assert($(array, dot, array) == 2.25 + 4.0 + 0.0625 + 16.0 + 0.5625);
+
+		DoubleArray *prefixSum = $(array, prefixSum);
+		ck_assert(prefixSum->values[4] == 3.0);
+
+		DoubleArray *sorted = $(array, sortedArray);
+		const double ascending[] = { -2.0, -0.75, 0.25, 1.5, 4.0 };
+		for (size_t i = 0; i < lengthof(ascending); i++) {
+			ck_assert(ascending[i] == sorted->values[i]);
+		}
+
+		Array *numbers = $(array, array);
+		DoubleArray *fromNumbers = $(alloc(DoubleArray), initWithArray, numbers);
+		ck_assert($((Object *) array, isEqual, (Object *) fromNumbers));
+
+		release(fromNumbers);
+		release(numbers);
+		release(sorted);
+		release(prefixSum);
+		release(array);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("doubleArray");
+	tcase_add_test(tcase, doubleArray);
+
+	Suite *suite = suite_create("doubleArray");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
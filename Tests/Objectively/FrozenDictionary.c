@@ -0,0 +1,144 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+START_TEST(frozenDictionary)
+	{
+		String *one = str("one"), *two = str("two"), *three = str("three");
+
+		Dictionary *dictionary = $$(Dictionary, dictionaryWithObjectsAndKeys, one, one, two, two, NULL);
+
+		FrozenDictionary *frozen = $(dictionary, freeze);
+		ck_assert(frozen != NULL);
+		ck_assert_ptr_eq(_FrozenDictionary(), classof(frozen));
+		ck_assert_int_eq(2, frozen->count);
+
+		ck_assert_ptr_eq(one, $(frozen, objectForKey, one));
+		ck_assert_ptr_eq(two, $(frozen, objectForKey, two));
+		ck_assert_ptr_eq(NULL, $(frozen, objectForKey, three));
+
+		ck_assert($(frozen, containsKey, one));
+		ck_assert(!$(frozen, containsKey, three));
+
+		ck_assert_ptr_eq(frozen, $((Object *) frozen, copy));
+		release(frozen);
+
+		FrozenDictionary *other = $(alloc(FrozenDictionary), initWithDictionary, dictionary);
+		ck_assert($((Object *) frozen, isEqual, (Object *) other));
+		ck_assert_int_eq($((Object *) frozen, hash), $((Object *) other, hash));
+
+		Array *keys = $(frozen, allKeys);
+		ck_assert_int_eq(2, keys->count);
+		ck_assert($(keys, containsObject, one));
+		ck_assert($(keys, containsObject, two));
+
+		release(keys);
+		release(other);
+		release(frozen);
+		release(dictionary);
+
+		FrozenDictionary *empty = $(alloc(FrozenDictionary), initWithDictionary, NULL);
+		ck_assert_int_eq(0, empty->count);
+		ck_assert_ptr_eq(NULL, $(empty, objectForKey, one));
+
+		release(empty);
+		release(three);
+		release(two);
+		release(one);
+
+	}END_TEST
+
+START_TEST(manyKeys)
+	{
+		const int count = 10000;
+
+		MutableDictionary *dictionary = $(alloc(MutableDictionary), init);
+
+		for (int i = 0; i < count; i++) {
+
+			Number *number = $$(Number, numberWithValue, i);
+			String *string = str("%d", i);
+
+			$(dictionary, setObjectForKey, string, number);
+			$(dictionary, setObjectForKey, number, string);
+
+			release(string);
+			release(number);
+		}
+
+		FrozenDictionary *frozen = $((Dictionary *) dictionary, freeze);
+		ck_assert_int_eq(count * 2, frozen->count);
+
+		for (int i = 0; i < count; i++) {
+
+			Number *number = $$(Number, numberWithValue, i);
+			String *string = str("%d", i);
+
+			const String *obj = $(frozen, objectForKey, number);
+			ck_assert($((Object *) obj, isEqual, (Object *) string));
+
+			const Number *key = $(frozen, objectForKey, string);
+			ck_assert($((Object *) key, isEqual, (Object *) number));
+
+			release(string);
+			release(number);
+		}
+
+		for (int i = count; i < count * 2; i++) {
+
+			Number *number = $$(Number, numberWithValue, i);
+			String *string = str("%d", i);
+
+			ck_assert(!$(frozen, containsKey, number));
+			ck_assert(!$(frozen, containsKey, string));
+
+			release(string);
+			release(number);
+		}
+
+		release(frozen);
+		release(dictionary);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("frozenDictionary");
+	tcase_add_test(tcase, frozenDictionary);
+	tcase_add_test(tcase, manyKeys);
+
+	Suite *suite = suite_create("frozenDictionary");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,90 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+static void enumerator(const FrozenSet *set, ident obj, ident data) {
+	(*(int *) data)++;
+}
+
+START_TEST(frozenSet)
+	{
+		String *one = str("one"), *two = str("two"), *three = str("three");
+
+		Set *set = $$(Set, setWithObjects, one, two, NULL);
+
+		FrozenSet *frozen = $(set, freeze);
+		ck_assert(frozen != NULL);
+		ck_assert_ptr_eq(_FrozenSet(), classof(frozen));
+		ck_assert_int_eq(2, frozen->count);
+
+		ck_assert($(frozen, containsObject, one));
+		ck_assert($(frozen, containsObject, two));
+		ck_assert(!$(frozen, containsObject, three));
+
+		int counter = 0;
+		$(frozen, enumerateObjects, enumerator, &counter);
+		ck_assert_int_eq(2, counter);
+
+		ck_assert_ptr_eq(frozen, $((Object *) frozen, copy));
+		release(frozen);
+
+		Array *array = $$(Array, arrayWithObjects, two, one, two, NULL);
+
+		FrozenSet *other = $(alloc(FrozenSet), initWithArray, array);
+		ck_assert_int_eq(2, other->count);
+		ck_assert($((Object *) frozen, isEqual, (Object *) other));
+
+		Array *objects = $(other, allObjects);
+		ck_assert_int_eq(2, objects->count);
+
+		release(objects);
+		release(other);
+		release(array);
+		release(frozen);
+		release(set);
+		release(three);
+		release(two);
+		release(one);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("frozenSet");
+	tcase_add_test(tcase, frozenSet);
+
+	Suite *suite = suite_create("frozenSet");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -36,6 +36,13 @@ START_TEST(indexSet)
 		ck_assert($(indexSet, containsIndex, 2));
 		ck_assert($(indexSet, containsIndex, 3));
 
+		size_t sorted[4];
+		ck_assert_int_eq(3, $(indexSet, getIndexes, sorted, lengthof(sorted)));
+		ck_assert_int_eq(1, sorted[0]);
+		ck_assert_int_eq(2, sorted[1]);
+		ck_assert_int_eq(3, sorted[2]);
+		ck_assert_int_eq(1, $(indexSet, getIndexes, sorted, 1));
+
 		String *description = $((Object *) indexSet, description);
 		ck_assert_str_eq("[1, 2, 3]", description->chars);
 
@@ -52,10 +59,50 @@ START_TEST(indexSet)
 
 	}END_TEST
 
+START_TEST(operations)
+	{
+		IndexSet *a = $(alloc(IndexSet), initWithIndexesInRange, (Range) { .location = 0, .length = 10 });
+		IndexSet *b = $(alloc(IndexSet), initWithIndexesInRange, (Range) { .location = 5, .length = 10 });
+
+		ck_assert_int_eq(1, a->numberOfRanges);
+		ck_assert_int_eq(10, a->count);
+		ck_assert($(a, containsIndexesInRange, (Range) { .location = 2, .length = 8 }));
+		ck_assert(!$(a, containsIndexesInRange, (Range) { .location = 2, .length = 9 }));
+		ck_assert(!$(a, containsIndex, 10));
+
+		IndexSet *united = $(a, unionWithIndexSet, b);
+		ck_assert_int_eq(1, united->numberOfRanges);
+		ck_assert_int_eq(15, united->count);
+
+		IndexSet *intersection = $(a, intersectionWithIndexSet, b);
+		ck_assert_int_eq(5, intersection->count);
+		ck_assert_int_eq(5, intersection->ranges[0].location);
+
+		IndexSet *difference = $(united, differenceWithIndexSet, intersection);
+		ck_assert_int_eq(2, difference->numberOfRanges);
+		ck_assert_int_eq(10, difference->count);
+		ck_assert(!$(difference, containsIndex, 7));
+		ck_assert($(difference, containsIndex, 14));
+
+		size_t indexes[] = { 9, 3, 4, 5, 1 };
+		IndexSet *sparse = $(alloc(IndexSet), initWithIndexes, indexes, lengthof(indexes));
+		ck_assert_int_eq(3, sparse->numberOfRanges);
+		ck_assert_int_eq(9, indexes[0]);
+
+		release(sparse);
+		release(difference);
+		release(intersection);
+		release(united);
+		release(b);
+		release(a);
+
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("indexSet");
 	tcase_add_test(tcase, indexSet);
+	tcase_add_test(tcase, operations);
 
 	Suite *suite = suite_create("indexSet");
 	suite_add_tcase(suite, tcase);
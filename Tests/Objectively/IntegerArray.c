@@ -0,0 +1,98 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+
+START_TEST(integerArray)
+	{
+		const int64_t values[] = { 3, -1, 4, -1, 5, -9, 2, 6 };
+
+		IntegerArray *array = $$(IntegerArray, integerArrayWithValues, values, lengthof(values));
+
+		ck_assert(array != NULL);
+		ck_assert_ptr_eq(_IntegerArray(), classof(array));
+		ck_assert_int_eq(8, array->count);
+
+		ck_assert_int_eq(9, $(array, sum));
+		ck_assert_int_eq(-9, $(array, minimum));
+		ck_assert_int_eq(6, $(array, maximum));
+		ck_assert($(array, mean) == 9.0 / 8.0);
+		ck_assert_int_eq(4, $(array, valueAtIndex, 2));
+
+		ck_assert_int_eq(9 + 1 + 16 + 1 + 25 + 81 + 4 + 36, $(array, dot, array));
+
+		IntegerArray *prefixSum = $(array, prefixSum);
+		const int64_t sums[] = { 3, 2, 6, 5, 10, 1, 3, 9 };
+		for (size_t i = 0; i < lengthof(sums); i++) {
+			ck_assert_int_eq(sums[i], prefixSum->values[i]);
+		}
+
+		IntegerArray *sorted = $(array, sortedArray);
+		const int64_t ascending[] = { -9, -1, -1, 2, 3, 4, 5, 6 };
+		for (size_t i = 0; i < lengthof(ascending); i++) {
+			ck_assert_int_eq(ascending[i], sorted->values[i]);
+		}
+
+		ck_assert_ptr_eq(array, $((Object *) array, copy));
+		release(array);
+
+		Array *numbers = $(array, array);
+		ck_assert_int_eq(8, numbers->count);
+
+		IntegerArray *fromNumbers = $(alloc(IntegerArray), initWithArray, numbers);
+		ck_assert($((Object *) array, isEqual, (Object *) fromNumbers));
+		ck_assert_int_eq($((Object *) array, hash), $((Object *) fromNumbers, hash));
+		ck_assert(!$((Object *) array, isEqual, (Object *) sorted));
+
+		String *description = $((Object *) sorted, description);
+		ck_assert_str_eq("[-9, -1, -1, 2, 3, 4, 5, 6]", description->chars);
+
+		release(description);
+		release(fromNumbers);
+		release(numbers);
+		release(sorted);
+		release(prefixSum);
+		release(array);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("integerArray");
+	tcase_add_test(tcase, integerArray);
+
+	Suite *suite = suite_create("integerArray");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -117,10 +117,66 @@ START_TEST(mutableArray)
 
 	}END_TEST
 
+START_TEST(copyOnWrite)
+	{
+		String *one = str("one"), *two = str("two"), *three = str("three");
+
+		Array *array = $$(Array, arrayWithObjects, one, two, NULL);
+
+		ck_assert_ptr_eq(array, $((Object *) array, copy));
+		release(array);
+
+		MutableArray *mutableCopy = $(array, mutableCopy);
+		ck_assert_ptr_eq(array->elements, ((Array *) mutableCopy)->elements);
+
+		MutableArray *copy = (MutableArray *) $((Object *) mutableCopy, copy);
+		ck_assert_ptr_eq(array->elements, ((Array *) copy)->elements);
+
+		$(mutableCopy, addObject, three);
+		ck_assert(array->elements != ((Array *) mutableCopy)->elements);
+		ck_assert_int_eq(2, array->count);
+		ck_assert_int_eq(3, ((Array *) mutableCopy)->count);
+		ck_assert_int_eq(2, ((Array *) copy)->count);
+
+		$(copy, setObjectAtIndex, three, 0);
+		ck_assert_ptr_eq(one, $(array, objectAtIndex, 0));
+		ck_assert_ptr_eq(three, $((Array *) copy, objectAtIndex, 0));
+
+		release(array);
+
+		$(copy, removeAllObjects);
+		ck_assert_int_eq(0, ((Array *) copy)->count);
+		ck_assert_ptr_eq(one, $((Array *) mutableCopy, objectAtIndex, 0));
+
+		MutableArray *shared = (MutableArray *) $((Object *) mutableCopy, copy);
+		$(shared, removeAllObjects);
+		ck_assert_int_eq(3, ((Array *) mutableCopy)->count);
+
+		release(shared);
+
+		Array *adopted = $$(Array, arrayWithObjects, one, two, NULL);
+		MutableArray *adopter = $(adopted, mutableCopy);
+		release(adopted);
+
+		for (size_t i = 0; i < 100; i++) {
+			$(adopter, addObject, three);
+		}
+		ck_assert_int_eq(102, ((Array *) adopter)->count);
+
+		release(adopter);
+		release(copy);
+		release(mutableCopy);
+		release(three);
+		release(two);
+		release(one);
+
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("mutableArray");
 	tcase_add_test(tcase, mutableArray);
+	tcase_add_test(tcase, copyOnWrite);
 
 	Suite *suite = suite_create("mutableArray");
 	suite_add_tcase(suite, tcase);
@@ -0,0 +1,98 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+START_TEST(mutableBitSet)
+	{
+		MutableBitSet *evens = $(alloc(MutableBitSet), init);
+		MutableBitSet *thirds = $(alloc(MutableBitSet), initWithCapacity, 64);
+
+		for (size_t i = 0; i < 1000; i++) {
+			if (i % 2 == 0) {
+				$(evens, addIndex, i);
+			}
+			if (i % 3 == 0) {
+				$(thirds, addIndex, i);
+			}
+		}
+
+		ck_assert_int_eq(500, $((BitSet *) evens, count));
+		ck_assert_int_eq(334, $((BitSet *) thirds, count));
+
+		MutableBitSet *both = $((BitSet *) evens, mutableCopy);
+		$(both, andBitSet, (BitSet *) thirds);
+		ck_assert_int_eq(167, $((BitSet *) both, count));
+
+		MutableBitSet *either = $((BitSet *) evens, mutableCopy);
+		$(either, orBitSet, (BitSet *) thirds);
+		ck_assert_int_eq(667, $((BitSet *) either, count));
+
+		MutableBitSet *exclusive = $((BitSet *) evens, mutableCopy);
+		$(exclusive, xorBitSet, (BitSet *) thirds);
+		ck_assert_int_eq(500, $((BitSet *) exclusive, count));
+
+		$(either, andNotBitSet, (BitSet *) both);
+		ck_assert($((Object *) either, isEqual, (Object *) exclusive));
+
+		$(evens, removeIndexesInRange, (Range) { .location = 10, .length = 980 });
+		ck_assert_int_eq(10, $((BitSet *) evens, count));
+
+		$(evens, addIndexesInRange, (Range) { .location = 1, .length = 9 });
+		ck_assert_int_eq(15, $((BitSet *) evens, count));
+		ck_assert_int_eq(9, $((BitSet *) evens, nextIndex, 9));
+
+		$(evens, removeIndex, 0);
+		ck_assert(!$((BitSet *) evens, containsIndex, 0));
+
+		$(evens, removeAllIndexes);
+		ck_assert_int_eq(0, $((BitSet *) evens, count));
+		ck_assert_int_eq(-1, $((BitSet *) evens, nextIndex, 0));
+
+		release(exclusive);
+		release(either);
+		release(both);
+		release(thirds);
+		release(evens);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("mutableBitSet");
+	tcase_add_test(tcase, mutableBitSet);
+
+	Suite *suite = suite_create("mutableBitSet");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,145 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+
+START_TEST(mutableCountedSet)
+	{
+		MutableCountedSet *set = $$(MutableCountedSet, countedSet);
+		CountedSet *counted = (CountedSet *) set;
+
+		const int count = 1000;
+
+		for (int i = 0; i < count; i++) {
+			Number *number = $$(Number, numberWithValue, i % 100);
+			$(set, addObject, number);
+			release(number);
+		}
+
+		ck_assert_int_eq(100, counted->count);
+		ck_assert_int_eq(count, counted->total);
+
+		Number *seven = $$(Number, numberWithValue, 7);
+		ck_assert_int_eq(10, $(counted, countForObject, seven));
+
+		$(set, addObjectWithCount, seven, 5);
+		ck_assert_int_eq(15, $(counted, countForObject, seven));
+
+		Array *top = $(counted, objectsWithHighestCounts, 1);
+		const Object *first = $(top, objectAtIndex, 0);
+		ck_assert($((Object *) seven, isEqual, first));
+		release(top);
+
+		for (int i = 0; i < 15; i++) {
+			$(set, removeObject, seven);
+		}
+
+		ck_assert(!$(counted, containsObject, seven));
+		ck_assert_int_eq(99, counted->count);
+		ck_assert_int_eq(count - 10, counted->total);
+
+		for (int i = 0; i < 100; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			ck_assert_int_eq(i == 7 ? 0 : 10, $(counted, countForObject, number));
+			release(number);
+		}
+
+		MutableCountedSet *other = $(alloc(MutableCountedSet), initWithCapacity, 10);
+		$(other, addObjectWithCount, seven, 3);
+		$(set, addObjectsFromCountedSet, (CountedSet *) other);
+		$(set, addObjectsFromCountedSet, (CountedSet *) other);
+		ck_assert_int_eq(6, $(counted, countForObject, seven));
+		ck_assert_int_eq(100, counted->count);
+
+		$(set, removeAllObjects);
+		ck_assert_int_eq(0, counted->count);
+		ck_assert_int_eq(0, counted->total);
+		ck_assert_int_eq(0, $(counted, countForObject, seven));
+
+		release(other);
+		release(seven);
+		release(set);
+
+	}END_TEST
+
+START_TEST(randomized)
+	{
+		MutableCountedSet *set = $$(MutableCountedSet, countedSet);
+
+		int counts[64] = { 0 };
+
+		srand(13);
+
+		for (int i = 0; i < 20000; i++) {
+
+			const int value = rand() % 64;
+			Number *number = $$(Number, numberWithValue, value);
+
+			if (rand() % 3) {
+				$(set, addObject, number);
+				counts[value]++;
+			} else {
+				$(set, removeObject, number);
+				counts[value] = counts[value] ? counts[value] - 1 : 0;
+			}
+
+			release(number);
+		}
+
+		size_t distinct = 0;
+
+		for (int i = 0; i < 64; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			ck_assert_int_eq(counts[i], $((CountedSet *) set, countForObject, number));
+			release(number);
+
+			distinct += counts[i] ? 1 : 0;
+		}
+
+		ck_assert_int_eq(distinct, ((CountedSet *) set)->count);
+
+		release(set);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("mutableCountedSet");
+	tcase_add_test(tcase, mutableCountedSet);
+	tcase_add_test(tcase, randomized);
+
+	Suite *suite = suite_create("mutableCountedSet");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
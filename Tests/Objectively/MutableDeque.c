@@ -0,0 +1,128 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+START_TEST(mutableDeque)
+	{
+		MutableDeque *deque = $$(MutableDeque, deque);
+
+		ck_assert(deque != NULL);
+		ck_assert_ptr_eq(_MutableDeque(), classof(deque));
+		ck_assert_ptr_eq(NULL, $(deque, popFront));
+		ck_assert_ptr_eq(NULL, $(deque, popBack));
+
+		for (int i = 0; i < 100; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			if (i % 2) {
+				$(deque, pushBack, number);
+			} else {
+				$(deque, pushFront, number);
+			}
+			release(number);
+		}
+
+		ck_assert_int_eq(100, ((Deque *) deque)->count);
+		ck_assert_int_eq(98, $((Number *) $((Deque *) deque, firstObject), intValue));
+		ck_assert_int_eq(99, $((Number *) $((Deque *) deque, lastObject), intValue));
+		ck_assert_int_eq(0, $((Number *) $((Deque *) deque, objectAtIndex, 49), intValue));
+		ck_assert_int_eq(1, $((Number *) $((Deque *) deque, objectAtIndex, 50), intValue));
+
+		Number *number = $(deque, popFront);
+		ck_assert_int_eq(98, $(number, intValue));
+		release(number);
+
+		number = $(deque, popBack);
+		ck_assert_int_eq(99, $(number, intValue));
+		release(number);
+
+		int count = 0;
+		foreach(Number *n, deque) {
+			count++;
+		}
+		ck_assert_int_eq(98, count);
+
+		Array *array = $(deque, drain);
+		ck_assert_int_eq(98, array->count);
+		ck_assert_int_eq(0, ((Deque *) deque)->count);
+		ck_assert_int_eq(96, $((Number *) $(array, firstObject), intValue));
+		ck_assert_int_eq(97, $((Number *) $(array, lastObject), intValue));
+
+		release(array);
+		release(deque);
+
+	}END_TEST
+
+START_TEST(limit)
+	{
+		MutableDeque *window = $(alloc(MutableDeque), initWithLimit, 3);
+
+		Object *objects[5];
+		for (int i = 0; i < 5; i++) {
+			objects[i] = $(alloc(Object), init);
+			$(window, pushBack, objects[i]);
+		}
+
+		ck_assert_int_eq(3, ((Deque *) window)->count);
+		ck_assert_ptr_eq(objects[2], $((Deque *) window, firstObject));
+		ck_assert_ptr_eq(objects[4], $((Deque *) window, lastObject));
+		ck_assert_int_eq(1, objects[0]->referenceCount);
+		ck_assert_int_eq(2, objects[4]->referenceCount);
+
+		$(window, pushFront, objects[0]);
+		ck_assert_ptr_eq(objects[0], $((Deque *) window, firstObject));
+		ck_assert_ptr_eq(objects[3], $((Deque *) window, lastObject));
+		ck_assert_int_eq(1, objects[4]->referenceCount);
+
+		$(window, removeAllObjects);
+		ck_assert_int_eq(0, ((Deque *) window)->count);
+
+		for (int i = 0; i < 5; i++) {
+			ck_assert_int_eq(1, objects[i]->referenceCount);
+			release(objects[i]);
+		}
+
+		release(window);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("mutableDeque");
+	tcase_add_test(tcase, mutableDeque);
+	tcase_add_test(tcase, limit);
+
+	Suite *suite = suite_create("mutableDeque");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
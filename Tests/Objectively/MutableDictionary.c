@@ -112,10 +112,40 @@ START_TEST(mutableDictionary)
 
 	}END_TEST
 
+START_TEST(valuesAreNotKeys)
+	{
+		MutableDictionary *dict = $$(MutableDictionary, dictionaryWithCapacity, 1);
+
+		String *a = str("a"), *b = str("b"), *c = str("c");
+
+		$(dict, setObjectForKey, b, a);
+
+		ck_assert_ptr_eq(NULL, $((Dictionary *) dict, objectForKey, b));
+
+		$(dict, removeObjectForKey, b);
+
+		ck_assert_int_eq(1, ((Dictionary *) dict)->count);
+		ck_assert_ptr_eq(b, $((Dictionary *) dict, objectForKey, a));
+
+		$(dict, setObjectForKey, c, b);
+
+		ck_assert_int_eq(2, ((Dictionary *) dict)->count);
+		ck_assert_ptr_eq(b, $((Dictionary *) dict, objectForKey, a));
+		ck_assert_ptr_eq(c, $((Dictionary *) dict, objectForKey, b));
+
+		release(dict);
+
+		release(a);
+		release(b);
+		release(c);
+
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("mutableDictionary");
 	tcase_add_test(tcase, mutableDictionary);
+	tcase_add_test(tcase, valuesAreNotKeys);
 
 	Suite *suite = suite_create("mutableDictionary");
 	suite_add_tcase(suite, tcase);
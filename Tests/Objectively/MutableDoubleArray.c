@@ -0,0 +1,97 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+
+START_TEST(mutableDoubleArray)
+	{
+		MutableDoubleArray *array = $$(MutableDoubleArray, doubleArray);
+
+		ck_assert(array != NULL);
+		ck_assert_ptr_eq(_MutableDoubleArray(), classof(array));
+
+		for (size_t i = 0; i < 1000; i++) {
+			$(array, addValue, 0.5);
+		}
+
+		ck_assert_int_eq(1000, ((DoubleArray *) array)->count);
+		ck_assert($((DoubleArray *) array, sum) == 500.0);
+
+		$(array, setValueAtIndex, -1.0, 999);
+		ck_assert($((DoubleArray *) array, minimum) == -1.0);
+
+		$(array, removeValueAtIndex, 999);
+		ck_assert($((DoubleArray *) array, minimum) == 0.5);
+
+		release(array);
+
+	}END_TEST
+
+START_TEST(sort)
+	{
+		MutableDoubleArray *array = $$(MutableDoubleArray, doubleArray);
+
+		for (size_t i = 0; i < 10000; i++) {
+			$(array, addValue, (rand() - RAND_MAX / 2.0) / 1000.0);
+		}
+
+		$(array, addValue, -INFINITY);
+		$(array, addValue, INFINITY);
+
+		$(array, sort);
+
+		const DoubleArray *sorted = (DoubleArray *) array;
+
+		ck_assert(sorted->values[0] == -INFINITY);
+		ck_assert(sorted->values[sorted->count - 1] == INFINITY);
+
+		for (size_t i = 1; i < sorted->count; i++) {
+			ck_assert(sorted->values[i - 1] <= sorted->values[i]);
+		}
+
+		release(array);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("mutableDoubleArray");
+	tcase_add_test(tcase, mutableDoubleArray);
+	tcase_add_test(tcase, sort);
+
+	Suite *suite = suite_create("mutableDoubleArray");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
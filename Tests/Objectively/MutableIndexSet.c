@@ -0,0 +1,149 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+
+#define N 1000
+
+START_TEST(mutableIndexSet)
+	{
+		MutableIndexSet *indexSet = $(alloc(MutableIndexSet), init);
+
+		ck_assert(indexSet != NULL);
+		ck_assert_int_eq(0, ((IndexSet *) indexSet)->count);
+
+		$(indexSet, addIndexesInRange, (Range) { .location = 10, .length = 10 });
+		$(indexSet, addIndexesInRange, (Range) { .location = 30, .length = 10 });
+		ck_assert_int_eq(2, ((IndexSet *) indexSet)->numberOfRanges);
+
+		$(indexSet, addIndex, 20);
+		ck_assert_int_eq(2, ((IndexSet *) indexSet)->numberOfRanges);
+		ck_assert_int_eq(21, ((IndexSet *) indexSet)->count);
+
+		$(indexSet, addIndexesInRange, (Range) { .location = 21, .length = 9 });
+		ck_assert_int_eq(1, ((IndexSet *) indexSet)->numberOfRanges);
+		ck_assert_int_eq(30, ((IndexSet *) indexSet)->count);
+
+		$(indexSet, removeIndexesInRange, (Range) { .location = 15, .length = 10 });
+		ck_assert_int_eq(2, ((IndexSet *) indexSet)->numberOfRanges);
+		ck_assert_int_eq(20, ((IndexSet *) indexSet)->count);
+		ck_assert(!$((IndexSet *) indexSet, containsIndex, 15));
+		ck_assert($((IndexSet *) indexSet, containsIndex, 25));
+
+		$(indexSet, removeIndex, 10);
+		ck_assert(!$((IndexSet *) indexSet, containsIndex, 10));
+		ck_assert_int_eq(19, ((IndexSet *) indexSet)->count);
+
+		Object *copy = $((Object *) indexSet, copy);
+		ck_assert_ptr_eq(_MutableIndexSet(), classof(copy));
+		ck_assert($((Object *) indexSet, isEqual, copy));
+		release(copy);
+
+		$(indexSet, removeAllIndexes);
+		ck_assert_int_eq(0, ((IndexSet *) indexSet)->count);
+
+		release(indexSet);
+
+	}END_TEST
+
+START_TEST(randomized)
+	{
+		MutableIndexSet *indexSet = $(alloc(MutableIndexSet), init);
+
+		_Bool expected[N] = { false };
+
+		srand(1);
+
+		for (int i = 0; i < 2000; i++) {
+
+			const size_t location = rand() % (N - 20);
+			const size_t length = rand() % 20;
+			const Range range = { .location = location, .length = length };
+
+			const _Bool add = rand() % 2;
+			if (add) {
+				$(indexSet, addIndexesInRange, range);
+			} else {
+				$(indexSet, removeIndexesInRange, range);
+			}
+
+			for (size_t j = location; j < location + length; j++) {
+				expected[j] = add;
+			}
+		}
+
+		size_t count = 0;
+		for (size_t i = 0; i < N; i++) {
+			ck_assert(expected[i] == $((IndexSet *) indexSet, containsIndex, i));
+			count += expected[i];
+		}
+
+		ck_assert_int_eq(count, ((IndexSet *) indexSet)->count);
+
+		const IndexSet *this = (IndexSet *) indexSet;
+		for (size_t i = 1; i < this->numberOfRanges; i++) {
+			ck_assert((size_t) this->ranges[i].location > this->ranges[i - 1].location + this->ranges[i - 1].length);
+		}
+
+		IndexSet *evens = $(alloc(IndexSet), initWithIndexes, NULL, 0);
+		MutableIndexSet *mutableEvens = $(evens, mutableCopy);
+		for (size_t i = 0; i < N; i += 2) {
+			$(mutableEvens, addIndex, i);
+		}
+
+		$(indexSet, intersectIndexSet, (IndexSet *) mutableEvens);
+
+		for (size_t i = 0; i < N; i++) {
+			ck_assert((expected[i] && i % 2 == 0) == $((IndexSet *) indexSet, containsIndex, i));
+		}
+
+		$(indexSet, removeIndexSet, (IndexSet *) mutableEvens);
+		ck_assert_int_eq(0, ((IndexSet *) indexSet)->count);
+
+		release(mutableEvens);
+		release(evens);
+		release(indexSet);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("mutableIndexSet");
+	tcase_add_test(tcase, mutableIndexSet);
+	tcase_add_test(tcase, randomized);
+
+	Suite *suite = suite_create("mutableIndexSet");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
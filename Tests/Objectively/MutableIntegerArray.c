@@ -0,0 +1,108 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+
+START_TEST(mutableIntegerArray)
+	{
+		MutableIntegerArray *array = $$(MutableIntegerArray, integerArray);
+
+		ck_assert(array != NULL);
+		ck_assert_ptr_eq(_MutableIntegerArray(), classof(array));
+		ck_assert_int_eq(0, ((IntegerArray *) array)->count);
+
+		for (int64_t i = 0; i < 100; i++) {
+			$(array, addValue, i);
+		}
+
+		ck_assert_int_eq(100, ((IntegerArray *) array)->count);
+		ck_assert_int_eq(4950, $((IntegerArray *) array, sum));
+
+		$(array, removeValueAtIndex, 0);
+		ck_assert_int_eq(99, ((IntegerArray *) array)->count);
+		ck_assert_int_eq(1, $((IntegerArray *) array, valueAtIndex, 0));
+
+		$(array, setValueAtIndex, -1, 0);
+		ck_assert_int_eq(-1, $((IntegerArray *) array, minimum));
+
+		MutableIntegerArray *copy = (MutableIntegerArray *) $((Object *) array, copy);
+		ck_assert_ptr_eq(_MutableIntegerArray(), classof(copy));
+		ck_assert($((Object *) array, isEqual, (Object *) copy));
+
+		$(array, removeAllValues);
+		ck_assert_int_eq(0, ((IntegerArray *) array)->count);
+		ck_assert_int_eq(99, ((IntegerArray *) copy)->count);
+
+		release(copy);
+		release(array);
+
+	}END_TEST
+
+START_TEST(sort)
+	{
+		MutableIntegerArray *array = $$(MutableIntegerArray, integerArray);
+
+		const int64_t extremes[] = { INT64_MAX, INT64_MIN, 0, -1, 1 };
+		$(array, addValues, extremes, lengthof(extremes));
+
+		for (size_t i = 0; i < 10000; i++) {
+			$(array, addValue, (int64_t) rand() - RAND_MAX / 2);
+		}
+
+		$(array, sort);
+
+		const IntegerArray *sorted = (IntegerArray *) array;
+
+		ck_assert_int_eq(10005, sorted->count);
+		ck_assert(sorted->values[0] == INT64_MIN);
+		ck_assert(sorted->values[sorted->count - 1] == INT64_MAX);
+
+		for (size_t i = 1; i < sorted->count; i++) {
+			ck_assert(sorted->values[i - 1] <= sorted->values[i]);
+		}
+
+		release(array);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("mutableIntegerArray");
+	tcase_add_test(tcase, mutableIntegerArray);
+	tcase_add_test(tcase, sort);
+
+	Suite *suite = suite_create("mutableIntegerArray");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,149 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively.h>
+
+START_TEST(mutableRadixTree)
+	{
+		MutableRadixTree *tree = $$(MutableRadixTree, radixTree);
+
+		ck_assert(tree != NULL);
+		ck_assert_ptr_eq(_MutableRadixTree(), classof(tree));
+		ck_assert_int_eq(0, ((RadixTree *) tree)->count);
+
+		String *one = str("one"), *two = str("two"), *three = str("three");
+
+		$(tree, setObjectForKey, one, one);
+		$(tree, setObjectForKey, two, two);
+		$(tree, setObjectForKey, three, three);
+		ck_assert_int_eq(3, ((RadixTree *) tree)->count);
+
+		$(tree, setObjectForKey, three, two);
+		ck_assert_int_eq(3, ((RadixTree *) tree)->count);
+		ck_assert_ptr_eq(three, $((RadixTree *) tree, objectForKey, two));
+
+		$(tree, removeObjectForKey, two);
+		ck_assert_int_eq(2, ((RadixTree *) tree)->count);
+		ck_assert(!$((RadixTree *) tree, containsKey, two));
+		ck_assert($((RadixTree *) tree, containsKey, three));
+
+		$(tree, removeAllObjects);
+		ck_assert_int_eq(0, ((RadixTree *) tree)->count);
+		ck_assert(!$((RadixTree *) tree, containsKey, one));
+
+		release(three);
+		release(two);
+		release(one);
+		release(tree);
+
+	}END_TEST
+
+START_TEST(randomized)
+	{
+		MutableRadixTree *tree = $$(MutableRadixTree, radixTree);
+		MutableDictionary *dictionary = $(alloc(MutableDictionary), init);
+
+		srand(39);
+
+		for (int i = 0; i < 100000; i++) {
+
+			uint8_t bytes[24];
+			const size_t length = rand() % 24;
+
+			for (size_t j = 0; j < length; j++) {
+				bytes[j] = (j < 12 && rand() % 4) ? 'a' + (j % 3) : rand() % 256;
+			}
+
+			Data *key = $$(Data, dataWithBytes, bytes, length);
+
+			if (rand() % 3) {
+				Number *number = $$(Number, numberWithValue, i);
+
+				$(tree, setObjectForKey, number, key);
+				$(dictionary, setObjectForKey, number, key);
+
+				release(number);
+			} else {
+				$(tree, removeObjectForKey, key);
+				$(dictionary, removeObjectForKey, key);
+			}
+
+			release(key);
+		}
+
+		ck_assert_int_eq(((Dictionary *) dictionary)->count, ((RadixTree *) tree)->count);
+
+		Array *keys = $((Dictionary *) dictionary, allKeys);
+		for (size_t i = 0; i < keys->count; i++) {
+			const ident key = $(keys, objectAtIndex, i);
+			ck_assert_ptr_eq($((Dictionary *) dictionary, objectForKey, key), $((RadixTree *) tree, objectForKey, key));
+		}
+
+		Array *ordered = $((RadixTree *) tree, allKeys);
+		ck_assert_int_eq(keys->count, ordered->count);
+
+		for (size_t i = 1; i < ordered->count; i++) {
+			const Data *a = $(ordered, objectAtIndex, i - 1);
+			const Data *b = $(ordered, objectAtIndex, i);
+
+			const int order = memcmp(a->bytes, b->bytes, min(a->length, b->length));
+			ck_assert(order < 0 || (order == 0 && a->length < b->length));
+		}
+
+		for (size_t i = 0; i < keys->count; i++) {
+			const ident key = $(keys, objectAtIndex, i);
+			$(tree, removeObjectForKey, key);
+		}
+
+		ck_assert_int_eq(0, ((RadixTree *) tree)->count);
+		ck_assert_ptr_eq(NULL, ((RadixTree *) tree)->root);
+
+		release(ordered);
+		release(keys);
+		release(dictionary);
+		release(tree);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("mutableRadixTree");
+	tcase_add_test(tcase, mutableRadixTree);
+	tcase_add_test(tcase, randomized);
+
+	Suite *suite = suite_create("mutableRadixTree");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -22,6 +22,10 @@
  */
 
 #include <check.h>
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <Objectively.h>
 
@@ -62,10 +66,156 @@ START_TEST(string)
 
 	}END_TEST
 
+START_TEST(edits)
+	{
+		MutableString *string = $$(MutableString, string);
+		ck_assert_str_eq("", string->string.chars);
+		ck_assert_int_eq(STRING_INLINE_CAPACITY, string->capacity);
+
+		$(string, appendBytes, (const uint8_t *) "hello world", 5);
+		ck_assert_str_eq("hello", string->string.chars);
+		ck_assert_ptr_eq(string->string.inlineChars, string->string.chars);
+
+		size_t reallocations = 0, capacity = string->capacity;
+		for (size_t i = 0; i < 10000; i++) {
+			$(string, appendCharacters, "!");
+			if (string->capacity != capacity) {
+				ck_assert_int_ge(string->capacity, capacity * 2);
+				capacity = string->capacity;
+				reallocations++;
+			}
+		}
+
+		ck_assert_int_eq(10005, string->string.length);
+		ck_assert_int_le(reallocations, 10);
+
+		$(string, deleteCharactersInRange, (Range) { 5, 10000 });
+		ck_assert_str_eq("hello", string->string.chars);
+
+		$(string, insertCharactersAtIndex, ", world", 5);
+		ck_assert_str_eq("hello, world", string->string.chars);
+
+		$(string, insertCharactersAtIndex, ">> ", 0);
+		ck_assert_str_eq(">> hello, world", string->string.chars);
+
+		$(string, replaceCharactersInRange, (Range) { 3, 5 }, "goodbye");
+		ck_assert_str_eq(">> goodbye, world", string->string.chars);
+
+		$(string, appendString, (String *) string);
+		ck_assert_str_eq(">> goodbye, world>> goodbye, world", string->string.chars);
+
+		$(string, deleteCharactersInRange, (Range) { 17, 17 });
+		$(string, replaceCharactersInRange, (Range) { 0, 2 }, "  ");
+		$(string, appendCharacters, " \n");
+
+		$(string, trim);
+		ck_assert_str_eq("goodbye, world", string->string.chars);
+		ck_assert_int_eq(14, string->string.length);
+
+		MutableString *formatted = (MutableString *) $((String *) alloc(MutableString), initWithCharacters, "inline");
+		$(formatted, insertStringAtIndex, (String *) string, 0);
+		ck_assert_str_eq("goodbye, worldinline", formatted->string.chars);
+
+		release(formatted);
+		release(string);
+
+	}END_TEST
+
+START_TEST(appenders)
+	{
+		MutableString *string = $$(MutableString, string);
+
+		$(string, appendInteger, 0);
+		$(string, appendCharacters, " ");
+		$(string, appendInteger, -42);
+		$(string, appendCharacters, " ");
+		$(string, appendInteger, INT64_MIN);
+		$(string, appendCharacters, " ");
+		$(string, appendInteger, INT64_MAX);
+		ck_assert_str_eq("0 -42 -9223372036854775808 9223372036854775807", string->string.chars);
+
+		$(string, deleteCharactersInRange, (Range) { 0, string->string.length });
+
+		$(string, appendHex, 0);
+		$(string, appendCharacters, " ");
+		$(string, appendHex, 0xdeadbeef);
+		$(string, appendCharacters, " ");
+		$(string, appendHex, UINT64_MAX);
+		ck_assert_str_eq("0 deadbeef ffffffffffffffff", string->string.chars);
+
+		const double values[] = { 0.0, -0.0, 0.125, 0.375, 1.005, 2.5, -2.5, 3.5, 123456.789, -0.001, 1e300, 1.0 / 3.0 };
+
+		char expected[512];
+		for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+			for (int precision = 0; precision < 8; precision++) {
+
+				$(string, deleteCharactersInRange, (Range) { 0, string->string.length });
+				$(string, appendDouble, values[i], precision);
+
+				snprintf(expected, sizeof(expected), "%.*f", precision, values[i]);
+				ck_assert_str_eq(expected, string->string.chars);
+			}
+		}
+
+		for (size_t i = 0; i < 100000; i++) {
+
+			const double value = (rand() - RAND_MAX / 2) / (double) (1 << (rand() % 20));
+			const int precision = rand() % 10;
+
+			$(string, deleteCharactersInRange, (Range) { 0, string->string.length });
+			$(string, appendDouble, value, precision);
+
+			snprintf(expected, sizeof(expected), "%.*f", precision, value);
+			ck_assert_str_eq(expected, string->string.chars);
+		}
+
+		$(string, deleteCharactersInRange, (Range) { 0, string->string.length });
+
+		for (size_t i = 0; i < 100; i++) {
+			$(string, appendFormat, "%03zu:%s;", i, "formatted in place");
+		}
+
+		ck_assert_int_eq(100 * 23, string->string.length);
+		ck_assert_int_eq(0, strncmp("099:formatted in place;", string->string.chars + 99 * 23, 23));
+
+		release(string);
+
+	}END_TEST
+
+START_TEST(caseMapping)
+	{
+		MutableString *string = mstr("Content-Type");
+
+		$(string, lowercase);
+		ck_assert_str_eq("content-type", ((String *) string)->chars);
+
+		$(string, appendCharacters, ": Application/JSON; Charset=UTF-8");
+		$(string, uppercase);
+		ck_assert_str_eq("CONTENT-TYPE: APPLICATION/JSON; CHARSET=UTF-8", ((String *) string)->chars);
+
+		if (setlocale(LC_CTYPE, "C.UTF-8")) {
+
+			$(string, appendCharacters, " \xc9\x90\xc9\x90\xc9\x90");
+			$(string, uppercase);
+			ck_assert_str_eq("CONTENT-TYPE: APPLICATION/JSON; CHARSET=UTF-8 \xe2\xb1\xaf\xe2\xb1\xaf\xe2\xb1\xaf", ((String *) string)->chars);
+
+			$(string, lowercase);
+			ck_assert_str_eq("content-type: application/json; charset=utf-8 \xc9\x90\xc9\x90\xc9\x90", ((String *) string)->chars);
+
+			setlocale(LC_CTYPE, "C");
+		}
+
+		release(string);
+
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("string");
 	tcase_add_test(tcase, string);
+	tcase_add_test(tcase, edits);
+	tcase_add_test(tcase, appenders);
+	tcase_add_test(tcase, caseMapping);
 
 	Suite *suite = suite_create("string");
 	suite_add_tcase(suite, tcase);
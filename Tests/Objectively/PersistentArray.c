@@ -0,0 +1,193 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+
+START_TEST(persistentArray)
+	{
+		Number *one = $$(Number, numberWithValue, 1);
+		Number *two = $$(Number, numberWithValue, 2);
+		Number *three = $$(Number, numberWithValue, 3);
+
+		PersistentArray *array = $(alloc(PersistentArray), initWithObjects, one, two, NULL);
+		ck_assert_int_eq(2, array->count);
+		ck_assert_ptr_eq(two, $(array, objectAtIndex, 1));
+
+		PersistentArray *appended = $(array, withObject, three);
+		ck_assert_int_eq(3, appended->count);
+		ck_assert_int_eq(2, array->count);
+
+		PersistentArray *replaced = $(appended, withObjectAtIndex, one, 2);
+		ck_assert_ptr_eq(one, $(replaced, objectAtIndex, 2));
+		ck_assert_ptr_eq(three, $(appended, objectAtIndex, 2));
+
+		PersistentArray *popped = $(appended, withoutLastObject);
+		ck_assert($((Object *) popped, isEqual, (Object *) array));
+		ck_assert_int_eq($((Object *) popped, hash), $((Object *) array, hash));
+
+		String *description = $((Object *) appended, description);
+		ck_assert_str_eq("[1.00000, 2.00000, 3.00000]", description->chars);
+
+		release(description);
+		release(popped);
+		release(replaced);
+		release(appended);
+		release(array);
+		release(three);
+		release(two);
+		release(one);
+
+	}END_TEST
+
+START_TEST(structuralSharing)
+	{
+		const int count = 40000;
+
+		PersistentArray *transient = $(alloc(PersistentArray), init);
+		PersistentArray *array = $(transient, transient);
+		release(transient);
+
+		for (int i = 0; i < count; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(array, addObject, number);
+			release(number);
+		}
+
+		$(array, persistent);
+		ck_assert_int_eq(count, array->count);
+
+		Number *zero = $$(Number, numberWithValue, -1);
+		PersistentArray **versions = calloc(count / 1000, sizeof(PersistentArray *));
+
+		PersistentArray *current = retain(array);
+		for (int i = 0; i < count / 1000; i++) {
+			versions[i] = $(current, withObjectAtIndex, zero, i * 1000);
+			release(current);
+			current = retain(versions[i]);
+		}
+
+		for (int i = 0; i < count; i++) {
+			ck_assert_int_eq(i, $((Number *) $(array, objectAtIndex, i), intValue));
+		}
+
+		for (int i = 0; i < count / 1000; i++) {
+			ck_assert_ptr_eq(zero, $(versions[i], objectAtIndex, i * 1000));
+			ck_assert_int_eq(i * 1000 + 1, $((Number *) $(versions[i], objectAtIndex, i * 1000 + 1), intValue));
+		}
+
+		while (current->count) {
+			PersistentArray *next = $(current, withoutLastObject);
+			release(current);
+			current = next;
+
+			if (current->count) {
+				ck_assert_int_eq(current->count - 1, $((Number *) $(array, objectAtIndex, current->count - 1), intValue));
+			}
+		}
+
+		ck_assert_int_eq(count, array->count);
+
+		Array *objects = $(array, allObjects);
+		PersistentArray *copy = $(alloc(PersistentArray), initWithArray, objects);
+		ck_assert($((Object *) copy, isEqual, (Object *) array));
+
+		release(copy);
+		release(objects);
+		release(current);
+
+		for (int i = 0; i < count / 1000; i++) {
+			release(versions[i]);
+		}
+
+		free(versions);
+		release(zero);
+		release(array);
+
+	}END_TEST
+
+START_TEST(transient)
+	{
+		const int count = 3000;
+
+		PersistentArray *array = $(alloc(PersistentArray), init);
+		PersistentArray *transient = $(array, transient);
+
+		for (int i = 0; i < count; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(transient, addObject, number);
+			release(number);
+		}
+
+		PersistentArray *snapshot = (PersistentArray *) $((Object *) transient, copy);
+
+		for (int i = 0; i < count; i++) {
+			Number *number = $$(Number, numberWithValue, -i);
+			$(transient, setObjectAtIndex, number, i);
+			release(number);
+		}
+
+		for (int i = 0; i < count / 2; i++) {
+			$(transient, removeLastObject);
+		}
+
+		$(transient, persistent);
+
+		ck_assert_int_eq(0, array->count);
+		ck_assert_int_eq(count, snapshot->count);
+		ck_assert_int_eq(count / 2, transient->count);
+
+		for (int i = 0; i < count; i++) {
+			ck_assert_int_eq(i, $((Number *) $(snapshot, objectAtIndex, i), intValue));
+			if (i < count / 2) {
+				ck_assert_int_eq(-i, $((Number *) $(transient, objectAtIndex, i), intValue));
+			}
+		}
+
+		release(snapshot);
+		release(transient);
+		release(array);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("persistentArray");
+	tcase_add_test(tcase, persistentArray);
+	tcase_add_test(tcase, structuralSharing);
+	tcase_add_test(tcase, transient);
+
+	Suite *suite = suite_create("persistentArray");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
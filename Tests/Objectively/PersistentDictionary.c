@@ -0,0 +1,202 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+
+START_TEST(persistentDictionary)
+	{
+		String *one = str("one"), *two = str("two");
+		Number *a = $$(Number, numberWithValue, 1), *b = $$(Number, numberWithValue, 2);
+
+		PersistentDictionary *empty = $(alloc(PersistentDictionary), init);
+		ck_assert_int_eq(0, empty->count);
+		ck_assert_ptr_eq(NULL, $(empty, objectForKey, one));
+
+		PersistentDictionary *first = $(empty, withObjectForKey, a, one);
+		PersistentDictionary *second = $(first, withObjectForKey, b, two);
+		PersistentDictionary *third = $(second, withObjectForKey, b, one);
+
+		ck_assert_int_eq(0, empty->count);
+		ck_assert_int_eq(1, first->count);
+		ck_assert_int_eq(2, second->count);
+		ck_assert_int_eq(2, third->count);
+
+		ck_assert_ptr_eq(a, $(first, objectForKey, one));
+		ck_assert_ptr_eq(a, $(second, objectForKey, one));
+		ck_assert_ptr_eq(b, $(third, objectForKey, one));
+		ck_assert($(second, containsKey, two));
+		ck_assert(!$(first, containsKey, two));
+
+		PersistentDictionary *fourth = $(third, withoutObjectForKey, two);
+		ck_assert_int_eq(1, fourth->count);
+		ck_assert_int_eq(2, third->count);
+		ck_assert(!$(fourth, containsKey, two));
+
+		PersistentDictionary *copy = (PersistentDictionary *) $((Object *) second, copy);
+		ck_assert_ptr_eq(second, copy);
+
+		PersistentDictionary *other = $(alloc(PersistentDictionary), initWithObjectsAndKeys, b, two, a, one, NULL);
+		ck_assert($((Object *) second, isEqual, (Object *) other));
+		ck_assert_int_eq($((Object *) second, hash), $((Object *) other, hash));
+		ck_assert(!$((Object *) third, isEqual, (Object *) other));
+
+		release(other);
+		release(copy);
+		release(fourth);
+		release(third);
+		release(second);
+		release(first);
+		release(empty);
+		release(b);
+		release(a);
+		release(two);
+		release(one);
+
+	}END_TEST
+
+START_TEST(structuralSharing)
+	{
+		const int count = 5000;
+
+		PersistentDictionary **versions = calloc(count + 1, sizeof(PersistentDictionary *));
+		versions[0] = $(alloc(PersistentDictionary), init);
+
+		for (int i = 0; i < count; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			versions[i + 1] = $(versions[i], withObjectForKey, number, number);
+			release(number);
+		}
+
+		for (int i = 0; i <= count; i += 499) {
+			ck_assert_int_eq(i, versions[i]->count);
+
+			for (int j = 0; j < count; j += 7) {
+				Number *number = $$(Number, numberWithValue, j);
+				ck_assert_int_eq(j < i, $(versions[i], containsKey, number));
+				release(number);
+			}
+		}
+
+		PersistentDictionary *dictionary = retain(versions[count]);
+		for (int i = 0; i < count; i += 2) {
+			Number *number = $$(Number, numberWithValue, i);
+			PersistentDictionary *next = $(dictionary, withoutObjectForKey, number);
+			release(dictionary);
+			dictionary = next;
+			release(number);
+		}
+
+		ck_assert_int_eq(count / 2, dictionary->count);
+		ck_assert_int_eq(count, versions[count]->count);
+
+		for (int i = 0; i < count; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			ck_assert_int_eq(i & 1, $(dictionary, containsKey, number));
+			ck_assert($(versions[count], containsKey, number));
+			release(number);
+		}
+
+		release(dictionary);
+
+		for (int i = 0; i <= count; i++) {
+			release(versions[i]);
+		}
+
+		free(versions);
+
+	}END_TEST
+
+START_TEST(transient)
+	{
+		const int count = 5000;
+
+		PersistentDictionary *empty = $(alloc(PersistentDictionary), init);
+		PersistentDictionary *transient = $(empty, transient);
+
+		for (int i = 0; i < count; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(transient, setObjectForKey, number, number);
+			release(number);
+		}
+
+		ck_assert_int_eq(count, transient->count);
+
+		PersistentDictionary *snapshot = (PersistentDictionary *) $((Object *) transient, copy);
+		ck_assert(snapshot != transient);
+
+		for (int i = 0; i < count; i += 2) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(transient, removeObjectForKey, number);
+			release(number);
+		}
+
+		$(transient, persistent);
+
+		ck_assert_int_eq(0, empty->count);
+		ck_assert_int_eq(count, snapshot->count);
+		ck_assert_int_eq(count / 2, transient->count);
+
+		for (int i = 0; i < count; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			ck_assert_ptr_ne(NULL, $(snapshot, objectForKey, number));
+			ck_assert_int_eq(i & 1, $(transient, containsKey, number));
+			release(number);
+		}
+
+		String *key = str("key");
+		Dictionary *dictionary = $$(Dictionary, dictionaryWithObjectsAndKeys, empty, key, NULL);
+		PersistentDictionary *converted = $(alloc(PersistentDictionary), initWithDictionary, dictionary);
+		ck_assert_int_eq(1, converted->count);
+		ck_assert_ptr_eq(empty, $(converted, objectForKey, key));
+
+		release(converted);
+		release(key);
+		release(dictionary);
+		release(snapshot);
+		release(transient);
+		release(empty);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("persistentDictionary");
+	tcase_add_test(tcase, persistentDictionary);
+	tcase_add_test(tcase, structuralSharing);
+	tcase_add_test(tcase, transient);
+
+	Suite *suite = suite_create("persistentDictionary");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,97 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+START_TEST(persistentSet)
+	{
+		String *one = str("one"), *two = str("two"), *three = str("three");
+
+		PersistentSet *set = $(alloc(PersistentSet), initWithObjects, one, two, NULL);
+		ck_assert_int_eq(2, $(set, count));
+		ck_assert($(set, containsObject, one));
+		ck_assert(!$(set, containsObject, three));
+
+		PersistentSet *more = $(set, withObject, three);
+		ck_assert_int_eq(3, $(more, count));
+		ck_assert_int_eq(2, $(set, count));
+		ck_assert($(more, containsObject, three));
+
+		PersistentSet *less = $(more, withoutObject, one);
+		ck_assert_int_eq(2, $(less, count));
+		ck_assert(!$(less, containsObject, one));
+		ck_assert($(more, containsObject, one));
+
+		Array *array = $$(Array, arrayWithObjects, two, three, NULL);
+		PersistentSet *other = $(alloc(PersistentSet), initWithArray, array);
+		ck_assert($((Object *) less, isEqual, (Object *) other));
+		ck_assert_int_eq($((Object *) less, hash), $((Object *) other, hash));
+
+		PersistentSet *transient = $(other, transient);
+		$(transient, addObject, one);
+		$(transient, removeObject, two);
+		$(transient, persistent);
+		ck_assert_int_eq(2, $(transient, count));
+		ck_assert($(transient, containsObject, one));
+		ck_assert(!$(transient, containsObject, two));
+		ck_assert($(other, containsObject, two));
+
+		PersistentSet *copy = (PersistentSet *) $((Object *) transient, copy);
+		ck_assert_ptr_eq(transient, copy);
+
+		Array *objects = $(copy, allObjects);
+		ck_assert_int_eq(2, objects->count);
+
+		release(objects);
+		release(copy);
+		release(transient);
+		release(other);
+		release(array);
+		release(less);
+		release(more);
+		release(set);
+		release(three);
+		release(two);
+		release(one);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("persistentSet");
+	tcase_add_test(tcase, persistentSet);
+
+	Suite *suite = suite_create("persistentSet");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,138 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+
+static Order comparator(const ident obj1, const ident obj2) {
+	return $((Number *) obj1, compareTo, (Number *) obj2);
+}
+
+START_TEST(priorityQueue)
+	{
+		PriorityQueue *queue = $(alloc(PriorityQueue), initWithComparator, comparator);
+
+		ck_assert(queue != NULL);
+		ck_assert_ptr_eq(NULL, $(queue, peek));
+		ck_assert_ptr_eq(NULL, $(queue, pop));
+
+		srand(1);
+
+		PriorityQueueHandle handles[1000];
+		for (int i = 0; i < 1000; i++) {
+			Number *number = $$(Number, numberWithValue, rand() % 10000);
+			handles[i] = $(queue, push, number);
+			release(number);
+		}
+
+		ck_assert_int_eq(1000, queue->count);
+
+		Number *minimum = $$(Number, numberWithValue, -1);
+		$(queue, decreaseKey, handles[500], minimum);
+		ck_assert_ptr_eq(minimum, $(queue, peek));
+		release(minimum);
+
+		double last = -2;
+		for (int i = 0; i < 1000; i++) {
+			Number *number = $(queue, pop);
+			ck_assert(number->value >= last);
+			last = number->value;
+			release(number);
+		}
+
+		ck_assert_int_eq(0, queue->count);
+
+		release(queue);
+
+	}END_TEST
+
+START_TEST(heapify)
+	{
+		MutableArray *numbers = $$(MutableArray, array);
+		for (int i = 100; i > 0; i--) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(numbers, addObject, number);
+			release(number);
+		}
+
+		PriorityQueue *queue = $(alloc(PriorityQueue), initWithArray, (Array *) numbers, comparator);
+		ck_assert_int_eq(100, queue->count);
+
+		for (int i = 1; i <= 100; i++) {
+			Number *number = $(queue, pop);
+			ck_assert_int_eq(i, $(number, intValue));
+			release(number);
+		}
+
+		release(queue);
+		release(numbers);
+
+	}END_TEST
+
+START_TEST(limit)
+	{
+		PriorityQueue *queue = $(alloc(PriorityQueue), initWithLimit, comparator, 10);
+
+		for (int i = 0; i < 100; i++) {
+			Number *number = $$(Number, numberWithValue, (i * 37) % 100);
+			$(queue, push, number);
+			release(number);
+		}
+
+		ck_assert_int_eq(10, queue->count);
+
+		Number *number = $$(Number, numberWithValue, 0);
+		ck_assert_int_eq(PRIORITY_QUEUE_HANDLE_NONE, $(queue, push, number));
+		release(number);
+
+		for (int i = 90; i < 100; i++) {
+			Number *number = $(queue, pop);
+			ck_assert_int_eq(i, $(number, intValue));
+			release(number);
+		}
+
+		release(queue);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("priorityQueue");
+	tcase_add_test(tcase, priorityQueue);
+	tcase_add_test(tcase, heapify);
+	tcase_add_test(tcase, limit);
+
+	Suite *suite = suite_create("priorityQueue");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
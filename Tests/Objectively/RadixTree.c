@@ -0,0 +1,145 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+static void enumerator(const RadixTree *tree, ident obj, ident key, ident data) {
+	$((MutableArray *) data, addObject, key);
+}
+
+START_TEST(radixTree)
+	{
+		MutableDictionary *dictionary = $(alloc(MutableDictionary), init);
+
+		const char *keys[] = {
+			"", "a", "ab", "abc", "abd", "b", "/api/v1/users", "/api/v1/users/settings", "/api/v2"
+		};
+
+		for (size_t i = 0; i < lengthof(keys); i++) {
+			String *key = str(keys[i]);
+			Number *number = $$(Number, numberWithValue, i);
+
+			$(dictionary, setObjectForKey, number, key);
+
+			release(number);
+			release(key);
+		}
+
+		RadixTree *tree = $(alloc(RadixTree), initWithDictionary, (Dictionary *) dictionary);
+		ck_assert(tree != NULL);
+		ck_assert_ptr_eq(_RadixTree(), classof(tree));
+		ck_assert_int_eq(lengthof(keys), tree->count);
+
+		for (size_t i = 0; i < lengthof(keys); i++) {
+			String *key = str(keys[i]);
+
+			const Number *number = $(tree, objectForKey, key);
+			ck_assert(number != NULL);
+			ck_assert_int_eq(i, $(number, intValue));
+
+			release(key);
+		}
+
+		String *absent = str("abcd");
+		ck_assert(!$(tree, containsKey, absent));
+
+		const Number *match = $(tree, objectForLongestPrefixOfKey, absent);
+		ck_assert_int_eq(3, $(match, intValue));
+		release(absent);
+
+		String *path = str("/api/v1/users/42");
+		match = $(tree, objectForLongestPrefixOfKey, path);
+		ck_assert_int_eq(6, $(match, intValue));
+		release(path);
+
+		String *unknown = str("zzz");
+		match = $(tree, objectForLongestPrefixOfKey, unknown);
+		ck_assert_int_eq(0, $(match, intValue));
+		release(unknown);
+
+		Array *allKeys = $(tree, allKeys);
+		ck_assert_int_eq(lengthof(keys), allKeys->count);
+
+		const char *ordered[] = {
+			"", "/api/v1/users", "/api/v1/users/settings", "/api/v2", "a", "ab", "abc", "abd", "b"
+		};
+		for (size_t i = 0; i < allKeys->count; i++) {
+			const String *key = $(allKeys, objectAtIndex, i);
+			ck_assert_str_eq(ordered[i], key->chars);
+		}
+
+		MutableArray *prefixed = $(alloc(MutableArray), init);
+
+		String *prefix = str("ab");
+		$(tree, enumerateObjectsAndKeysWithPrefix, prefix, enumerator, prefixed);
+		ck_assert_int_eq(3, ((Array *) prefixed)->count);
+		release(prefix);
+
+		$(prefixed, removeAllObjects);
+
+		prefix = str("/api/v1/u");
+		$(tree, enumerateObjectsAndKeysWithPrefix, prefix, enumerator, prefixed);
+		ck_assert_int_eq(2, ((Array *) prefixed)->count);
+		release(prefix);
+
+		ck_assert_ptr_eq(tree, $((Object *) tree, copy));
+		release(tree);
+
+		MutableRadixTree *mutableCopy = $(tree, mutableCopy);
+		ck_assert($((Object *) tree, isEqual, (Object *) mutableCopy));
+		ck_assert_int_eq($((Object *) tree, hash), $((Object *) mutableCopy, hash));
+
+		const uint8_t bytes[] = { 0x0a, 0x00, 0x00, 0x01 };
+		Data *data = $$(Data, dataWithBytes, bytes, lengthof(bytes));
+		$(mutableCopy, setObjectForKey, data, data);
+		ck_assert_ptr_eq(data, $((RadixTree *) mutableCopy, objectForKey, data));
+		ck_assert(!$((Object *) tree, isEqual, (Object *) mutableCopy));
+
+		release(data);
+		release(mutableCopy);
+		release(prefixed);
+		release(allKeys);
+		release(tree);
+		release(dictionary);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("radixTree");
+	tcase_add_test(tcase, radixTree);
+
+	Suite *suite = suite_create("radixTree");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,204 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <Objectively.h>
+
+START_TEST(rope)
+	{
+		Rope *rope = $(alloc(Rope), init);
+
+		ck_assert(rope != NULL);
+		ck_assert_ptr_eq(_Rope(), classof(rope));
+		ck_assert_int_eq(0, rope->length);
+
+		String *hello = str("hello");
+		String *world = str("world");
+
+		$(rope, appendString, hello);
+		$(rope, appendCharacters, " ");
+		$(rope, appendString, world);
+		ck_assert_int_eq(11, rope->length);
+
+		String *string = $(rope, string);
+		ck_assert_str_eq("hello world", string->chars);
+		release(string);
+
+		$(rope, insertCharactersAtIndex, "big ", 6);
+		$(rope, insertCharactersAtIndex, "oh, ", 0);
+		$(rope, appendCharacters, "!");
+
+		string = $(rope, string);
+		ck_assert_str_eq("oh, hello big world!", string->chars);
+		release(string);
+
+		$(rope, deleteCharactersInRange, (Range) { 4, 10 });
+
+		string = $(rope, string);
+		ck_assert_str_eq("oh, world!", string->chars);
+		release(string);
+
+		String *substring = $(rope, substring, (Range) { 4, 5 });
+		ck_assert_str_eq("world", substring->chars);
+		release(substring);
+
+		Data *data = $(rope, data);
+		ck_assert_int_eq(10, data->length);
+		ck_assert(memcmp("oh, world!", data->bytes, 10) == 0);
+		release(data);
+
+		Rope *copy = (Rope *) $((Object *) rope, copy);
+		$(copy, deleteCharactersInRange, (Range) { 0, 4 });
+
+		String *description = $((Object *) copy, description);
+		ck_assert_str_eq("world!", description->chars);
+		release(description);
+
+		description = $((Object *) rope, description);
+		ck_assert_str_eq("oh, world!", description->chars);
+		release(description);
+
+		release(copy);
+		release(world);
+		release(hello);
+		release(rope);
+
+	}END_TEST
+
+START_TEST(edits)
+	{
+		Rope *rope = $(alloc(Rope), init);
+		MutableString *expected = $(alloc(MutableString), init);
+
+		srand(7);
+
+		for (int i = 0; i < 5000; i++) {
+
+			const size_t length = ((String *) expected)->length;
+
+			char chars[16];
+			snprintf(chars, sizeof(chars), "<%d>", i);
+
+			switch (rand() % 4) {
+				case 0:
+					$(rope, appendCharacters, chars);
+					$(expected, appendCharacters, chars);
+					break;
+				case 1: {
+					const size_t index = length ? rand() % (length + 1) : 0;
+					$(rope, insertCharactersAtIndex, chars, index);
+					$(expected, insertCharactersAtIndex, chars, index);
+				}
+					break;
+				case 2:
+					if (length) {
+						const size_t location = rand() % length;
+						const Range range = { location, rand() % min(length - location, (size_t) 12) };
+						$(rope, deleteCharactersInRange, range);
+						$(expected, deleteCharactersInRange, range);
+					}
+					break;
+				case 3:
+					if (length) {
+						const size_t location = rand() % length;
+						const Range range = { location, rand() % (length - location) };
+
+						String *a = $(rope, substring, range);
+						String *b = $((String *) expected, substring, range);
+						ck_assert($((Object *) a, isEqual, (Object *) b));
+
+						release(a);
+						release(b);
+					}
+					break;
+			}
+
+			ck_assert_int_eq(((String *) expected)->length, rope->length);
+		}
+
+		String *string = $(rope, string);
+		ck_assert_str_eq(((String *) expected)->chars, string->chars);
+		release(string);
+
+		release(expected);
+		release(rope);
+
+	}END_TEST
+
+START_TEST(writeToFileDescriptor)
+	{
+		String *large = $$(String, stringWithCharacters, "a piece which is long enough not to be stored inline");
+
+		Rope *rope = $(alloc(Rope), initWithString, large);
+
+		MutableString *expected = $((String *) large, mutableCopy);
+
+		for (int i = 0; i < 1000; i++) {
+			$(rope, appendString, large);
+			$(expected, appendString, large);
+		}
+
+		const char *path = "/tmp/Objectively_Rope.test";
+
+		FILE *file = fopen(path, "w");
+		ck_assert(file != NULL);
+
+		ck_assert($(rope, writeToFileDescriptor, fileno(file)));
+		fclose(file);
+
+		Data *data = $$(Data, dataWithContentsOfFile, path);
+		ck_assert_int_eq(((String *) expected)->length, data->length);
+		ck_assert(memcmp(((String *) expected)->chars, data->bytes, data->length) == 0);
+
+		unlink(path);
+
+		release(data);
+		release(expected);
+		release(rope);
+		release(large);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("rope");
+	tcase_add_test(tcase, rope);
+	tcase_add_test(tcase, edits);
+	tcase_add_test(tcase, writeToFileDescriptor);
+
+	Suite *suite = suite_create("rope");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,172 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+static ident doubler(const ident obj, ident data) {
+	return $$(Number, numberWithValue, $((Number *) obj, intValue) * 2);
+}
+
+static _Bool isEven(const ident obj, ident data) {
+	return $((Number *) obj, intValue) % 2 == 0;
+}
+
+static ident summer(const ident obj, ident accumulator, ident data) {
+	return (ident) ((intptr_t) accumulator + $((Number *) obj, intValue));
+}
+
+static ident naturals(size_t index, ident data) {
+
+	(*(int *) data)++;
+
+	return $$(Number, numberWithValue, index);
+}
+
+static ident pair(const ident obj, ident data) {
+	return $$(Array, arrayWithObjects, obj, obj, NULL);
+}
+
+START_TEST(sequence)
+	{
+		MutableArray *numbers = $$(MutableArray, array);
+		for (int i = 0; i < 10; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(numbers, addObject, number);
+			release(number);
+		}
+
+		Sequence *sequence = $(alloc(Sequence), initWithArray, (Array *) numbers);
+		ck_assert(sequence != NULL);
+		ck_assert_int_eq(10, $(sequence, count));
+
+		Sequence *mapped = $(sequence, map, doubler, NULL);
+		Sequence *filtered = $(mapped, filter, isEven, NULL);
+		Sequence *skipped = $(filtered, skip, 2);
+		Sequence *taken = $(skipped, take, 3);
+
+		Array *array = $(taken, toArray);
+		ck_assert_int_eq(3, array->count);
+		ck_assert_int_eq(4, $((Number *) $(array, objectAtIndex, 0), intValue));
+		ck_assert_int_eq(8, $((Number *) $(array, objectAtIndex, 2), intValue));
+
+		ck_assert_int_eq(90, (intptr_t) $(mapped, reduce, summer, (ident) 0, NULL));
+
+		Number *first = $(taken, first);
+		ck_assert_int_eq(4, $(first, intValue));
+
+		release(first);
+		release(array);
+		release(taken);
+		release(skipped);
+		release(filtered);
+		release(mapped);
+		release(sequence);
+		release(numbers);
+
+	}END_TEST
+
+START_TEST(generator)
+	{
+		int calls = 0;
+
+		Sequence *sequence = $(alloc(Sequence), initWithGenerator, naturals, &calls);
+		Sequence *taken = $(sequence, take, 5);
+
+		ck_assert_int_eq(10, (intptr_t) $(taken, reduce, summer, (ident) 0, NULL));
+		ck_assert_int_eq(5, calls);
+
+		Sequence *flattened = $(taken, flatMap, pair, NULL);
+		ck_assert_int_eq(10, $(flattened, count));
+
+		Sequence *zipped = $(taken, zip, flattened);
+		Array *array = $(zipped, toArray);
+		ck_assert_int_eq(5, array->count);
+
+		Array *last = $(array, lastObject);
+		ck_assert_int_eq(4, $((Number *) $(last, objectAtIndex, 0), intValue));
+		ck_assert_int_eq(2, $((Number *) $(last, objectAtIndex, 1), intValue));
+
+		release(array);
+		release(zipped);
+		release(flattened);
+		release(taken);
+		release(sequence);
+
+	}END_TEST
+
+START_TEST(collections)
+	{
+		String *a = str("a"), *b = str("b"), *c = str("c");
+
+		Set *set = $$(Set, setWithObjects, a, b, c, NULL);
+		Sequence *sequence = $(alloc(Sequence), initWithSet, set);
+		ck_assert_int_eq(3, $(sequence, count));
+		release(sequence);
+
+		String *one = str("1"), *oneKey = str("one"), *two = str("2"), *twoKey = str("two");
+
+		Dictionary *dictionary = $$(Dictionary, dictionaryWithObjectsAndKeys, one, oneKey, two, twoKey, NULL);
+		sequence = $(alloc(Sequence), initWithDictionary, dictionary);
+		ck_assert_int_eq(2, $(sequence, count));
+		release(sequence);
+
+		size_t indexes[] = { 1, 2, 3 };
+		IndexSet *indexSet = $(alloc(IndexSet), initWithIndexes, indexes, lengthof(indexes));
+		sequence = $(alloc(Sequence), initWithIndexSet, indexSet);
+		ck_assert_int_eq(6, (intptr_t) $(sequence, reduce, summer, (ident) 0, NULL));
+		release(sequence);
+
+		release(indexSet);
+		release(dictionary);
+		release(twoKey);
+		release(two);
+		release(oneKey);
+		release(one);
+		release(set);
+		release(c);
+		release(b);
+		release(a);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("sequence");
+	tcase_add_test(tcase, sequence);
+	tcase_add_test(tcase, generator);
+	tcase_add_test(tcase, collections);
+
+	Suite *suite = suite_create("sequence");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
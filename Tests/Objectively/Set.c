@@ -41,6 +41,22 @@ static ident reducer(const ident obj, ident accumulator, ident data) {
 	return (ident) (intptr_t) accumulator + 1;
 }
 
+static _Bool parallelPredicate(const ident obj, ident data) {
+	return $((Number *) obj, intValue) % 2 == 0;
+}
+
+static ident parallelFunctor(const ident obj, ident data) {
+	return $$(Number, numberWithValue, $((Number *) obj, intValue) * 2);
+}
+
+static ident parallelReducer(const ident obj, ident accumulator, ident data) {
+	return (ident) ((intptr_t) accumulator + $((Number *) obj, intValue));
+}
+
+static ident parallelCombiner(const ident obj, ident accumulator, ident data) {
+	return (ident) ((intptr_t) accumulator + (intptr_t) obj);
+}
+
 START_TEST(set)
 	{
 		Object *one = $(alloc(Object), init);
@@ -89,10 +105,67 @@ START_TEST(set)
 
 	}END_TEST
 
+START_TEST(parallel)
+	{
+		ParallelChunkSize = 64;
+		ParallelThreadCount = 4;
+
+		MutableSet *numbers = $$(MutableSet, set);
+		for (int i = 0; i < 1000; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(numbers, addObject, number);
+			release(number);
+		}
+
+		Set *set = (Set *) numbers;
+
+		Set *mapped = $(set, parallelMappedSet, parallelFunctor, NULL);
+		ck_assert_int_eq(1000, mapped->count);
+
+		Number *number = $$(Number, numberWithValue, 1998);
+		ck_assert($(mapped, containsObject, number));
+		release(number);
+
+		Set *filtered = $(set, parallelFilteredSet, parallelPredicate, NULL);
+		ck_assert_int_eq(500, filtered->count);
+
+		const intptr_t sum = (intptr_t) $(set, parallelReduce, parallelReducer, parallelCombiner, (ident) 0, NULL);
+		ck_assert_int_eq(499500, sum);
+
+		release(filtered);
+		release(mapped);
+		release(set);
+
+		ParallelChunkSize = PARALLEL_DEFAULT_CHUNK_SIZE;
+		ParallelThreadCount = 0;
+
+	}END_TEST
+
+START_TEST(fastEnumeration)
+	{
+		MutableSet *set = $$(MutableSet, set);
+		for (int i = 0; i < 100; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(set, addObject, number);
+			release(number);
+		}
+
+		int sum = 0;
+		foreach(Number *number, set) {
+			sum += $(number, intValue);
+		}
+		ck_assert_int_eq(4950, sum);
+
+		release(set);
+
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("set");
 	tcase_add_test(tcase, set);
+	tcase_add_test(tcase, parallel);
+	tcase_add_test(tcase, fastEnumeration);
 
 	Suite *suite = suite_create("set");
 	suite_add_tcase(suite, tcase);
@@ -21,6 +21,8 @@
  * 3. This notice may not be removed or altered from any source distribution.
  */
 
+#include <iconv.h>
+#include <locale.h>
 #include <unistd.h>
 #include <check.h>
 
@@ -35,6 +37,7 @@ START_TEST(string)
 
 		String *copy = (String *) $((Object * ) string, copy);
 		ck_assert_str_eq("hello world!", copy->chars);
+		ck_assert_ptr_eq(string, copy);
 
 		ck_assert($((Object *) string, isEqual, (Object *) copy));
 		ck_assert_int_eq($((Object *) string, hash), $((Object *) copy, hash));
@@ -105,10 +108,255 @@ START_TEST(string)
 
 	}END_TEST
 
+START_TEST(inlineStrings)
+	{
+		String *empty = $$(String, stringWithCharacters, "");
+		ck_assert_ptr_eq(empty->inlineChars, empty->chars);
+		ck_assert_int_eq(0, empty->length);
+
+		String *small = str("%s %d", "inline", 1);
+		ck_assert_ptr_eq(small->inlineChars, small->chars);
+		ck_assert_str_eq("inline 1", small->chars);
+
+		const char *chars = "this string is too long to be stored inline";
+
+		String *large = str("%s", chars);
+		ck_assert(large->chars != large->inlineChars);
+		ck_assert_str_eq(chars, large->chars);
+
+		String *characters = $$(String, stringWithCharacters, chars);
+		ck_assert(characters->chars != characters->inlineChars);
+		ck_assert($((Object *) large, isEqual, (Object *) characters));
+
+		String *substring = $(large, substring, (Range) { 5, 6 });
+		ck_assert_ptr_eq(substring->inlineChars, substring->chars);
+		ck_assert_str_eq("string", substring->chars);
+
+		String *bytes = $$(String, stringWithBytes, (uint8_t *) chars, 4, STRING_ENCODING_UTF8);
+		ck_assert_ptr_eq(bytes->inlineChars, bytes->chars);
+		ck_assert_str_eq("this", bytes->chars);
+
+		MutableString *mutable = (MutableString *) $((String *) alloc(MutableString), initWithCharacters, "inline");
+		ck_assert_ptr_eq(((String *) mutable)->inlineChars, ((String *) mutable)->chars);
+
+		$(mutable, appendCharacters, " and then on the heap");
+		ck_assert_str_eq("inline and then on the heap", ((String *) mutable)->chars);
+		ck_assert(((String *) mutable)->chars != ((String *) mutable)->inlineChars);
+
+		release(mutable);
+		release(bytes);
+		release(substring);
+		release(characters);
+		release(large);
+		release(small);
+		release(empty);
+
+	}END_TEST
+
+START_TEST(slice)
+	{
+		String *string = str("%s", "the quick brown fox jumps over the lazy dog, twice over");
+
+		String *slice = $(string, slice, (Range) { 4, 35 });
+		ck_assert_ptr_eq(string->chars + 4, slice->chars);
+		ck_assert_int_eq(35, slice->length);
+		ck_assert_int_eq(2, ((Object *) string)->referenceCount);
+
+		String *expected = str("quick brown fox jumps over the lazy");
+		ck_assert($((Object *) slice, isEqual, (Object *) expected));
+		ck_assert($((Object *) expected, isEqual, (Object *) slice));
+		ck_assert_int_eq($((Object *) expected, hash), $((Object *) slice, hash));
+
+		String *over = str("over");
+		Range range = $(slice, rangeOfString, over, (Range) { 0, slice->length });
+		ck_assert_int_eq(22, range.location);
+
+		String *prefix = $(expected, slice, (Range) { 0, 30 });
+		ck_assert($(slice, hasPrefix, prefix));
+
+		String *dog = str("dog");
+		range = $(slice, rangeOfString, dog, (Range) { 0, slice->length });
+		ck_assert_int_eq(-1, range.location);
+
+		String *nested = $(slice, slice, (Range) { 6, 24 });
+		ck_assert_ptr_eq(string->chars + 10, nested->chars);
+		ck_assert_int_eq(3, ((Object *) string)->referenceCount);
+
+		String *o = $(over, slice, (Range) { 0, 1 });
+		Array *components = $(nested, componentsSeparatedByString, o);
+		ck_assert_int_eq(4, components->count);
+
+		String *component = $(components, objectAtIndex, 0);
+		ck_assert_str_eq("br", component->chars);
+
+		component = $(components, objectAtIndex, 3);
+		ck_assert_str_eq("ver the", component->chars);
+
+		String *small = $(string, slice, (Range) { 0, 3 });
+		ck_assert_ptr_eq(small->inlineChars, small->chars);
+		ck_assert_str_eq("the", small->chars);
+
+		String *compact = $(slice, compact);
+		ck_assert(compact != slice);
+		ck_assert_str_eq("quick brown fox jumps over the lazy", compact->chars);
+
+		String *description = $((Object *) nested, description);
+		ck_assert_str_eq("brown fox jumps over the", description->chars);
+
+		MutableString *mutable = $(slice, mutableCopy);
+		ck_assert_str_eq("quick brown fox jumps over the lazy", ((String *) mutable)->chars);
+
+		release(mutable);
+		release(description);
+		release(compact);
+		release(small);
+		release(components);
+		release(o);
+		release(prefix);
+		release(nested);
+		release(dog);
+		release(over);
+		release(expected);
+		release(slice);
+
+		ck_assert_int_eq(1, ((Object *) string)->referenceCount);
+		release(string);
+
+	}END_TEST
+
+START_TEST(encodings)
+	{
+		const char *chars = "h\xc3\xa9llo, w\xc3\xb6rld \xe2\x82\xac \xf0\x9d\x84\x9e";
+		String *string = $$(String, stringWithCharacters, chars);
+
+		const StringEncoding encodings[] = {
+			STRING_ENCODING_UTF16,
+			STRING_ENCODING_UTF32,
+			STRING_ENCODING_UTF8,
+			STRING_ENCODING_WCHAR,
+		};
+
+		for (size_t i = 0; i < sizeof(encodings) / sizeof(encodings[0]); i++) {
+
+			Data *data = $(string, getData, encodings[i]);
+
+			char expected[256];
+
+			iconv_t cd = iconv_open(NameForStringEncoding(encodings[i]), "UTF-8");
+			char *in = (char *) chars, *out = expected;
+			size_t inBytesRemaining = strlen(chars), outBytesRemaining = sizeof(expected);
+			ck_assert(iconv(cd, &in, &inBytesRemaining, &out, &outBytesRemaining) != (size_t) -1);
+			iconv_close(cd);
+
+			ck_assert_int_eq(out - expected, data->length);
+			ck_assert(memcmp(expected, data->bytes, data->length) == 0);
+
+			String *decoded = $$(String, stringWithData, data, encodings[i]);
+			ck_assert_str_eq(chars, decoded->chars);
+
+			release(decoded);
+			release(data);
+		}
+
+		const uint8_t utf16[] = { 0xfe, 0xff, 0x00, 'h', 0x00, 0xe9, 0xd8, 0x34, 0xdd, 0x1e };
+		String *bigEndian = $$(String, stringWithBytes, utf16, sizeof(utf16), STRING_ENCODING_UTF16);
+		ck_assert_str_eq("h\xc3\xa9\xf0\x9d\x84\x9e", bigEndian->chars);
+
+		String *latin1 = $$(String, stringWithBytes, (uint8_t *) "h\xe9llo", 5, STRING_ENCODING_LATIN1);
+		ck_assert_str_eq("h\xc3\xa9llo", latin1->chars);
+
+		Data *data = $(latin1, getData, STRING_ENCODING_LATIN1);
+		ck_assert_int_eq(5, data->length);
+		ck_assert(memcmp("h\xe9llo", data->bytes, 5) == 0);
+		release(data);
+
+		data = $(latin1, getData, STRING_ENCODING_LATIN2);
+		ck_assert_int_eq(5, data->length);
+		ck_assert(memcmp("h\xe9llo", data->bytes, 5) == 0);
+
+		String *latin2 = $$(String, stringWithData, data, STRING_ENCODING_LATIN2);
+		ck_assert($((Object *) latin1, isEqual, (Object *) latin2));
+		release(data);
+
+		data = $(string, getData, STRING_ENCODING_UTF8);
+		ck_assert_int_eq(string->length, data->length);
+		release(data);
+
+		String *invalid = $$(String, stringWithBytes, (uint8_t *) "a\xff" "b", 3, STRING_ENCODING_UTF8);
+		ck_assert_str_eq("", invalid->chars);
+		release(invalid);
+
+		String *unrepresentable = str("\xe6\x97\xa5");
+		data = $(unrepresentable, getData, STRING_ENCODING_LATIN2);
+		ck_assert_int_eq(0, data->length);
+		release(data);
+		release(unrepresentable);
+
+		release(latin2);
+		release(latin1);
+		release(bigEndian);
+		release(string);
+
+	}END_TEST
+
+START_TEST(caseMapping)
+	{
+		String *string = str("The Quick Brown Fox Jumps Over The Lazy Dog 0123456789");
+
+		String *lower = $(string, lowercaseString);
+		ck_assert_str_eq("the quick brown fox jumps over the lazy dog 0123456789", lower->chars);
+
+		String *upper = $(string, uppercaseString);
+		ck_assert_str_eq("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG 0123456789", upper->chars);
+
+		ck_assert($(lower, isEqualCaseInsensitive, upper));
+		ck_assert_int_eq(OrderSame, $(lower, compareToCaseInsensitive, upper, (Range) { 0, lower->length }));
+		ck_assert_int_eq(OrderAscending, $(lower, compareToCaseInsensitive, upper, (Range) { 0, 10 }));
+
+		String *prefix = str("THE quick");
+		ck_assert($(string, hasPrefixCaseInsensitive, prefix));
+		ck_assert(!$(prefix, hasPrefixCaseInsensitive, string));
+
+		String *other = str("the quick brown cat");
+		ck_assert(!$(string, isEqualCaseInsensitive, other));
+		ck_assert_int_eq(OrderDescending, $(string, compareToCaseInsensitive, other, (Range) { 0, string->length }));
+
+		if (setlocale(LC_CTYPE, "C.UTF-8")) {
+
+			String *accents = str("\xc3\x89t\xc3\xa9 \xc9\x90");
+
+			String *upperAccents = $(accents, uppercaseString);
+			ck_assert_str_eq("\xc3\x89T\xc3\x89 \xe2\xb1\xaf", upperAccents->chars);
+
+			String *lowerAccents = $(upperAccents, lowercaseString);
+			ck_assert_str_eq("\xc3\xa9t\xc3\xa9 \xc9\x90", lowerAccents->chars);
+
+			ck_assert($(accents, isEqualCaseInsensitive, upperAccents));
+			ck_assert($(upperAccents, hasPrefixCaseInsensitive, lowerAccents));
+
+			release(lowerAccents);
+			release(upperAccents);
+			release(accents);
+
+			setlocale(LC_CTYPE, "C");
+		}
+
+		release(other);
+		release(prefix);
+		release(upper);
+		release(lower);
+		release(string);
+
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("string");
 	tcase_add_test(tcase, string);
+	tcase_add_test(tcase, inlineStrings);
+	tcase_add_test(tcase, slice);
+	tcase_add_test(tcase, encodings);
+	tcase_add_test(tcase, caseMapping);
 
 	Suite *suite = suite_create("string");
 	suite_add_tcase(suite, tcase);
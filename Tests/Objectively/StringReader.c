@@ -22,6 +22,10 @@
  */
 
 #include <check.h>
+#include <locale.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
 
 #include <Objectively.h>
 
@@ -115,21 +119,226 @@ START_TEST(readToken) {
 } END_TEST
 
 
-int main(int argc, char **argv) {
+START_TEST(readTokenSlice) {
 
-	TCase *tcase;
+	StringReader *reader = $(alloc(StringReader), initWithCharacters, "a token long enough to be a slice, and more");
+	ck_assert(reader != NULL);
 
-	tcase = tcase_create("initWithCharacters");
-	tcase_add_test(tcase, initWithCharacters);
+	const Unicode *charset = L",";
+	Unicode stop;
 
-	tcase = tcase_create("read_english");
-	tcase_add_test(tcase, read_english);
+	String *token = $(reader, readTokenSlice, charset, &stop);
+	ck_assert_ptr_eq(reader->chars, token->chars);
+	ck_assert_int_eq(33, token->length);
+	ck_assert_int_eq(',', stop);
+	release(token);
 
-	tcase = tcase_create("read_japanese");
-	tcase_add_test(tcase, read_japanese);
+	$(reader, reset);
+
+	token = $(reader, readToken, charset, &stop);
+	ck_assert_str_eq("a token long enough to be a slice", token->chars);
+	release(token);
+
+	release(reader);
+} END_TEST
+
+START_TEST(readLine) {
+
+	StringReader *reader = $(alloc(StringReader), initWithCharacters, "first line\r\nsecond line, which is long enough to be a slice\n\nlast");
+	ck_assert(reader != NULL);
+
+	String *line = $(reader, readLine);
+	ck_assert_str_eq("first line", line->chars);
+	release(line);
+
+	line = $(reader, readLineSlice);
+	ck_assert_ptr_eq(reader->chars + 12, line->chars);
+	ck_assert_int_eq(47, line->length);
+	release(line);
+
+	line = $(reader, readLine);
+	ck_assert_int_eq(0, line->length);
+	release(line);
+
+	line = $(reader, readLine);
+	ck_assert_str_eq("last", line->chars);
+	release(line);
+
+	ck_assert($(reader, readLine) == NULL);
+
+	release(reader);
+} END_TEST
+
+START_TEST(readUntilCharacters) {
+
+	StringReader *reader = $(alloc(StringReader), initWithCharacters, "GET / HTTP/1.1\r\nHost: example.com\r\n\r\nbody");
+	ck_assert(reader != NULL);
+
+	String *headers = $(reader, readUntilCharactersSlice, "\r\n\r\n");
+	ck_assert_ptr_eq(reader->chars, headers->chars);
+	ck_assert_int_eq(33, headers->length);
+	ck_assert(strncmp("GET / HTTP/1.1\r\nHost: example.com", headers->chars, headers->length) == 0);
+	release(headers);
+
+	$(reader, reset);
+
+	headers = $(reader, readUntilCharacters, "\r\n\r\n");
+	ck_assert_str_eq("GET / HTTP/1.1\r\nHost: example.com", headers->chars);
+	release(headers);
+
+	String *body = $(reader, readUntilCharacters, "\r\n\r\n");
+	ck_assert_str_eq("body", body->chars);
+	release(body);
+
+	ck_assert($(reader, readUntilCharacters, "\r\n\r\n") == NULL);
+
+	release(reader);
+} END_TEST
+
+START_TEST(readNumbers) {
+
+	StringReader *reader = $(alloc(StringReader), initWithCharacters, " 42 -9223372036854775808 9223372036854775808 3.25 -1e-3 0.1 123456789012345678901 x");
+	ck_assert(reader != NULL);
+
+	int64_t i;
+	ck_assert($(reader, readInteger, &i));
+	ck_assert_int_eq(42, i);
+
+	ck_assert($(reader, readInteger, &i));
+	ck_assert(i == INT64_MIN);
+
+	char *head = reader->head;
+	ck_assert(!$(reader, readInteger, &i));
+	ck_assert_ptr_eq(head, reader->head);
+
+	double d;
+	ck_assert($(reader, readDouble, &d));
+	ck_assert(d == 9223372036854775808.0);
+
+	ck_assert($(reader, readDouble, &d));
+	ck_assert(d == 3.25);
+
+	ck_assert($(reader, readDouble, &d));
+	ck_assert(d == -1e-3);
+
+	ck_assert($(reader, readDouble, &d));
+	ck_assert(d == 0.1);
+
+	ck_assert($(reader, readDouble, &d));
+	ck_assert(d == 123456789012345678901.0);
+
+	ck_assert(!$(reader, readDouble, &d));
+	ck_assert(!$(reader, readInteger, &i));
+	ck_assert_int_eq(' ', $(reader, read));
+	ck_assert_int_eq('x', $(reader, read));
+
+	release(reader);
+} END_TEST
+
+START_TEST(readDoubleLocale) {
+
+	const char *locales[] = { "de_DE.UTF-8", "fr_FR.UTF-8", "de_DE", "fr_FR" };
+	for (size_t i = 0; i < sizeof(locales) / sizeof(locales[0]); i++) {
+		if (setlocale(LC_NUMERIC, locales[i])) {
+			break;
+		}
+	}
+
+	StringReader *reader = $(alloc(StringReader), initWithCharacters, "3.14159265358979323 x");
+
+	double d;
+	ck_assert($(reader, readDouble, &d));
+	ck_assert(d == 3.14159265358979323);
+	ck_assert_int_eq(' ', $(reader, read));
+
+	release(reader);
 
-	tcase = tcase_create("readToken");
+	setlocale(LC_NUMERIC, "C");
+} END_TEST
+
+START_TEST(initWithData) {
+
+	const char *chars = "key = a value long enough to be sliced from the Data\nother = こんにちは\n";
+
+	Data *data = $$(Data, dataWithBytes, (uint8_t *) chars, strlen(chars));
+
+	StringReader *reader = $(alloc(StringReader), initWithData, data);
+	ck_assert(reader != NULL);
+	ck_assert(reader->string == NULL);
+
+	const Unicode *charset = L" =\n";
+	Unicode stop;
+
+	String *token = $(reader, readToken, charset, &stop);
+	ck_assert_str_eq("key", token->chars);
+	ck_assert_int_eq(' ', stop);
+	release(token);
+
+	String *line = $(reader, readLineSlice);
+	ck_assert_ptr_eq((char *) data->bytes + 3, line->chars);
+	ck_assert_int_eq(3, ((Object *) data)->referenceCount);
+	release(line);
+
+	token = $(reader, readToken, L" =\nん", &stop);
+	ck_assert_str_eq("other", token->chars);
+	release(token);
+
+	token = $(reader, readToken, L" =\nん", &stop);
+	ck_assert_str_eq("こ", token->chars);
+	ck_assert_int_eq(L'ん', stop);
+	release(token);
+
+	release(reader);
+
+	const char *path = "/tmp/Objectively_StringReader.test";
+	ck_assert($(data, writeToFile, path));
+
+	reader = $(alloc(StringReader), initWithContentsOfFile, path);
+	ck_assert(reader != NULL);
+
+	line = $(reader, readLine);
+	ck_assert_str_eq("key = a value long enough to be sliced from the Data", line->chars);
+	release(line);
+
+	line = $(reader, readLine);
+	ck_assert_str_eq("other = こんにちは", line->chars);
+	release(line);
+
+	ck_assert($(reader, readLine) == NULL);
+
+	unlink(path);
+
+	release(reader);
+	release(data);
+} END_TEST
+
+START_TEST(invalid) {
+
+	StringReader *reader = $(alloc(StringReader), initWithCharacters, "a\xff\xc3");
+	ck_assert(reader != NULL);
+
+	ck_assert_int_eq('a', $(reader, read));
+	ck_assert_int_eq(0xfffd, $(reader, read));
+	ck_assert_int_eq(0xfffd, $(reader, read));
+	ck_assert_int_eq(-1, $(reader, read));
+
+	release(reader);
+} END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("stringReader");
+	tcase_add_test(tcase, initWithCharacters);
+	tcase_add_test(tcase, read_english);
+	tcase_add_test(tcase, read_japanese);
 	tcase_add_test(tcase, readToken);
+	tcase_add_test(tcase, readTokenSlice);
+	tcase_add_test(tcase, readLine);
+	tcase_add_test(tcase, readUntilCharacters);
+	tcase_add_test(tcase, readNumbers);
+	tcase_add_test(tcase, readDoubleLocale);
+	tcase_add_test(tcase, initWithData);
+	tcase_add_test(tcase, invalid);
 
 	Suite *suite = suite_create("stringReader");
 	suite_add_tcase(suite, tcase);
@@ -0,0 +1,182 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively.h>
+
+/**
+ * @return The offset of the first occurrence of `pattern` in `string` at or after `offset`, or -1.
+ */
+static ssize_t naive(const String *string, size_t offset, const char *pattern, size_t length) {
+
+	for (size_t i = offset; i + length <= string->length; i++) {
+		if (memcmp(string->chars + i, pattern, length) == 0) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+START_TEST(stringSearcher)
+	{
+		String *string = str("the quick brown fox jumps over the lazy dog");
+
+		StringSearcher *searcher = $(alloc(StringSearcher), initWithCharacters, "the");
+		ck_assert(searcher != NULL);
+		ck_assert_ptr_eq(_StringSearcher(), classof(searcher));
+		ck_assert_int_eq(3, searcher->length);
+
+		Range range = $(searcher, rangeInString, string, (Range) { 0, string->length });
+		ck_assert_int_eq(0, range.location);
+		ck_assert_int_eq(3, range.length);
+
+		range = $(searcher, rangeInString, string, (Range) { 1, string->length - 1 });
+		ck_assert_int_eq(31, range.location);
+
+		range = $(searcher, rangeInString, string, (Range) { 1, 32 });
+		ck_assert_int_eq(-1, range.location);
+
+		Range *ranges;
+		const size_t count = $(searcher, rangesInString, string, (Range) { 0, string->length }, &ranges);
+		ck_assert_int_eq(2, count);
+		ck_assert_int_eq(0, ranges[0].location);
+		ck_assert_int_eq(31, ranges[1].location);
+		free(ranges);
+
+		StringSearcher *copy = (StringSearcher *) $((Object *) searcher, copy);
+		ck_assert_str_eq("the", copy->chars);
+
+		release(copy);
+		release(searcher);
+		release(string);
+
+	}END_TEST
+
+START_TEST(randomized)
+	{
+		const size_t lengths[] = { 1, 2, 3, 5, 8, 15, 16, 17, 31, 32, 33, 64 };
+
+		char *chars = malloc(4097);
+		ck_assert(chars != NULL);
+
+		for (size_t i = 0; i < 4096; i++) {
+			chars[i] = "abc"[rand() % 3];
+		}
+		chars[4096] = '\0';
+
+		String *string = $$(String, stringWithCharacters, chars);
+
+		for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+			for (size_t j = 0; j < 32; j++) {
+
+				const size_t length = lengths[i];
+
+				char pattern[65];
+				if (j & 1) {
+					memcpy(pattern, chars + rand() % (4096 - length), length);
+				} else {
+					for (size_t k = 0; k < length; k++) {
+						pattern[k] = "abc"[rand() % 3];
+					}
+				}
+				pattern[length] = '\0';
+
+				StringSearcher *searcher = $(alloc(StringSearcher), initWithCharacters, pattern);
+
+				const size_t offset = rand() % 64;
+				const Range range = $(searcher, rangeInString, string, (Range) { offset, string->length - offset });
+				ck_assert_int_eq(naive(string, offset, pattern, length), range.location);
+
+				Range *ranges;
+				const size_t count = $(searcher, rangesInString, string, (Range) { 0, string->length }, &ranges);
+
+				ssize_t expected = naive(string, 0, pattern, length);
+				for (size_t k = 0; k < count; k++) {
+					ck_assert_int_eq(expected, ranges[k].location);
+					expected = naive(string, ranges[k].location + length, pattern, length);
+				}
+				ck_assert_int_eq(-1, expected);
+
+				free(ranges);
+				release(searcher);
+			}
+		}
+
+		release(string);
+		free(chars);
+
+	}END_TEST
+
+START_TEST(replaceOccurrences)
+	{
+		MutableString *string = $$(MutableString, stringWithCapacity, 0);
+		$(string, appendCharacters, "one fish two fish red fish blue fish");
+
+		$(string, replaceOccurrencesOfCharacters, "fish", "cat");
+		ck_assert_str_eq("one cat two cat red cat blue cat", ((String *) string)->chars);
+
+		$(string, replaceOccurrencesOfCharactersInRange, "cat", (Range) { 0, 15 }, "dog");
+		ck_assert_str_eq("one dog two dog red cat blue cat", ((String *) string)->chars);
+
+		const Range range = { 0, ((String *) string)->length };
+
+		String *dog = str("dog");
+		Range *ranges;
+
+		size_t count = $((String *) string, rangesOfString, dog, range, &ranges);
+		ck_assert_int_eq(2, count);
+		ck_assert_int_eq(12, ranges[1].location);
+		free(ranges);
+
+		count = $((String *) string, rangesOfCharacters, "fish", range, &ranges);
+		ck_assert_int_eq(0, count);
+		ck_assert_ptr_eq(NULL, ranges);
+
+		release(dog);
+		release(string);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("stringSearcher");
+	tcase_add_test(tcase, stringSearcher);
+	tcase_add_test(tcase, randomized);
+	tcase_add_test(tcase, replaceOccurrences);
+
+	Suite *suite = suite_create("stringSearcher");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,224 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively.h>
+
+START_TEST(stringTokenizer)
+	{
+		String *string = str("alpha,beta,,gamma");
+
+		StringTokenizer *tokenizer = $(alloc(StringTokenizer), initWithString, string, ",");
+		ck_assert(tokenizer != NULL);
+		ck_assert_ptr_eq(_StringTokenizer(), classof(tokenizer));
+
+		const char *expected[] = { "alpha", "beta", "", "gamma" };
+
+		for (size_t i = 0; i < 4; i++) {
+			String *token = $(tokenizer, nextToken);
+			ck_assert(token != NULL);
+			ck_assert_int_eq(strlen(expected[i]), token->length);
+			ck_assert(strncmp(expected[i], token->chars, token->length) == 0);
+			release(token);
+		}
+
+		ck_assert($(tokenizer, nextToken) == NULL);
+
+		$(tokenizer, reset);
+		tokenizer->options = STRING_TOKENIZER_SKIP_EMPTY;
+
+		Range range;
+		for (size_t i = 0; i < 4; i++) {
+			if (i == 2) {
+				continue;
+			}
+			ck_assert($(tokenizer, nextRange, &range));
+			ck_assert(strncmp(expected[i], string->chars + range.location, range.length) == 0);
+		}
+
+		ck_assert(!$(tokenizer, nextRange, &range));
+
+		release(tokenizer);
+
+		String *large = str("%s", "the quick brown fox jumps over the lazy dog");
+		tokenizer = $(alloc(StringTokenizer), initWithString, large, " ");
+
+		String *token = $(tokenizer, nextToken);
+		ck_assert_str_eq("the", token->chars);
+		release(token);
+
+		tokenizer->maximumSplits = 3;
+
+		token = $(tokenizer, nextToken);
+		ck_assert_str_eq("quick", token->chars);
+		release(token);
+
+		token = $(tokenizer, nextToken);
+		ck_assert_str_eq("brown", token->chars);
+		release(token);
+
+		token = $(tokenizer, nextTokenSlice);
+		ck_assert_ptr_eq(large->chars + 16, token->chars);
+		ck_assert_int_eq(27, token->length);
+		release(token);
+
+		ck_assert($(tokenizer, nextTokenSlice) == NULL);
+
+		$(tokenizer, reset);
+
+		for (size_t i = 0; i < 3; i++) {
+			token = $(tokenizer, nextToken);
+			release(token);
+		}
+
+		token = $(tokenizer, nextToken);
+		ck_assert_str_eq("fox jumps over the lazy dog", token->chars);
+		release(token);
+
+		release(tokenizer);
+		release(large);
+		release(string);
+
+	}END_TEST
+
+START_TEST(delimiters)
+	{
+		Data *data = $$(Data, dataWithBytes, (uint8_t *) "name=objectively;version=1;;license=zlib", 41);
+
+		StringTokenizer *tokenizer = $(alloc(StringTokenizer), initWithData, data, "=");
+		tokenizer->options = STRING_TOKENIZER_SKIP_EMPTY;
+
+		const char *expected[] = { "name", "objectively", "version", "1", "license", "zlib" };
+
+		for (size_t i = 0; i < 6; i++) {
+
+			$(tokenizer, setDelimiters, i % 2 ? ";" : "=;");
+
+			String *token = $(tokenizer, nextToken);
+			ck_assert_str_eq(expected[i], token->chars);
+			release(token);
+		}
+
+		ck_assert($(tokenizer, nextToken) == NULL);
+
+		$(tokenizer, reset);
+		$(tokenizer, setDelimiters, ";");
+
+		String *slice = $(tokenizer, nextTokenSlice);
+		ck_assert_int_eq(16, slice->length);
+		ck_assert(strncmp("name=objectively", slice->chars, slice->length) == 0);
+		release(slice);
+
+		StringTokenizer *copy = (StringTokenizer *) $((Object *) tokenizer, copy);
+		release(tokenizer);
+
+		$(copy, reset);
+		$(copy, setDelimiters, "");
+
+		Range range;
+		ck_assert($(copy, nextRange, &range));
+		ck_assert_int_eq(41, range.length);
+
+		release(copy);
+		release(data);
+
+	}END_TEST
+
+START_TEST(randomized)
+	{
+		const char *alphabet = "abc,;: \t|#/\\-_";
+		const char *sets[] = { ",", ",;", ",;: \t|", ",;: \t|#/\\-" };
+
+		srand(11);
+
+		for (int i = 0; i < 1000; i++) {
+
+			MutableString *input = $(alloc(MutableString), init);
+
+			const int length = rand() % 200;
+			for (int j = 0; j < length; j++) {
+				const char c[] = { alphabet[rand() % strlen(alphabet)], '\0' };
+				$(input, appendCharacters, c);
+			}
+
+			const char *delimiters = sets[i % 4];
+			const String *string = (String *) input;
+
+			StringTokenizer *tokenizer = $(alloc(StringTokenizer), initWithString, string, delimiters);
+			tokenizer->options = i % 3 ? STRING_TOKENIZER_NONE : STRING_TOKENIZER_SKIP_EMPTY;
+
+			size_t location = 0;
+			Range range;
+
+			while (true) {
+
+				if (tokenizer->options & STRING_TOKENIZER_SKIP_EMPTY) {
+					location += strspn(string->chars + location, delimiters);
+					if (location == string->length) {
+						break;
+					}
+				}
+
+				const size_t end = location + strcspn(string->chars + location, delimiters);
+
+				ck_assert($(tokenizer, nextRange, &range));
+				ck_assert_int_eq(location, range.location);
+				ck_assert_int_eq(end - location, range.length);
+
+				if (end == string->length) {
+					break;
+				}
+
+				location = end + 1;
+			}
+
+			ck_assert(!$(tokenizer, nextRange, &range));
+
+			release(tokenizer);
+			release(input);
+		}
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("stringTokenizer");
+	tcase_add_test(tcase, stringTokenizer);
+	tcase_add_test(tcase, delimiters);
+	tcase_add_test(tcase, randomized);
+
+	Suite *suite = suite_create("stringTokenizer");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_NORMAL);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}